@@ -0,0 +1,125 @@
+// Copyright (c) 2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <benchmark/benchmark.h>
+#include <memory>
+#include <string>
+#include <vector>
+#include "dali/benchmark/operator_bench.h"
+#include "dali/benchmark/dali_bench.h"
+#include "dali/pipeline/util/thread_pool.h"
+
+namespace dali {
+
+namespace {
+
+/**
+ * @brief Returns an expression alternating multiplication and addition of constants,
+ *        with `depth` function nodes, e.g. `add(mul(&0 $0:float32) $1:float32)`.
+ */
+std::string ChainExpression(int depth) {
+  std::string expr = "&0";
+  for (int i = 0; i < depth; i++)
+    expr = make_string(i % 2 ? "add(" : "mul(", expr, " $", i, ":float32)");
+  return expr;
+}
+
+OpSpec ArithmeticSpec(const std::string &expr, std::vector<float> constants, int batch_size,
+                      int num_threads) {
+  return OpSpec("ArithmeticGenericOp")
+      .AddArg("max_batch_size", batch_size)
+      .AddArg("num_threads", num_threads)
+      .AddArg("device", "cpu")
+      .AddArg("expression_desc", expr)
+      .AddArg("real_constants", constants)
+      .AddInput("data", StorageDevice::CPU)
+      .AddOutput("out", StorageDevice::CPU);
+}
+
+}  // namespace
+
+class ArithmeticTreeBench : public OperatorBench {
+ public:
+  /**
+   * @brief Evaluates an expression of the given depth over a batch of float images.
+   *
+   * With `whole_tree`, the expression is evaluated by one operator. Otherwise, every function
+   * node is a separate operator, which is how the expressions used to be evaluated.
+   */
+  void Run(benchmark::State &st, bool whole_tree) {
+    int depth = st.range(0);
+    const int batch_size = 16, num_threads = 4;
+    const int H = 480, W = 640, C = 3;
+
+    auto data = std::make_shared<TensorList<CPUBackend>>(batch_size);
+    data->set_type<float>();
+    data->Resize(uniform_list_shape(batch_size, TensorShape<>{H, W, C}));
+    for (int s = 0; s < batch_size; s++) {
+      auto *ptr = data->mutable_tensor<float>(s);
+      for (int64_t i = 0, n = H * W * C; i < n; i++)
+        ptr[i] = i & 0xff;
+    }
+
+    std::vector<OpSpec> specs;
+    if (whole_tree) {
+      std::vector<float> constants;
+      for (int i = 0; i < depth; i++)
+        constants.push_back(i % 2 ? 0.5f : 1.25f);
+      specs.push_back(ArithmeticSpec(ChainExpression(depth), constants, batch_size, num_threads));
+    } else {
+      for (int i = 0; i < depth; i++)
+        specs.push_back(ArithmeticSpec(i % 2 ? "add(&0 $0:float32)" : "mul(&0 $0:float32)",
+                                       {i % 2 ? 0.5f : 1.25f}, batch_size, num_threads));
+    }
+
+    ThreadPool tp(num_threads, 0, false, "ArithmeticTreeBench");
+    std::vector<std::unique_ptr<OperatorBase>> ops;
+    std::vector<Workspace> workspaces(specs.size());
+    for (size_t i = 0; i < specs.size(); i++) {
+      ops.push_back(InstantiateOperator(specs[i]));
+      auto &ws = workspaces[i];
+      ws.AddInput(i == 0 ? data : workspaces[i - 1].OutputPtr<CPUBackend>(0));
+      ws.SetThreadPool(&tp);
+      Setup<TensorList<CPUBackend>>(ops[i], specs[i], ws, batch_size);
+      ops[i]->Run(ws);
+    }
+
+    for (auto _ : st) {
+      for (size_t i = 0; i < ops.size(); i++)
+        ops[i]->Run(workspaces[i]);
+    }
+    st.counters["FPS"] = benchmark::Counter(batch_size * st.iterations(),
+                                            benchmark::Counter::kIsRate);
+  }
+};
+
+BENCHMARK_DEFINE_F(ArithmeticTreeBench, WholeTree)(benchmark::State &st) {
+  this->Run(st, true);
+}
+
+BENCHMARK_REGISTER_F(ArithmeticTreeBench, WholeTree)
+->Unit(benchmark::kMillisecond)
+->UseRealTime()
+->DenseRange(1, 8, 1);
+
+BENCHMARK_DEFINE_F(ArithmeticTreeBench, NodePerOperator)(benchmark::State &st) {
+  this->Run(st, false);
+}
+
+BENCHMARK_REGISTER_F(ArithmeticTreeBench, NodePerOperator)
+->Unit(benchmark::kMillisecond)
+->UseRealTime()
+->DenseRange(1, 8, 1);
+
+}  // namespace dali
@@ -0,0 +1,88 @@
+// Copyright (c) 2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <benchmark/benchmark.h>
+#include <cmath>
+#include <vector>
+#include "dali/kernels/signal/downmixing.h"
+#include "dali/kernels/signal/resampling_cpu.h"
+
+namespace dali {
+
+using kernels::signal::resampling::ResamplerCPU;
+using kernels::signal::resampling::ResampleCPUImpl;
+using kernels::signal::resampling::resampled_length;
+
+// Args: input rate, output rate, number of channels, downmix, use the polyphase resampler
+static void AudioResampleCPUArgs(benchmark::internal::Benchmark *b) {
+  for (int polyphase : {0, 1}) {
+    b->Args({44100, 16000, 1, 0, polyphase});
+    b->Args({48000, 16000, 1, 0, polyphase});
+    b->Args({22050, 16000, 1, 0, polyphase});
+    b->Args({16000, 44100, 1, 0, polyphase});
+    b->Args({44100, 16000, 2, 0, polyphase});
+    b->Args({44100, 16000, 2, 1, polyphase});
+  }
+}
+
+/**
+ * @brief Resamples 10 seconds of audio; the "realtime" counter is the number of seconds of audio
+ *        processed per second of wall time.
+ */
+static void AudioResampleCPU(benchmark::State &st) {
+  int in_rate = st.range(0);
+  int out_rate = st.range(1);
+  int channels = st.range(2);
+  bool downmix = st.range(3);
+  bool polyphase = st.range(4);
+  const double seconds = 10;
+
+  ResamplerCPU R;
+  R.Initialize(16, 16 * 64 + 1);
+
+  int64_t n_in = seconds * in_rate;
+  int64_t n_out = resampled_length(n_in, in_rate, out_rate);
+  int out_channels = downmix ? 1 : channels;
+  std::vector<float> in(n_in * channels), mono, out(n_out * out_channels);
+  for (int64_t i = 0; i < n_in; i++)
+    for (int c = 0; c < channels; c++)
+      in[i * channels + c] = std::sin(i * (0.01 + 0.003 * c));
+
+  for (auto _ : st) {
+    if (polyphase) {
+      R.Resample(out.data(), 0, n_out, out_rate, in.data(), n_in, in_rate, channels, downmix);
+    } else {
+      // the generic resampler; downmixing goes through an intermediate buffer
+      const float *src = in.data();
+      if (downmix) {
+        mono.resize(n_in);
+        kernels::signal::Downmix(mono.data(), in.data(), n_in, channels);
+        src = mono.data();
+      }
+      ResampleCPUImpl(R.window, out.data(), 0, n_out, out_rate, src, n_in, in_rate,
+                      out_channels);
+    }
+    benchmark::DoNotOptimize(out.data());
+  }
+
+  st.counters["realtime"] = benchmark::Counter(seconds * st.iterations(),
+                                               benchmark::Counter::kIsRate);
+}
+
+BENCHMARK(AudioResampleCPU)
+->Unit(benchmark::kMillisecond)
+->UseRealTime()
+->Apply(AudioResampleCPUArgs);
+
+}  // namespace dali
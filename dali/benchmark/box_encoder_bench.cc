@@ -0,0 +1,145 @@
+// Copyright (c) 2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <benchmark/benchmark.h>
+#include <algorithm>
+#include <cmath>
+#include <memory>
+#include <vector>
+#include "dali/benchmark/operator_bench.h"
+#include "dali/benchmark/dali_bench.h"
+
+namespace dali {
+
+enum class AnchorGrid {
+  SSD300,     // 8732 anchors
+  SSD512,     // 24564 anchors
+  RetinaNet,  // 640x640 input, P3-P7, 9 anchors per location: 76725 anchors
+};
+
+/**
+ * @brief Generates `ltrb` anchors for a set of feature maps, with `num_anchors[i]` boxes
+ *        of different scales and aspect ratios centered at each cell of i-th feature map.
+ */
+static std::vector<float> MakeAnchors(const std::vector<int> &fmap_sizes,
+                                      const std::vector<int> &num_anchors) {
+  std::vector<float> anchors;
+  const float aspect_ratios[] = {1.0f, 2.0f, 0.5f, 3.0f, 1.0f / 3};
+  for (size_t level = 0; level < fmap_sizes.size(); level++) {
+    int fsize = fmap_sizes[level];
+    float scale = 0.1f + 0.8f * level / std::max<size_t>(fmap_sizes.size() - 1, 1);
+    for (int y = 0; y < fsize; y++) {
+      for (int x = 0; x < fsize; x++) {
+        float cx = (x + 0.5f) / fsize, cy = (y + 0.5f) / fsize;
+        for (int a = 0; a < num_anchors[level]; a++) {
+          float ar = std::sqrt(aspect_ratios[a % 5]);
+          float s = scale * (1 + a / 5);
+          float w = s * ar, h = s / ar;
+          anchors.push_back(std::max(cx - w / 2, 0.0f));
+          anchors.push_back(std::max(cy - h / 2, 0.0f));
+          anchors.push_back(std::min(cx + w / 2, 1.0f));
+          anchors.push_back(std::min(cy + h / 2, 1.0f));
+        }
+      }
+    }
+  }
+  return anchors;
+}
+
+static std::vector<float> MakeAnchors(AnchorGrid grid) {
+  switch (grid) {
+    case AnchorGrid::SSD300:
+      return MakeAnchors({38, 19, 10, 5, 3, 1}, {4, 6, 6, 6, 4, 4});
+    case AnchorGrid::SSD512:
+      return MakeAnchors({64, 32, 16, 8, 4, 2, 1}, {4, 6, 6, 6, 6, 4, 4});
+    case AnchorGrid::RetinaNet:
+    default:
+      return MakeAnchors({80, 40, 20, 10, 5}, {9, 9, 9, 9, 9});
+  }
+}
+
+static void BoxEncoderCPUArgs(benchmark::internal::Benchmark *b) {
+  for (auto grid : {AnchorGrid::SSD300, AnchorGrid::SSD512, AnchorGrid::RetinaNet}) {
+    for (int batch_size : {1, 32, 256}) {
+      for (int num_threads : {1, 4}) {
+        int num_boxes = 20;
+        b->Args({static_cast<int>(grid), batch_size, num_boxes, num_threads});
+      }
+    }
+  }
+}
+
+BENCHMARK_DEFINE_F(OperatorBench, BoxEncoderCPU)(benchmark::State& st) {
+  auto grid = static_cast<AnchorGrid>(st.range(0));
+  int batch_size = st.range(1);
+  int num_boxes = st.range(2);
+  int num_threads = st.range(3);
+
+  auto anchors = MakeAnchors(grid);
+  auto op_spec = OpSpec("BoxEncoder")
+                     .AddArg("max_batch_size", batch_size)
+                     .AddArg("num_threads", num_threads)
+                     .AddArg("device", "cpu")
+                     .AddArg("criteria", 0.5f)
+                     .AddArg("anchors", anchors)
+                     .AddArg("offset", true)
+                     .AddArg("scale", 300.0f)
+                     .AddArg("stds", std::vector<float>({0.1f, 0.1f, 0.2f, 0.2f}))
+                     .AddInput("bboxes", StorageDevice::CPU)
+                     .AddInput("labels", StorageDevice::CPU)
+                     .AddOutput("encoded_bboxes", StorageDevice::CPU)
+                     .AddOutput("encoded_labels", StorageDevice::CPU);
+  auto op_ptr = InstantiateOperator(op_spec);
+
+  auto boxes = std::make_shared<TensorList<CPUBackend>>(batch_size);
+  auto labels = std::make_shared<TensorList<CPUBackend>>(batch_size);
+  boxes->Resize(uniform_list_shape(batch_size, {num_boxes, 4}), DALI_FLOAT);
+  labels->Resize(uniform_list_shape(batch_size, {num_boxes}), DALI_INT32);
+  for (int sample_idx = 0; sample_idx < batch_size; sample_idx++) {
+    auto *box_data = boxes->mutable_tensor<float>(sample_idx);
+    auto *label_data = labels->mutable_tensor<int>(sample_idx);
+    for (int i = 0; i < num_boxes; i++) {
+      float l = RandReal<float>(0, 1) * 0.8f, t = RandReal<float>(0, 1) * 0.8f;
+      float w = 0.01f + RandReal<float>(0, 1) * (0.99f - l);
+      float h = 0.01f + RandReal<float>(0, 1) * (0.99f - t);
+      box_data[4 * i + 0] = l;
+      box_data[4 * i + 1] = t;
+      box_data[4 * i + 2] = l + w;
+      box_data[4 * i + 3] = t + h;
+      label_data[i] = RandInt(1, 80);
+    }
+  }
+
+  Workspace ws;
+  ws.AddInput(boxes);
+  ws.AddInput(labels);
+  ThreadPool tp(num_threads, 0, false, "BoxEncoderBench");
+  ws.SetThreadPool(&tp);
+
+  Setup<TensorList<CPUBackend>>(op_ptr, op_spec, ws, batch_size);
+  op_ptr->Run(ws);
+  for (auto _ : st) {
+    op_ptr->Run(ws);
+  }
+  st.counters["anchors"] = anchors.size() / 4;
+  st.counters["FPS"] = benchmark::Counter(batch_size * st.iterations(),
+                                          benchmark::Counter::kIsRate);
+}
+
+BENCHMARK_REGISTER_F(OperatorBench, BoxEncoderCPU)->Iterations(50)
+->Unit(benchmark::kMicrosecond)
+->UseRealTime()
+->Apply(BoxEncoderCPUArgs);
+
+}  // namespace dali
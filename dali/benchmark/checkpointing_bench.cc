@@ -21,17 +21,25 @@
 
 namespace dali {
 
-enum class CheckpointingPolicy {Disabled, Enabled, SaveEveryIter, SerializeEveryIter};
+enum class CheckpointingPolicy {
+  Disabled, Enabled, SaveEveryIter, SerializeEveryIter, SerializeIncrementalEveryIter
+};
 
 class CheckpointingOverhead : public DALIBenchmark {
  public:
   void run(benchmark::State& st,
            const OpSpec &op_spec,
            const vector<std::pair<string, string>> &outputs) {
+    run(st, vector<OpSpec>{op_spec}, outputs);
+  }
+
+  void run(benchmark::State& st,
+           const vector<OpSpec> &op_specs,
+           const vector<std::pair<string, string>> &outputs) {
     auto policy = static_cast<CheckpointingPolicy>(st.range(0));
     bool checkpointing = (policy != CheckpointingPolicy::Disabled);
 
-    auto pipe = createPipeline(op_spec);
+    auto pipe = createPipeline(op_specs);
     if (checkpointing) {
       pipe->EnableCheckpointing();
     }
@@ -43,15 +51,23 @@ class CheckpointingOverhead : public DALIBenchmark {
     pipe->Run();
     pipe->Outputs(&ws);
 
+    size_t checkpoint_bytes = 0;
+    int iters = 0;
     while (st.KeepRunning()) {
       pipe->Run();
       pipe->Outputs(&ws);
       if (policy == CheckpointingPolicy::SaveEveryIter) {
         volatile auto cpt = pipe->GetCheckpoint();
-      } else if (policy == CheckpointingPolicy::SerializeEveryIter) {
-        volatile auto cpt = pipe->GetSerializedCheckpoint({});
+      } else if (policy == CheckpointingPolicy::SerializeEveryIter ||
+                 policy == CheckpointingPolicy::SerializeIncrementalEveryIter) {
+        bool incremental = policy == CheckpointingPolicy::SerializeIncrementalEveryIter;
+        auto cpt = pipe->GetSerializedCheckpoint({}, incremental);
+        checkpoint_bytes += cpt.size();
       }
+      iters++;
     }
+    if (iters > 0)
+      st.counters["checkpoint_bytes"] = checkpoint_bytes / iters;
 
     if (policy == CheckpointingPolicy::Disabled) {
       st.SetLabel("disabled");
@@ -61,11 +77,13 @@ class CheckpointingOverhead : public DALIBenchmark {
       st.SetLabel("save");
     } else if (policy == CheckpointingPolicy::SerializeEveryIter) {
       st.SetLabel("serialize");
+    } else if (policy == CheckpointingPolicy::SerializeIncrementalEveryIter) {
+      st.SetLabel("serialize_incremental");
     }
   }
 
  protected:
-  std::unique_ptr<Pipeline> createPipeline(const OpSpec &op_spec) {
+  std::unique_ptr<Pipeline> createPipeline(const vector<OpSpec> &op_specs) {
     const int batch_size = 256;
     const int num_thread = 4;
     const bool pipelined = true;
@@ -74,7 +92,8 @@ class CheckpointingOverhead : public DALIBenchmark {
 
     auto pipe = std::make_unique<Pipeline>(batch_size, num_thread, 0, -1, pipelined,
                                            prefetch_queue_depth, async);
-    pipe->AddOperator(op_spec);
+    for (auto &op_spec : op_specs)
+      pipe->AddOperator(op_spec);
     return pipe;
   }
 };
@@ -85,6 +104,7 @@ static void Args(benchmark::internal::Benchmark *b) {
     CheckpointingPolicy::Enabled,
     CheckpointingPolicy::SaveEveryIter,
     CheckpointingPolicy::SerializeEveryIter,
+    CheckpointingPolicy::SerializeIncrementalEveryIter,
   };
   for (auto p : policies) {
     b->Args({static_cast<int>(p)});
@@ -129,6 +149,56 @@ BENCHMARK_REGISTER_F(CheckpointingOverhead, RandomCpu)->Iterations(100)
 ->Unit(benchmark::kMillisecond)
 ->Apply(Args);
 
+BENCHMARK_DEFINE_F(CheckpointingOverhead, RandomCpuScalar)(benchmark::State& st) {
+  // a typical random augmentation parameter - a few draws per sample and iteration,
+  // so the random engines are stored as the number of draws
+  auto op = OpSpec("random__Uniform")
+        .AddArg("device", "cpu")
+        .AddArg("range", std::vector<float>{-30, 30})
+        .AddOutput("output", StorageDevice::CPU);
+  this->run(st, op, {{"output", "cpu"}});
+}
+
+BENCHMARK_REGISTER_F(CheckpointingOverhead, RandomCpuScalar)->Iterations(100)
+->Unit(benchmark::kMillisecond)
+->Apply(Args);
+
+BENCHMARK_DEFINE_F(CheckpointingOverhead, MixedStatefulness)(benchmark::State& st) {
+  // only some of the operators change their state in every iteration,
+  // which is what the incremental checkpoints take advantage of
+  vector<OpSpec> ops;
+  vector<std::pair<string, string>> outputs;
+  for (int i = 0; i < 8; i++) {
+    auto name = make_string("random_", i);
+    ops.push_back(OpSpec("CoinFlip")
+        .AddArg("device", "cpu")
+        .AddArg("probability", 0.5f)
+        .AddOutput(name, StorageDevice::CPU));
+    outputs.push_back({name, "cpu"});
+  }
+  for (int i = 0; i < 8; i++) {
+    auto name = make_string("constant_", i);
+    ops.push_back(OpSpec("Constant")
+        .AddArg("device", "cpu")
+        .AddArg("idata", std::vector<int>(1, i))
+        .AddOutput(name, StorageDevice::CPU));
+    outputs.push_back({name, "cpu"});
+  }
+  ops.push_back(OpSpec("FileReader")
+        .AddArg("device", "cpu")
+        .AddArg("files", jpeg_names_)
+        .AddArg("initial_fill", 1024)
+        .AddArg("random_shuffle", true)
+        .AddOutput("encoded", StorageDevice::CPU)
+        .AddOutput("labels", StorageDevice::CPU));
+  outputs.push_back({"labels", "cpu"});
+  this->run(st, ops, outputs);
+}
+
+BENCHMARK_REGISTER_F(CheckpointingOverhead, MixedStatefulness)->Iterations(100)
+->Unit(benchmark::kMillisecond)
+->Apply(Args);
+
 BENCHMARK_DEFINE_F(CheckpointingOverhead, RandomGpu)(benchmark::State& st) {
   auto op = OpSpec("CoinFlip")
         .AddArg("device", "gpu")
@@ -156,4 +226,37 @@ BENCHMARK_REGISTER_F(CheckpointingOverhead, Reader)->Iterations(100)
 ->Unit(benchmark::kMillisecond)
 ->Apply(Args);
 
+class CheckpointRestore : public CheckpointingOverhead {};
+
+BENCHMARK_DEFINE_F(CheckpointRestore, RandomCpu)(benchmark::State& st) {
+  // the number of values drawn from every engine between the checkpoints
+  const int draws_per_sample = st.range(0);
+  auto op = OpSpec("random__Uniform")
+        .AddArg("device", "cpu")
+        .AddArg("shape", std::vector<int>{draws_per_sample})
+        .AddOutput("output", StorageDevice::CPU);
+
+  auto pipe = createPipeline({op});
+  pipe->EnableCheckpointing();
+  pipe->Build({{"output", "cpu"}});
+  Workspace ws;
+  for (int i = 0; i < 5; i++) {
+    pipe->Run();
+    pipe->Outputs(&ws);
+  }
+  auto serialized = pipe->GetSerializedCheckpoint({});
+
+  auto restored = createPipeline({op});
+  restored->EnableCheckpointing();
+  restored->Build({{"output", "cpu"}});
+  while (st.KeepRunning()) {
+    restored->RestoreFromSerializedCheckpoint(serialized);
+  }
+  st.counters["checkpoint_bytes"] = serialized.size();
+}
+
+BENCHMARK_REGISTER_F(CheckpointRestore, RandomCpu)->Iterations(20)
+->Unit(benchmark::kMillisecond)
+->Args({1})->Args({1000})->Args({100000});
+
 }  // namespace dali
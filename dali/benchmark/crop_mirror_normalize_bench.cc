@@ -1,4 +1,4 @@
-// Copyright (c) 2019, NVIDIA CORPORATION. All rights reserved.
+// Copyright (c) 2019-2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
 //
 // Licensed under the Apache License, Version 2.0 (the "License");
 // you may not use this file except in compliance with the License.
@@ -15,23 +15,26 @@
 #include <benchmark/benchmark.h>
 #include "dali/benchmark/operator_bench.h"
 #include "dali/benchmark/dali_bench.h"
+#include "dali/kernels/common/cpu_dispatch.h"
 
 namespace dali {
 
 static void CropMirrorNormalizeCPUArgs(benchmark::internal::Benchmark *b) {
   int batch_size = 8;
   int mean = 128, std = 1;
-  for (auto &dtype : {DALI_FLOAT}) {
+  for (auto &dtype : {DALI_FLOAT, DALI_FLOAT16}) {
     for (auto nchw : {0, 1}) {
       for (int mirror : {0, 1}) {
         for (int pad : {0, 1}) {
           for (int H = 1000; H >= 500; H /= 2) {
-            int W = H, C = 3;
-            int crop_h = static_cast<float>(9 * H / 10);
-            int crop_w = static_cast<float>(9 * W / 10);
-            b->Args({dtype, nchw, mirror, pad,
-                     batch_size, H, W, C, crop_h, crop_w,
-                     mean, std});
+            for (auto isa : kernels::simd::SupportedCpuIsas()) {
+              int W = H, C = 3;
+              int crop_h = static_cast<float>(9 * H / 10);
+              int crop_w = static_cast<float>(9 * W / 10);
+              b->Args({dtype, nchw, mirror, pad,
+                       batch_size, H, W, C, crop_h, crop_w,
+                       mean, std, static_cast<int>(isa)});
+            }
           }
         }
       }
@@ -52,6 +55,9 @@ BENCHMARK_DEFINE_F(OperatorBench, CropMirrorNormalizeCPU)(benchmark::State& st)
   int crop_w = st.range(9);
   float mean = static_cast<float>(st.range(10));
   float std = static_cast<float>(st.range(11));
+  auto isa = static_cast<kernels::simd::CpuIsa>(st.range(12));
+  kernels::simd::ScopedCpuIsa scoped_isa(isa);
+  st.SetLabel(kernels::simd::CpuIsaName(isa));
 
   this->RunCPU<uint8_t>(
     st,
@@ -67,7 +73,8 @@ BENCHMARK_DEFINE_F(OperatorBench, CropMirrorNormalizeCPU)(benchmark::State& st)
       .AddArg("crop_pos_y", 0.5f)
       .AddArg("mean", std::vector<float>(C, mean))
       .AddArg("std", std::vector<float>(C, std))
-      .AddArg("mirror", mirror),
+      .AddArg("mirror", mirror)
+      .AddArg("pad_output", pad != 0),
     batch_size, H, W, C);
 }
 
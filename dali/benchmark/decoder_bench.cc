@@ -112,6 +112,26 @@ BENCHMARK_REGISTER_F(DecoderBench, ImageDecoder_CPU)->Iterations(100)
 ->UseRealTime()
 ->Apply(PipeArgs);
 
+BENCHMARK_DEFINE_F(DecoderBench, ImageDecoderSizeHint_CPU)(benchmark::State& st) {
+  int batch_size = st.range(0);
+  int num_thread = st.range(1);
+  DALIImageType img_type = DALI_RGB;
+
+  this->DecoderPipelineTest(
+    st, batch_size, num_thread, "cpu",
+    OpSpec("ImageDecoder")
+      .AddArg("device", "cpu")
+      .AddArg("output_type", img_type)
+      .AddArg("decode_size_hint", std::vector<int>{64, 64})
+      .AddInput("raw_jpegs", StorageDevice::CPU)
+      .AddOutput("images", StorageDevice::CPU));
+}
+
+BENCHMARK_REGISTER_F(DecoderBench, ImageDecoderSizeHint_CPU)->Iterations(100)
+->Unit(benchmark::kMillisecond)
+->UseRealTime()
+->Apply(PipeArgs);
+
 BENCHMARK_DEFINE_F(DecoderBench, ImageDecoder_GPU)(benchmark::State& st) {
   int batch_size = st.range(0);
   int num_thread = st.range(1);
@@ -220,6 +240,26 @@ BENCHMARK_REGISTER_F(DecoderBench, ImageDecoderRandomCrop_CPU)->Iterations(100)
 ->UseRealTime()
 ->Apply(PipeArgs);
 
+BENCHMARK_DEFINE_F(DecoderBench, ImageDecoderRandomCropSizeHint_CPU)(benchmark::State& st) {
+  int batch_size = st.range(0);
+  int num_thread = st.range(1);
+  DALIImageType img_type = DALI_RGB;
+
+  this->DecoderPipelineTest(
+    st, batch_size, num_thread, "cpu",
+    OpSpec("ImageDecoderRandomCrop")
+      .AddArg("device", "cpu")
+      .AddArg("output_type", img_type)
+      .AddArg("decode_size_hint", std::vector<int>{64, 64})
+      .AddInput("raw_jpegs", StorageDevice::CPU)
+      .AddOutput("images", StorageDevice::CPU));
+}
+
+BENCHMARK_REGISTER_F(DecoderBench, ImageDecoderRandomCropSizeHint_CPU)->Iterations(100)
+->Unit(benchmark::kMillisecond)
+->UseRealTime()
+->Apply(PipeArgs);
+
 BENCHMARK_DEFINE_F(DecoderBench, ImageDecoderCrop_CPU)(benchmark::State& st) {
   int batch_size = st.range(0);
   int num_thread = st.range(1);
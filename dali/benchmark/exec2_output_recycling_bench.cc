@@ -0,0 +1,186 @@
+// Copyright (c) 2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <benchmark/benchmark.h>
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <cstring>
+#include <memory>
+#include <random>
+#include <utility>
+#include <vector>
+#include "dali/core/mm/default_resources.h"
+#include "dali/pipeline/executor/executor2/exec2.h"
+#include "dali/pipeline/graph/op_graph2.h"
+#include "dali/pipeline/operator/operator.h"
+
+namespace dali {
+
+namespace {
+
+/** Produces 1D uint8 samples with Pareto-distributed sizes, i.e. a few very large ones. */
+class HeavyTailedSourceCPU : public Operator<CPUBackend> {
+ public:
+  explicit HeavyTailedSourceCPU(const OpSpec &spec) : Operator<CPUBackend>(spec) {}
+
+  bool SetupImpl(std::vector<OutputDesc> &outs, const Workspace &ws) override {
+    constexpr double kAlpha = 1.2, kMinBytes = 16 << 10, kMaxBytes = 16 << 20;
+    int N = ws.GetRequestedBatchSize(0);
+    std::uniform_real_distribution<double> dist(0, 1);
+    outs.resize(1);
+    outs[0].type = DALI_UINT8;
+    outs[0].shape.resize(N, 1);
+    for (int i = 0; i < N; i++) {
+      double size = kMinBytes / std::pow(1 - dist(rng_), 1 / kAlpha);
+      outs[0].shape.set_tensor_shape(i, {static_cast<int64_t>(std::min(size, kMaxBytes))});
+    }
+    return true;
+  }
+
+  void RunImpl(Workspace &ws) override {
+    auto &out = ws.Output<CPUBackend>(0);
+    for (int i = 0; i < out.num_samples(); i++)
+      memset(out.mutable_tensor<uint8_t>(i), i, out.tensor_shape_span(i)[0]);
+  }
+
+ private:
+  std::mt19937_64 rng_{1234};
+};
+
+DALI_SCHEMA(HeavyTailedSourceBench)
+  .DocStr("Benchmark-only source of samples with heavy-tailed sizes.")
+  .NumInput(0)
+  .NumOutput(1);
+
+DALI_REGISTER_OPERATOR(HeavyTailedSourceBench, HeavyTailedSourceCPU, CPU);
+
+/** Counts the allocations and the resident memory of the upstream host resource. */
+class CountingHostResource : public mm::host_memory_resource {
+ public:
+  explicit CountingHostResource(std::shared_ptr<mm::host_memory_resource> upstream)
+  : upstream_(std::move(upstream)) {}
+
+  void ResetCounters() {
+    allocations_ = 0;
+    peak_ = live_.load();
+  }
+
+  int64_t allocations() const { return allocations_; }
+  size_t peak_bytes() const { return peak_; }
+
+ private:
+  void *do_allocate(size_t bytes, size_t alignment) override {
+    void *ptr = upstream_->allocate(bytes, alignment);
+    allocations_++;
+    size_t live = live_ += bytes;
+    size_t peak = peak_;
+    while (live > peak && !peak_.compare_exchange_weak(peak, live)) {}
+    return ptr;
+  }
+
+  void do_deallocate(void *ptr, size_t bytes, size_t alignment) override {
+    live_ -= bytes;
+    upstream_->deallocate(ptr, bytes, alignment);
+  }
+
+  bool do_is_equal(const mm::host_memory_resource &other) const noexcept override {
+    return this == &other;
+  }
+
+  std::shared_ptr<mm::host_memory_resource> upstream_;
+  std::atomic<int64_t> allocations_{0};
+  std::atomic<size_t> live_{0}, peak_{0};
+};
+
+OpSpec CommonArgs(OpSpec spec, int batch_size) {
+  return spec.AddArg("max_batch_size", batch_size)
+             .AddArg("num_threads", 1)
+             .AddArg("device", "cpu");
+}
+
+}  // namespace
+
+/**
+ * @brief Runs a CPU-only graph with variable-size outputs in the dynamic executor and reports
+ *        the steady-state number of host allocations per iteration and the peak resident memory.
+ */
+static void Exec2OutputRecycling(benchmark::State &st) {
+  bool recycle = st.range(0);
+  const int batch_size = 32, queue_depth = 2;
+
+  graph::OpGraph::Builder b;
+  b.Add("src", CommonArgs(OpSpec("HeavyTailedSourceBench"), batch_size)
+                  .AddOutput("src_out", StorageDevice::CPU));
+  b.Add("cast", CommonArgs(OpSpec("Cast"), batch_size)
+                  .AddArg("dtype", DALI_FLOAT)
+                  .AddInput("src_out", StorageDevice::CPU)
+                  .AddOutput("cast_out", StorageDevice::CPU));
+  b.AddOutput("cast_out_cpu");
+  auto graph = std::move(b).GetGraph(true);
+
+  auto upstream = mm::ShareDefaultResource<mm::memory_kind::host>();
+  auto counting = std::make_shared<CountingHostResource>(upstream);
+  mm::SetDefaultResource<mm::memory_kind::host>(counting);
+
+  {
+    exec2::Executor2::Config cfg;
+    cfg.max_batch_size = batch_size;
+    cfg.operator_threads = 2;
+    cfg.thread_pool_threads = 4;
+    cfg.cpu_queue_depth = queue_depth;
+    cfg.recycle_cpu_outputs = recycle;
+    exec2::Executor2 exec(cfg);
+    exec.Build(graph);
+
+    Workspace ws;
+    auto next = [&]() {
+      ws.Clear();
+      exec.Outputs(&ws);
+      exec.Run();
+    };
+
+    for (int i = 0; i < queue_depth; i++)
+      exec.Run();
+    for (int i = 0; i < 10; i++)  // warm-up
+      next();
+    counting->ResetCounters();
+
+    for (auto _ : st)
+      next();
+
+    st.counters["allocs/iter"] = benchmark::Counter(
+        static_cast<double>(counting->allocations()) / st.iterations());
+    st.counters["peak_MB"] = benchmark::Counter(counting->peak_bytes() / 1048576.0);
+    st.counters["FPS"] = benchmark::Counter(batch_size * st.iterations(),
+                                            benchmark::Counter::kIsRate);
+
+    for (int i = 0; i < queue_depth; i++) {
+      ws.Clear();
+      exec.Outputs(&ws);
+    }
+    ws.Clear();
+  }
+
+  mm::SetDefaultResource<mm::memory_kind::host>(upstream);
+}
+
+BENCHMARK(Exec2OutputRecycling)
+->Unit(benchmark::kMillisecond)
+->UseRealTime()
+->Iterations(200)
+->Arg(0)
+->Arg(1);
+
+}  // namespace dali
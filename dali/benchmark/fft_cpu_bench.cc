@@ -0,0 +1,75 @@
+// Copyright (c) 2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <benchmark/benchmark.h>
+#include <cmath>
+#include <vector>
+#include "dali/kernels/dynamic_scratchpad.h"
+#include "dali/kernels/signal/fft/batched_real_fft_cpu.h"
+#include "dali/kernels/signal/fft/fft_cpu.h"
+
+namespace dali {
+
+// Args: nfft, batched (BatchedRealFftCpu) or per-window (ffts) execution
+static void FftCPUArgs(benchmark::internal::Benchmark *b) {
+  for (int batched : {0, 1})
+    for (int nfft : {128, 256, 512, 1024, 2048})
+      b->Args({nfft, batched});
+}
+
+/**
+ * @brief Power spectrum of 1000 windows stored in the frequency-major layout, as produced by
+ *        the Spectrogram operator; the "windows" counter is the number of transforms per second.
+ */
+static void FftCPU(benchmark::State &st) {
+  int nfft = st.range(0);
+  bool batched = st.range(1);
+  const int64_t nwindows = 1000;
+  int nbins = nfft / 2 + 1;
+
+  std::vector<float> in(nfft * nwindows);
+  for (size_t i = 0; i < in.size(); i++)
+    in[i] = std::sin(i * 0.05f) + 0.3f * std::sin(i * 0.71f);
+  std::vector<float> out(nbins * nwindows);
+  auto in_view = make_tensor_cpu<2, const float>(in.data(), {nfft, nwindows});
+  auto out_view = make_tensor_cpu<2>(out.data(), {nbins, nwindows});
+
+  kernels::signal::fft::FftArgs args;
+  args.nfft = nfft;
+  args.transform_axis = 0;
+  args.spectrum_type = kernels::signal::fft::FFT_SPECTRUM_POWER;
+  kernels::signal::fft::Fft1DCpu<float, float, 2> kernel;
+
+  bool was_batched = kernels::signal::fft::BatchedRealFftEnabled();
+  kernels::signal::fft::SetBatchedRealFftEnabled(batched);
+  for (auto _ : st) {
+    kernels::KernelContext ctx;
+    kernels::DynamicScratchpad scratchpad(AccessOrder::host());
+    ctx.scratchpad = &scratchpad;
+    kernel.Setup(ctx, in_view, args);
+    kernel.Run(ctx, out_view, in_view, args);
+    benchmark::DoNotOptimize(out.data());
+  }
+  kernels::signal::fft::SetBatchedRealFftEnabled(was_batched);
+
+  st.counters["windows"] = benchmark::Counter(nwindows * st.iterations(),
+                                              benchmark::Counter::kIsRate);
+}
+
+BENCHMARK(FftCPU)
+->Unit(benchmark::kMicrosecond)
+->UseRealTime()
+->Apply(FftCPUArgs);
+
+}  // namespace dali
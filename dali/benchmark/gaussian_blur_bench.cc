@@ -51,4 +51,35 @@ BENCHMARK_REGISTER_F(OperatorBench, GaussianBlurGPU)->Iterations(1000)
 ->UseRealTime()
 ->Apply(GaussianBlurGPUArgs);
 
+static void GaussianBlurCPUArgs(benchmark::internal::Benchmark *b) {
+  int num_threads = 4;
+  for (int window_size : {3, 15, 51, 101}) {
+    // a single large image is split into tiles processed by all threads
+    b->Args({1, 2000, window_size, num_threads});
+    b->Args({16, 500, window_size, num_threads});
+  }
+}
+
+BENCHMARK_DEFINE_F(OperatorBench, GaussianBlurCPU)(benchmark::State& st) {
+  int batch_size = st.range(0);
+  int H = st.range(1);
+  int W = H, C = 3;
+  int window_size = st.range(2);
+  int num_threads = st.range(3);
+
+  this->RunCPU<uint8_t>(
+    st,
+    OpSpec("GaussianBlur")
+      .AddArg("max_batch_size", batch_size)
+      .AddArg("num_threads", num_threads)
+      .AddArg("device", "cpu")
+      .AddArg("window_size", window_size),
+    batch_size, H, W, C, false, num_threads);
+}
+
+BENCHMARK_REGISTER_F(OperatorBench, GaussianBlurCPU)->Iterations(20)
+->Unit(benchmark::kMillisecond)
+->UseRealTime()
+->Apply(GaussianBlurCPUArgs);
+
 }  // namespace dali
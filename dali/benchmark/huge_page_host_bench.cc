@@ -0,0 +1,138 @@
+// Copyright (c) 2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <benchmark/benchmark.h>
+#include <cstring>
+#include <memory>
+#include <vector>
+#include "dali/core/mm/default_resources.h"
+#include "dali/core/mm/memory.h"
+#include "dali/core/tensor_view.h"
+#include "dali/kernels/transpose/transpose.h"
+
+namespace dali {
+
+namespace {
+
+enum class HostPages {
+  Regular = 0,
+  Transparent = 1,
+  Explicit2M = 2,
+};
+
+const char *Label(HostPages pages) {
+  switch (pages) {
+    case HostPages::Transparent:
+      return "transparent huge pages";
+    case HostPages::Explicit2M:
+      return "2M huge pages";
+    default:
+      return "regular pages";
+  }
+}
+
+/**
+ * Replaces the default host resource for the lifetime of the object.
+ */
+class ScopedHostPages {
+ public:
+  explicit ScopedHostPages(HostPages pages)
+  : prev_(mm::ShareDefaultResource<mm::memory_kind::host>()) {
+    if (pages == HostPages::Transparent)
+      mm::UseHugePageHostMemory(0);
+    else if (pages == HostPages::Explicit2M)
+      mm::UseHugePageHostMemory(2 << 20);
+  }
+
+  ~ScopedHostPages() {
+    mm::SetDefaultResource<mm::memory_kind::host>(prev_);
+  }
+
+ private:
+  std::shared_ptr<mm::host_memory_resource> prev_;
+};
+
+// A 256 MiB volume - larger than the malloc pool threshold, so with regular pages each buffer
+// is mapped anew and faulted in on first touch.
+const TensorShape<> kVolumeShape = { 256, 512, 512 };
+
+}  // namespace
+
+/**
+ * @brief Allocates a large output buffer for every iteration (as a pipeline does for every batch)
+ *        and copies a volume to it.
+ */
+static void HugePageHostCopy(benchmark::State &st) {
+  auto pages = static_cast<HostPages>(st.range(0));
+  ScopedHostPages scoped_pages(pages);
+  size_t n = volume(kVolumeShape);
+  auto src = mm::alloc_raw_unique<float, mm::memory_kind::host>(n);
+  for (size_t i = 0; i < n; i++)
+    src.get()[i] = i;
+
+  for (auto _ : st) {
+    auto dst = mm::alloc_raw_unique<float, mm::memory_kind::host>(n);
+    memcpy(dst.get(), src.get(), n * sizeof(float));
+    benchmark::DoNotOptimize(dst.get());
+    benchmark::ClobberMemory();
+  }
+
+  st.SetBytesProcessed(st.iterations() * n * sizeof(float));
+  st.SetLabel(Label(pages));
+}
+
+BENCHMARK(HugePageHostCopy)
+->Unit(benchmark::kMillisecond)
+->UseRealTime()
+->Arg(static_cast<int>(HostPages::Regular))
+->Arg(static_cast<int>(HostPages::Transparent))
+->Arg(static_cast<int>(HostPages::Explicit2M));
+
+/**
+ * @brief Allocates a large output buffer for every iteration and transposes a volume to it.
+ *
+ * The strided access pattern of the transposition touches many pages at once, which makes it
+ * sensitive to the TLB reach.
+ */
+static void HugePageHostTranspose(benchmark::State &st) {
+  auto pages = static_cast<HostPages>(st.range(0));
+  ScopedHostPages scoped_pages(pages);
+  size_t n = volume(kVolumeShape);
+  std::vector<int> perm = { 2, 1, 0 };
+  auto dst_shape = permute(kVolumeShape, perm);
+  auto src = mm::alloc_raw_unique<float, mm::memory_kind::host>(n);
+  for (size_t i = 0; i < n; i++)
+    src.get()[i] = i;
+  TensorView<StorageCPU, const float> src_view(src.get(), kVolumeShape);
+
+  for (auto _ : st) {
+    auto dst = mm::alloc_raw_unique<float, mm::memory_kind::host>(n);
+    TensorView<StorageCPU, float> dst_view(dst.get(), dst_shape);
+    kernels::Transpose<float>(dst_view, src_view, make_cspan(perm));
+    benchmark::DoNotOptimize(dst.get());
+    benchmark::ClobberMemory();
+  }
+
+  st.SetBytesProcessed(st.iterations() * n * sizeof(float));
+  st.SetLabel(Label(pages));
+}
+
+BENCHMARK(HugePageHostTranspose)
+->Unit(benchmark::kMillisecond)
+->UseRealTime()
+->Arg(static_cast<int>(HostPages::Regular))
+->Arg(static_cast<int>(HostPages::Transparent))
+->Arg(static_cast<int>(HostPages::Explicit2M));
+
+}  // namespace dali
@@ -0,0 +1,172 @@
+// Copyright (c) 2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <benchmark/benchmark.h>
+#include <cmath>
+#include <vector>
+#include "dali/kernels/audio/mel_scale/mel_filter_bank_cpu.h"
+#include "dali/kernels/audio/mel_scale/mel_spectrogram_cpu.h"
+#include "dali/kernels/dynamic_scratchpad.h"
+#include "dali/kernels/signal/dct/dct_cpu.h"
+#include "dali/kernels/signal/decibel/to_decibels_cpu.h"
+#include "dali/kernels/signal/fft/fft_cpu.h"
+#include "dali/kernels/signal/window/extract_windows_cpu.h"
+#include "dali/kernels/signal/window/window_functions.h"
+
+namespace dali {
+
+using kernels::audio::MelSpectrogramArgs;
+
+namespace {
+
+/**
+ * @brief Runs the same kernels as the Spectrogram -> MelFilterBank -> ToDecibels (-> MFCC)
+ *        operator chain, each producing a full intermediate result.
+ */
+class SeparateFeatureExtraction {
+ public:
+  explicit SeparateFeatureExtraction(const MelSpectrogramArgs &args) : args_(args) {
+    fft_args_.nfft = args.nfft;
+    fft_args_.transform_axis = 0;
+    fft_args_.spectrum_type = kernels::signal::fft::FFT_SPECTRUM_POWER;
+    mel_args_ = args.mel;
+    mel_args_.axis = 0;
+    mel_args_.nfft = args.nfft;
+  }
+
+  /** @return The number of bytes of the intermediate results */
+  int64_t Run(const kernels::InTensorCPU<float, 1> &in,
+              const kernels::InTensorCPU<float, 1> &window_fn) {
+    kernels::KernelContext ctx;
+    kernels::DynamicScratchpad scratchpad(AccessOrder::host());
+    ctx.scratchpad = &scratchpad;
+
+    auto windows_shape = windows_kernel_.Setup(ctx, in, window_fn, args_.window)
+                                        .output_shapes[0][0].to_static<2>();
+    windows_.resize(volume(windows_shape));
+    auto windows = make_tensor_cpu<2>(windows_.data(), windows_shape);
+    windows_kernel_.Run(ctx, windows, in, window_fn, args_.window);
+    auto windows_in = make_tensor_cpu<2>(static_cast<const float *>(windows_.data()),
+                                         windows_shape);
+
+    auto spectrum_shape = fft_kernel_.Setup(ctx, windows_in, fft_args_)
+                                     .output_shapes[0][0].to_static<2>();
+    spectrum_.resize(volume(spectrum_shape));
+    auto spectrum = make_tensor_cpu<2>(spectrum_.data(), spectrum_shape);
+    fft_kernel_.Run(ctx, spectrum, windows_in, fft_args_);
+
+    auto mel_shape = mel_kernel_.Setup(ctx, spectrum, mel_args_).output_shapes[0][0];
+    mel_.resize(volume(mel_shape));
+    auto mel = make_tensor_cpu(mel_.data(), mel_shape);
+    mel_kernel_.Run(ctx, mel, spectrum);
+
+    db_.resize(mel_.size());
+    auto db = make_tensor_cpu(db_.data(), mel_shape);
+    db_kernel_.Setup(ctx, mel, args_.db);
+    db_kernel_.Run(ctx, db, mel, args_.db);
+
+    int64_t intermediate = windows_.size() + spectrum_.size() + mel_.size();
+    if (args_.dct) {
+      auto db_in = make_tensor_cpu<2>(static_cast<const float *>(db_.data()),
+                                      mel_shape.to_static<2>());
+      auto out_shape = dct_kernel_.Setup(ctx, db_in, args_.dct_args, 0)
+                                  .output_shapes[0][0].to_static<2>();
+      out_.resize(volume(out_shape));
+      dct_kernel_.Run(ctx, make_tensor_cpu<2>(out_.data(), out_shape), db_in, args_.dct_args, 0);
+      intermediate += db_.size();
+    }
+    return intermediate * sizeof(float);
+  }
+
+ private:
+  MelSpectrogramArgs args_;
+  kernels::signal::fft::FftArgs fft_args_;
+  kernels::audio::MelFilterBankArgs mel_args_;
+  kernels::signal::ExtractWindowsCpu<float, float, 1, true> windows_kernel_;
+  kernels::signal::fft::Fft1DCpu<float, float, 2> fft_kernel_;
+  kernels::audio::MelFilterBankCpu<float> mel_kernel_;
+  kernels::signal::ToDecibelsCpu<float> db_kernel_;
+  kernels::signal::dct::Dct1DCpu<float, float, 2> dct_kernel_;
+  std::vector<float> windows_, spectrum_, mel_, db_, out_;
+};
+
+}  // namespace
+
+// Args: window length, nfft, number of mel filters, number of MFCCs (0 - log-mel), fused
+static void MelSpectrogramCPUArgs(benchmark::internal::Benchmark *b) {
+  for (int fused : {0, 1}) {
+    b->Args({400, 512, 80, 0, fused});
+    b->Args({400, 512, 64, 20, fused});
+    b->Args({1024, 1024, 128, 0, fused});
+    b->Args({2048, 2048, 128, 0, fused});
+  }
+}
+
+/**
+ * @brief Extracts the features of 10 seconds of 16 kHz audio with a 10 ms step; the "realtime"
+ *        counter is the number of seconds of audio processed per second of wall time and
+ *        "intermediate_bytes" is the size of the intermediate results stored per signal.
+ */
+static void MelSpectrogramCPU(benchmark::State &st) {
+  MelSpectrogramArgs args;
+  args.window = {static_cast<int>(st.range(0)), -1, 160, 0,
+                 kernels::signal::Padding::Reflect};
+  args.nfft = st.range(1);
+  args.mel.sample_rate = 16000;
+  args.mel.freq_high = 8000;
+  args.mel.nfilter = st.range(2);
+  args.dct = st.range(3) > 0;
+  args.dct_args.ndct = st.range(3);
+  bool fused = st.range(4);
+  const double seconds = 10;
+
+  int64_t n = seconds * args.mel.sample_rate;
+  std::vector<float> signal(n);
+  for (int64_t i = 0; i < n; i++)
+    signal[i] = std::sin(i * 0.05f) + 0.3f * std::sin(i * 0.71f);
+  std::vector<float> window_fn(args.window.window_length);
+  kernels::signal::HannWindow(make_span(window_fn));
+  auto in = make_tensor_cpu<1, const float>(signal.data(), {n});
+  auto wnd = make_tensor_cpu<1, const float>(window_fn.data(), {args.window.window_length});
+
+  SeparateFeatureExtraction separate(args);
+  kernels::audio::MelSpectrogramCpu kernel;
+  std::vector<float> out;
+  int64_t intermediate = 0;
+
+  for (auto _ : st) {
+    if (fused) {
+      kernels::KernelContext ctx;
+      kernels::DynamicScratchpad scratchpad(AccessOrder::host());
+      ctx.scratchpad = &scratchpad;
+      auto out_shape = kernel.Setup(ctx, in, wnd, args).output_shapes[0][0].to_static<2>();
+      out.resize(volume(out_shape));
+      kernel.Run(ctx, make_tensor_cpu<2>(out.data(), out_shape), in, wnd);
+      benchmark::DoNotOptimize(out.data());
+    } else {
+      intermediate = separate.Run(in, wnd);
+    }
+  }
+
+  st.counters["realtime"] = benchmark::Counter(seconds * st.iterations(),
+                                               benchmark::Counter::kIsRate);
+  st.counters["intermediate_bytes"] = intermediate;
+}
+
+BENCHMARK(MelSpectrogramCPU)
+->Unit(benchmark::kMillisecond)
+->UseRealTime()
+->Apply(MelSpectrogramCPUArgs);
+
+}  // namespace dali
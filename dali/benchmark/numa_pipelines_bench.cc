@@ -0,0 +1,128 @@
+// Copyright (c) 2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <benchmark/benchmark.h>
+#include <algorithm>
+#include <memory>
+#include <optional>
+#include <thread>
+#include <vector>
+#include "dali/core/os/numa.h"
+#include "dali/pipeline/pipeline.h"
+
+namespace dali {
+
+namespace {
+
+/** The NUMA nodes which have CPUs available to the process */
+std::vector<int> UsableNodes() {
+  std::vector<int> nodes;
+  auto &process_cpus = numa::ProcessCpus();
+  for (int node = 0; node < numa::NumNodes(); node++) {
+    auto &cpus = numa::NodeCpus(node);
+    if (std::any_of(cpus.begin(), cpus.end(), [&](int cpu) {
+          return std::binary_search(process_cpus.begin(), process_cpus.end(), cpu);
+        }))
+      nodes.push_back(node);
+  }
+  return nodes;
+}
+
+/**
+ * Creates a CPU pipeline which generates large float tensors and transposes them - the running
+ * time is dominated by the memory traffic.
+ */
+std::unique_ptr<Pipeline> CreatePipeline(int batch_size, int num_threads,
+                                         std::optional<int> numa_node) {
+  PipelineParams params = MakePipelineParams(batch_size, num_threads, CPU_ONLY_DEVICE_ID);
+  params.numa_node = numa_node;
+  auto pipe = std::make_unique<Pipeline>(params);
+  pipe->AddOperator(OpSpec("random__Uniform")
+      .AddArg("device", "cpu")
+      .AddArg("range", std::vector<float>{0, 1})
+      .AddArg("shape", std::vector<int>{1024, 1024})
+      .AddOutput("data", StorageDevice::CPU));
+  pipe->AddOperator(OpSpec("Transpose")
+      .AddArg("device", "cpu")
+      .AddArg("perm", std::vector<int>{1, 0})
+      .AddInput("data", StorageDevice::CPU)
+      .AddOutput("transposed", StorageDevice::CPU));
+  pipe->AddOperator(OpSpec("Cast")
+      .AddArg("device", "cpu")
+      .AddArg("dtype", DALI_FLOAT16)
+      .AddInput("transposed", StorageDevice::CPU)
+      .AddOutput("output", StorageDevice::CPU));
+  pipe->Build({{"output", "cpu"}});
+  return pipe;
+}
+
+}  // namespace
+
+/**
+ * @brief Runs one CPU pipeline per NUMA node concurrently and reports the total throughput.
+ *
+ * With the argument 0, the pipelines have no NUMA policy - their threads migrate freely and
+ * the buffers are placed wherever they are first touched. With 1, each pipeline is bound to its
+ * own node, so both the computation and the memory stay local.
+ */
+static void NumaPipelines(benchmark::State &st) {
+  bool numa_policy = st.range(0);
+  const int batch_size = 16, iters_per_run = 10;
+  auto nodes = UsableNodes();
+  int num_pipelines = std::max<int>(nodes.size(), 2);
+  int num_threads = std::max<int>(numa::ProcessCpus().size() / num_pipelines, 1);
+
+  std::vector<std::unique_ptr<Pipeline>> pipes;
+  for (int i = 0; i < num_pipelines; i++) {
+    std::optional<int> node;
+    if (numa_policy)
+      node = nodes[i % nodes.size()];
+    pipes.push_back(CreatePipeline(batch_size, num_threads, node));
+  }
+
+  auto run_all = [&](int iters) {
+    std::vector<std::thread> threads;
+    for (auto &pipe : pipes) {
+      threads.emplace_back([&pipe, iters]() {
+        Workspace ws;
+        for (int i = 0; i < iters; i++) {
+          pipe->Run();
+          pipe->Outputs(&ws);
+        }
+      });
+    }
+    for (auto &t : threads)
+      t.join();
+  };
+
+  run_all(2);  // warm-up
+
+  for (auto _ : st)
+    run_all(iters_per_run);
+
+  st.counters["pipelines"] = num_pipelines;
+  st.counters["FPS"] = benchmark::Counter(
+      static_cast<double>(batch_size) * iters_per_run * num_pipelines * st.iterations(),
+      benchmark::Counter::kIsRate);
+  st.SetLabel(numa_policy ? "numa_node" : "no policy");
+}
+
+BENCHMARK(NumaPipelines)
+->Unit(benchmark::kMillisecond)
+->UseRealTime()
+->Iterations(20)
+->Arg(0)
+->Arg(1);
+
+}  // namespace dali
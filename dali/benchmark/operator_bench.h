@@ -1,4 +1,4 @@
-// Copyright (c) 2019-2022, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+// Copyright (c) 2019-2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
 //
 // Licensed under the Apache License, Version 2.0 (the "License");
 // you may not use this file except in compliance with the License.
@@ -16,6 +16,9 @@
 #define DALI_BENCHMARK_OPERATOR_BENCH_H_
 
 #include <benchmark/benchmark.h>
+#include <algorithm>
+#include <chrono>
+#include <cmath>
 #include <memory>
 #include <vector>
 #include "dali/benchmark/dali_bench.h"
@@ -80,6 +83,59 @@ class OperatorBench : public DALIBenchmark {
     }
   }
 
+  /**
+   * @brief Runs a CPU operator on a batch of samples with (possibly) varying shapes
+   *
+   * Apart from the throughput, it reports the mean, standard deviation and maximum
+   * of the batch latency, in milliseconds.
+   */
+  template <typename T>
+  void RunCPU(benchmark::State &st, const OpSpec &op_spec, const TensorListShape<> &shape,
+              TensorLayout layout = "HWC", int num_threads = 4) {
+    assert(layout.size() == shape.sample_dim());
+    int batch_size = shape.num_samples();
+
+    auto op_ptr = InstantiateOperator(op_spec);
+
+    auto data_in = std::make_shared<TensorList<CPUBackend>>(batch_size);
+    data_in->set_type<T>();
+    data_in->Resize(shape);
+    data_in->SetLayout(layout);
+    for (int sample_idx = 0; sample_idx < batch_size; sample_idx++) {
+      auto *ptr = data_in->template mutable_tensor<T>(sample_idx);
+      for (int64_t i = 0, n = shape.tensor_size(sample_idx); i < n; i++) {
+        ptr[i] = static_cast<T>(i & 0x7f);
+      }
+    }
+
+    Workspace ws;
+    ws.AddInput(data_in);
+    ThreadPool tp(num_threads, 0, false, "OperatorBench");
+    ws.SetThreadPool(&tp);
+
+    Setup<TensorList<CPUBackend>>(op_ptr, op_spec, ws, batch_size);
+    op_ptr->Run(ws);
+
+    double sum = 0, sum_sq = 0, max = 0;
+    for (auto _ : st) {
+      auto start = std::chrono::high_resolution_clock::now();
+      op_ptr->Run(ws);
+      auto end = std::chrono::high_resolution_clock::now();
+      double ms = std::chrono::duration<double, std::milli>(end - start).count();
+      sum += ms;
+      sum_sq += ms * ms;
+      max = std::max(max, ms);
+    }
+    double n = st.iterations();
+    double mean = n > 0 ? sum / n : 0;
+    double var = n > 0 ? std::max(sum_sq / n - mean * mean, 0.0) : 0;
+    st.counters["FPS"] = benchmark::Counter(batch_size * st.iterations(),
+                                            benchmark::Counter::kIsRate);
+    st.counters["batch_ms_mean"] = mean;
+    st.counters["batch_ms_stddev"] = std::sqrt(var);
+    st.counters["batch_ms_max"] = max;
+  }
+
   template <typename T>
   void RunGPU(benchmark::State &st, const OpSpec &op_spec, int batch_size = 128,
               TensorListShape<> shape = uniform_list_shape(128, {1080, 1920, 3}),
@@ -0,0 +1,124 @@
+// Copyright (c) 2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <benchmark/benchmark.h>
+#include <unistd.h>
+#include <atomic>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <thread>
+#include "dali/core/os/shm_ring.h"
+#include "dali/pipeline/pipeline.h"
+
+namespace dali {
+
+namespace {
+
+constexpr int kBatchSize = 16;
+constexpr int kSampleBytes = 4 << 20;
+constexpr int kNumSlots = 4;
+
+const TensorListShape<> kBatchShape = uniform_list_shape(kBatchSize, TensorShape<>{kSampleBytes});
+
+/** Simulates an ingest service filling a buffer with the data of a batch. */
+void ProduceBatch(uint8_t *dst, int iteration) {
+  memset(dst, iteration & 0xff, static_cast<size_t>(kBatchSize) * kSampleBytes);
+}
+
+std::unique_ptr<Pipeline> CreatePipeline(const OpSpec &input_spec) {
+  auto pipe = std::make_unique<Pipeline>(kBatchSize, 4, CPU_ONLY_DEVICE_ID);
+  pipe->AddOperator(input_spec, "input");
+  pipe->Build({{"data", "cpu"}});
+  return pipe;
+}
+
+}  // namespace
+
+/**
+ * @brief Feeds the batches with ExternalSource - the data is produced in a staging buffer
+ *        and copied to the pipeline.
+ */
+static void ShmRingIngestExternalSource(benchmark::State &st) {
+  auto pipe = CreatePipeline(OpSpec("ExternalSource")
+      .AddArg("device", "cpu")
+      .AddArg("dtype", DALI_UINT8)
+      .AddOutput("data", StorageDevice::CPU));
+  TensorList<CPUBackend> staging;
+  staging.set_pinned(false);
+  staging.Resize(kBatchShape, DALI_UINT8);
+  Workspace ws;
+  int iteration = 0;
+
+  for (auto _ : st) {
+    ProduceBatch(staging.mutable_tensor<uint8_t>(0), iteration++);
+    pipe->SetExternalInput("input", staging, AccessOrder::host());
+    pipe->Run();
+    pipe->Outputs(&ws);
+    benchmark::DoNotOptimize(ws.Output<CPUBackend>(0).tensor<uint8_t>(0));
+  }
+
+  st.SetBytesProcessed(st.iterations() * kBatchShape.num_elements());
+  st.SetLabel("copy");
+}
+
+/**
+ * @brief Feeds the batches from a shared memory ring - the producer writes the data directly
+ *        to the ring slot and the pipeline uses it without a copy.
+ */
+static void ShmRingIngest(benchmark::State &st) {
+  std::string name = make_string("/dali_shm_ring_bench_", getpid());
+  uint64_t slot_size = shm_ring::RequiredSlotSize(kBatchSize, 1, kBatchShape.num_elements());
+  shm_ring::Producer producer(name, kNumSlots, slot_size);
+  std::atomic<bool> stop{false};
+  std::thread producer_thread([&]() {
+    for (int iteration = 0; !stop; iteration++) {
+      if (!producer.WaitForSlot(std::chrono::milliseconds(100)))
+        continue;
+      ProduceBatch(producer.BeginWrite(kBatchShape, DALI_UINT8), iteration);
+      producer.Publish();
+    }
+    producer.Close();
+  });
+
+  {
+    auto pipe = CreatePipeline(OpSpec("experimental__inputs__SharedMemoryRing")
+        .AddArg("device", "cpu")
+        .AddArg("ring_name", name)
+        .AddArg("dtype", DALI_UINT8)
+        .AddOutput("data", StorageDevice::CPU));
+    Workspace ws;
+
+    for (auto _ : st) {
+      pipe->Run();
+      pipe->Outputs(&ws);
+      benchmark::DoNotOptimize(ws.Output<CPUBackend>(0).tensor<uint8_t>(0));
+    }
+    stop = true;
+  }
+  producer_thread.join();
+
+  st.SetBytesProcessed(st.iterations() * kBatchShape.num_elements());
+  st.SetLabel("zero-copy");
+}
+
+BENCHMARK(ShmRingIngestExternalSource)
+->Unit(benchmark::kMillisecond)
+->UseRealTime();
+
+BENCHMARK(ShmRingIngest)
+->Unit(benchmark::kMillisecond)
+->UseRealTime();
+
+}  // namespace dali
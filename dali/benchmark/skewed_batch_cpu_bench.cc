@@ -0,0 +1,144 @@
+// Copyright (c) 2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <benchmark/benchmark.h>
+#include <string>
+#include <vector>
+#include "dali/benchmark/operator_bench.h"
+#include "dali/benchmark/dali_bench.h"
+
+namespace dali {
+
+// Batches with a few large images among many small ones, which used to produce stragglers.
+
+static void SkewedBatchArgs(benchmark::internal::Benchmark *b) {
+  int batch_size = 32;
+  for (int num_threads : {4, 8}) {
+    for (int num_large : {0, 1, 4}) {
+      b->Args({batch_size, num_large, num_threads});
+    }
+  }
+}
+
+static TensorListShape<> SkewedBatchShape(int batch_size, int num_large) {
+  TensorListShape<> shape(batch_size, 3);
+  for (int i = 0; i < batch_size; i++) {
+    if (i < num_large)
+      shape.set_tensor_shape(i, TensorShape<>{3000, 4000, 3});
+    else
+      shape.set_tensor_shape(i, TensorShape<>{480, 640, 3});
+  }
+  return shape;
+}
+
+static OpSpec SkewedBatchSpec(const std::string &name, int batch_size) {
+  return OpSpec(name)
+    .AddArg("max_batch_size", batch_size)
+    .AddArg("num_threads", 1)
+    .AddArg("device", "cpu");
+}
+
+BENCHMARK_DEFINE_F(OperatorBench, TransposeSkewedCPU)(benchmark::State& st) {
+  int batch_size = st.range(0);
+  auto spec = SkewedBatchSpec("Transpose", batch_size)
+    .AddArg("perm", std::vector<int>{2, 0, 1});
+  this->RunCPU<uint8_t>(st, spec, SkewedBatchShape(batch_size, st.range(1)), "HWC", st.range(2));
+}
+
+BENCHMARK_REGISTER_F(OperatorBench, TransposeSkewedCPU)->Iterations(20)
+->Unit(benchmark::kMillisecond)
+->UseRealTime()
+->Apply(SkewedBatchArgs);
+
+BENCHMARK_DEFINE_F(OperatorBench, CastSkewedCPU)(benchmark::State& st) {
+  int batch_size = st.range(0);
+  auto spec = SkewedBatchSpec("Cast", batch_size)
+    .AddArg("dtype", DALI_FLOAT);
+  this->RunCPU<uint8_t>(st, spec, SkewedBatchShape(batch_size, st.range(1)), "HWC", st.range(2));
+}
+
+BENCHMARK_REGISTER_F(OperatorBench, CastSkewedCPU)->Iterations(20)
+->Unit(benchmark::kMillisecond)
+->UseRealTime()
+->Apply(SkewedBatchArgs);
+
+BENCHMARK_DEFINE_F(OperatorBench, FlipSkewedCPU)(benchmark::State& st) {
+  int batch_size = st.range(0);
+  auto spec = SkewedBatchSpec("Flip", batch_size)
+    .AddArg("horizontal", 1)
+    .AddArg("vertical", 1);
+  this->RunCPU<uint8_t>(st, spec, SkewedBatchShape(batch_size, st.range(1)), "HWC", st.range(2));
+}
+
+BENCHMARK_REGISTER_F(OperatorBench, FlipSkewedCPU)->Iterations(20)
+->Unit(benchmark::kMillisecond)
+->UseRealTime()
+->Apply(SkewedBatchArgs);
+
+BENCHMARK_DEFINE_F(OperatorBench, PadSkewedCPU)(benchmark::State& st) {
+  int batch_size = st.range(0);
+  auto spec = SkewedBatchSpec("Pad", batch_size)
+    .AddArg("axes", std::vector<int>{2})
+    .AddArg("shape", std::vector<int>{4});
+  this->RunCPU<uint8_t>(st, spec, SkewedBatchShape(batch_size, st.range(1)), "HWC", st.range(2));
+}
+
+BENCHMARK_REGISTER_F(OperatorBench, PadSkewedCPU)->Iterations(20)
+->Unit(benchmark::kMillisecond)
+->UseRealTime()
+->Apply(SkewedBatchArgs);
+
+BENCHMARK_DEFINE_F(OperatorBench, SliceSkewedCPU)(benchmark::State& st) {
+  int batch_size = st.range(0);
+  auto spec = SkewedBatchSpec("Slice", batch_size)
+    .AddArg("rel_start", std::vector<float>{0.1f, 0.1f})
+    .AddArg("rel_end", std::vector<float>{0.9f, 0.9f})
+    .AddArg("axis_names", TensorLayout("HW"));
+  this->RunCPU<uint8_t>(st, spec, SkewedBatchShape(batch_size, st.range(1)), "HWC", st.range(2));
+}
+
+BENCHMARK_REGISTER_F(OperatorBench, SliceSkewedCPU)->Iterations(20)
+->Unit(benchmark::kMillisecond)
+->UseRealTime()
+->Apply(SkewedBatchArgs);
+
+BENCHMARK_DEFINE_F(OperatorBench, CropMirrorNormalizeSkewedCPU)(benchmark::State& st) {
+  int batch_size = st.range(0);
+  auto spec = SkewedBatchSpec("CropMirrorNormalize", batch_size)
+    .AddArg("dtype", DALI_FLOAT)
+    .AddArg("output_layout", "CHW")
+    .AddArg("mean", std::vector<float>(3, 128.0f))
+    .AddArg("std", std::vector<float>(3, 64.0f))
+    .AddArg("mirror", 1);
+  this->RunCPU<uint8_t>(st, spec, SkewedBatchShape(batch_size, st.range(1)), "HWC", st.range(2));
+}
+
+BENCHMARK_REGISTER_F(OperatorBench, CropMirrorNormalizeSkewedCPU)->Iterations(20)
+->Unit(benchmark::kMillisecond)
+->UseRealTime()
+->Apply(SkewedBatchArgs);
+
+BENCHMARK_DEFINE_F(OperatorBench, NormalizeSkewedCPU)(benchmark::State& st) {
+  int batch_size = st.range(0);
+  auto spec = SkewedBatchSpec("Normalize", batch_size)
+    .AddArg("axes", std::vector<int>{0, 1});
+  this->RunCPU<uint8_t>(st, spec, SkewedBatchShape(batch_size, st.range(1)), "HWC", st.range(2));
+}
+
+BENCHMARK_REGISTER_F(OperatorBench, NormalizeSkewedCPU)->Iterations(20)
+->Unit(benchmark::kMillisecond)
+->UseRealTime()
+->Apply(SkewedBatchArgs);
+
+}  // namespace dali
@@ -1,4 +1,4 @@
-// Copyright (c) 2019, NVIDIA CORPORATION. All rights reserved.
+// Copyright (c) 2019-2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
 //
 // Licensed under the Apache License, Version 2.0 (the "License");
 // you may not use this file except in compliance with the License.
@@ -55,6 +55,47 @@ BENCHMARK_REGISTER_F(OperatorBench, WarpAffineCPU)->Iterations(50)
 ->Apply(WarpAffineCPUArgs);
 
 
+// A few large images (split into bands of rows) vs many small ones, with different
+// interpolation methods and output types.
+static void WarpAffineCPUInterpArgs(benchmark::internal::Benchmark *b) {
+  for (int interp : {DALI_INTERP_NN, DALI_INTERP_LINEAR}) {
+    for (int float_output : {0, 1}) {
+      b->Args({1, 4096, interp, float_output});
+      b->Args({2, 2048, interp, float_output});
+      b->Args({64, 256, interp, float_output});
+    }
+  }
+}
+
+BENCHMARK_DEFINE_F(OperatorBench, WarpAffineCPUInterp)(benchmark::State& st) {
+  int batch_size = st.range(0);
+  int H = st.range(1);
+  int W = H, C = 3;
+  auto interp = static_cast<DALIInterpType>(st.range(2));
+  DALIDataType dtype = st.range(3) ? DALI_FLOAT : DALI_UINT8;
+
+  vector<float> mtx = {
+    1.1f, 0.2f, -10.0f,
+    -0.15f, 0.9f, 5.0f
+  };
+  this->RunCPU<uint8_t>(
+    st,
+    OpSpec("WarpAffine")
+      .AddArg("max_batch_size", batch_size)
+      .AddArg("num_threads", 4)
+      .AddArg("device", "cpu")
+      .AddArg("matrix", mtx)
+      .AddArg("interp_type", interp)
+      .AddArg("dtype", dtype)
+      .AddArg("fill_value", 42),
+    batch_size, H, W, C);
+}
+
+BENCHMARK_REGISTER_F(OperatorBench, WarpAffineCPUInterp)->Iterations(50)
+->Unit(benchmark::kMicrosecond)
+->UseRealTime()
+->Apply(WarpAffineCPUInterpArgs);
+
 static void WarpAffineGPUArgs(benchmark::internal::Benchmark *b) {
   for (int batch_size = 256; batch_size >= 1; batch_size /= 2) {
     for (int H = 2048; H >= 256; H /= 2) {
@@ -13,6 +13,10 @@
 // limitations under the License.
 
 #include "dali/c_api_2/pipeline.h"
+#include <sys/eventfd.h>
+#include <unistd.h>
+#include <cerrno>
+#include <system_error>
 #include "dali/c_api_2/pipeline_outputs.h"
 #include "dali/c_api_2/checkpoint.h"
 #include "dali/c_api_2/error_handling.h"
@@ -76,7 +80,14 @@ PipelineWrapper::PipelineWrapper(
     ToCppParams(params));
 }
 
-PipelineWrapper::~PipelineWrapper() = default;
+PipelineWrapper::~PipelineWrapper() {
+  // Stop the pipeline first - its threads may signal the events
+  pipeline_.reset();
+  if (outputs_ready_fd_ >= 0)
+    close(outputs_ready_fd_);
+  for (auto &[name, fd] : input_consumed_fds_)
+    close(fd);
+}
 
 std::unique_ptr<PipelineOutputs>
 PipelineWrapper::PopOutputs(AccessOrder order) {
@@ -275,7 +286,86 @@ void PipelineWrapper::RestoreFromCheckpoint(CheckpointWrapper &chk) {
   pipeline_->RestoreFromCheckpoint(*chk.Unwrap());
 }
 
+void PipelineWrapper::EnableEvents() {
+  if (events_enabled_)
+    return;
+  pipeline_->SetOutputReadyCallback([this]() {
+    SignalEvent(DALI_PIPELINE_EVENT_OUTPUTS_READY, nullptr);
+  });
+  for (auto &[name, node] : pipeline_->GetInputOperators()) {
+    const char *input_name = name.c_str();  // the name is owned by the pipeline
+    pipeline_->SetInputConsumedCallback(name, [this, input_name]() {
+      SignalEvent(DALI_PIPELINE_EVENT_INPUT_CONSUMED, input_name);
+    });
+  }
+  events_enabled_ = true;
+}
+
+void PipelineWrapper::SignalEvent(daliPipelineEvent_t event, const char *input_name) {
+  daliPipelineEventCallback_t callback;
+  void *context;
+  {
+    std::lock_guard lock(event_mtx_);
+    int fd = outputs_ready_fd_;
+    if (event == DALI_PIPELINE_EVENT_INPUT_CONSUMED) {
+      auto it = input_consumed_fds_.find(input_name);
+      fd = it != input_consumed_fds_.end() ? it->second : -1;
+    }
+    if (fd >= 0) {
+      // This can fail only if the counter would overflow - and then the descriptor is readable.
+      (void)eventfd_write(fd, 1);
+    }
+    callback = event_callback_;
+    context = event_context_;
+  }
+  if (callback)
+    callback(context, this, event, input_name);
+}
+
+void PipelineWrapper::SetEventCallback(daliPipelineEventCallback_t callback, void *context) {
+  EnableEvents();
+  std::lock_guard lock(event_mtx_);
+  event_callback_ = callback;
+  event_context_ = context;
+}
+
+int PipelineWrapper::GetEventFd(daliPipelineEvent_t event, const char *input_name) {
+  int *fd = nullptr;
+  std::string_view name;
+  if (event == DALI_PIPELINE_EVENT_OUTPUTS_READY) {
+    if (input_name)
+      throw std::invalid_argument(
+          "The input name must be NULL for DALI_PIPELINE_EVENT_OUTPUTS_READY.");
+  } else if (event == DALI_PIPELINE_EVENT_INPUT_CONSUMED) {
+    if (!input_name)
+      throw std::invalid_argument(
+          "The input name must not be NULL for DALI_PIPELINE_EVENT_INPUT_CONSUMED.");
+    name = input_name;
+    auto &inputs = pipeline_->GetInputOperators();
+    if (inputs.find(name) == inputs.end())
+      throw invalid_key(make_string("The input with the name \"", name, "\" was not found."));
+  } else {
+    throw std::invalid_argument(make_string("Invalid pipeline event: ", static_cast<int>(event)));
+  }
 
+  EnableEvents();
+  std::lock_guard lock(event_mtx_);
+  if (event == DALI_PIPELINE_EVENT_OUTPUTS_READY) {
+    fd = &outputs_ready_fd_;
+  } else {
+    auto it = input_consumed_fds_.find(name);
+    if (it == input_consumed_fds_.end())
+      it = input_consumed_fds_.emplace(std::string(name), -1).first;
+    fd = &it->second;
+  }
+  if (*fd < 0) {
+    int new_fd = eventfd(0, EFD_CLOEXEC | EFD_NONBLOCK);
+    if (new_fd < 0)
+      throw std::system_error(errno, std::generic_category(), "Cannot create an eventfd");
+    *fd = new_fd;
+  }
+  return *fd;
+}
 
 }  // namespace dali::c_api
 
@@ -423,6 +513,27 @@ daliResult_t daliPipelinePopOutputs(daliPipeline_h pipeline, daliPipelineOutputs
   DALI_EPILOG();
 }
 
+daliResult_t daliPipelineSetEventCallback(
+      daliPipeline_h pipeline,
+      daliPipelineEventCallback_t callback,
+      void *context) {
+  DALI_PROLOG();
+  ToPointer(pipeline)->SetEventCallback(callback, context);
+  DALI_EPILOG();
+}
+
+daliResult_t daliPipelineGetEventFd(
+      daliPipeline_h pipeline,
+      int *out_fd,
+      daliPipelineEvent_t event,
+      const char *input_name) {
+  DALI_PROLOG();
+  auto p = ToPointer(pipeline);
+  CHECK_OUTPUT(out_fd);
+  *out_fd = p->GetEventFd(event, input_name);
+  DALI_EPILOG();
+}
+
 daliResult_t daliPipelinePopOutputsAsync(
         daliPipeline_h pipeline,
         daliPipelineOutputs_h *out,
@@ -15,7 +15,10 @@
 #ifndef DALI_C_API_2_PIPELINE_H_
 #define DALI_C_API_2_PIPELINE_H_
 
+#include <functional>
+#include <map>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <string_view>
 #include <vector>
@@ -78,6 +81,9 @@ class PipelineWrapper : public _DALIPipeline {
 
   void RestoreFromCheckpoint(CheckpointWrapper &chk);
 
+  void SetEventCallback(daliPipelineEventCallback_t callback, void *context);
+
+  int GetEventFd(daliPipelineEvent_t event, const char *input_name);
 
  private:
   template <typename Backend>
@@ -88,8 +94,21 @@ class PipelineWrapper : public _DALIPipeline {
         daliFeedInputFlags_t options,
         AccessOrder order);
 
+  /** Installs the hooks which signal the events; it's done once, on the first request. */
+  void EnableEvents();
+
+  /** Writes to the event's descriptor (if any) and calls the event callback (if any). */
+  void SignalEvent(daliPipelineEvent_t event, const char *input_name);
+
   std::unique_ptr<Pipeline> pipeline_;
   mutable std::vector<std::string_view> input_names_;
+
+  std::mutex event_mtx_;
+  bool events_enabled_ = false;
+  daliPipelineEventCallback_t event_callback_ = nullptr;
+  void *event_context_ = nullptr;
+  int outputs_ready_fd_ = -1;
+  std::map<std::string, int, std::less<>> input_consumed_fds_;
 };
 
 PipelineWrapper *ToPointer(daliPipeline_h handle);
@@ -13,8 +13,14 @@
 // limitations under the License.
 
 #include <gtest/gtest.h>
+#include <poll.h>
+#include <sys/eventfd.h>
+#include <atomic>
+#include <cstring>
 #include <limits>
+#include <memory>
 #include <random>
+#include <vector>
 #include "dali/c_api_2/pipeline.h"
 #include "dali/pipeline/pipeline.h"
 #include "dali/pipeline/executor/executor2/exec2_ops_for_test.h"
@@ -505,6 +511,117 @@ TEST(CAPI2_PipelineTest, FeedInputGPUAsync) {
   TestFeedInput<GPUBackend>({});
 }
 
+namespace {
+
+struct EventCounter {
+  std::atomic<int> outputs_ready{0}, input_consumed{0};
+};
+
+void CountEvent(void *context, daliPipeline_h, daliPipelineEvent_t event, const char *input_name) {
+  auto *counter = static_cast<EventCounter *>(context);
+  if (event == DALI_PIPELINE_EVENT_OUTPUTS_READY && !input_name)
+    counter->outputs_ready++;
+  else if (event == DALI_PIPELINE_EVENT_INPUT_CONSUMED && input_name && !strcmp(input_name, "ext"))
+    counter->input_consumed++;
+}
+
+/** Waits until the eventfd is signaled and returns the number of events (0 on timeout). */
+uint64_t WaitForEvents(int fd) {
+  pollfd pfd = { fd, POLLIN, 0 };
+  if (poll(&pfd, 1, 10000) <= 0)
+    return 0;
+  eventfd_t value = 0;
+  if (eventfd_read(fd, &value) != 0)
+    return 0;
+  return value;
+}
+
+}  // namespace
+
+TEST(CAPI2_PipelineTest, EventFd) {
+  auto proto = GetPipelineWithExternalSource(StorageDevice::CPU, 4, 4, CPU_ONLY_DEVICE_ID);
+  daliPipelineParams_t params{};
+  params.max_batch_size_present = true;
+  params.max_batch_size = 4;
+  params.prefetch_queue_depths_present = true;
+  params.prefetch_queue_depths = { 2, 2 };
+  params.exec_type_present = true;
+  params.exec_type = DALI_EXEC_DYNAMIC;
+
+  EventCounter counter;  // must outlive the pipeline
+  auto h = Deserialize(proto, params);
+  ASSERT_NE(h, nullptr);
+  int outputs_fd = -1, input_fd = -1, fd = -1;
+  EXPECT_EQ(daliPipelineGetEventFd(h, &fd, DALI_PIPELINE_EVENT_OUTPUTS_READY, nullptr),
+            DALI_ERROR_INVALID_OPERATION) << "The pipeline is not built yet.";
+  daliClearLastError();
+  CHECK_DALI(daliPipelineBuild(h));
+
+  EXPECT_EQ(daliPipelineGetEventFd(h, &fd, DALI_PIPELINE_EVENT_OUTPUTS_READY, "ext"),
+            DALI_ERROR_INVALID_ARGUMENT);
+  EXPECT_EQ(daliPipelineGetEventFd(h, &fd, DALI_PIPELINE_EVENT_INPUT_CONSUMED, nullptr),
+            DALI_ERROR_INVALID_ARGUMENT);
+  EXPECT_EQ(daliPipelineGetEventFd(h, &fd, DALI_PIPELINE_EVENT_INPUT_CONSUMED, "nonexistent"),
+            DALI_ERROR_INVALID_KEY);
+  daliClearLastError();
+
+  CHECK_DALI(daliPipelineGetEventFd(h, &outputs_fd, DALI_PIPELINE_EVENT_OUTPUTS_READY, nullptr));
+  CHECK_DALI(daliPipelineGetEventFd(h, &input_fd, DALI_PIPELINE_EVENT_INPUT_CONSUMED, "ext"));
+  ASSERT_GE(outputs_fd, 0);
+  ASSERT_GE(input_fd, 0);
+  EXPECT_NE(outputs_fd, input_fd);
+  CHECK_DALI(daliPipelineGetEventFd(h, &fd, DALI_PIPELINE_EVENT_OUTPUTS_READY, nullptr));
+  EXPECT_EQ(fd, outputs_fd) << "The descriptor should be reused.";
+  CHECK_DALI(daliPipelineSetEventCallback(h, CountEvent, &counter));
+
+  eventfd_t value = 0;
+  EXPECT_NE(eventfd_read(outputs_fd, &value), 0) << "No events should be signaled yet.";
+
+  int feed_count = 0;
+  CHECK_DALI(daliPipelineGetFeedCount(h, &feed_count, "ext"));
+  ASSERT_GT(feed_count, 0);
+
+  std::mt19937_64 rng(4321);
+  std::vector<std::shared_ptr<TensorList<CPUBackend>>> cpp_tls;
+  auto feed = [&]() {
+    auto cpp_tl = std::make_shared<TensorList<CPUBackend>>();
+    cpp_tls.push_back(cpp_tl);
+    FillRandomTensorList<uint8_t>(*cpp_tl, rng, { 4, 4, 1 }, { 64, 64, 3 }, 4);
+    auto tl = Wrap(cpp_tl);
+    CHECK_DALI(daliPipelineFeedInput(h, "ext", tl.get(), nullptr, {}, nullptr));
+  };
+
+  constexpr int kIters = 6;
+  for (int i = 0; i < feed_count; i++)
+    feed();
+  CHECK_DALI(daliPipelinePrefetch(h));
+
+  uint64_t ready = 0, consumed = 0;
+  for (int iter = 0; iter < kIters; iter++) {
+    if (ready == 0)
+      ready += WaitForEvents(outputs_fd);
+    ASSERT_GT(ready, 0u) << "Timed out waiting for the outputs of iteration " << iter;
+    ready--;
+    auto outs = PopOutputs(h);
+    ASSERT_NE(outs, nullptr);
+    CompareTensorLists(*cpp_tls[iter], *Unwrap<CPUBackend>(GetOutput(outs, 0)));
+
+    if (iter + feed_count < kIters) {
+      // the input can accept another batch
+      if (consumed == 0)
+        consumed += WaitForEvents(input_fd);
+      ASSERT_GT(consumed, 0u) << "Timed out waiting for the input to be consumed";
+      consumed--;
+      feed();
+      CHECK_DALI(daliPipelineRun(h));
+    }
+  }
+
+  h.reset();  // wait for all the callbacks
+  EXPECT_EQ(counter.outputs_ready, kIters);
+  EXPECT_EQ(counter.input_consumed, kIters);
+}
+
 TEST(CAPI2_PipelineTest, InputDescSimple) {
   auto proto = GetPipelineWithExternalSource(dali::StorageDevice::GPU, 4, 4, 0, false);
   daliPipelineParams_t params{};
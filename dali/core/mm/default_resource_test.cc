@@ -1,4 +1,4 @@
-// Copyright (c) 2021-2023, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+// Copyright (c) 2021-2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
 //
 // Licensed under the Apache License, Version 2.0 (the "License");
 // you may not use this file except in compliance with the License.
@@ -446,6 +446,58 @@ TEST(MMDefaultResource, PreallocatePinnedMemory) {
   mm::ReleaseUnusedMemory();
 }
 
+TEST(MMDefaultResource, UseHugePageHostMemory) {
+  auto prev = ShareDefaultResource<memory_kind::host>();
+  void *old_mem = prev->allocate(10 << 20);
+  mm::UseHugePageHostMemory(0, 1 << 20);
+  auto *res = GetDefaultResource<memory_kind::host>();
+  EXPECT_NE(res, prev.get());
+
+  // the small allocations are still served by the previous resource
+  void *small = res->allocate(1000);
+  memset(small, 1, 1000);
+  void *large1 = res->allocate(5 << 20);
+  void *large2 = res->allocate(100 << 20);
+  memset(large1, 2, 5 << 20);
+  memset(large2, 3, 100 << 20);
+  res->deallocate(large1, 5 << 20);
+  res->deallocate(large2, 100 << 20);
+  res->deallocate(small, 1000);
+
+  // the memory allocated before the change is still valid
+  memset(old_mem, 4, 10 << 20);
+  prev->deallocate(old_mem, 10 << 20);
+  SetDefaultResource<memory_kind::host>(prev);
+
+  EXPECT_THROW(mm::UseHugePageHostMemory(12345), std::invalid_argument);
+  EXPECT_EQ(GetDefaultResource<memory_kind::host>(), prev.get());
+}
+
+TEST(MMDefaultResource, UseNumaHostMemory) {
+  auto prev = ShareDefaultResource<memory_kind::host>();
+  void *old_mem = prev->allocate(100 << 20);
+  if (!mm::UseNumaHostMemory()) {
+    EXPECT_EQ(GetDefaultResource<memory_kind::host>(), prev.get());
+    prev->deallocate(old_mem, 100 << 20);
+    GTEST_SKIP() << "NUMA-aware host memory is not available.";
+  }
+  auto *res = GetDefaultResource<memory_kind::host>();
+  EXPECT_NE(res, prev.get());
+  // calling it again doesn't stack the resources
+  EXPECT_TRUE(mm::UseNumaHostMemory());
+  EXPECT_EQ(GetDefaultResource<memory_kind::host>(), res);
+
+  void *small = res->allocate(1000);
+  void *large = res->allocate(100 << 20);
+  memset(small, 1, 1000);
+  memset(large, 2, 100 << 20);
+  res->deallocate(large, 100 << 20);
+  res->deallocate(small, 1000);
+  // a large block allocated before the change can be freed by the new resource
+  res->deallocate(old_mem, 100 << 20);
+  SetDefaultResource<memory_kind::host>(prev);
+}
+
 static void TestPreallocateDeviceMemory(bool multigpu) {
   int device_id = multigpu ? 1 : 0;
   DeviceGuard dg(device_id);
@@ -1,4 +1,4 @@
-// Copyright (c) 2021-2024, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+// Copyright (c) 2021-2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
 //
 // Licensed under the Apache License, Version 2.0 (the "License");
 // you may not use this file except in compliance with the License.
@@ -12,12 +12,18 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+#include <algorithm>
+#include <atomic>
+#include <mutex>
 #include <stdexcept>
 #include <cstring>
 #include "dali/core/mm/default_resources.h"
 #include "dali/core/error_handling.h"
 #include "dali/core/format.h"
 #include "dali/core/mm/malloc_resource.h"
+#include "dali/core/mm/huge_page_resource.h"
+#include "dali/core/mm/numa_resource.h"
+#include "dali/core/os/numa.h"
 #include "dali/core/mm/binning_resource.h"
 #include "dali/core/device_guard.h"
 #include "dali/core/mm/async_pool.h"
@@ -140,8 +146,12 @@ struct MMEnv {
   bool use_pinned_mem_pool = true;
   bool use_vmm = true;
   bool use_cuda_malloc_async = false;
+  bool use_numa_host_mem = false;
+  bool disable_numa_host_mem = false;
+  bool use_host_huge_pages = false;
 
   size_t host_malloc_threshold;
+  size_t host_huge_page_size = 0;
 
   static const MMEnv &get() {
     static MMEnv env;
@@ -162,6 +172,12 @@ struct MMEnv {
     const char *use_cuda_malloc_async_env = std::getenv("DALI_USE_CUDA_MALLOC_ASYNC");
     use_cuda_malloc_async = use_cuda_malloc_async_env && atoi(use_cuda_malloc_async_env);
 
+    const char *use_numa_host_mem_env = std::getenv("DALI_USE_NUMA_HOST_MEM");
+    use_numa_host_mem = use_numa_host_mem_env && atoi(use_numa_host_mem_env);
+    disable_numa_host_mem = use_numa_host_mem_env && !atoi(use_numa_host_mem_env);
+
+    ParseHugePagesEnv();
+
     if (use_dev_mem_pool && use_cuda_malloc_async) {
       if (!use_dev_mem_pool_env) {
         use_dev_mem_pool = false;
@@ -183,6 +199,25 @@ struct MMEnv {
     host_malloc_threshold = ParseMallocThresholdEnv();
   }
 
+  void ParseHugePagesEnv() {
+    const char *env = std::getenv("DALI_HOST_HUGE_PAGES");
+    if (!env || !strcmp(env, "0") || !*env) {
+      use_host_huge_pages = false;
+    } else if (!strcmp(env, "1")) {
+      use_host_huge_pages = true;
+      host_huge_page_size = 0;  // transparent huge pages
+    } else if (!strcmp(env, "2M")) {
+      use_host_huge_pages = true;
+      host_huge_page_size = 2 << 20;
+    } else if (!strcmp(env, "1G")) {
+      use_host_huge_pages = true;
+      host_huge_page_size = 1 << 30;
+    } else {
+      DALI_FAIL(make_string(
+        "DALI_HOST_HUGE_PAGES must be 0, 1 (transparent huge pages), 2M or 1G, got: ", env));
+    }
+  }
+
   ssize_t ParseMallocThresholdEnv() {
     char *env = getenv("DALI_MALLOC_POOL_THRESHOLD");
     int len = 0;
@@ -213,7 +248,29 @@ struct MMEnv {
   }
 };
 
-inline std::shared_ptr<host_memory_resource> CreateDefaultHostResource() {
+/**
+ * @brief Creates a host resource which serves the allocations larger than `min_bytes` from
+ *        a pool of huge pages and the remaining ones from `small`.
+ */
+std::shared_ptr<host_memory_resource> CreateHugePageHostResource(
+      std::shared_ptr<host_memory_resource> small, size_t page_size, size_t min_bytes) {
+  auto upstream = std::make_shared<huge_page_memory_resource>(page_size);
+  size_t granularity = upstream->block_granularity();
+  pool_options opts = default_host_pool_opts();
+  opts.min_block_size = granularity;
+  opts.max_block_size = std::max(opts.max_block_size, granularity);
+  opts.upstream_alignment = granularity;
+  opts.max_upstream_alignment = granularity;
+  using pool_t = pool_resource<mm::memory_kind::host, mm::coalescing_free_tree, spinlock>;
+  auto pool = make_shared_composite_resource(std::make_shared<pool_t>(upstream.get(), opts),
+                                             upstream);
+  std::array<size_t, 1> thresholds = {{ min_bytes }};
+  std::array<std::shared_ptr<host_memory_resource>, 2> resources = {{ std::move(small), pool }};
+  using binning_t = binning_resource<mm::memory_kind::host, 2, decltype(resources)>;
+  return std::make_shared<binning_t>(thresholds, resources, resources);
+}
+
+inline std::shared_ptr<host_memory_resource> CreateRegularHostResource() {
   auto rsrc = std::make_shared<malloc_memory_resource>();
   size_t threshold = MMEnv::get().host_malloc_threshold;
   if (threshold > 0) {
@@ -228,6 +285,35 @@ inline std::shared_ptr<host_memory_resource> CreateDefaultHostResource() {
   return rsrc;
 }
 
+/**
+ * @brief Creates a host resource which serves the allocations larger than the malloc threshold
+ *        from the pools of the NUMA node of the calling thread, and the remaining ones from
+ *        `small`.
+ */
+std::shared_ptr<host_memory_resource> CreateNumaHostResource(
+      std::shared_ptr<host_memory_resource> small) {
+  return std::make_shared<numa_host_memory_resource>(std::move(small),
+                                                     MMEnv::get().host_malloc_threshold);
+}
+
+/** The NUMA-aware host resource most recently installed as the default one */
+std::atomic<host_memory_resource *> g_numa_host_resource{nullptr};
+
+inline std::shared_ptr<host_memory_resource> CreateDefaultHostResource() {
+  auto &env = MMEnv::get();
+  auto rsrc = CreateRegularHostResource();
+  bool numa = env.use_numa_host_mem && numa::NumNodes() > 1;
+  if (numa)
+    rsrc = CreateNumaHostResource(std::move(rsrc));
+  if (env.use_host_huge_pages) {
+    rsrc = CreateHugePageHostResource(std::move(rsrc), env.host_huge_page_size,
+                                      kDefaultHugePageMinBytes);
+  }
+  if (numa)
+    g_numa_host_resource = rsrc.get();
+  return rsrc;
+}
+
 inline std::shared_ptr<device_async_resource> CreateDefaultDeviceResource() {
   static CUDARTLoader CUDAInit;
   CUDAEventPool::instance();
@@ -480,5 +566,27 @@ void PreallocatePinnedMemory(size_t bytes) {
   res->deallocate(mem, bytes);
 }
 
+DLL_PUBLIC
+void UseHugePageHostMemory(size_t page_size, size_t min_bytes) {
+  auto res = CreateHugePageHostResource(ShareDefaultResource<mm::memory_kind::host>(),
+                                        page_size, min_bytes);
+  SetDefaultResource<mm::memory_kind::host>(std::move(res));
+}
+
+DLL_PUBLIC
+bool UseNumaHostMemory() {
+  if (MMEnv::get().disable_numa_host_mem || numa::NumNodes() <= 1)
+    return false;
+  static std::mutex mtx;
+  std::lock_guard<std::mutex> g(mtx);
+  auto current = ShareDefaultResource<mm::memory_kind::host>();
+  if (current.get() == g_numa_host_resource)
+    return true;  // already installed
+  auto rsrc = CreateNumaHostResource(std::move(current));
+  g_numa_host_resource = rsrc.get();
+  SetDefaultResource<mm::memory_kind::host>(std::move(rsrc));
+  return true;
+}
+
 }  // namespace mm
 }  // namespace dali
@@ -0,0 +1,121 @@
+// Copyright (c) 2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "dali/core/mm/huge_page_resource.h"
+#include <sys/mman.h>
+#include <unistd.h>
+#include <algorithm>
+#include <new>
+#include <stdexcept>
+#include "dali/core/format.h"
+#include "dali/core/mm/detail/align.h"
+#include "dali/core/util.h"
+
+#ifndef MAP_HUGE_SHIFT
+#define MAP_HUGE_SHIFT 26
+#endif
+
+namespace dali {
+namespace mm {
+
+namespace {
+
+size_t BasePageSize() {
+  static const size_t page_size = sysconf(_SC_PAGESIZE);
+  return page_size;
+}
+
+int Log2(size_t x) {
+  int log = 0;
+  while (x > 1) {
+    x >>= 1;
+    log++;
+  }
+  return log;
+}
+
+}  // namespace
+
+huge_page_memory_resource::huge_page_memory_resource(size_t page_size, bool prefault)
+: page_size_(page_size), prefault_(prefault) {
+  if (page_size != 0 && page_size != (2 << 20) && page_size != (1 << 30))
+    throw std::invalid_argument(make_string("Unsupported huge page size: ", page_size,
+                                            ". Valid values are 0 (transparent huge pages), "
+                                            "2 MiB and 1 GiB."));
+}
+
+void *huge_page_memory_resource::MapExplicit(size_t size) {
+  int flags = MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB | (Log2(page_size_) << MAP_HUGE_SHIFT);
+  if (prefault_)
+    flags |= MAP_POPULATE;
+  void *mem = mmap(nullptr, size, PROT_READ | PROT_WRITE, flags, -1, 0);
+  return mem == MAP_FAILED ? nullptr : mem;
+}
+
+void *huge_page_memory_resource::MapTransparent(size_t size, size_t alignment) {
+  // Over-allocate so that the block can be aligned to the huge page boundary - otherwise
+  // the kernel couldn't use huge pages for the head and the tail of the block.
+  size_t extra = alignment - BasePageSize();
+  void *mem = mmap(nullptr, size + extra, PROT_READ | PROT_WRITE,
+                   MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+  if (mem == MAP_FAILED)
+    return nullptr;
+  char *base = static_cast<char *>(mem);
+  char *start = static_cast<char *>(detail::align_ptr(base, alignment));
+  if (start > base)
+    munmap(base, start - base);
+  if (base + extra > start)
+    munmap(start + size, base + extra - start);
+  // Not fatal - without THP support the memory is still usable, just with regular pages.
+  (void)madvise(start, size, MADV_HUGEPAGE);
+  if (prefault_)
+    Prefault(start, size);
+  return start;
+}
+
+void huge_page_memory_resource::Prefault(void *ptr, size_t size) {
+#ifdef MADV_POPULATE_WRITE
+  if (madvise(ptr, size, MADV_POPULATE_WRITE) == 0)
+    return;
+#endif
+  // Older kernels - touch every page. The memory is freshly mapped, so writing zeros is safe.
+  volatile char *p = static_cast<char *>(ptr);
+  for (size_t offset = 0; offset < size; offset += BasePageSize())
+    p[offset] = 0;
+}
+
+void *huge_page_memory_resource::do_allocate(size_t bytes, size_t alignment) {
+  if (bytes == 0)
+    return nullptr;
+  size_t granularity = block_granularity();
+  size_t size = align_up(bytes, granularity);
+  if (page_size_ && alignment <= page_size_) {
+    if (void *mem = MapExplicit(size))
+      return mem;
+    num_fallbacks_++;
+  }
+  void *mem = MapTransparent(size, std::max(alignment, granularity));
+  if (!mem)
+    throw std::bad_alloc();
+  return mem;
+}
+
+void huge_page_memory_resource::do_deallocate(void *ptr, size_t bytes, size_t alignment) {
+  if (!ptr)
+    return;
+  munmap(ptr, align_up(bytes, block_granularity()));
+}
+
+}  // namespace mm
+}  // namespace dali
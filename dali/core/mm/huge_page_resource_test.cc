@@ -0,0 +1,68 @@
+// Copyright (c) 2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+#include <cstring>
+#include <stdexcept>
+#include "dali/core/mm/detail/align.h"
+#include "dali/core/mm/huge_page_resource.h"
+
+namespace dali {
+namespace mm {
+namespace test {
+
+namespace {
+
+void TestAllocations(huge_page_memory_resource &res) {
+  size_t granularity = res.block_granularity();
+  for (size_t size : { 1, 4096, 3 << 20 }) {
+    void *p = res.allocate(size);
+    ASSERT_NE(p, nullptr);
+    EXPECT_TRUE(detail::is_aligned(p, granularity));
+    // the whole rounded-up block is usable
+    memset(p, 0x55, align_up(size, granularity));
+    res.deallocate(p, size);
+  }
+  void *p = res.allocate(100, 4 * granularity);
+  EXPECT_TRUE(detail::is_aligned(p, 4 * granularity));
+  res.deallocate(p, 100, 4 * granularity);
+  EXPECT_EQ(res.allocate(0), nullptr);
+}
+
+}  // namespace
+
+TEST(MMHugePageResource, Transparent) {
+  for (bool prefault : { false, true }) {
+    huge_page_memory_resource res(0, prefault);
+    EXPECT_EQ(res.block_granularity(), 2u << 20);
+    TestAllocations(res);
+    EXPECT_EQ(res.num_fallbacks(), 0);
+  }
+}
+
+TEST(MMHugePageResource, Explicit2M) {
+  // Without reserved huge pages, the resource falls back to transparent huge pages.
+  huge_page_memory_resource res(2 << 20);
+  EXPECT_EQ(res.block_granularity(), 2u << 20);
+  TestAllocations(res);
+}
+
+TEST(MMHugePageResource, InvalidPageSize) {
+  EXPECT_THROW(huge_page_memory_resource(4096), std::invalid_argument);
+  EXPECT_THROW(huge_page_memory_resource(3 << 20), std::invalid_argument);
+}
+
+}  // namespace test
+}  // namespace mm
+}  // namespace dali
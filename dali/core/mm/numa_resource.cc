@@ -0,0 +1,133 @@
+// Copyright (c) 2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "dali/core/mm/numa_resource.h"
+#include <sys/mman.h>
+#include <unistd.h>
+#include <algorithm>
+#include <cassert>
+#include <new>
+#include <utility>
+#include "dali/core/mm/detail/align.h"
+#include "dali/core/os/numa.h"
+#include "dali/core/util.h"
+
+namespace dali {
+namespace mm {
+
+namespace {
+
+size_t PageSize() {
+  static const size_t page_size = sysconf(_SC_PAGESIZE);
+  return page_size;
+}
+
+}  // namespace
+
+bool numa_node_memory_resource::owns(const void *ptr) const {
+  auto addr = reinterpret_cast<uintptr_t>(ptr);
+  std::lock_guard<std::mutex> g(mtx_);
+  auto it = blocks_.upper_bound(addr);
+  if (it == blocks_.begin())
+    return false;
+  --it;
+  return addr < it->second;
+}
+
+void *numa_node_memory_resource::do_allocate(size_t bytes, size_t alignment) {
+  if (bytes == 0)
+    return nullptr;
+  size_t page = PageSize();
+  size_t size = align_up(bytes, page);
+  // over-allocate to satisfy alignments larger than a page and trim the excess
+  size_t extra = alignment > page ? alignment - page : 0;
+  void *mem = mmap(nullptr, size + extra, PROT_READ | PROT_WRITE,
+                   MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+  if (mem == MAP_FAILED)
+    throw std::bad_alloc();
+  char *base = static_cast<char *>(mem);
+  char *start = static_cast<char *>(detail::align_ptr(base, std::max(alignment, page)));
+  if (start > base)
+    munmap(base, start - base);
+  if (base + extra > start)
+    munmap(start + size, base + extra - start);
+
+  // The binding is a hint - if it fails, the memory is still usable.
+  numa::BindMemory(start, size, node_);
+
+  std::lock_guard<std::mutex> g(mtx_);
+  auto addr = reinterpret_cast<uintptr_t>(start);
+  blocks_[addr] = addr + size;
+  return start;
+}
+
+void numa_node_memory_resource::do_deallocate(void *ptr, size_t bytes, size_t alignment) {
+  if (!ptr)
+    return;
+  size_t size = align_up(bytes, PageSize());
+  {
+    std::lock_guard<std::mutex> g(mtx_);
+    blocks_.erase(reinterpret_cast<uintptr_t>(ptr));
+  }
+  munmap(ptr, size);
+}
+
+numa_host_memory_resource::numa_host_memory_resource(
+      std::shared_ptr<host_memory_resource> small, size_t pool_threshold)
+: small_(std::move(small)), pool_threshold_(pool_threshold) {
+  int num_nodes = numa::NumNodes();
+  nodes_.resize(num_nodes);
+  for (int i = 0; i < num_nodes; i++) {
+    nodes_[i].upstream = std::make_unique<numa_node_memory_resource>(i);
+    nodes_[i].pool = std::make_unique<pool_t>(nodes_[i].upstream.get());
+  }
+}
+
+numa_host_memory_resource::~numa_host_memory_resource() = default;
+
+void *numa_host_memory_resource::do_allocate(size_t bytes, size_t alignment) {
+  if (bytes == 0)
+    return nullptr;
+  if (!use_pool(bytes))
+    return small_->allocate(bytes, alignment);
+  int node = numa::CurrentNode();
+  assert(node >= 0 && node < num_nodes());
+  return nodes_[node].pool->allocate(bytes, alignment);
+}
+
+void numa_host_memory_resource::do_deallocate(void *ptr, size_t bytes, size_t alignment) {
+  if (!ptr)
+    return;
+  // The memory may be freed by a thread running on a different node than the one which
+  // allocated it - find the owner.
+  Node *n = use_pool(bytes) ? NodeOf(ptr) : nullptr;
+  if (n)
+    n->pool->deallocate(ptr, bytes, alignment);
+  else
+    small_->deallocate(ptr, bytes, alignment);
+}
+
+numa_host_memory_resource::Node *numa_host_memory_resource::NodeOf(void *ptr) {
+  // Try the current node first - most of the memory is freed where it was allocated
+  int current = numa::CurrentNode();
+  if (nodes_[current].upstream->owns(ptr))
+    return &nodes_[current];
+  for (auto &n : nodes_)
+    if (n.upstream->owns(ptr))
+      return &n;
+  return nullptr;
+}
+
+}  // namespace mm
+}  // namespace dali
@@ -0,0 +1,108 @@
+// Copyright (c) 2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <thread>
+#include <utility>
+#include <vector>
+#include "dali/core/mm/detail/align.h"
+#include "dali/core/mm/numa_resource.h"
+#include "dali/core/os/numa.h"
+#include "dali/core/util.h"
+
+namespace dali {
+namespace mm {
+namespace test {
+
+TEST(MMNumaResource, NodeResource) {
+  numa_node_memory_resource res(numa::CurrentNode());
+  void *p1 = res.allocate(100);
+  void *p2 = res.allocate(3 << 20, 1 << 20);
+  ASSERT_NE(p1, nullptr);
+  ASSERT_NE(p2, nullptr);
+  EXPECT_TRUE(detail::is_aligned(p2, 1 << 20));
+  memset(p1, 1, 100);
+  memset(p2, 2, 3 << 20);
+  EXPECT_TRUE(res.owns(p1));
+  EXPECT_TRUE(res.owns(static_cast<char *>(p2) + (3 << 20) - 1));
+  EXPECT_FALSE(res.owns(static_cast<char *>(p2) + (3 << 20)));
+  int local = 0;
+  EXPECT_FALSE(res.owns(&local));
+  res.deallocate(p1, 100);
+  EXPECT_FALSE(res.owns(p1));
+  res.deallocate(p2, 3 << 20, 1 << 20);
+  EXPECT_EQ(res.allocate(0), nullptr);
+}
+
+namespace {
+
+/** A malloc-based resource which counts the allocations it serves. */
+class counting_resource : public host_memory_resource {
+ public:
+  int outstanding = 0;
+
+ private:
+  void *do_allocate(size_t bytes, size_t alignment) override {
+    outstanding++;
+    return aligned_alloc(alignment, align_up(bytes, alignment));
+  }
+
+  void do_deallocate(void *ptr, size_t, size_t) override {
+    outstanding--;
+    free(ptr);
+  }
+
+  bool do_is_equal(const host_memory_resource &other) const noexcept override {
+    return this == &other;
+  }
+};
+
+}  // namespace
+
+TEST(MMNumaResource, HostResource) {
+  auto small = std::make_shared<counting_resource>();
+  // a large block allocated before the NUMA resource existed
+  void *foreign = small->allocate(5 << 20, 64);
+  {
+    numa_host_memory_resource res(small, 1 << 20);
+    EXPECT_EQ(res.num_nodes(), numa::NumNodes());
+    std::vector<std::pair<void *, size_t>> allocs;
+    for (size_t size : { 16, 1000, 65536, 1 << 20, (1 << 20) + 1, 5 << 20 }) {
+      void *p = res.allocate(size, 64);
+      ASSERT_NE(p, nullptr);
+      EXPECT_TRUE(detail::is_aligned(p, 64));
+      memset(p, 0xaa, size);
+      allocs.emplace_back(p, size);
+    }
+    // the allocations up to the threshold go to the small resource, like in the default one
+    EXPECT_EQ(small->outstanding, 5);
+    // free from another thread, possibly running on another node
+    std::thread t([&]() {
+      std::vector<int> cpus = { numa::ProcessCpus().back() };
+      numa::SetThreadAffinity(make_cspan(cpus));
+      for (auto &[p, size] : allocs)
+        res.deallocate(p, size, 64);
+      res.deallocate(foreign, 5 << 20, 64);
+    });
+    t.join();
+  }
+  EXPECT_EQ(small->outstanding, 0);
+}
+
+}  // namespace test
+}  // namespace mm
+}  // namespace dali
@@ -0,0 +1,203 @@
+// Copyright (c) 2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "dali/core/os/numa.h"
+#include <linux/mempolicy.h>
+#include <pthread.h>
+#include <sched.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#include <algorithm>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <map>
+#include "dali/core/error_handling.h"
+#include "dali/core/format.h"
+
+namespace dali {
+namespace numa {
+
+std::vector<int> ParseCpuList(const std::string &list) {
+  std::vector<int> cpus;
+  size_t pos = 0;
+  while (pos < list.size()) {
+    size_t end = list.find(',', pos);
+    if (end == std::string::npos)
+      end = list.size();
+    std::string range = list.substr(pos, end - pos);
+    pos = end + 1;
+    if (range.find_first_not_of(" \t\n") == std::string::npos)
+      continue;
+    size_t dash = range.find('-');
+    int first = std::stoi(range.substr(0, dash));
+    int last = dash == std::string::npos ? first : std::stoi(range.substr(dash + 1));
+    for (int cpu = first; cpu <= last; cpu++)
+      cpus.push_back(cpu);
+  }
+  return cpus;
+}
+
+namespace {
+
+struct Topology {
+  std::vector<std::vector<int>> node_cpus;
+  std::vector<int> cpu_node;
+
+  Topology() {
+    namespace fs = std::filesystem;
+    std::map<int, std::vector<int>> nodes;
+    std::error_code ec;
+    for (auto &entry : fs::directory_iterator("/sys/devices/system/node", ec)) {
+      std::string name = entry.path().filename().string();
+      if (name.rfind("node", 0) != 0 || name.size() == 4 ||
+          name.find_first_not_of("0123456789", 4) != std::string::npos)
+        continue;
+      std::ifstream f(entry.path() / "cpulist");
+      std::string list;
+      std::getline(f, list);
+      try {
+        nodes[std::stoi(name.substr(4))] = ParseCpuList(list);
+      } catch (std::exception &) {
+        continue;
+      }
+    }
+
+    if (nodes.empty()) {  // no NUMA information - one node with all the CPUs
+      int ncpus = std::max<int>(sysconf(_SC_NPROCESSORS_CONF), 1);
+      nodes[0].resize(ncpus);
+      for (int i = 0; i < ncpus; i++)
+        nodes[0][i] = i;
+    }
+
+    node_cpus.resize(nodes.rbegin()->first + 1);
+    for (auto &[node, cpus] : nodes) {
+      std::sort(cpus.begin(), cpus.end());
+      for (int cpu : cpus) {
+        if (cpu >= static_cast<int>(cpu_node.size()))
+          cpu_node.resize(cpu + 1, -1);
+        cpu_node[cpu] = node;
+      }
+      node_cpus[node] = std::move(cpus);
+    }
+  }
+
+  static const Topology &get() {
+    static Topology topology;
+    return topology;
+  }
+};
+
+std::vector<int> ToVector(const cpu_set_t &set) {
+  std::vector<int> cpus;
+  for (int i = 0; i < CPU_SETSIZE; i++)
+    if (CPU_ISSET(i, &set))
+      cpus.push_back(i);
+  return cpus;
+}
+
+// Captures the affinity of the process when the library is loaded, before anything is pinned.
+const std::vector<int> &g_process_cpus = ProcessCpus();
+
+}  // namespace
+
+const std::vector<int> &ProcessCpus() {
+  static const std::vector<int> cpus = GetThreadAffinity();
+  return cpus;
+}
+
+int NumNodes() {
+  return Topology::get().node_cpus.size();
+}
+
+const std::vector<int> &NodeCpus(int node) {
+  static const std::vector<int> empty;
+  auto &topology = Topology::get();
+  if (node < 0 || node >= static_cast<int>(topology.node_cpus.size()))
+    return empty;
+  return topology.node_cpus[node];
+}
+
+int NodeOfCpu(int cpu) {
+  auto &topology = Topology::get();
+  if (cpu < 0 || cpu >= static_cast<int>(topology.cpu_node.size()))
+    return -1;
+  return topology.cpu_node[cpu];
+}
+
+int NodeOfCpus(span<const int> cpus) {
+  std::vector<int> count(NumNodes());
+  for (int cpu : cpus) {
+    int node = NodeOfCpu(cpu);
+    if (node >= 0)
+      count[node]++;
+  }
+  auto it = std::max_element(count.begin(), count.end());
+  return it == count.end() || *it == 0 ? -1 : it - count.begin();
+}
+
+int CurrentNode() {
+  return std::max(NodeOfCpu(sched_getcpu()), 0);
+}
+
+bool BindMemory(void *addr, size_t size, int node) {
+  if (node < 0 || node >= NumNodes())
+    return false;
+  constexpr int kBitsPerWord = 8 * sizeof(unsigned long);  // NOLINT(runtime/int)
+  std::vector<unsigned long> mask(node / kBitsPerWord + 1);  // NOLINT(runtime/int)
+  mask[node / kBitsPerWord] = 1ul << (node % kBitsPerWord);
+  // the kernel expects the number of bits + 1
+  unsigned long maxnode = mask.size() * kBitsPerWord + 1;  // NOLINT(runtime/int)
+  return syscall(SYS_mbind, addr, size, MPOL_PREFERRED, mask.data(), maxnode, 0) == 0;
+}
+
+std::vector<int> GetThreadAffinity() {
+  cpu_set_t set;
+  CPU_ZERO(&set);
+  if (pthread_getaffinity_np(pthread_self(), sizeof(set), &set) != 0)
+    return {};
+  return ToVector(set);
+}
+
+void SetThreadAffinity(span<const int> cpus) {
+  cpu_set_t set;
+  CPU_ZERO(&set);
+  for (int cpu : cpus) {
+    DALI_ENFORCE(cpu >= 0 && cpu < CPU_SETSIZE, make_string("Invalid CPU index: ", cpu));
+    CPU_SET(cpu, &set);
+  }
+  int err = pthread_setaffinity_np(pthread_self(), sizeof(set), &set);
+  DALI_ENFORCE(err == 0, make_string("Cannot set the CPU affinity of a thread: ",
+                                     std::strerror(err)));
+}
+
+ScopedThreadAffinity::ScopedThreadAffinity(span<const int> cpus) {
+  if (cpus.empty())
+    return;
+  prev_ = GetThreadAffinity();
+  SetThreadAffinity(cpus);
+}
+
+ScopedThreadAffinity::~ScopedThreadAffinity() {
+  if (prev_.empty())
+    return;
+  try {
+    SetThreadAffinity(make_cspan(prev_));
+  } catch (const std::exception &e) {
+    DALI_WARN("Cannot restore the CPU affinity of a thread: ", e.what());
+  }
+}
+
+}  // namespace numa
+}  // namespace dali
@@ -0,0 +1,85 @@
+// Copyright (c) 2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "dali/core/os/numa.h"
+#include <gtest/gtest.h>
+#include <sys/mman.h>
+#include <cerrno>
+#include <thread>
+#include <vector>
+
+namespace dali {
+namespace numa {
+namespace test {
+
+TEST(Numa, ParseCpuList) {
+  EXPECT_EQ(ParseCpuList("0-3,8,10-11\n"), (std::vector<int>{0, 1, 2, 3, 8, 10, 11}));
+  EXPECT_EQ(ParseCpuList("5"), (std::vector<int>{5}));
+  EXPECT_TRUE(ParseCpuList("\n").empty());
+}
+
+TEST(Numa, Topology) {
+  ASSERT_GE(NumNodes(), 1);
+  ASSERT_FALSE(ProcessCpus().empty());
+  for (int cpu : ProcessCpus()) {
+    int node = NodeOfCpu(cpu);
+    ASSERT_GE(node, 0);
+    ASSERT_LT(node, NumNodes());
+    auto &cpus = NodeCpus(node);
+    EXPECT_NE(std::find(cpus.begin(), cpus.end(), cpu), cpus.end());
+  }
+  EXPECT_EQ(NodeOfCpus(make_cspan(NodeCpus(NodeOfCpu(ProcessCpus()[0])))),
+            NodeOfCpu(ProcessCpus()[0]));
+  EXPECT_EQ(NodeOfCpus({}), -1);
+  EXPECT_TRUE(NodeCpus(-1).empty());
+  EXPECT_TRUE(NodeCpus(NumNodes()).empty());
+}
+
+TEST(Numa, ScopedThreadAffinity) {
+  auto original = GetThreadAffinity();
+  ASSERT_FALSE(original.empty());
+  std::vector<int> one_cpu = { original.back() };
+  {
+    ScopedThreadAffinity scoped(make_cspan(one_cpu));
+    EXPECT_EQ(GetThreadAffinity(), one_cpu);
+    EXPECT_EQ(CurrentNode(), NodeOfCpu(one_cpu[0]));
+    // the affinity is inherited by the new threads
+    std::vector<int> thread_affinity;
+    std::thread t([&]() { thread_affinity = GetThreadAffinity(); });
+    t.join();
+    EXPECT_EQ(thread_affinity, one_cpu);
+  }
+  EXPECT_EQ(GetThreadAffinity(), original);
+  {
+    ScopedThreadAffinity no_op({});
+    EXPECT_EQ(GetThreadAffinity(), original);
+  }
+}
+
+TEST(Numa, BindMemory) {
+  size_t size = 4 << 20;
+  void *mem = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+  ASSERT_NE(mem, MAP_FAILED);
+  bool bound = BindMemory(mem, size, CurrentNode());
+  if (!bound) {  // a kernel without NUMA support or a restricted container
+    EXPECT_TRUE(errno == ENOSYS || errno == EPERM) << "errno: " << errno;
+  }
+  EXPECT_FALSE(BindMemory(mem, size, NumNodes()));
+  static_cast<char *>(mem)[size - 1] = 1;
+  munmap(mem, size);
+}
+
+}  // namespace test
+}  // namespace numa
+}  // namespace dali
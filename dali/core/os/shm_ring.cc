@@ -0,0 +1,355 @@
+// Copyright (c) 2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "dali/core/os/shm_ring.h"
+#include <fcntl.h>
+#include <linux/futex.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <limits>
+#include <utility>
+#include "dali/core/format.h"
+#include "dali/core/util.h"
+
+namespace dali {
+namespace shm_ring {
+
+namespace {
+
+// The waits are sliced, so that the flags which are not guarded by the futex word
+// (closing, interruption) are noticed even if their wake-up is missed.
+constexpr std::chrono::microseconds kMaxWaitSlice = std::chrono::milliseconds(10);
+
+/** Waits while `*word == expected`, up to `timeout`; the futex is shared between processes. */
+void FutexWait(std::atomic<uint32_t> *word, uint32_t expected, std::chrono::microseconds timeout) {
+  auto us = timeout.count();
+  timespec ts;
+  ts.tv_sec = us / 1000000;
+  ts.tv_nsec = (us % 1000000) * 1000;
+  syscall(SYS_futex, reinterpret_cast<uint32_t *>(word), FUTEX_WAIT, expected, &ts, nullptr, 0);
+}
+
+void FutexWakeAll(std::atomic<uint32_t> *word) {
+  syscall(SYS_futex, reinterpret_cast<uint32_t *>(word), FUTEX_WAKE, INT32_MAX, nullptr,
+          nullptr, 0);
+}
+
+/**
+ * Waits until the predicate is satisfied, the wait is interrupted or the timeout elapses.
+ * Returns the value of the predicate.
+ */
+template <typename Predicate, typename Interrupted>
+bool WaitFor(std::atomic<uint32_t> *word, std::chrono::microseconds timeout,
+             Predicate &&pred, Interrupted &&interrupted) {
+  using clock = std::chrono::steady_clock;
+  bool infinite = timeout == std::chrono::microseconds::max();
+  auto deadline = infinite ? clock::time_point::max() : clock::now() + timeout;
+  for (;;) {
+    uint32_t value = word->load(std::memory_order_acquire);
+    if (pred())
+      return true;
+    if (interrupted())
+      return false;
+    auto slice = kMaxWaitSlice;
+    if (!infinite) {
+      auto now = clock::now();
+      if (now >= deadline)
+        return false;
+      slice = std::min(slice, std::chrono::duration_cast<std::chrono::microseconds>(
+                                  deadline - now));
+    }
+    FutexWait(word, value, slice);
+  }
+}
+
+// The ring carries only numeric types - the core library doesn't depend on the type table.
+// Returns 0 for the types which can't be stored in the ring.
+size_t ElementSize(daliDataType_t type) {
+  switch (type) {
+    case DALI_UINT8:
+    case DALI_INT8:
+    case DALI_BOOL:
+      return 1;
+    case DALI_UINT16:
+    case DALI_INT16:
+    case DALI_FLOAT16:
+      return 2;
+    case DALI_UINT32:
+    case DALI_INT32:
+    case DALI_FLOAT:
+      return 4;
+    case DALI_UINT64:
+    case DALI_INT64:
+    case DALI_FLOAT64:
+      return 8;
+    default:
+      return 0;
+  }
+}
+
+size_t CheckedElementSize(daliDataType_t type) {
+  size_t size = ElementSize(type);
+  DALI_ENFORCE(size > 0, make_string("Unsupported type of ring data: ", static_cast<int>(type)));
+  return size;
+}
+
+}  // namespace
+
+Producer::Producer(std::string name, int num_slots, uint64_t slot_size) {
+  DALI_ENFORCE(num_slots > 0, "The ring must have at least one slot.");
+  DALI_ENFORCE(slot_size > sizeof(SlotHeader), make_string("The slot size is too small: ",
+                                                          slot_size));
+  name_ = std::move(name);
+  slot_size = align_up(slot_size, kDataAlignment);
+  uint64_t slots_offset = align_up(sizeof(RingHeader), 4096);
+  uint64_t total_size = slots_offset + num_slots * slot_size;
+
+  int fd = shm_open(name_.c_str(), O_CREAT | O_EXCL | O_RDWR, S_IRUSR | S_IWUSR);
+  POSIX_CHECK_STATUS_EX(fd, "shm_open", make_string("Cannot create the ring \"", name_, "\"."));
+  try {
+    if (ftruncate(fd, total_size) != 0) {
+      int e = errno;
+      ::close(fd);
+      errno = e;
+      POSIX_CHECK_STATUS_EX(-1, "ftruncate", "Failed to resize shared memory.");
+    }
+    shm_ = std::make_unique<SharedMem>(fd, total_size);  // takes over the descriptor
+  } catch (...) {
+    shm_unlink(name_.c_str());
+    throw;
+  }
+  shm_->close_handle();
+
+  auto *h = header();
+  new (h) RingHeader();
+  h->num_slots = num_slots_ = num_slots;
+  h->slot_size = slot_size_ = slot_size;
+  h->slots_offset = slots_offset_ = slots_offset;
+  h->head.store(0, std::memory_order_relaxed);
+  h->tail.store(0, std::memory_order_relaxed);
+  h->closed.store(0, std::memory_order_relaxed);
+  h->version = kVersion;
+  // the magic is written last - a consumer which sees it can use the header
+  std::atomic_thread_fence(std::memory_order_release);
+  h->magic = kMagic;
+}
+
+Producer::~Producer() {
+  if (shm_) {
+    Close();
+    shm_unlink(name_.c_str());
+  }
+}
+
+int Producer::free_slots() const {
+  auto *h = header();
+  uint32_t used = h->head.load(std::memory_order_relaxed) -
+                  h->tail.load(std::memory_order_acquire);
+  return num_slots_ - used;
+}
+
+bool Producer::WaitForSlot(std::chrono::microseconds timeout) {
+  return WaitFor(&header()->tail, timeout,
+                 [&]() { return free_slots() > 0; },
+                 []() { return false; });
+}
+
+uint8_t *Producer::BeginWrite(const TensorListShape<> &shape, daliDataType_t type,
+                              const TensorLayout &layout) {
+  DALI_ENFORCE(!writing_, "The previous batch hasn't been published.");
+  DALI_ENFORCE(free_slots() > 0, "The ring is full.");
+  DALI_ENFORCE(shape.sample_dim() <= kMaxNdim, make_string(
+      "Too many dimensions: ", shape.sample_dim(), ". The maximum is ", kMaxNdim, "."));
+  DALI_ENFORCE(layout.empty() || layout.ndim() == shape.sample_dim(),
+               make_string("The layout \"", layout, "\" doesn't match the number of dimensions: ",
+                           shape.sample_dim()));
+  int N = shape.num_samples(), ndim = shape.sample_dim();
+  uint64_t data_size = shape.num_elements() * CheckedElementSize(type);
+  uint64_t required = RequiredSlotSize(N, ndim, data_size);
+  DALI_ENFORCE(required <= slot_size(), make_string(
+      "The batch doesn't fit in a slot of the ring. Required: ", required, " bytes, slot size: ",
+      slot_size(), " bytes."));
+
+  uint8_t *s = slot(header()->head.load(std::memory_order_relaxed));
+  auto *sh = reinterpret_cast<SlotHeader *>(s);
+  sh->num_samples = N;
+  sh->ndim = ndim;
+  sh->type = type;
+  memset(sh->layout, 0, sizeof(sh->layout));
+  memcpy(sh->layout, layout.c_str(), layout.size());
+  sh->data_offset = DataOffset(N, ndim);
+  sh->data_size = data_size;
+  memcpy(s + sizeof(SlotHeader), shape.shapes.data(), sizeof(int64_t) * N * ndim);
+  writing_ = true;
+  return s + sh->data_offset;
+}
+
+void Producer::Publish() {
+  DALI_ENFORCE(writing_, "There's no batch to publish - call BeginWrite first.");
+  writing_ = false;
+  header()->head.fetch_add(1, std::memory_order_release);
+  FutexWakeAll(&header()->head);
+}
+
+bool Producer::Push(const void *data, const TensorListShape<> &shape, daliDataType_t type,
+                    const TensorLayout &layout, std::chrono::microseconds timeout) {
+  if (!WaitForSlot(timeout))
+    return false;
+  uint8_t *dst = BeginWrite(shape, type, layout);
+  memcpy(dst, data, shape.num_elements() * CheckedElementSize(type));
+  Publish();
+  return true;
+}
+
+void Producer::Close() {
+  header()->closed.store(1, std::memory_order_release);
+  FutexWakeAll(&header()->head);
+}
+
+Consumer::Consumer(std::string name) {
+  name_ = std::move(name);
+  int fd = shm_open(name_.c_str(), O_RDWR, 0);
+  POSIX_CHECK_STATUS_EX(fd, "shm_open", make_string("Cannot open the ring \"", name_, "\"."));
+  struct stat st;
+  if (fstat(fd, &st) != 0 || static_cast<size_t>(st.st_size) < sizeof(RingHeader)) {
+    ::close(fd);
+    DALI_FAIL(make_string("\"", name_, "\" is not a valid ring."));
+  }
+  shm_ = std::make_unique<SharedMem>(fd, st.st_size);
+  shm_->close_handle();
+  auto *h = header();
+  DALI_ENFORCE(h->magic == kMagic, make_string("\"", name_, "\" is not a valid ring."));
+  std::atomic_thread_fence(std::memory_order_acquire);
+  DALI_ENFORCE(h->version == kVersion, make_string("Unsupported ring version: ", h->version,
+                                                  ". Expected: ", kVersion));
+  uint64_t size = st.st_size;
+  DALI_ENFORCE(h->num_slots > 0 && h->slot_size > sizeof(SlotHeader) &&
+               h->slots_offset >= sizeof(RingHeader) && h->slots_offset <= size,
+               make_string("\"", name_, "\" is not a valid ring."));
+  DALI_ENFORCE(h->slot_size <= (size - h->slots_offset) / h->num_slots,
+               make_string("The ring \"", name_, "\" is truncated."));
+  num_slots_ = h->num_slots;
+  slot_size_ = h->slot_size;
+  slots_offset_ = h->slots_offset;
+  released_.resize(num_slots_);
+}
+
+bool Consumer::closed() const {
+  return header()->closed.load(std::memory_order_acquire);
+}
+
+bool Consumer::WaitForBatch(uint32_t seq, std::chrono::microseconds timeout) {
+  auto *h = header();
+  auto published = [&]() {
+    // wrap-around safe "head > seq"
+    return static_cast<int32_t>(h->head.load(std::memory_order_acquire) - seq) > 0;
+  };
+  bool ready = WaitFor(&h->head, timeout, published, [&]() {
+    return interrupted_.load() || closed();
+  });
+  // the batches published before closing are still available
+  return ready || published();
+}
+
+BatchView Consumer::Get(uint32_t seq) const {
+  uint8_t *s = slot(seq);
+  // The slot is written by another process - validate a copy of the header and the shapes,
+  // so that they can't change after the validation.
+  SlotHeader sh;
+  memcpy(&sh, s, sizeof(SlotHeader));
+  auto check = [&](bool condition, const char *what) {
+    if (!condition)
+      DALI_FAIL(make_string("Corrupted batch ", seq, " in the ring \"", name_, "\": ", what, "."));
+  };
+  check(sh.ndim >= 0 && sh.ndim <= kMaxNdim, "invalid number of dimensions");
+  check(sh.num_samples <= static_cast<uint32_t>(std::numeric_limits<int>::max()),
+        "invalid number of samples");
+  uint64_t max_extents = (slot_size() - sizeof(SlotHeader)) / sizeof(int64_t);
+  check(static_cast<uint64_t>(sh.num_samples) * sh.ndim <= max_extents,
+        "the shapes don't fit in the slot");
+  check(sh.data_offset >= DataOffset(sh.num_samples, sh.ndim), "the data overlaps the shapes");
+  check(sh.data_offset <= slot_size() && sh.data_size <= slot_size() - sh.data_offset,
+        "the data doesn't fit in the slot");
+  auto type = static_cast<daliDataType_t>(sh.type);
+  size_t element_size = ElementSize(type);
+  check(element_size > 0, "unsupported type");
+  size_t layout_len = strnlen(sh.layout, sizeof(sh.layout));
+  check(layout_len <= static_cast<size_t>(TensorLayout::max_ndim), "invalid layout");
+
+  BatchView view;
+  view.seq = seq;
+  view.type = type;
+  view.layout = TensorLayout(sh.layout, layout_len);
+  view.shape.resize(sh.num_samples, sh.ndim);
+  memcpy(view.shape.shapes.data(), s + sizeof(SlotHeader),
+         sizeof(int64_t) * sh.num_samples * sh.ndim);
+  // The volume is accumulated with a bound, so that it can't overflow
+  uint64_t max_elements = sh.data_size / element_size;
+  uint64_t num_elements = 0;
+  for (int i = 0; i < view.shape.num_samples(); i++) {
+    auto sample_shape = view.shape.tensor_shape_span(i);
+    uint64_t volume = 1;
+    for (int64_t extent : sample_shape) {
+      check(extent >= 0, "negative extent");
+      if (extent == 0)
+        volume = 0;
+    }
+    for (int64_t extent : sample_shape) {
+      if (volume == 0)
+        break;
+      check(volume <= max_elements / extent, "the shape doesn't match the data size");
+      volume *= extent;
+    }
+    num_elements += volume;
+    check(num_elements <= max_elements, "the shape doesn't match the data size");
+  }
+  check(num_elements * element_size == sh.data_size, "the shape doesn't match the data size");
+  view.data = s + sh.data_offset;
+  view.size = sh.data_size;
+  return view;
+}
+
+void Consumer::Release(uint32_t seq) {
+  auto *h = header();
+  std::lock_guard<std::mutex> g(release_mtx_);
+  released_[seq % num_slots_] = 1;
+  uint32_t tail = h->tail.load(std::memory_order_relaxed);
+  uint32_t head = h->head.load(std::memory_order_acquire);
+  uint32_t new_tail = tail;
+  while (new_tail != head && released_[new_tail % num_slots_]) {
+    released_[new_tail % num_slots_] = 0;
+    new_tail++;
+  }
+  if (new_tail != tail) {
+    h->tail.store(new_tail, std::memory_order_release);
+    FutexWakeAll(&h->tail);
+  }
+}
+
+void Consumer::Interrupt() {
+  interrupted_ = true;
+  FutexWakeAll(&header()->head);
+}
+
+uint32_t Consumer::first_unreleased() const {
+  return header()->tail.load(std::memory_order_acquire);
+}
+
+}  // namespace shm_ring
+}  // namespace dali
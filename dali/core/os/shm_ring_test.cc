@@ -0,0 +1,203 @@
+// Copyright (c) 2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "dali/core/os/shm_ring.h"
+#include <gtest/gtest.h>
+#include <unistd.h>
+#include <cstring>
+#include <numeric>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace dali {
+namespace shm_ring {
+namespace test {
+
+namespace {
+
+std::string UniqueName(const char *suffix) {
+  return make_string("/dali_shm_ring_test_", getpid(), "_", suffix);
+}
+
+}  // namespace
+
+TEST(ShmRing, Roundtrip) {
+  Producer producer(UniqueName("roundtrip"), 2, 1 << 16);
+  Consumer consumer(producer.name());
+  EXPECT_EQ(consumer.num_slots(), 2);
+  EXPECT_EQ(consumer.slot_size(), producer.slot_size());
+
+  TensorListShape<> shape = {{ 2, 3 }, { 4, 1 }};
+  std::vector<float> data(shape.num_elements());
+  std::iota(data.begin(), data.end(), 0.0f);
+  ASSERT_TRUE(producer.Push(data.data(), shape, DALI_FLOAT, "HW"));
+
+  ASSERT_TRUE(consumer.WaitForBatch(0, std::chrono::seconds(1)));
+  BatchView batch = consumer.Get(0);
+  EXPECT_EQ(batch.seq, 0u);
+  EXPECT_EQ(batch.shape, shape);
+  EXPECT_EQ(batch.type, DALI_FLOAT);
+  EXPECT_EQ(batch.layout, "HW");
+  EXPECT_EQ(batch.size, data.size() * sizeof(float));
+  EXPECT_EQ(reinterpret_cast<uintptr_t>(batch.data) % kDataAlignment, 0u);
+  EXPECT_EQ(memcmp(batch.data, data.data(), batch.size), 0);
+  consumer.Release(0);
+  EXPECT_EQ(consumer.first_unreleased(), 1u);
+}
+
+TEST(ShmRing, Backpressure) {
+  Producer producer(UniqueName("backpressure"), 2, 4096);
+  Consumer consumer(producer.name());
+  TensorListShape<> shape = {{ 16 }};
+  std::vector<uint8_t> data(16);
+  EXPECT_EQ(producer.free_slots(), 2);
+  EXPECT_TRUE(producer.Push(data.data(), shape, DALI_UINT8));
+  EXPECT_TRUE(producer.Push(data.data(), shape, DALI_UINT8));
+  EXPECT_EQ(producer.free_slots(), 0);
+  EXPECT_FALSE(producer.WaitForSlot(std::chrono::milliseconds(20)));
+  EXPECT_FALSE(producer.Push(data.data(), shape, DALI_UINT8, "",
+                             std::chrono::milliseconds(20)));
+  EXPECT_THROW(producer.BeginWrite(shape, DALI_UINT8), std::exception);
+
+  consumer.Release(0);
+  EXPECT_EQ(producer.free_slots(), 1);
+  EXPECT_TRUE(producer.WaitForSlot(std::chrono::milliseconds(20)));
+}
+
+TEST(ShmRing, OutOfOrderRelease) {
+  Producer producer(UniqueName("out_of_order"), 3, 4096);
+  Consumer consumer(producer.name());
+  TensorListShape<> shape = {{ 4 }};
+  int32_t data[4] = {};
+  for (int i = 0; i < 3; i++)
+    ASSERT_TRUE(producer.Push(data, shape, DALI_INT32));
+
+  consumer.Release(2);
+  consumer.Release(1);
+  EXPECT_EQ(consumer.first_unreleased(), 0u);
+  EXPECT_EQ(producer.free_slots(), 0);
+  consumer.Release(0);
+  EXPECT_EQ(consumer.first_unreleased(), 3u);
+  EXPECT_EQ(producer.free_slots(), 3);
+}
+
+TEST(ShmRing, SlotTooSmall) {
+  Producer producer(UniqueName("too_small"), 1, 256);
+  TensorListShape<> shape = {{ 1024 }};
+  EXPECT_GE(producer.data_capacity(1, 1), 64u);
+  EXPECT_LT(producer.data_capacity(1, 1), 1024u);
+  EXPECT_THROW(producer.BeginWrite(shape, DALI_UINT8), std::exception);
+}
+
+TEST(ShmRing, CorruptedSlotHeader) {
+  Producer producer(UniqueName("corrupted"), 1, 4096);
+  Consumer consumer(producer.name());
+  TensorListShape<> shape = {{ 2, 3 }, { 4, 1 }};
+  uint8_t *data = producer.BeginWrite(shape, DALI_INT32, "HW");
+  producer.Publish();
+  // the producer's and the consumer's mappings are the same memory
+  auto *sh = reinterpret_cast<SlotHeader *>(data - DataOffset(2, 2));
+  auto *extents = reinterpret_cast<int64_t *>(sh + 1);
+  const SlotHeader valid = *sh;
+  EXPECT_NO_THROW(consumer.Get(0));
+
+  auto expect_rejected = [&](auto &&corrupt) {
+    corrupt();
+    EXPECT_THROW(consumer.Get(0), std::exception);
+    *sh = valid;
+    extents[0] = 2;
+  };
+  expect_rejected([&]() { sh->ndim = -1; });
+  expect_rejected([&]() { sh->ndim = kMaxNdim + 1; });
+  expect_rejected([&]() { sh->num_samples = 1000; });
+  expect_rejected([&]() { sh->data_offset = sizeof(SlotHeader); });
+  expect_rejected([&]() { sh->data_size = ~uint64_t(0) - sh->data_offset + 1; });
+  expect_rejected([&]() { sh->data_size += 4; });
+  expect_rejected([&]() { sh->type = DALI_STRING; });
+  expect_rejected([&]() { sh->type = 12345; });
+  expect_rejected([&]() { extents[0] = -2; });
+  expect_rejected([&]() { extents[0] = int64_t(1) << 62; });
+  EXPECT_NO_THROW(consumer.Get(0));
+}
+
+TEST(ShmRing, CloseAndInterrupt) {
+  Producer producer(UniqueName("close"), 2, 4096);
+  Consumer consumer(producer.name());
+  TensorListShape<> shape = {{ 1 }};
+  uint8_t x = 42;
+  ASSERT_TRUE(producer.Push(&x, shape, DALI_UINT8));
+
+  std::thread interrupter([&]() {
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    consumer.Interrupt();
+  });
+  EXPECT_FALSE(consumer.WaitForBatch(1));
+  interrupter.join();
+
+  producer.Close();
+  EXPECT_TRUE(consumer.closed());
+  // the batches published before closing can still be read
+  EXPECT_TRUE(consumer.WaitForBatch(0));
+  EXPECT_EQ(*consumer.Get(0).data, 42);
+}
+
+TEST(ShmRing, InvalidRing) {
+  EXPECT_THROW(Consumer(UniqueName("does_not_exist")), std::exception);
+  Producer producer(UniqueName("duplicate"), 1, 4096);
+  EXPECT_THROW(Producer(producer.name(), 1, 4096), std::exception);
+}
+
+TEST(ShmRing, Stream) {
+  constexpr int kNumBatches = 1000;
+  Producer producer(UniqueName("stream"), 4, 4096);
+  Consumer consumer(producer.name());
+
+  std::thread producer_thread([&]() {
+    for (int i = 0; i < kNumBatches; i++) {
+      TensorListShape<> shape = {{ 1 + i % 7 }};
+      ASSERT_TRUE(producer.WaitForSlot());
+      auto *dst = reinterpret_cast<int32_t *>(producer.BeginWrite(shape, DALI_INT32));
+      for (int j = 0; j < shape[0][0]; j++)
+        dst[j] = i + j;
+      producer.Publish();
+    }
+    producer.Close();
+  });
+
+  // the batches are released with a delay of one, from another thread
+  std::vector<std::thread> releasers;
+  int n = 0;
+  for (uint32_t seq = 0; consumer.WaitForBatch(seq); seq++, n++) {
+    BatchView batch = consumer.Get(seq);
+    ASSERT_EQ(batch.shape[0][0], 1 + n % 7);
+    auto *src = reinterpret_cast<const int32_t *>(batch.data);
+    for (int j = 0; j < batch.shape[0][0]; j++)
+      ASSERT_EQ(src[j], n + j);
+    releasers.emplace_back([&consumer, seq]() { consumer.Release(seq); });
+    if (releasers.size() > 1) {
+      releasers.front().join();
+      releasers.erase(releasers.begin());
+    }
+  }
+  for (auto &t : releasers)
+    t.join();
+  producer_thread.join();
+  EXPECT_EQ(n, kNumBatches);
+  EXPECT_EQ(consumer.first_unreleased(), static_cast<uint32_t>(kNumBatches));
+}
+
+}  // namespace test
+}  // namespace shm_ring
+}  // namespace dali
@@ -0,0 +1,391 @@
+// Copyright (c) 2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "dali/kernels/audio/mel_scale/mel_spectrogram_cpu.h"
+#include <ffts.h>
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <vector>
+#include "dali/core/boundary.h"
+#include "dali/core/format.h"
+#include "dali/core/util.h"
+#include "dali/kernels/audio/mel_scale/mel_scale.h"
+#include "dali/kernels/signal/dct/table.h"
+#include "dali/kernels/signal/decibel/decibel_calculator.h"
+#include "dali/kernels/signal/fft/ffts_plan_cache.h"
+
+namespace dali {
+namespace kernels {
+namespace audio {
+
+namespace {
+
+/**
+ * @brief Mel filter bank stored as a sparse matrix: each filter is a contiguous range of FFT bins
+ *        with precomputed (and normalized) weights.
+ *
+ * The bins and the weights are the same as the ones used by MelFilterBankCpu.
+ */
+class SparseMelFilterBank : public MelFilterImplBase<float> {
+ public:
+  template <typename MelScale>
+  SparseMelFilterBank(MelScale mel_scale, const MelFilterBankArgs &args)
+      : MelFilterImplBase<float>(mel_scale, args) {
+    int nfilter = args.nfilter;
+    std::vector<int> interval_ends(nfilter + 2);
+    interval_ends[0] = fftbin_start_;
+    interval_ends[nfilter + 1] = fftbin_end_;
+    double mel = mel_low_ + mel_delta_;
+    for (int interval = 1; interval < nfilter + 1; interval++, mel += mel_delta_) {
+      double freq = mel_scale.mel_to_hz(mel);
+      interval_ends[interval] = std::ceil(freq / hz_step_);
+    }
+
+    first_bin_.resize(nfilter);
+    offsets_.resize(nfilter + 1);
+    offsets_[0] = 0;
+    for (int m = 0; m < nfilter; m++) {
+      int f0 = interval_ends[m], f1 = interval_ends[m + 1], f2 = interval_ends[m + 2];
+      float norm = args.normalize ? norm_factors_[m] : 1.0f;
+      first_bin_[m] = f0;
+      for (int fftbin = f0; fftbin < f1; fftbin++)
+        weights_.push_back((1.0f - weights_down_[fftbin]) * norm);
+      for (int fftbin = f1; fftbin < f2; fftbin++)
+        weights_.push_back(weights_down_[fftbin] * norm);
+      offsets_[m + 1] = weights_.size();
+    }
+  }
+
+  void Apply(float *mel, const float *spectrum) const {
+    int nfilter = first_bin_.size();
+    for (int m = 0; m < nfilter; m++) {
+      const float *w = weights_.data() + offsets_[m];
+      const float *s = spectrum + first_bin_[m];
+      int n = offsets_[m + 1] - offsets_[m];
+      float acc = 0;
+      for (int i = 0; i < n; i++)
+        acc += w[i] * s[i];
+      mel[m] = acc;
+    }
+  }
+
+ private:
+  std::vector<int> first_bin_;
+  std::vector<int> offsets_;
+  std::vector<float> weights_;
+};
+
+bool SameTables(const MelSpectrogramArgs &a, const MelSpectrogramArgs &b) {
+  return a.window == b.window && a.nfft == b.nfft && a.mel == b.mel &&
+         a.dct == b.dct && a.dct_args == b.dct_args && a.lifter == b.lifter;
+}
+
+}  // namespace
+
+class MelSpectrogramCpu::Impl {
+ public:
+  explicit Impl(const MelSpectrogramArgs &args) : args_(args) {
+    int nfft = args.nfft;
+    real_fft_ = is_pow2(nfft);
+    // Creates the plan (if needed) so that it's readily available in Run
+    Plan();
+
+    switch (args.mel.mel_formula) {
+      case MelScaleFormula::HTK:
+        mel_fb_ = std::make_unique<SparseMelFilterBank>(HtkMelScale<float>(), args.mel);
+        break;
+      case MelScaleFormula::Slaney:
+      default:
+        mel_fb_ = std::make_unique<SparseMelFilterBank>(SlaneyMelScale<float>(), args.mel);
+        break;
+    }
+
+    if (args.dct) {
+      int nfilter = args.mel.nfilter;
+      int ndct = args.dct_args.ndct;
+      cos_table_.resize(static_cast<size_t>(ndct) * nfilter);
+      signal::dct::FillCosineTable(cos_table_.data(), nfilter, args.dct_args);
+      if (args.lifter != 0.0f) {
+        // same as in the MFCC operator
+        float ampl_mult = args.lifter / 2;
+        float phase_mult = static_cast<float>(M_PI) / args.lifter;
+        lifter_coeffs_.resize(ndct);
+        for (int k = 0; k < ndct; k++)
+          lifter_coeffs_[k] = 1.f + ampl_mult * sin(phase_mult * (k + 1));
+      }
+    }
+  }
+
+  const MelSpectrogramArgs &Args() const {
+    return args_;
+  }
+
+  void SetArgs(const MelSpectrogramArgs &args) {
+    assert(SameTables(args, args_));
+    args_ = args;
+  }
+
+  int NumFeatures() const {
+    return args_.dct ? args_.dct_args.ndct : args_.mel.nfilter;
+  }
+
+  void Run(KernelContext &ctx, const OutTensorCPU<float, 2> &out,
+           const InTensorCPU<float, 1> &in, const InTensorCPU<float, 1> &window_fn) {
+    const auto &wargs = args_.window;
+    int64_t length = in.shape[0];
+    int64_t nwindows = wargs.num_windows(length);
+    int nfeat = NumFeatures();
+    int nfilter = args_.mel.nfilter;
+    int nfft = args_.nfft;
+    int nbins = nfft / 2 + 1;
+    assert(out.shape == (args_.time_major ? TensorShape<2>(nwindows, nfeat)
+                                          : TensorShape<2>(nfeat, nwindows)));
+
+    // The scratch buffers are tiny (a few FFT sizes), so they stay in L1/L2 for the whole sample.
+    // ffts requires 32-byte aligned memory
+    int in_buf_sz = real_fft_ ? nfft : 2 * nfft;
+    int out_buf_sz = real_fft_ ? nfft + 2 : 2 * nfft;
+    float *in_buf = ctx.scratchpad->AllocateHost<float>(in_buf_sz, 32);
+    float *out_buf = ctx.scratchpad->AllocateHost<float>(out_buf_sz, 32);
+    float *spectrum = ctx.scratchpad->AllocateHost<float>(nbins);
+    float *mel = ctx.scratchpad->AllocateHost<float>(nfilter);
+    float *feat = ctx.scratchpad->AllocateHost<float>(nfeat);
+    // the parts of the FFT input which are not covered by the window stay zero
+    std::memset(in_buf, 0, in_buf_sz * sizeof(float));
+    auto plan = Plan();
+
+    // When the reference is the maximum of the mel spectrogram, the conversion to decibels
+    // (and the DCT) can only be done once the whole mel spectrogram is known.
+    bool two_pass = args_.to_db && args_.db.ref_max;
+    float *mel_all = nullptr;
+    if (two_pass && args_.dct)
+      mel_all = ctx.scratchpad->AllocateHost<float>(nwindows * nfilter);
+
+    auto store = [&](int64_t w, const float *values) {
+      if (args_.time_major) {
+        float *out_row = out.data + w * nfeat;
+        for (int k = 0; k < nfeat; k++)
+          out_row[k] = values[k];
+      } else {
+        for (int k = 0; k < nfeat; k++)
+          out.data[k * nwindows + w] = values[k];
+      }
+    };
+
+    int win_len = wargs.window_length;
+    int win_center = wargs.padding == signal::Padding::None ? 0 : wargs.window_center;
+    // When the nfft is larger than the window length, the window is centered in the FFT input
+    int in_win_start = (nfft - win_len) / 2;
+    const float *wnd = window_fn.data;
+    const float *in_data = in.data;
+
+    for (int64_t w = 0; w < nwindows; w++) {
+      int64_t window_start = w * wargs.window_step - win_center;
+      float *frame = real_fft_ ? in_buf + in_win_start : in_buf + 2 * in_win_start;
+      int frame_stride = real_fft_ ? 1 : 2;
+      if (window_start >= 0 && window_start + win_len <= length) {
+        const float *src = in_data + window_start;
+        for (int t = 0; t < win_len; t++)
+          frame[t * frame_stride] = wnd[t] * src[t];
+      } else if (wargs.padding == signal::Padding::Reflect) {
+        for (int t = 0; t < win_len; t++) {
+          int64_t idx = boundary::idx_reflect_101(window_start + t, length);
+          frame[t * frame_stride] = wnd[t] * in_data[idx];
+        }
+      } else {
+        for (int t = 0; t < win_len; t++) {
+          int64_t idx = window_start + t;
+          frame[t * frame_stride] = idx >= 0 && idx < length ? wnd[t] * in_data[idx] : 0.0f;
+        }
+      }
+
+      ffts_execute(plan.get(), in_buf, out_buf);
+
+      // Only the first half of the spectrum is used, regardless of the transform type
+      if (args_.power == 2) {
+        for (int i = 0; i < nbins; i++) {
+          float re = out_buf[2 * i], im = out_buf[2 * i + 1];
+          spectrum[i] = re * re + im * im;
+        }
+      } else {
+        for (int i = 0; i < nbins; i++) {
+          float re = out_buf[2 * i], im = out_buf[2 * i + 1];
+          spectrum[i] = std::sqrt(re * re + im * im);
+        }
+      }
+
+      if (!two_pass) {
+        mel_fb_->Apply(mel, spectrum);
+        store(w, Features(feat, mel, 1.0f));
+      } else if (mel_all) {
+        mel_fb_->Apply(mel_all + w * nfilter, spectrum);
+      } else {
+        mel_fb_->Apply(mel, spectrum);
+        store(w, mel);
+      }
+    }
+
+    if (!two_pass)
+      return;
+
+    // The mel spectrogram is either in the output or in `mel_all` - both are much smaller than
+    // the spectrogram itself.
+    float *mel_data = mel_all ? mel_all : out.data;
+    int64_t mel_size = nwindows * nfilter;
+    float s_ref = 0.0f;
+    for (int64_t i = 0; i < mel_size; i++)
+      s_ref = std::max(s_ref, mel_data[i]);
+    // avoid division by 0
+    if (s_ref == 0.0f)
+      s_ref = 1.0f;
+
+    if (mel_all) {
+      for (int64_t w = 0; w < nwindows; w++)
+        store(w, Features(feat, mel_all + w * nfilter, s_ref));
+    } else {
+      signal::MagnitudeToDecibel<float> dB(args_.db.multiplier, s_ref, args_.db.min_ratio);
+      for (int64_t i = 0; i < mel_size; i++)
+        out.data[i] = dB(out.data[i]);
+    }
+  }
+
+ private:
+  /**
+   * @brief Converts the mel bands of a single window to the output features.
+   *
+   * The mel bands are modified in place.
+   * @return Pointer to the features - either `feat` or `mel`
+   */
+  const float *Features(float *feat, float *mel, float s_ref) const {
+    int nfilter = args_.mel.nfilter;
+    if (args_.to_db) {
+      if (!args_.db.ref_max)
+        s_ref = args_.db.s_ref;
+      signal::MagnitudeToDecibel<float> dB(args_.db.multiplier, s_ref, args_.db.min_ratio);
+      for (int m = 0; m < nfilter; m++)
+        mel[m] = dB(mel[m]);
+    }
+    if (!args_.dct)
+      return mel;
+
+    int ndct = args_.dct_args.ndct;
+    for (int k = 0; k < ndct; k++) {
+      const float *cos_row = cos_table_.data() + k * nfilter;
+      float acc = 0;
+      for (int m = 0; m < nfilter; m++)
+        acc += cos_row[m] * mel[m];
+      feat[k] = acc;
+    }
+    if (!lifter_coeffs_.empty()) {
+      for (int k = 0; k < ndct; k++)
+        feat[k] *= lifter_coeffs_[k];
+    }
+    return feat;
+  }
+
+  signal::fft::FftsPlanCache::PlanPtr Plan() const {
+    using signal::fft::FftsPlanCache;
+    auto type = real_fft_ ? FftsPlanCache::Type::Real : FftsPlanCache::Type::Complex;
+    return FftsPlanCache::Instance().Get(args_.nfft, FFTS_FORWARD, type);
+  }
+
+  MelSpectrogramArgs args_;
+  bool real_fft_ = false;
+  std::unique_ptr<SparseMelFilterBank> mel_fb_;
+  std::vector<float> cos_table_;
+  std::vector<float> lifter_coeffs_;
+};
+
+MelSpectrogramCpu::MelSpectrogramCpu() = default;
+
+MelSpectrogramCpu::~MelSpectrogramCpu() = default;
+
+KernelRequirements MelSpectrogramCpu::Setup(KernelContext &context,
+                                            const InTensorCPU<float, 1> &in,
+                                            const InTensorCPU<float, 1> &window_fn,
+                                            const MelSpectrogramArgs &orig_args) {
+  auto args = orig_args;
+  auto &wargs = args.window;
+  DALI_ENFORCE(wargs.window_length > 0,
+               make_string("Invalid window length: ", wargs.window_length));
+  DALI_ENFORCE(wargs.window_step > 0, make_string("Invalid window step: ", wargs.window_step));
+  DALI_ENFORCE(wargs.axis <= 0, "Only 1D signals are supported");
+  wargs.axis = 0;
+  if (wargs.padding != signal::Padding::None) {
+    if (wargs.window_center < 0)
+      wargs.window_center = wargs.window_length / 2;
+    DALI_ENFORCE(wargs.window_center <= wargs.window_length,
+      make_string("Window center offset must be in the range [0, ", wargs.window_length, "]"));
+  } else {
+    wargs.window_center = 0;
+  }
+  DALI_ENFORCE(window_fn.shape[0] == wargs.window_length,
+               "Window function should match the specified window length");
+
+  args.nfft = args.nfft > 0 ? args.nfft : wargs.window_length;
+  DALI_ENFORCE(wargs.window_length <= args.nfft, make_string(
+    "Window length (", wargs.window_length, ") can't be bigger than the FFT size (", args.nfft,
+    ")"));
+  DALI_ENFORCE(args.power == 1 || args.power == 2, make_string(
+    "`power` can be only 1 (energy) or 2 (power), received ", args.power));
+
+  auto &mel = args.mel;
+  DALI_ENFORCE(mel.nfilter > 0, make_string("Invalid number of mel filters: ", mel.nfilter));
+  mel.axis = 0;
+  mel.nfft = args.nfft;
+  mel.freq_high = mel.freq_high > 0 ? mel.freq_high : mel.sample_rate / 2;
+
+  if (args.dct) {
+    auto &dct = args.dct_args;
+    if (dct.ndct <= 0 || dct.ndct > mel.nfilter)
+      dct.ndct = mel.nfilter;
+    DALI_ENFORCE(dct.dct_type >= 1 && dct.dct_type <= 4,
+      make_string("Unsupported DCT type: ", dct.dct_type, ". Supported types are: 1, 2, 3, 4."));
+    if (dct.dct_type == 1) {
+      DALI_ENFORCE(!dct.normalize, "Ortho-normalization is not supported for DCT type I.");
+      DALI_ENFORCE(mel.nfilter > 1, "DCT type I requires an input length > 1");
+    }
+  } else {
+    args.dct_args = {};
+    args.lifter = 0.0f;
+  }
+
+  int64_t nwindows = wargs.num_windows(in.shape[0]);
+  DALI_ENFORCE(nwindows > 0, make_string("Signal is too short (", in.shape[0], ")"));
+
+  if (!impl_ || !SameTables(impl_->Args(), args))
+    impl_ = std::make_unique<Impl>(args);
+  else
+    impl_->SetArgs(args);
+
+  int nfeat = impl_->NumFeatures();
+  TensorShape<> out_shape = args.time_major ? TensorShape<>(nwindows, nfeat)
+                                            : TensorShape<>(nfeat, nwindows);
+  KernelRequirements req;
+  req.output_shapes = {TensorListShape<>({out_shape})};
+  return req;
+}
+
+void MelSpectrogramCpu::Run(KernelContext &context,
+                            const OutTensorCPU<float, 2> &out,
+                            const InTensorCPU<float, 1> &in,
+                            const InTensorCPU<float, 1> &window_fn) {
+  DALI_ENFORCE(impl_ != nullptr);
+  impl_->Run(context, out, in, window_fn);
+}
+
+}  // namespace audio
+}  // namespace kernels
+}  // namespace dali
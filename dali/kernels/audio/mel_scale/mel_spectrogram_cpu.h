@@ -0,0 +1,92 @@
+// Copyright (c) 2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef DALI_KERNELS_AUDIO_MEL_SCALE_MEL_SPECTROGRAM_CPU_H_
+#define DALI_KERNELS_AUDIO_MEL_SCALE_MEL_SPECTROGRAM_CPU_H_
+
+#include <memory>
+#include <vector>
+#include "dali/core/common.h"
+#include "dali/core/error_handling.h"
+#include "dali/kernels/kernel.h"
+#include "dali/kernels/audio/mel_scale/mel_filter_bank_args.h"
+#include "dali/kernels/signal/dct/dct_args.h"
+#include "dali/kernels/signal/decibel/to_decibels_args.h"
+#include "dali/kernels/signal/window/extract_windows_args.h"
+
+namespace dali {
+namespace kernels {
+namespace audio {
+
+struct MelSpectrogramArgs {
+  /// @brief Window extraction; only the temporal axis 0 of a 1D signal is supported
+  signal::ExtractWindowsArgs window;
+  /// @brief Size of the FFT; if not positive, the window length is used
+  int nfft = -1;
+  /// @brief Exponent of the magnitude of the spectrum: 1 (amplitude) or 2 (power)
+  int power = 2;
+  /// @brief Mel filter bank; `nfft` and `axis` are ignored
+  MelFilterBankArgs mel;
+  /// @brief Whether to convert the mel spectrogram to decibels
+  bool to_db = true;
+  signal::ToDecibelsArgs<float> db;
+  /// @brief Whether to apply a DCT to the (log) mel spectrogram, producing MFCCs
+  bool dct = false;
+  /// @brief DCT along the mel axis; `ndct` <= 0 means `mel.nfilter` coefficients
+  signal::dct::DctArgs dct_args;
+  /// @brief Cepstral liftering coefficient; 0 means no liftering
+  float lifter = 0.0f;
+  /// @brief If true, the output is (time, features), otherwise (features, time)
+  bool time_major = false;
+};
+
+/**
+ * @brief Computes log-mel spectrograms or MFCCs of a 1D signal in a single pass.
+ *
+ * The result is the same as the one obtained by running ExtractWindowsCpu, Fft1DCpu,
+ * MelFilterBankCpu, ToDecibelsCpu and Dct1DCpu one after another, but the signal is processed
+ * one window at a time: the windowed frame, its spectrum and the mel bands only occupy a few
+ * kilobytes of scratch memory and no intermediate spectrogram is ever stored.
+ * The mel filter bank is applied as a sparse matrix - each filter only visits the FFT bins
+ * within its support.
+ *
+ * The kernel instance keeps the state which depends on the arguments only (FFT plan, filter
+ * weights, cosine table), so it can be set up once and run for any number of signals, but it
+ * must not be run concurrently from multiple threads.
+ */
+class DLL_PUBLIC MelSpectrogramCpu {
+ public:
+  DLL_PUBLIC MelSpectrogramCpu();
+  DLL_PUBLIC ~MelSpectrogramCpu();
+
+  DLL_PUBLIC KernelRequirements Setup(KernelContext &context,
+                                      const InTensorCPU<float, 1> &in,
+                                      const InTensorCPU<float, 1> &window_fn,
+                                      const MelSpectrogramArgs &args);
+
+  DLL_PUBLIC void Run(KernelContext &context,
+                      const OutTensorCPU<float, 2> &out,
+                      const InTensorCPU<float, 1> &in,
+                      const InTensorCPU<float, 1> &window_fn);
+
+ private:
+  class Impl;
+  std::unique_ptr<Impl> impl_;
+};
+
+}  // namespace audio
+}  // namespace kernels
+}  // namespace dali
+
+#endif  // DALI_KERNELS_AUDIO_MEL_SCALE_MEL_SPECTROGRAM_CPU_H_
@@ -0,0 +1,214 @@
+// Copyright (c) 2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+#include <cmath>
+#include <random>
+#include <vector>
+#include "dali/kernels/audio/mel_scale/mel_spectrogram_cpu.h"
+#include "dali/kernels/audio/mel_scale/mel_filter_bank_cpu.h"
+#include "dali/kernels/dynamic_scratchpad.h"
+#include "dali/kernels/signal/dct/dct_cpu.h"
+#include "dali/kernels/signal/decibel/to_decibels_cpu.h"
+#include "dali/kernels/signal/fft/fft_cpu.h"
+#include "dali/kernels/signal/window/extract_windows_cpu.h"
+#include "dali/kernels/signal/window/window_functions.h"
+#include "dali/test/tensor_test_utils.h"
+
+namespace dali {
+namespace kernels {
+namespace audio {
+namespace test {
+
+namespace {
+
+/**
+ * @brief Computes the features with the separate kernels, materializing all intermediate results.
+ */
+template <bool time_major>
+std::vector<float> ReferenceFeatures(TensorShape<2> &out_shape,
+                                     const InTensorCPU<float, 1> &in,
+                                     const InTensorCPU<float, 1> &window_fn,
+                                     const MelSpectrogramArgs &args) {
+  KernelContext ctx;
+  DynamicScratchpad scratchpad(AccessOrder::host());
+  ctx.scratchpad = &scratchpad;
+  int axis = time_major ? 1 : 0;
+
+  signal::ExtractWindowsCpu<float, float, 1, !time_major> windows_kernel;
+  auto windows_req = windows_kernel.Setup(ctx, in, window_fn, args.window);
+  auto windows_shape = windows_req.output_shapes[0][0].template to_static<2>();
+  std::vector<float> windows(volume(windows_shape));
+  auto windows_view = make_tensor_cpu<2>(windows.data(), windows_shape);
+  windows_kernel.Run(ctx, windows_view, in, window_fn, args.window);
+  auto windows_in = make_tensor_cpu<2>(static_cast<const float *>(windows.data()), windows_shape);
+
+  signal::fft::Fft1DCpu<float, float, 2> fft_kernel;
+  signal::fft::FftArgs fft_args;
+  fft_args.nfft = args.nfft;
+  fft_args.transform_axis = axis;
+  fft_args.spectrum_type = args.power == 2 ? signal::fft::FFT_SPECTRUM_POWER
+                                           : signal::fft::FFT_SPECTRUM_MAGNITUDE;
+  auto fft_req = fft_kernel.Setup(ctx, windows_in, fft_args);
+  auto spectrum_shape = fft_req.output_shapes[0][0].template to_static<2>();
+  std::vector<float> spectrum(volume(spectrum_shape));
+  auto spectrum_view = make_tensor_cpu<2>(spectrum.data(), spectrum_shape);
+  fft_kernel.Run(ctx, spectrum_view, windows_in, fft_args);
+
+  MelFilterBankCpu<float> mel_kernel;
+  auto mel_args = args.mel;
+  mel_args.axis = axis;
+  mel_args.nfft = args.nfft;
+  auto mel_req = mel_kernel.Setup(ctx, spectrum_view, mel_args);
+  auto mel_shape = mel_req.output_shapes[0][0];
+  std::vector<float> mel(volume(mel_shape));
+  auto mel_view = make_tensor_cpu(mel.data(), mel_shape);
+  mel_kernel.Run(ctx, mel_view, spectrum_view);
+
+  if (args.to_db) {
+    signal::ToDecibelsCpu<float> db_kernel;
+    db_kernel.Setup(ctx, mel_view, args.db);
+    db_kernel.Run(ctx, mel_view, mel_view, args.db);
+  }
+
+  out_shape = mel_shape.template to_static<2>();
+  if (!args.dct)
+    return mel;
+
+  signal::dct::Dct1DCpu<float, float, 2> dct_kernel;
+  auto mel_view_2d = make_tensor_cpu<2>(static_cast<const float *>(mel.data()), out_shape);
+  auto dct_req = dct_kernel.Setup(ctx, mel_view_2d, args.dct_args, axis);
+  out_shape = dct_req.output_shapes[0][0].template to_static<2>();
+  std::vector<float> out(volume(out_shape));
+  dct_kernel.Run(ctx, make_tensor_cpu<2>(out.data(), out_shape), mel_view_2d, args.dct_args,
+                 axis);
+  if (args.lifter != 0) {
+    int ndct = out_shape[axis];
+    for (int64_t i = 0; i < volume(out_shape); i++) {
+      int k = time_major ? i % ndct : i / out_shape[1];
+      out[i] *= 1.f + args.lifter / 2 * sin(static_cast<float>(M_PI) / args.lifter * (k + 1));
+    }
+  }
+  return out;
+}
+
+}  // namespace
+
+class MelSpectrogramCpuTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    std::mt19937 rng(1234);
+    std::normal_distribution<float> noise(0, 0.1f);
+    signal_.resize(length_);
+    for (int64_t i = 0; i < length_; i++)
+      signal_[i] = std::sin(i * 0.05f) + 0.5f * std::sin(i * 0.31f) + noise(rng);
+  }
+
+  void RunTest(MelSpectrogramArgs args, float eps) {
+    std::vector<float> window_fn(args.window.window_length);
+    signal::HannWindow(make_span(window_fn));
+    auto in = make_tensor_cpu<1, const float>(signal_.data(), {length_});
+    auto wnd = make_tensor_cpu<1, const float>(window_fn.data(), {args.window.window_length});
+
+    TensorShape<2> ref_shape;
+    auto ref = args.time_major ? ReferenceFeatures<true>(ref_shape, in, wnd, args)
+                               : ReferenceFeatures<false>(ref_shape, in, wnd, args);
+
+    KernelContext ctx;
+    DynamicScratchpad scratchpad(AccessOrder::host());
+    ctx.scratchpad = &scratchpad;
+    MelSpectrogramCpu kernel;
+    auto req = kernel.Setup(ctx, in, wnd, args);
+    auto out_shape = req.output_shapes[0][0].template to_static<2>();
+    ASSERT_EQ(out_shape, ref_shape);
+    std::vector<float> out(volume(out_shape));
+    auto out_view = make_tensor_cpu<2>(out.data(), out_shape);
+    kernel.Run(ctx, out_view, in, wnd);
+
+    Check(out_view, make_tensor_cpu<2>(ref.data(), ref_shape), EqualEpsRel(eps, eps));
+  }
+
+  int64_t length_ = 16000;
+  std::vector<float> signal_;
+};
+
+TEST_F(MelSpectrogramCpuTest, LogMel) {
+  MelSpectrogramArgs args;
+  args.window = {400, 200, 160, 0, signal::Padding::Reflect};
+  args.nfft = 512;
+  args.mel.sample_rate = 16000;
+  args.mel.freq_high = 8000;
+  args.mel.nfilter = 80;
+  args.db.min_ratio = 1e-10f;
+  for (bool time_major : {false, true}) {
+    args.time_major = time_major;
+    RunTest(args, 1e-3f);
+  }
+}
+
+TEST_F(MelSpectrogramCpuTest, MaxReference) {
+  MelSpectrogramArgs args;
+  args.window = {512, 256, 128, 0, signal::Padding::Zero};
+  args.mel.sample_rate = 16000;
+  args.mel.freq_high = 8000;
+  args.mel.nfilter = 64;
+  args.mel.mel_formula = MelScaleFormula::HTK;
+  args.db.ref_max = true;
+  args.db.min_ratio = 1e-8f;
+  for (bool time_major : {false, true}) {
+    args.time_major = time_major;
+    RunTest(args, 1e-3f);
+  }
+}
+
+TEST_F(MelSpectrogramCpuTest, NonPow2MagnitudeNoPadding) {
+  MelSpectrogramArgs args;
+  args.window = {400, -1, 160, 0, signal::Padding::None};
+  args.power = 1;
+  args.mel.sample_rate = 16000;
+  args.mel.nfilter = 40;
+  args.mel.freq_low = 100;
+  args.mel.freq_high = 7000;
+  args.mel.normalize = false;
+  args.to_db = false;
+  RunTest(args, 1e-4f);
+}
+
+TEST_F(MelSpectrogramCpuTest, MFCC) {
+  MelSpectrogramArgs args;
+  args.window = {400, 200, 160, 0, signal::Padding::Reflect};
+  args.nfft = 512;
+  args.mel.sample_rate = 16000;
+  args.mel.freq_high = 8000;
+  args.mel.nfilter = 64;
+  args.db.min_ratio = 1e-10f;
+  args.dct = true;
+  args.dct_args.ndct = 20;
+  args.lifter = 22;
+  for (bool ref_max : {false, true}) {
+    for (bool time_major : {false, true}) {
+      for (bool normalize : {false, true}) {
+        args.db.ref_max = ref_max;
+        args.time_major = time_major;
+        args.dct_args.normalize = normalize;
+        RunTest(args, 1e-3f);
+      }
+    }
+  }
+}
+
+}  // namespace test
+}  // namespace audio
+}  // namespace kernels
+}  // namespace dali
@@ -0,0 +1,124 @@
+// Copyright (c) 2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "dali/kernels/common/cpu_dispatch.h"
+#include <strings.h>
+#include <atomic>
+#include <cstdlib>
+#include <stdexcept>
+#include "dali/core/error_handling.h"
+#include "dali/core/format.h"
+
+namespace dali {
+namespace kernels {
+namespace simd {
+
+namespace {
+
+CpuIsa DetectCpuIsa() {
+#if DALI_X86_DISPATCH
+  // __builtin_cpu_supports checks the OS support (XSAVE state) as well as the CPUID flags
+  __builtin_cpu_init();
+  bool avx2 = __builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma") &&
+              __builtin_cpu_supports("f16c");
+  if (avx2 && __builtin_cpu_supports("avx512f"))
+    return CpuIsa::AVX512;
+  if (avx2)
+    return CpuIsa::AVX2;
+#endif
+  return CpuIsa::Baseline;
+}
+
+CpuIsa DetectedCpuIsa() {
+  static const CpuIsa isa = DetectCpuIsa();
+  return isa;
+}
+
+/**
+ * @brief The level detected at startup, lowered by DALI_CPU_ISA, if set.
+ */
+CpuIsa InitialCpuIsa() {
+  static const CpuIsa isa = []() {
+    CpuIsa detected = DetectedCpuIsa();
+    const char *env = std::getenv("DALI_CPU_ISA");
+    if (!env || !*env)
+      return detected;
+    for (int i = 0; i < kNumCpuIsas; i++) {
+      CpuIsa requested = static_cast<CpuIsa>(i);
+      if (!strcasecmp(env, CpuIsaName(requested))) {
+        if (requested > detected) {
+          DALI_WARN("DALI_CPU_ISA=", env, " is not supported by this CPU; using ",
+                    CpuIsaName(detected), " instead.");
+          return detected;
+        }
+        return requested;
+      }
+    }
+    DALI_WARN("Unrecognized DALI_CPU_ISA value \"", env, "\"; using ", CpuIsaName(detected), ".");
+    return detected;
+  }();
+  return isa;
+}
+
+std::atomic<int> &CurrentCpuIsa() {
+  static std::atomic<int> isa{static_cast<int>(InitialCpuIsa())};
+  return isa;
+}
+
+}  // namespace
+
+const char *CpuIsaName(CpuIsa isa) {
+  switch (isa) {
+    case CpuIsa::Baseline:
+      return "baseline";
+    case CpuIsa::AVX2:
+      return "avx2";
+    case CpuIsa::AVX512:
+      return "avx512";
+    default:
+      return "<unknown>";
+  }
+}
+
+bool CpuIsaSupported(CpuIsa isa) {
+  return isa >= CpuIsa::Baseline && isa <= DetectedCpuIsa();
+}
+
+std::vector<CpuIsa> SupportedCpuIsas() {
+  std::vector<CpuIsa> isas;
+  for (int i = 0; i < kNumCpuIsas; i++) {
+    if (CpuIsaSupported(static_cast<CpuIsa>(i)))
+      isas.push_back(static_cast<CpuIsa>(i));
+  }
+  return isas;
+}
+
+CpuIsa GetCpuIsa() {
+  return static_cast<CpuIsa>(CurrentCpuIsa().load(std::memory_order_relaxed));
+}
+
+void SetCpuIsa(CpuIsa isa) {
+  if (!CpuIsaSupported(isa))
+    throw std::invalid_argument(make_string(
+        "The instruction set level \"", CpuIsaName(isa), "\" is not supported by this CPU."));
+  CurrentCpuIsa().store(static_cast<int>(isa), std::memory_order_relaxed);
+}
+
+void ResetCpuIsa() {
+  CurrentCpuIsa().store(static_cast<int>(InitialCpuIsa()), std::memory_order_relaxed);
+}
+
+}  // namespace simd
+}  // namespace kernels
+}  // namespace dali
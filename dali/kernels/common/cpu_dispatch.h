@@ -0,0 +1,143 @@
+// Copyright (c) 2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef DALI_KERNELS_COMMON_CPU_DISPATCH_H_
+#define DALI_KERNELS_COMMON_CPU_DISPATCH_H_
+
+#include <vector>
+#include "dali/core/api_helper.h"
+
+/**
+ * Runtime selection of the instruction set used by CPU kernels.
+ *
+ * DALI is built for a baseline instruction set (SSE2 on x86-64, NEON on AArch64). Kernels which
+ * benefit from wider vectors can additionally compile variants of their inner loops for
+ * higher ISA levels, by marking them with DALI_TARGET_AVX2 / DALI_TARGET_AVX512, and pick one
+ * with IsaDispatch:
+ *
+ * ```
+ * void MyLoop(float *out, const float *in, int64_t n);  // baseline
+ * DALI_TARGET_AVX2 void MyLoopAVX2(float *out, const float *in, int64_t n);
+ *
+ * auto func = simd::IsaDispatch<decltype(&MyLoop)>{ MyLoop, MyLoopAVX2 }.Select();
+ * ```
+ *
+ * The ISA level is detected once, at startup. It can be lowered with the `DALI_CPU_ISA`
+ * environment variable (`baseline`, `avx2` or `avx512`) or, in tests, with ScopedCpuIsa.
+ * Kernels should query it once per invocation rather than cache it, so that an override takes
+ * effect immediately.
+ */
+
+#if defined(__x86_64__) && defined(__GNUC__)
+#define DALI_X86_DISPATCH 1
+#define DALI_TARGET_AVX2 __attribute__((target("avx2,fma,f16c")))
+#define DALI_TARGET_AVX512 __attribute__((target("avx512f,avx2,fma,f16c")))
+#else
+#define DALI_X86_DISPATCH 0
+#endif
+
+namespace dali {
+namespace kernels {
+namespace simd {
+
+/**
+ * @brief Instruction set levels, in increasing order of capability
+ */
+enum class CpuIsa : int {
+  Baseline = 0,  ///< the instruction set DALI is compiled for
+  AVX2 = 1,      ///< AVX2, FMA and F16C
+  AVX512 = 2,    ///< AVX-512 Foundation
+};
+
+constexpr int kNumCpuIsas = 3;
+
+DLL_PUBLIC const char *CpuIsaName(CpuIsa isa);
+
+/**
+ * @brief Checks whether the host CPU (and OS) supports given instruction set level
+ */
+DLL_PUBLIC bool CpuIsaSupported(CpuIsa isa);
+
+/**
+ * @brief Returns all the instruction set levels supported by the host, starting with Baseline
+ */
+DLL_PUBLIC std::vector<CpuIsa> SupportedCpuIsas();
+
+/**
+ * @brief Returns the instruction set level that the kernels should use.
+ *
+ * This is the highest level supported by the host, unless lowered by `DALI_CPU_ISA` or SetCpuIsa.
+ */
+DLL_PUBLIC CpuIsa GetCpuIsa();
+
+/**
+ * @brief Overrides the instruction set level used by the kernels.
+ *
+ * @throws std::invalid_argument if the level is not supported by the host
+ */
+DLL_PUBLIC void SetCpuIsa(CpuIsa isa);
+
+/**
+ * @brief Restores the instruction set level selected at startup.
+ */
+DLL_PUBLIC void ResetCpuIsa();
+
+/**
+ * @brief Sets the instruction set level for the lifetime of the object; meant for tests.
+ */
+class ScopedCpuIsa {
+ public:
+  explicit ScopedCpuIsa(CpuIsa isa) : prev_(GetCpuIsa()) {
+    SetCpuIsa(isa);
+  }
+  ~ScopedCpuIsa() {
+    SetCpuIsa(prev_);
+  }
+  ScopedCpuIsa(const ScopedCpuIsa &) = delete;
+  ScopedCpuIsa &operator=(const ScopedCpuIsa &) = delete;
+
+ private:
+  CpuIsa prev_;
+};
+
+/**
+ * @brief A set of variants of a function, compiled for different instruction set levels.
+ *
+ * The baseline variant is mandatory; the others may be null, in which case the best available
+ * lower level is used.
+ */
+template <typename Func>
+struct IsaDispatch {
+  Func baseline;
+  Func avx2 = nullptr;
+  Func avx512 = nullptr;
+
+  Func Select(CpuIsa isa) const {
+    if (isa >= CpuIsa::AVX512 && avx512)
+      return avx512;
+    if (isa >= CpuIsa::AVX2 && avx2)
+      return avx2;
+    return baseline;
+  }
+
+  Func Select() const {
+    return Select(GetCpuIsa());
+  }
+};
+
+}  // namespace simd
+}  // namespace kernels
+}  // namespace dali
+
+#endif  // DALI_KERNELS_COMMON_CPU_DISPATCH_H_
@@ -0,0 +1,80 @@
+// Copyright (c) 2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+#include <stdexcept>
+#include "dali/kernels/common/cpu_dispatch.h"
+
+namespace dali {
+namespace kernels {
+namespace simd {
+namespace test {
+
+namespace {
+
+int Baseline() { return 0; }
+int AVX2() { return 1; }
+int AVX512() { return 2; }
+
+}  // namespace
+
+TEST(CpuDispatchTest, SupportedIsas) {
+  auto isas = SupportedCpuIsas();
+  ASSERT_FALSE(isas.empty());
+  EXPECT_EQ(isas[0], CpuIsa::Baseline);
+  for (size_t i = 1; i < isas.size(); i++)
+    EXPECT_EQ(static_cast<int>(isas[i]), static_cast<int>(isas[i - 1]) + 1);
+  EXPECT_TRUE(CpuIsaSupported(GetCpuIsa()));
+}
+
+TEST(CpuDispatchTest, Select) {
+  IsaDispatch<int (*)()> all = { Baseline, AVX2, AVX512 };
+  EXPECT_EQ(all.Select(CpuIsa::Baseline)(), 0);
+  EXPECT_EQ(all.Select(CpuIsa::AVX2)(), 1);
+  EXPECT_EQ(all.Select(CpuIsa::AVX512)(), 2);
+
+  IsaDispatch<int (*)()> no_avx512 = { Baseline, AVX2 };
+  EXPECT_EQ(no_avx512.Select(CpuIsa::AVX512)(), 1);
+
+  IsaDispatch<int (*)()> baseline_only = { Baseline };
+  EXPECT_EQ(baseline_only.Select(CpuIsa::AVX2)(), 0);
+  EXPECT_EQ(baseline_only.Select(CpuIsa::AVX512)(), 0);
+}
+
+TEST(CpuDispatchTest, Override) {
+  IsaDispatch<int (*)()> all = { Baseline, AVX2, AVX512 };
+  CpuIsa initial = GetCpuIsa();
+  for (auto isa : SupportedCpuIsas()) {
+    ScopedCpuIsa scoped(isa);
+    EXPECT_EQ(GetCpuIsa(), isa);
+    EXPECT_EQ(all.Select()(), static_cast<int>(isa));
+  }
+  EXPECT_EQ(GetCpuIsa(), initial);
+
+  for (int i = 0; i < kNumCpuIsas; i++) {
+    auto isa = static_cast<CpuIsa>(i);
+    if (!CpuIsaSupported(isa)) {
+      EXPECT_THROW(SetCpuIsa(isa), std::invalid_argument);
+    }
+  }
+  SetCpuIsa(CpuIsa::Baseline);
+  EXPECT_EQ(GetCpuIsa(), CpuIsa::Baseline);
+  ResetCpuIsa();
+  EXPECT_EQ(GetCpuIsa(), initial);
+}
+
+}  // namespace test
+}  // namespace simd
+}  // namespace kernels
+}  // namespace dali
@@ -23,6 +23,11 @@
 #include <limits>
 #include <type_traits>
 #include "dali/core/force_inline.h"
+#include "dali/kernels/common/cpu_dispatch.h"
+
+#if DALI_X86_DISPATCH
+#include <immintrin.h>
+#endif
 
 namespace dali {
 namespace kernels {
@@ -328,6 +333,64 @@ DALI_FORCEINLINE static void store(Out *out, multivec<num_vecs> m) noexcept {
 
 #endif  // __SSE2__
 
+#if DALI_X86_DISPATCH
+
+/**
+ * Helpers for kernel variants compiled for the AVX2 instruction set level.
+ * They can only be used in functions marked with DALI_TARGET_AVX2 (or higher).
+ */
+namespace avx2 {
+
+/**
+ * @brief Load 8 values and convert them to float32x8
+ */
+DALI_TARGET_AVX2 inline __m256 load8_f(const float *f) {
+  return _mm256_loadu_ps(f);
+}
+
+DALI_TARGET_AVX2 inline __m256 load8_f(const uint8_t *u8) {
+  __m128i in = _mm_loadl_epi64(reinterpret_cast<const __m128i *>(u8));
+  return _mm256_cvtepi32_ps(_mm256_cvtepu8_epi32(in));
+}
+
+DALI_TARGET_AVX2 inline __m256 load8_f(const int8_t *i8) {
+  __m128i in = _mm_loadl_epi64(reinterpret_cast<const __m128i *>(i8));
+  return _mm256_cvtepi32_ps(_mm256_cvtepi8_epi32(in));
+}
+
+DALI_TARGET_AVX2 inline __m256 load8_f(const uint16_t *u16) {
+  __m128i in = _mm_loadu_si128(reinterpret_cast<const __m128i *>(u16));
+  return _mm256_cvtepi32_ps(_mm256_cvtepu16_epi32(in));
+}
+
+DALI_TARGET_AVX2 inline __m256 load8_f(const int16_t *i16) {
+  __m128i in = _mm_loadu_si128(reinterpret_cast<const __m128i *>(i16));
+  return _mm256_cvtepi32_ps(_mm256_cvtepi16_epi32(in));
+}
+
+DALI_TARGET_AVX2 inline __m256 load8_f(const int32_t *i32) {
+  return _mm256_cvtepi32_ps(_mm256_loadu_si256(reinterpret_cast<const __m256i *>(i32)));
+}
+
+/**
+ * @brief Converts `num_vecs` float32x8 vectors to Out and stores them.
+ *
+ * The conversion is the same as in the baseline `simd::store`.
+ */
+template <int num_vecs, typename Out>
+DALI_TARGET_AVX2 inline void store(Out *out, const __m256 (&v)[num_vecs]) {
+  multivec<2 * num_vecs> m;
+  for (int i = 0; i < num_vecs; i++) {
+    m.v[2 * i] = _mm256_castps256_ps128(v[i]);
+    m.v[2 * i + 1] = _mm256_extractf128_ps(v[i], 1);
+  }
+  simd::store(out, m);
+}
+
+}  // namespace avx2
+
+#endif  // DALI_X86_DISPATCH
+
 }  // namespace simd
 }  // namespace kernels
 }  // namespace dali
@@ -1,4 +1,4 @@
-// Copyright (c) 2020-2021, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+// Copyright (c) 2020-2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
 //
 // Licensed under the Apache License, Version 2.0 (the "License");
 // you may not use this file except in compliance with the License.
@@ -15,12 +15,15 @@
 #ifndef DALI_KERNELS_IMGPROC_CONVOLUTION_CONVOLUTION_CPU_H_
 #define DALI_KERNELS_IMGPROC_CONVOLUTION_CONVOLUTION_CPU_H_
 
+#include <algorithm>
 #include "dali/core/boundary.h"
 #include "dali/core/convert.h"
+#include "dali/core/exec/engine.h"
 #include "dali/core/format.h"
 #include "dali/core/tensor_view.h"
 #include "dali/kernels/common/utils.h"
 #include "dali/kernels/kernel.h"
+#include "dali/pipeline/util/cost_scheduler.h"
 #include "dali/pipeline/util/operator_impl_utils.h"
 
 namespace dali {
@@ -231,11 +234,23 @@ void load_pixel_no_border(CyclicWindowWrapper<T, max_lanes>& cww, const T* in_pt
   cww.PushBack(in_ptr + in_idx * stride);
 }
 
+/**
+ * @brief Convolves the innermost spatial dimension (not in-place).
+ *
+ * The outer elements (rows) in range [outer_begin, outer_end) are processed; negative
+ * `outer_end` denotes all of them.
+ *
+ * The interior of each row, where no border handling is necessary, is processed in blocks of
+ * `kBlock` consecutive output values, with the window loop outside of the loop over the block,
+ * which allows the compiler to vectorize the latter. The order of summation for each output value
+ * is the same as in the scalar version, so the results are identical.
+ */
 template <bool has_channels, typename Out, typename In, typename W, int ndim,
           typename T = conv_transform::TransScaleSat<Out, W>>
 void ConvolveInnerDim(Out* out, const In* in, const W* window, int window_size,
                       const TensorShape<ndim>& shape, const TensorShape<ndim>& strides,
-                      const T& transform) {
+                      const T& transform, int64_t outer_begin = 0, int64_t outer_end = -1) {
+  constexpr int kBlock = 64;
   constexpr int last_dim = has_channels ? ndim - 2 : ndim - 1;
   int channels = has_channels ? strides[last_dim] : 1;
   int64_t outer_elements = volume(&shape[0], &shape[last_dim]);
@@ -244,7 +259,9 @@ void ConvolveInnerDim(Out* out, const In* in, const W* window, int window_size,
   int radius = (window_size - 1) / 2;
   // N.B. this can be negative for window_size > axis_size + 1
   int64_t flat_x_limit = (axis_size - window_size + 1) * channels;
-  for (int64_t o = 0; o < outer_elements; o++) {
+  if (outer_end < 0)
+    outer_end = outer_elements;
+  for (int64_t o = outer_begin; o < outer_end; o++) {
     int64_t x0 = -radius;
     int64_t xout = 0;
     int64_t axis_offset = o * axis_stride;
@@ -262,7 +279,20 @@ void ConvolveInnerDim(Out* out, const In* in, const W* window, int window_size,
     }
     int64_t flat_x = x0 * channels;
     int64_t flat_xout = xout * channels;
-    // This loop won't execute if the window_size > axis_size
+    // These loops won't execute if the window_size > axis_size
+    for (; flat_x + kBlock <= flat_x_limit; flat_x += kBlock, flat_xout += kBlock) {
+      float acc[kBlock];
+      for (int i = 0; i < kBlock; i++)
+        acc[i] = 0;
+      for (int k = 0; k < window_size; k++) {
+        const In* __restrict__ in_k = &in_axis[flat_x + k * channels];
+        W w = window[k];
+        for (int i = 0; i < kBlock; i++)
+          acc[i] += in_k[i] * w;
+      }
+      for (int i = 0; i < kBlock; i++)
+        transform(out, axis_offset + flat_xout + i, acc[i]);
+    }
     for (; flat_x < flat_x_limit; flat_x++, flat_xout++) {
       float acc = 0;
       for (int k = 0; k < window_size; k++) {
@@ -287,6 +317,50 @@ void ConvolveInnerDim(Out* out, const In* in, const W* window, int window_size,
   }
 }
 
+/**
+ * @brief Convolves an outer (not the innermost) axis, not in-place.
+ *
+ * Processes the output rows in range [row_begin, row_end), where a row is the contiguous
+ * span of `strides[axis]` elements at a given position along the axis; the rows are enumerated
+ * in the order of the outer dimensions and the position along the axis.
+ *
+ * Each row is processed in cache-sized blocks, accumulating the contributions of the
+ * `diameter` input rows for the whole block at once - the inner loop over the block is contiguous
+ * and can be vectorized. The order of summation is the same as in the sliding window version.
+ */
+template <int axis, typename Out, typename In, typename W, int ndim,
+          typename T = conv_transform::TransScaleSat<Out, W>>
+void ConvolveOuterAxis(Out* out, const In* in, const W* window, int diameter,
+                       const TensorShape<ndim>& shape, const TensorShape<ndim>& strides,
+                       const T& transform, int64_t row_begin, int64_t row_end) {
+  constexpr int kBlock = 256;
+  int64_t axis_size = shape[axis];
+  int64_t axis_stride = strides[axis];
+  int64_t outer_stride = axis > 0 ? strides[axis - 1] : 0;
+  int radius = (diameter - 1) / 2;
+  W acc[kBlock];
+  for (int64_t row = row_begin; row < row_end; row++) {
+    int64_t outer_idx = row / axis_size;
+    int64_t y = row % axis_size;
+    const In* in_outer = in + outer_idx * outer_stride;
+    int64_t out_offset = outer_idx * outer_stride + y * axis_stride;
+    for (int64_t x0 = 0; x0 < axis_stride; x0 += kBlock) {
+      int n = std::min<int64_t>(kBlock, axis_stride - x0);
+      for (int i = 0; i < n; i++)
+        acc[i] = 0;
+      for (int k = 0; k < diameter; k++) {
+        int64_t in_y = boundary::idx_reflect_101<int64_t>(y - radius + k, axis_size);
+        const In* __restrict__ in_row = in_outer + in_y * axis_stride + x0;
+        W w = window[k];
+        for (int i = 0; i < n; i++)
+          acc[i] += w * in_row[i];
+      }
+      for (int i = 0; i < n; i++)
+        transform(out, out_offset + x0 + i, acc[i]);
+    }
+  }
+}
+
 template <int axis, bool has_channels, int max_lanes, typename Out, typename In, typename W,
           int ndim, typename T = conv_transform::TransScaleSat<Out, W>>
 void ConvolveInplaceAxisLoop(Out* out, const In* in, const W* window,
@@ -330,32 +404,52 @@ void ConvolveInplaceAxisLoop(Out* out, const In* in, const W* window,
   }
 }
 
+/**
+ * @brief The number of lanes processed at once by the sliding window in ConvolveInplaceOuterLoop.
+ */
+template <int axis, bool has_channels, int max_lanes, int ndim>
+int64_t InplaceStripSize(const TensorShape<ndim>& shape) {
+  if (has_channels && axis == ndim - 2) {
+    return shape[ndim - 1];
+  } else if (!has_channels && axis == ndim - 1) {
+    return 1;
+  }
+  return max_lanes;
+}
+
+/**
+ * @brief Convolves the `axis` with a sliding window kept in a cyclic buffer, which allows
+ *        for in-place operation.
+ *
+ * The strips in range [strip_begin, strip_end) are processed, where the strips are enumerated
+ * by the outer index and then by the position in the inner dimensions; negative `strip_end`
+ * denotes all of them. The strips are independent, so disjoint ranges can be processed
+ * concurrently, each with its own `input_window_buffer`.
+ */
 template <int axis, bool has_channels, int max_lanes, typename Out, typename In, typename W,
           int ndim, typename T = conv_transform::TransScaleSat<Out, W>>
 void ConvolveInplaceOuterLoop(Out* out, const In* in, const W* window,
                               const TensorShape<ndim>& shape, const TensorShape<ndim>& strides,
-                              int diameter, In* input_window_buffer, const T& transform) {
+                              int diameter, In* input_window_buffer, const T& transform,
+                              int64_t strip_begin = 0, int64_t strip_end = -1) {
   int64_t outer_elements = volume(&shape[0], &shape[axis]);
-  int64_t axis_elements = shape[axis];
   int64_t inner_elements = volume(&shape[axis + 1], &shape[ndim]);
   assert(strides[axis] == inner_elements);
 
-  int64_t strip_size = max_lanes;
-  if (has_channels && axis == ndim - 2) {
-    strip_size = shape[ndim - 1];
-  } else if (!has_channels && axis == ndim - 1) {
-    strip_size = 1;
-  }
+  int64_t strip_size = InplaceStripSize<axis, has_channels, max_lanes>(shape);
+  int64_t strips_per_outer = div_ceil(inner_elements, strip_size);
+  if (strip_end < 0)
+    strip_end = outer_elements * strips_per_outer;
   // TODO(klecki): to handle border fill, one must keep track of how inner_idx maps to
   // pixel/channels, and prepare a fill window starting with appropriate channel
-  for (int64_t outer_idx = 0; outer_idx < outer_elements; outer_idx++) {
-    for (int64_t inner_idx = 0; inner_idx < inner_elements; inner_idx += strip_size) {
-      int64_t offset = outer_idx * (axis > 0 ? strides[axis - 1] : 0) + inner_idx;
-      int num_lanes = std::min(inner_elements - inner_idx, strip_size);
-      ConvolveInplaceAxisLoop<axis, has_channels, max_lanes>(
-        out, in, window, shape, strides, diameter, offset, input_window_buffer, num_lanes,
-        transform);
-    }
+  for (int64_t strip = strip_begin; strip < strip_end; strip++) {
+    int64_t outer_idx = strip / strips_per_outer;
+    int64_t inner_idx = strip % strips_per_outer * strip_size;
+    int64_t offset = outer_idx * (axis > 0 ? strides[axis - 1] : 0) + inner_idx;
+    int num_lanes = std::min(inner_elements - inner_idx, strip_size);
+    ConvolveInplaceAxisLoop<axis, has_channels, max_lanes>(
+      out, in, window, shape, strides, diameter, offset, input_window_buffer, num_lanes,
+      transform);
   }
 }
 
@@ -363,12 +457,16 @@ void ConvolveInplaceOuterLoop(Out* out, const In* in, const W* window,
  * @brief Apply convolution with 1-channel `window` in specified axis.
  *
  * The innermost dimension performed _not_ in-place uses implementation that will be faster
- * than in-place one that requires additional copy.
+ * than in-place one that requires additional copy. Its interior is processed in blocks of
+ * output values, which can be vectorized.
+ *
+ * Non-innermost convolution performed _not_ in-place accumulates whole blocks of rows
+ * along the axis, which is vectorized and cache friendly.
  *
- * For non-innermost convolution a sliding window (using a cyclic buffer) over several lanes is used
- * (can be comprised of several pixels, one channel is one lane). Can be safely performed in-place.
+ * In-place, a sliding window (using a cyclic buffer) over several lanes is used
+ * (can be comprised of several pixels, one channel is one lane).
  *
- * The same implementation is used for in-place innermost convolution.
+ * The work can be split into blocks and processed by an execution engine (see Schedule).
  */
 template <typename Out, typename In, typename W, int ndim, int axis, bool has_channels = true,
           typename T = conv_transform::TransScaleSat<Out, W>>
@@ -385,24 +483,54 @@ struct ConvolutionCpu {
     return req;
   }
 
+  /**
+   * @brief Schedules the convolution with an execution engine.
+   *
+   * The work is split into blocks of rows (or strips, for in-place operation), which are added
+   * to the `engine` and don't start until the caller calls `engine.RunAll()`.
+   * The buffers are allocated from `ctx.scratchpad`, which must be kept alive until the work
+   * is complete.
+   *
+   * @param req_nblocks Requested number of blocks. By default, it's `8 * engine.NumThreads()`
+   *                    or 1, for a single-threaded engine; limited by kMinBlockVolume.
+   */
+  template <typename ExecutionEngine>
+  void Schedule(KernelContext& ctx, const TensorView<StorageCPU, Out, ndim> &out,
+                const TensorView<StorageCPU, const In, ndim>& in,
+                const TensorView<StorageCPU, const W, 1>& window,
+                ExecutionEngine &engine, const T &transform = {}, int req_nblocks = -1) {
+    int64_t total_volume = volume(in.shape);
+    if (total_volume == 0)
+      return;
+    if (req_nblocks < 0)
+      req_nblocks = engine.NumThreads() > 1 ? engine.NumThreads() * 8 : 1;
+    int diameter = window.num_elements();
+    auto strides = GetStrides(in.shape);
+    Method method = GetMethod(out, in);
+    int64_t nrows = NumRows(method, in.shape);
+    int64_t row_volume = div_ceil(total_volume, nrows);
+    int64_t min_rows = div_ceil(kMinBlockVolume, row_volume);
+    int64_t nblocks = std::max<int64_t>(1, std::min<int64_t>(req_nblocks, nrows / min_rows));
+    int input_window_buf_size = GetInputWindowBufSize(in.shape, diameter);
+
+    for (int64_t b = 0; b < nblocks; b++) {
+      int64_t begin = nrows * b / nblocks;
+      int64_t end = nrows * (b + 1) / nblocks;
+      In* input_window_buffer = method == Method::SlidingWindow
+                                    ? ctx.scratchpad->AllocateHost<In>(input_window_buf_size)
+                                    : nullptr;
+      engine.AddWork([=](int) {
+        RunRows(method, out, in, window, strides, input_window_buffer, transform, begin, end);
+      }, (end - begin) * row_volume * diameter, false);
+    }
+  }
+
   void Run(KernelContext& ctx, const TensorView<StorageCPU, Out, ndim> &out,
            const TensorView<StorageCPU, const In, ndim>& in,
            const TensorView<StorageCPU, const W, 1>& window,
            const T &transform = {}) {
-    auto diameter = window.num_elements();
-    int input_window_buf_size = GetInputWindowBufSize(in.shape, diameter);
-    auto* input_window_buffer = ctx.scratchpad->AllocateHost<In>(input_window_buf_size);
-    auto strides = GetStrides(in.shape);
-
-    if (axis == ndim - has_channels - 1 &&
-        static_cast<const void*>(out.data) != static_cast<const void*>(in.data)) {
-      ConvolveInnerDim<has_channels>(
-        out.data, in.data, window.data, diameter, in.shape, strides, transform);
-    } else {
-      ConvolveInplaceOuterLoop<axis, has_channels, kStripSize, Out, In, W, ndim>(
-        out.data, in.data, window.data, in.shape, strides, diameter, input_window_buffer,
-        transform);
-    }
+    SequentialExecutionEngine engine;
+    Schedule(ctx, out, in, window, engine, transform);
   }
 
  private:
@@ -410,8 +538,60 @@ struct ConvolutionCpu {
                 "Selected axis must be in [0, ndim) when there is no channel axis, or in [0, ndim "
                 "- 1) for channel-last input");
 
+  static constexpr bool kInnermost = axis == ndim - has_channels - 1;
+
+  enum class Method {
+    InnerDim,      // ConvolveInnerDim, rows are the outer elements
+    OuterAxis,     // ConvolveOuterAxis, rows are the rows along the axis
+    SlidingWindow  // ConvolveInplaceOuterLoop, rows are the strips
+  };
+
+  static Method GetMethod(const TensorView<StorageCPU, Out, ndim> &out,
+                          const TensorView<StorageCPU, const In, ndim>& in) {
+    if (static_cast<const void*>(out.data) == static_cast<const void*>(in.data))
+      return Method::SlidingWindow;
+    return kInnermost ? Method::InnerDim : Method::OuterAxis;
+  }
+
+  static int64_t NumRows(Method method, const TensorShape<ndim>& shape) {
+    switch (method) {
+      case Method::InnerDim:
+        return volume(&shape[0], &shape[axis]);
+      case Method::OuterAxis:
+        return volume(&shape[0], &shape[axis + 1]);
+      default: {
+        int64_t strip_size = InplaceStripSize<axis, has_channels, kStripSize>(shape);
+        return volume(&shape[0], &shape[axis]) *
+               div_ceil(volume(&shape[axis + 1], &shape[ndim]), strip_size);
+      }
+    }
+  }
+
+  static void RunRows(Method method, const TensorView<StorageCPU, Out, ndim> &out,
+                      const TensorView<StorageCPU, const In, ndim>& in,
+                      const TensorView<StorageCPU, const W, 1>& window,
+                      const TensorShape<ndim>& strides, In* input_window_buffer,
+                      const T& transform, int64_t begin, int64_t end) {
+    int diameter = window.num_elements();
+    switch (method) {
+      case Method::InnerDim:
+        ConvolveInnerDim<has_channels>(out.data, in.data, window.data, diameter, in.shape, strides,
+                                       transform, begin, end);
+        break;
+      case Method::OuterAxis:
+        ConvolveOuterAxis<axis>(out.data, in.data, window.data, diameter, in.shape, strides,
+                                transform, begin, end);
+        break;
+      default:
+        ConvolveInplaceOuterLoop<axis, has_channels, kStripSize, Out, In, W, ndim>(
+          out.data, in.data, window.data, in.shape, strides, diameter, input_window_buffer,
+          transform, begin, end);
+        break;
+    }
+  }
+
   int GetInputWindowBufSize(const TensorShape<ndim>& in_shape, int window_size) {
-    if (axis == ndim - has_channels - 1) {
+    if (kInnermost) {
       int num_channels = has_channels ? in_shape[ndim - 1] : 1;
       return num_channels * window_size;
     } else {
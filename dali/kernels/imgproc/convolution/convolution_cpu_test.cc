@@ -1,4 +1,4 @@
-// Copyright (c) 2020-2021, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+// Copyright (c) 2020-2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
 //
 // Licensed under the Apache License, Version 2.0 (the "License");
 // you may not use this file except in compliance with the License.
@@ -26,10 +26,13 @@
 #include "dali/test/test_tensors.h"
 #include "dali/kernels/imgproc/convolution/baseline_convolution.h"
 #include "dali/kernels/dynamic_scratchpad.h"
+#include "dali/kernels/test/test_execution_engine.h"
 
 namespace dali {
 namespace kernels {
 
+using dali::testing::ReverseExecutionEngine;
+
 template <typename T>
 struct CyclicWindowWrapperTest : public ::testing::Test {};
 
@@ -409,5 +412,66 @@ REGISTER_TYPED_TEST_SUITE_P(ConvolutionCpuKernelTest, DoConvolution);
 INSTANTIATE_TYPED_TEST_SUITE_P(ConvolutionCpuKernel, ConvolutionCpuKernelTest,
                                ConvolutionTestValues);
 
+template <int ndim, int axis, typename In>
+void TestScheduledConvolution(const TensorShape<ndim> &shape, int window_size, bool in_place) {
+  using Kernel = ConvolutionCpu<float, In, float, ndim, axis, true>;
+  TestTensorList<float, 1> window_list;
+  window_list.reshape(uniform_list_shape<1>(1, {window_size}));
+  auto window = window_list.cpu()[0];
+  testing::InitTriangleWindow(window);
+
+  TestTensorList<In, ndim> input, input_copy;
+  TestTensorList<float, ndim> output, baseline;
+  for (auto *tl : {&input, &input_copy})
+    tl->reshape(uniform_list_shape<ndim>(1, shape));
+  for (auto *tl : {&output, &baseline})
+    tl->reshape(uniform_list_shape<ndim>(1, shape));
+  auto in = input.cpu()[0];
+  std::mt19937 rng;
+  UniformRandomFill(in, rng, 0, 255);
+  memcpy(input_copy.cpu()[0].data, in.data, volume(shape) * sizeof(In));
+  testing::BaselineConvolve(baseline.cpu()[0], input_copy.cpu()[0], window, axis,
+                            window_size / 2);
+
+  TensorView<StorageCPU, float, ndim> out;
+  if (in_place) {
+    out = {reinterpret_cast<float *>(in.data), shape};
+  } else {
+    out = output.cpu()[0];
+    ConstantFill(out, -1);
+  }
+
+  Kernel kernel;
+  KernelContext ctx;
+  DynamicScratchpad scratchpad(AccessOrder::host());
+  ctx.scratchpad = &scratchpad;
+  kernel.Setup(ctx, shape, window_size);
+  ReverseExecutionEngine engine;
+  kernel.Schedule(ctx, out, in, window, engine, {}, 7);
+  engine.RunAll();
+  EXPECT_GT(engine.num_blocks_, 1);
+  Check(out, baseline.cpu()[0]);
+}
+
+TEST(ConvolutionCpuScheduleTest, InnerAxis) {
+  for (int window_size : {3, 31, 101})
+    TestScheduledConvolution<3, 1, uint8_t>({60, 300, 3}, window_size, false);
+}
+
+TEST(ConvolutionCpuScheduleTest, OuterAxis) {
+  for (int window_size : {3, 31, 101}) {
+    TestScheduledConvolution<3, 0, uint8_t>({200, 150, 3}, window_size, false);
+    TestScheduledConvolution<4, 1, uint8_t>({7, 90, 80, 3}, window_size, false);
+  }
+}
+
+TEST(ConvolutionCpuScheduleTest, InPlace) {
+  for (int window_size : {3, 31}) {
+    TestScheduledConvolution<3, 0, float>({200, 150, 3}, window_size, true);
+    TestScheduledConvolution<3, 1, float>({200, 150, 3}, window_size, true);
+    TestScheduledConvolution<4, 1, float>({7, 90, 80, 3}, window_size, true);
+  }
+}
+
 }  // namespace kernels
 }  // namespace dali
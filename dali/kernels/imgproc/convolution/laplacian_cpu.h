@@ -1,4 +1,4 @@
-// Copyright (c) 2021-2022, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+// Copyright (c) 2021-2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
 //
 // Licensed under the Apache License, Version 2.0 (the "License");
 // you may not use this file except in compliance with the License.
@@ -17,6 +17,7 @@
 
 #include <memory>
 
+#include "dali/core/exec/engine.h"
 #include "dali/core/tensor_view.h"
 #include "dali/kernels/common/utils.h"
 #include "dali/kernels/imgproc/convolution/convolution_cpu.h"
@@ -71,6 +72,19 @@ struct PartialDeriv {
     return multi_dim_impl_->Setup(ctx, in_shape, window_sizes);
   }
 
+  template <typename ExecutionEngine>
+  void Schedule(KernelContext& ctx, const TensorView<StorageCPU, Out, ndim>& out,
+                const TensorView<StorageCPU, const In, ndim>& in,
+                const std::array<TensorView<StorageCPU, const W, 1>, axes>& windows,
+                ExecutionEngine& engine, const T& transform = {}, int req_nblocks = -1) {
+    if (no_smoothing_) {
+      single_dim_impl_->Schedule(ctx, out, in, windows[deriv_axis], engine, transform,
+                                 req_nblocks);
+    } else {
+      multi_dim_impl_->Schedule(ctx, out, in, windows, engine, transform, req_nblocks);
+    }
+  }
+
   void Run(KernelContext& ctx, const TensorView<StorageCPU, Out, ndim>& out,
            const TensorView<StorageCPU, const In, ndim>& in,
            const std::array<TensorView<StorageCPU, const W, 1>, axes>& windows,
@@ -93,6 +107,9 @@ struct PartialDeriv {
  *  Run methods expect additional ``acc`` buffer that will be used to accumulate
  *  partial derivatives. If ``Intermediate`` and ``Out`` are the same type,
  *  the ``acc`` and ``out`` can be the same tensor.
+ *  Schedule methods split the partial derivatives into blocks processed by an execution engine;
+ *  ``engine.RunAll()`` is called between the dependent steps and the last one is left
+ *  to the caller.
  */
 template <typename T, typename Intermediate, typename Out, typename In, typename W, int axes,
           bool has_channels>
@@ -136,6 +153,19 @@ struct LaplacianCpuBase<T, Intermediate, Out, In, W, 2, has_channels> {
     }
   }
 
+  template <typename ExecutionEngine>
+  void Schedule(KernelContext& ctx, const TensorView<StorageCPU, Out, ndim>& out,
+                const TensorView<StorageCPU, Intermediate, ndim>& acc,
+                const TensorView<StorageCPU, const In, ndim>& in,
+                const std::array<std::array<TensorView<StorageCPU, const W, 1>, axes>, axes>&
+                    windows,
+                const std::array<float, axes>& scale, const T& transform,
+                ExecutionEngine& engine, int req_nblocks = -1) {
+    dy_kernel_.Schedule(ctx, acc, in, windows[0], engine, scale[0], req_nblocks);
+    engine.RunAll();
+    dx_kernel_.Schedule(ctx, out, in, windows[1], engine, transform, req_nblocks);
+  }
+
   DyKernel dy_kernel_;
   DxKernel dx_kernel_;
 };
@@ -189,6 +219,21 @@ struct LaplacianCpuBase<T, Intermediate, Out, In, W, 3, has_channels> {
     }
   }
 
+  template <typename ExecutionEngine>
+  void Schedule(KernelContext& ctx, const TensorView<StorageCPU, Out, ndim>& out,
+                const TensorView<StorageCPU, Intermediate, ndim>& acc,
+                const TensorView<StorageCPU, const In, ndim>& in,
+                const std::array<std::array<TensorView<StorageCPU, const W, 1>, axes>, axes>&
+                    windows,
+                const std::array<float, axes>& scale, const T& transform,
+                ExecutionEngine& engine, int req_nblocks = -1) {
+    dz_kernel_.Schedule(ctx, acc, in, windows[0], engine, scale[0], req_nblocks);
+    engine.RunAll();
+    dy_kernel_.Schedule(ctx, acc, in, windows[1], engine, scale[1], req_nblocks);
+    engine.RunAll();
+    dx_kernel_.Schedule(ctx, out, in, windows[2], engine, transform, req_nblocks);
+  }
+
   DzKernel dz_kernel_;
   DyKernel dy_kernel_;
   DxKernel dx_kernel_;
@@ -248,6 +293,19 @@ struct LaplacianCpu<Intermediate, Out, In, W, axes, has_channels,
     auto acc = TensorView<StorageCPU, Intermediate, ndim>(tmp, in.shape);
     Base::Run(ctx, out, acc, in, windows, scale, {tmp, scale[axes - 1]});
   }
+
+  template <typename ExecutionEngine>
+  void Schedule(KernelContext& ctx, const TensorView<StorageCPU, Out, ndim>& out,
+                const TensorView<StorageCPU, const In, ndim>& in,
+                const std::array<std::array<TensorView<StorageCPU, const W, 1>, axes>, axes>&
+                    windows,
+                const std::array<float, axes>& scale, ExecutionEngine& engine,
+                int req_nblocks = -1) {
+    auto* tmp = ctx.scratchpad->AllocateHost<Intermediate>(volume(in.shape));
+    auto acc = TensorView<StorageCPU, Intermediate, ndim>(tmp, in.shape);
+    Base::Schedule(ctx, out, acc, in, windows, scale, {tmp, scale[axes - 1]}, engine,
+                   req_nblocks);
+  }
 };
 
 template <typename Out, typename In, typename W, int axes, bool has_channels>
@@ -264,6 +322,16 @@ struct LaplacianCpu<Out, Out, In, W, axes, has_channels, std::enable_if_t<axes !
            const std::array<float, axes>& scale) {
     Base::Run(ctx, out, out, in, windows, scale, scale[axes - 1]);
   }
+
+  template <typename ExecutionEngine>
+  void Schedule(KernelContext& ctx, const TensorView<StorageCPU, Out, ndim>& out,
+                const TensorView<StorageCPU, const In, ndim>& in,
+                const std::array<std::array<TensorView<StorageCPU, const W, 1>, axes>, axes>&
+                    windows,
+                const std::array<float, axes>& scale, ExecutionEngine& engine,
+                int req_nblocks = -1) {
+    Base::Schedule(ctx, out, out, in, windows, scale, scale[axes - 1], engine, req_nblocks);
+  }
 };
 
 template <typename Intermediate, typename Out, typename In, typename W, bool has_channels>
@@ -285,6 +353,16 @@ struct LaplacianCpu<Intermediate, Out, In, W, 1, has_channels> {
     return conv_.Run(ctx, out, in, windows[0], scale[0]);
   }
 
+  template <typename ExecutionEngine>
+  void Schedule(KernelContext& ctx, const TensorView<StorageCPU, Out, ndim>& out,
+                const TensorView<StorageCPU, const In, ndim>& in,
+                const std::array<std::array<TensorView<StorageCPU, const W, 1>, axes>, axes>&
+                    windows,
+                const std::array<float, axes>& scale, ExecutionEngine& engine,
+                int req_nblocks = -1) {
+    conv_.Schedule(ctx, out, in, windows[0], engine, scale[0], req_nblocks);
+  }
+
   ConvKernel conv_;
 };
 
@@ -1,4 +1,4 @@
-// Copyright (c) 2020-2021, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+// Copyright (c) 2020-2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
 //
 // Licensed under the Apache License, Version 2.0 (the "License");
 // you may not use this file except in compliance with the License.
@@ -16,6 +16,7 @@
 #define DALI_KERNELS_IMGPROC_CONVOLUTION_SEPARABLE_CONVOLUTION_CPU_H_
 
 #include "dali/core/convert.h"
+#include "dali/core/exec/engine.h"
 #include "dali/core/format.h"
 #include "dali/core/tensor_view.h"
 #include "dali/kernels/common/utils.h"
@@ -38,6 +39,11 @@ namespace kernels {
  * Specialized for 1, 2 or 3 axes, to not go overboard with TMP for generic solutions
  * For 2 and 3 axes, an intermediate buffer is allocated in the scratchpad.
  *
+ * `Schedule` splits each pass into blocks processed by an execution engine. The passes depend
+ * on each other, so `engine.RunAll()` is called between them; the work of the last pass
+ * is only scheduled - it's up to the caller to run it. The scratchpad must be kept alive until
+ * the work is complete.
+ *
  * N.B. For more dimension, fusing a permute step when writing the result
  * could allow for processing all steps with innermost, contiguous dimension.
  * For example DHWC->DWHC->HWDC->DHWC, while applying convolutions for W, H, D respectively.
@@ -60,6 +66,14 @@ struct SeparableConvolutionCpu<Out, In, W, 1, has_channels, T> {
     return req;
   }
 
+  template <typename ExecutionEngine>
+  void Schedule(KernelContext& ctx, const TensorView<StorageCPU, Out, ndim> &out,
+                const TensorView<StorageCPU, const In, ndim>& in,
+                const std::array<TensorView<StorageCPU, const W, 1>, axes>& windows,
+                ExecutionEngine& engine, const T& transform = {}, int req_nblocks = -1) {
+    conv_.Schedule(ctx, out, in, windows[0], engine, transform, req_nblocks);
+  }
+
   void Run(KernelContext& ctx, const TensorView<StorageCPU, Out, ndim> &out,
            const TensorView<StorageCPU, const In, ndim>& in,
            const std::array<TensorView<StorageCPU, const W, 1>, axes>& windows,
@@ -88,25 +102,25 @@ struct SeparableConvolutionCpu<Out, In, W, 2, has_channels, T> {
     return req;
   }
 
+  template <typename ExecutionEngine>
+  void Schedule(KernelContext& ctx, const TensorView<StorageCPU, Out, ndim> &out,
+                const TensorView<StorageCPU, const In, ndim>& in,
+                const std::array<TensorView<StorageCPU, const W, 1>, axes>& windows,
+                ExecutionEngine& engine, const T& transform = {}, int req_nblocks = -1) {
+    auto *tmp = ctx.scratchpad->AllocateHost<Intermediate>(volume(in.shape));
+    auto intermediate = TensorView<StorageCPU, Intermediate, ndim>(tmp, in.shape);
+
+    conv_innermost_.Schedule(ctx, intermediate, in, windows[1], engine, {}, req_nblocks);
+    engine.RunAll();
+    conv_outermost_.Schedule(ctx, out, intermediate, windows[0], engine, transform, req_nblocks);
+  }
+
   void Run(KernelContext& ctx, const TensorView<StorageCPU, Out, ndim> &out,
            const TensorView<StorageCPU, const In, ndim>& in,
            const std::array<TensorView<StorageCPU, const W, 1>, axes>& windows,
            const T& transform = {}) {
-    auto *tmp = ctx.scratchpad->AllocateHost<Intermediate>(volume(in.shape));
-    auto intermediate = TensorView<StorageCPU, Intermediate, ndim>(tmp, in.shape);
-
-    {
-      KernelContext sub_ctx = ctx;
-      kernels::DynamicScratchpad dyn_scratchpad(AccessOrder::host());
-      sub_ctx.scratchpad = &dyn_scratchpad;
-      conv_innermost_.Run(sub_ctx, intermediate, in, windows[1]);
-    }
-    {
-      KernelContext sub_ctx = ctx;
-      kernels::DynamicScratchpad dyn_scratchpad(AccessOrder::host());
-      sub_ctx.scratchpad = &dyn_scratchpad;
-      conv_outermost_.Run(sub_ctx, out, intermediate, windows[0], transform);
-    }
+    SequentialExecutionEngine engine;
+    Schedule(ctx, out, in, windows, engine, transform);
   }
 
   ConvolutionCpu<Intermediate, In, W, ndim, 1, has_channels, InnerTransform> conv_innermost_;
@@ -131,33 +145,27 @@ struct SeparableConvolutionCpu<Out, In, W, 3, has_channels, T> {
     return req;
   }
 
+  template <typename ExecutionEngine>
+  void Schedule(KernelContext& ctx, const TensorView<StorageCPU, Out, ndim> &out,
+                const TensorView<StorageCPU, const In, ndim>& in,
+                const std::array<TensorView<StorageCPU, const W, 1>, axes>& windows,
+                ExecutionEngine& engine, const T& transform = {}, int req_nblocks = -1) {
+    auto* tmp = ctx.scratchpad->AllocateHost<Intermediate>(volume(in.shape));
+    auto intermediate = TensorView<StorageCPU, Intermediate, ndim>(tmp, in.shape);
+
+    conv_innermost_.Schedule(ctx, intermediate, in, windows[2], engine, {}, req_nblocks);
+    engine.RunAll();
+    conv_middle_.Schedule(ctx, intermediate, intermediate, windows[1], engine, {}, req_nblocks);
+    engine.RunAll();
+    conv_outermost_.Schedule(ctx, out, intermediate, windows[0], engine, transform, req_nblocks);
+  }
+
   void Run(KernelContext& ctx, const TensorView<StorageCPU, Out, ndim> &out,
            const TensorView<StorageCPU, const In, ndim>& in,
            const std::array<TensorView<StorageCPU, const W, 1>, axes>& windows,
            const T& transform = {}) {
-    auto* tmp = ctx.scratchpad->AllocateHost<Intermediate>(volume(in.shape));
-    auto intermediate = TensorView<StorageCPU, Intermediate, ndim>(tmp, in.shape);
-
-    {
-      KernelContext sub_ctx = ctx;
-      kernels::DynamicScratchpad dyn_scratchpad(AccessOrder::host());
-      sub_ctx.scratchpad = &dyn_scratchpad;
-      conv_innermost_.Run(sub_ctx, intermediate, in, windows[2]);
-    }
-
-    {
-      KernelContext sub_ctx = ctx;
-      kernels::DynamicScratchpad dyn_scratchpad(AccessOrder::host());
-      sub_ctx.scratchpad = &dyn_scratchpad;
-      conv_middle_.Run(sub_ctx, intermediate, intermediate, windows[1]);
-    }
-
-    {
-      KernelContext sub_ctx = ctx;
-      kernels::DynamicScratchpad dyn_scratchpad(AccessOrder::host());
-      sub_ctx.scratchpad = &dyn_scratchpad;
-      conv_outermost_.Run(sub_ctx, out, intermediate, windows[0], transform);
-    }
+    SequentialExecutionEngine engine;
+    Schedule(ctx, out, in, windows, engine, transform);
   }
 
   ConvolutionCpu<Intermediate, In, W, ndim, 2, has_channels, InnerTransform> conv_innermost_;
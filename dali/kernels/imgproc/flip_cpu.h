@@ -1,4 +1,4 @@
-// Copyright (c) 2019, NVIDIA CORPORATION. All rights reserved.
+// Copyright (c) 2019-2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
 //
 // Licensed under the Apache License, Version 2.0 (the "License");
 // you may not use this file except in compliance with the License.
@@ -16,6 +16,7 @@
 #ifndef DALI_KERNELS_IMGPROC_FLIP_CPU_H_
 #define DALI_KERNELS_IMGPROC_FLIP_CPU_H_
 
+#include <algorithm>
 #include "dali/util/ocv.h"
 #include "dali/core/common.h"
 #include "dali/core/error_handling.h"
@@ -93,6 +94,42 @@ void FlipImpl(Type *output, const Type *input,
   }
 }
 
+/**
+ * @brief Produces the output rows [row_begin, row_end) of a flipped tensor
+ *
+ * The rows of all the planes (frames * depth) are numbered consecutively, so the range can
+ * be used to split the flipping of a large sample into several jobs.
+ */
+template <typename Type>
+void FlipRows(Type *output, const Type *input,
+              TensorShape<sample_ndim> shape, bool flip_z, bool flip_y, bool flip_x,
+              int64_t row_begin, int64_t row_end) {
+  int64_t depth = shape[1], height = shape[2], width = shape[3], channels = shape[4];
+  int64_t row_size = width * channels;
+  int64_t plane_size = height * row_size;
+  int flip_flag = !flip_y ? 1 : !flip_x ? 0 : -1;
+  auto ocv_type = flip_x || flip_y ? GetOcvType<uint8_t>(channels * sizeof(Type)) : 0;
+  for (int64_t row = row_begin; row < row_end; ) {
+    int64_t plane = row / height;
+    int64_t y_begin = row - plane * height;
+    int64_t y_end = std::min(height, y_begin + row_end - row);
+    int64_t nrows = y_end - y_begin;
+    int64_t z = plane % depth;
+    int64_t in_plane = plane - z + (flip_z ? depth - z - 1 : z);
+    int64_t in_y_begin = flip_y ? height - y_end : y_begin;
+    Type *out = output + plane * plane_size + y_begin * row_size;
+    const Type *in = input + in_plane * plane_size + in_y_begin * row_size;
+    if (flip_x || flip_y) {
+      auto input_mat = CreateMatFromPtr(nrows, width, ocv_type, in);
+      auto output_mat = CreateMatFromPtr(nrows, width, ocv_type, out);
+      cv::flip(input_mat, output_mat, flip_flag);
+    } else {
+      std::copy(in, in + nrows * row_size, out);
+    }
+    row += nrows;
+  }
+}
+
 }  // namespace cpu
 }  // namespace detail
 
@@ -114,6 +151,23 @@ class DLL_PUBLIC FlipCPU {
     auto out_data = out.data;
     detail::cpu::FlipImpl(out_data, in_data, in.shape, flip_z, flip_y, flip_x);
   }
+
+  /**
+   * @brief Produces the output rows [row_begin, row_end), out of `NumRows(in.shape)`
+   */
+  DLL_PUBLIC void Run(KernelContext &Context, OutTensorCPU<Type, sample_ndim> &out,
+      const InTensorCPU<Type, sample_ndim> &in, bool flip_z, bool flip_y, bool flip_x,
+      int64_t row_begin, int64_t row_end) {
+    detail::cpu::FlipRows(out.data, in.data, in.shape, flip_z, flip_y, flip_x,
+                          row_begin, row_end);
+  }
+
+  /**
+   * @brief The number of rows (in all frames and planes) in a tensor of given shape
+   */
+  static int64_t NumRows(const TensorShape<sample_ndim> &shape) {
+    return shape[0] * shape[1] * shape[2];
+  }
 };
 
 }  // namespace kernels
@@ -1,4 +1,4 @@
-// Copyright (c) 2019, NVIDIA CORPORATION. All rights reserved.
+// Copyright (c) 2019-2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
 //
 // Licensed under the Apache License, Version 2.0 (the "License");
 // you may not use this file except in compliance with the License.
@@ -13,6 +13,7 @@
 // limitations under the License.
 
 #include <gtest/gtest.h>
+#include <algorithm>
 #include <tuple>
 #include <vector>
 #include "dali/kernels/imgproc/flip_test.h"
@@ -73,6 +74,25 @@ TEST_P(FlipCpuTest, KernelTest) {
                          flip_z_, flip_y_, flip_x_));
 }
 
+TEST_P(FlipCpuTest, KernelRangesTest) {
+  KernelContext ctx;
+  FlipCPU<float> kernel;
+  KernelRequirements reqs = kernel.Setup(ctx, in_view_);
+  auto out_shape = reqs.output_shapes[0][0].to_static<sample_ndim>();
+  std::vector<float> out_data(volume(out_shape));
+  auto out_view = OutTensorCPU<float, sample_ndim>(out_data.data(), out_shape);
+  int64_t nrows = FlipCPU<float>::NumRows(in_view_.shape);
+  // an odd step, so that the ranges cross the plane boundaries
+  int64_t step = 7;
+  for (int64_t begin = 0; begin < nrows; begin += step) {
+    kernel.Run(ctx, out_view, in_view_, flip_z_, flip_y_, flip_x_,
+               begin, std::min(begin + step, nrows));
+  }
+  ASSERT_TRUE(is_flipped(out_view.data, in_view_.data,
+                         shape_[0], shape_[1], shape_[2], shape_[3], shape_[4],
+                         flip_z_, flip_y_, flip_x_));
+}
+
 INSTANTIATE_TEST_SUITE_P(FlipCpuTest, FlipCpuTest, testing::Combine(
     testing::Values(0, 1),
     testing::Values(0, 1),
@@ -19,6 +19,7 @@
 #include <type_traits>
 #include "dali/core/static_switch.h"
 #include "dali/core/convert.h"
+#include "dali/kernels/common/cpu_dispatch.h"
 #include "dali/kernels/common/simd.h"
 #include "dali/kernels/imgproc/surface.h"
 #include "dali/core/geom/vec.h"
@@ -120,6 +121,34 @@ struct SIMD_vert_resample_impl {
       out[i] = ConvertSat<Out>(tmp);
     }
   }
+
+#if DALI_X86_DISPATCH
+  static constexpr int kNumLanesAVX2 = kNumLanes > 8 ? kNumLanes : 8;
+  static constexpr int kNumVecsAVX2 = kNumLanesAVX2 / 8;
+
+  /**
+   * @brief AVX2 variant of `run` - processes kNumLanesAVX2 columns at a time; the remaining
+   *        columns are processed by `run`.
+   */
+  DALI_TARGET_AVX2
+  static void run_avx2(Out *out, const In **rows, const float *kernel, int support,
+                       int begin_col, int end_col) {
+    int i = begin_col;
+    for (; i + kNumLanesAVX2 <= end_col; i += kNumLanesAVX2) {
+      __m256 vtmp[kNumVecsAVX2];
+      for (int v = 0; v < kNumVecsAVX2; v++)
+        vtmp[v] = _mm256_setzero_ps();
+
+      for (int k = 0; k < support; k++) {
+        __m256 coeff = _mm256_set1_ps(kernel[k]);
+        for (int v = 0; v < kNumVecsAVX2; v++)
+          vtmp[v] = _mm256_fmadd_ps(coeff, simd::avx2::load8_f(rows[k] + i + 8 * v), vtmp[v]);
+      }
+      simd::avx2::store(out + i, vtmp);
+    }
+    run(out, rows, kernel, support, i, end_col);
+  }
+#endif
 };
 
 
@@ -370,6 +399,14 @@ void ResampleVert(
   assert(support > 0);
   const In **in_row_ptrs = static_cast<const In **>(alloca(support * sizeof(const In *)));
 
+  using Impl = SIMD_vert_resample_impl<Out, In>;
+  auto run = simd::IsaDispatch<decltype(&Impl::run)>{
+    Impl::run,
+#if DALI_X86_DISPATCH
+    Impl::run_avx2
+#endif
+  }.Select();
+
   for (int y = 0; y < out.size.y; y++) {
     Out *out_row = &out(0, y, 0);
 
@@ -383,8 +420,7 @@ void ResampleVert(
     for (int x0 = 0; x0 < flat_w; x0 += tile) {
       int tile_w = x0 + tile <= flat_w ? tile : flat_w - x0;
       assert(tile_w <= tile);
-      SIMD_vert_resample_impl<Out, In> res;
-      res.run(out_row, in_row_ptrs, &row_coeffs[y * support], support, x0, x0 + tile_w);
+      run(out_row, in_row_ptrs, &row_coeffs[y * support], support, x0, x0 + tile_w);
     }
   }
 }
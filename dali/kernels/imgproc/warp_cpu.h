@@ -1,4 +1,4 @@
-// Copyright (c) 2019, NVIDIA CORPORATION. All rights reserved.
+// Copyright (c) 2019-2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
 //
 // Licensed under the Apache License, Version 2.0 (the "License");
 // you may not use this file except in compliance with the License.
@@ -17,6 +17,7 @@
 
 #include <algorithm>
 #include "dali/core/common.h"
+#include "dali/core/exec/engine.h"
 #include "dali/core/geom/vec.h"
 #include "dali/core/geom/transform.h"
 #include "dali/core/static_switch.h"
@@ -25,16 +26,96 @@
 #include "dali/kernels/imgproc/sampler.h"
 #include "dali/kernels/imgproc/warp/map_coords.h"
 #include "dali/kernels/imgproc/warp/affine.h"
+#include "dali/pipeline/util/cost_scheduler.h"
 
 namespace dali {
 namespace kernels {
 
+namespace warp {
+
+/**
+ * @brief Warps a range of pixels of an output row with an affine mapping.
+ *
+ * The source coordinates are a linear function of x, so they are calculated for a block of
+ * pixels at once, along with the interpolation weights and the offsets of the source pixels -
+ * these loops can be vectorized. The pixels whose whole interpolation footprint lies within
+ * the source image are then sampled directly, without border handling; the remaining ones
+ * go through the generic sampler.
+ *
+ * @tparam static_channels  the number of channels, if known at compile time, or 0
+ */
+template <int static_channels, DALIInterpType interp, typename Out, typename In,
+          typename BorderType>
+void WarpAffineRow(Out *out_row, int out_w, const Sampler2D<interp, In> &sampler,
+                   vec2 src_row, vec2 dsdx, const BorderType &border) {
+  static_assert(interp == DALI_INTERP_NN || interp == DALI_INTERP_LINEAR,
+                "Only nearest neighbor and linear interpolation are supported");
+  constexpr int kBlock = 64;
+  constexpr bool is_linear = interp == DALI_INTERP_LINEAR;
+  const auto &in = sampler.surface;
+  const int nch = static_channels > 0 ? static_channels : in.channels;
+  const int64_t stride_x = in.strides.x;
+  const int64_t stride_y = in.strides.y;
+  const int64_t stride_c = in.channel_stride;
+  // the pixels at (x, y) and, for linear interpolation, (x + 1, y + 1) must be within the image
+  const unsigned limit_x = std::max(in.size.x - is_linear, 0);
+  const unsigned limit_y = std::max(in.size.y - is_linear, 0);
+
+  float sx[kBlock], sy[kBlock], qx[kBlock], qy[kBlock];
+  int64_t offset[kBlock];
+  uint8_t inside[kBlock];
+
+  for (int block_start = 0; block_start < out_w; block_start += kBlock) {
+    int n = std::min(kBlock, out_w - block_start);
+    for (int i = 0; i < n; i++) {
+      sx[i] = src_row.x + (block_start + i) * dsdx.x;
+      sy[i] = src_row.y + (block_start + i) * dsdx.y;
+    }
+    for (int i = 0; i < n; i++) {
+      // same as in the sampler - linear interpolation uses pixel centers
+      float x = is_linear ? sx[i] - 0.5f : sx[i];
+      float y = is_linear ? sy[i] - 0.5f : sy[i];
+      int x0 = floor_int(x);
+      int y0 = floor_int(y);
+      qx[i] = x - x0;
+      qy[i] = y - y0;
+      inside[i] = static_cast<unsigned>(x0) < limit_x && static_cast<unsigned>(y0) < limit_y;
+      offset[i] = inside[i] ? x0 * stride_x + y0 * stride_y : 0;
+    }
+    for (int i = 0; i < n; i++) {
+      Out *out_pixel = out_row + static_cast<int64_t>(block_start + i) * nch;
+      if (!inside[i]) {
+        sampler(out_pixel, vec2(sx[i], sy[i]), border);
+        continue;
+      }
+      const In *src = in.data + offset[i];
+      if constexpr (is_linear) {
+        float px = 1 - qx[i];
+        for (int c = 0; c < nch; c++) {
+          const In *s = src + c * stride_c;
+          float s0 = s[0] * px + s[stride_x] * qx[i];
+          float s1 = s[stride_y] * px + s[stride_x + stride_y] * qx[i];
+          out_pixel[c] = ConvertSat<Out>(s0 + (s1 - s0) * qy[i]);
+        }
+      } else {
+        for (int c = 0; c < nch; c++)
+          out_pixel[c] = ConvertSat<Out>(src[c * stride_c]);
+      }
+    }
+  }
+}
+
+}  // namespace warp
+
 /**
  * @brief Performs generic warping of one tensor (on CPU)
  *
  * The warping uses a mapping functor to map destination coordinates to source
  * coordinates and samples the source tensor at the resulting locations.
  *
+ * The output rows (or, in 3D, the rows of all slices) can be split into bands processed
+ * by an execution engine (see Schedule).
+ *
  * @remarks
  *  * Assumes HWC layout
  *  * Output and input have same number of spatial dimenions
@@ -69,6 +150,52 @@ class WarpCPU {
     return req;
   }
 
+  /**
+   * @brief Schedules the warp with an execution engine.
+   *
+   * The output is split into bands of rows, which are added to the `engine` and don't start
+   * until the caller calls `engine.RunAll()`.
+   *
+   * @param req_nblocks Requested number of bands. By default, it's `8 * engine.NumThreads()`
+   *                    or 1, for a single-threaded engine; limited by kMinBlockVolume.
+   */
+  template <typename ExecutionEngine>
+  void Schedule(
+      KernelContext &context,
+      const OutTensorCPU<OutputType, tensor_ndim> &output,
+      const InTensorCPU<InputType, tensor_ndim> &input,
+      const MappingParams &mapping_params,
+      const TensorShape<spatial_ndim> &out_size,
+      DALIInterpType interp,
+      const BorderType &border,
+      ExecutionEngine &engine,
+      int req_nblocks = -1) {
+    assert(output.shape == shape_cat(out_size, input.shape[channel_dim]));
+    if (interp != DALI_INTERP_NN && interp != DALI_INTERP_LINEAR)
+      DALI_FAIL("Unsupported interpolation type");
+
+    int64_t nrows = volume(&output.shape[0], &output.shape[spatial_ndim - 1]);
+    int64_t row_volume = output.shape[spatial_ndim - 1] * output.shape[channel_dim];
+    if (nrows == 0 || row_volume == 0)
+      return;
+    if (req_nblocks < 0)
+      req_nblocks = engine.NumThreads() > 1 ? engine.NumThreads() * 8 : 1;
+    int64_t min_rows = div_ceil(kMinBlockVolume, row_volume);
+    int64_t nblocks = std::max<int64_t>(1, std::min<int64_t>(req_nblocks, nrows / min_rows));
+
+    for (int64_t b = 0; b < nblocks; b++) {
+      int64_t row_begin = nrows * b / nblocks;
+      int64_t row_end = nrows * (b + 1) / nblocks;
+      engine.AddWork([this, output, input, mapping_params, interp, border,
+                      row_begin, row_end](int) {
+        Mapping mapping(mapping_params);
+        VALUE_SWITCH(interp, static_interp, (DALI_INTERP_NN, DALI_INTERP_LINEAR),
+          (RunImpl<static_interp>(output, input, mapping, border, row_begin, row_end);),
+          (assert(!"Unreachable code")));
+      }, (row_end - row_begin) * row_volume, false);
+    }
+  }
+
   void Run(
       KernelContext &context,
       const OutTensorCPU<OutputType, tensor_ndim> &output,
@@ -77,33 +204,26 @@ class WarpCPU {
       const TensorShape<spatial_ndim> &out_size,
       DALIInterpType interp = DALI_INTERP_LINEAR,
       const BorderType &border = {}) {
-    Mapping mapping(mapping_params);
-
-    assert(output.shape == shape_cat(out_size, input.shape[channel_dim]));
-
-    VALUE_SWITCH(interp, static_interp, (DALI_INTERP_NN, DALI_INTERP_LINEAR),
-      (RunImpl<static_interp>(context, output, input, mapping, border);),
-      (DALI_FAIL("Unsupported interpolation type"))
-    ); // NOLINT
+    SequentialExecutionEngine engine;
+    Schedule(context, output, input, mapping_params, out_size, interp, border, engine);
   }
 
  private:
   template <DALIInterpType static_interp, typename Mapping_>
   void RunImpl(
-      KernelContext &context,
       const OutTensorCPU<OutputType, 3> &output,
       const InTensorCPU<InputType, 3> &input,
       Mapping_ &mapping,
-      BorderType border = {}) {
+      BorderType border,
+      int64_t row_begin, int64_t row_end) {
     int out_w = output.shape[1];
-    int out_h = output.shape[0];
     int c     = output.shape[2];
 
     Surface2D<const InputType> in = as_surface_channel_last(input);
 
     Sampler2D<static_interp, InputType> sampler(in);
 
-    for (int y = 0; y < out_h; y++) {
+    for (int y = row_begin; y < row_end; y++) {
       OutputType *out_row = output(y, 0);
       for (int x = 0; x < out_w; x++) {
         auto src = warp::map_coords(mapping, ivec2(x, y));
@@ -114,27 +234,26 @@ class WarpCPU {
 
   template <DALIInterpType static_interp, typename Mapping_>
   void RunImpl(
-      KernelContext &context,
       const OutTensorCPU<OutputType, 4> &output,
       const InTensorCPU<InputType, 4> &input,
       Mapping_ &mapping,
-      BorderType border = {}) {
+      BorderType border,
+      int64_t row_begin, int64_t row_end) {
     int out_w = output.shape[2];
     int out_h = output.shape[1];
-    int out_d = output.shape[0];
     int c     = output.shape[3];
 
-    Surface2D<const InputType> in = as_surface_channel_last(input);
+    Surface3D<const InputType> in = as_surface_channel_last(input);
 
-    Sampler2D<static_interp, InputType> sampler(in);
+    Sampler3D<static_interp, InputType> sampler(in);
 
-    for (int z = 0; z < out_d; z++) {
-      for (int y = 0; y < out_h; y++) {
-        OutputType *out_row = output(z, y, 0);
-        for (int x = 0; x < out_w; x++) {
-          auto src = warp::map_coords(mapping, ivec3(x, y, z));
-          sampler(&out_row[c*x], src, border);
-        }
+    for (int64_t row = row_begin; row < row_end; row++) {
+      int z = row / out_h;
+      int y = row % out_h;
+      OutputType *out_row = output(z, y, 0);
+      for (int x = 0; x < out_w; x++) {
+        auto src = warp::map_coords(mapping, ivec3(x, y, z));
+        sampler(&out_row[c*x], src, border);
       }
     }
   }
@@ -142,52 +261,54 @@ class WarpCPU {
 
   template <DALIInterpType static_interp>
   void RunImpl(
-      KernelContext &context,
       const OutTensorCPU<OutputType, 3> &output,
       const InTensorCPU<InputType, 3> &input,
       AffineMapping<2> &mapping,
-      BorderType border = {}) {
+      BorderType border,
+      int64_t row_begin, int64_t row_end) {
+    int c = output.shape[2];
+    VALUE_SWITCH(c, static_channels, (1, 3, 4),
+      (RunAffineRows<static_channels, static_interp>(output, input, mapping, border,
+                                                     row_begin, row_end);),
+      (RunAffineRows<0, static_interp>(output, input, mapping, border, row_begin, row_end);)
+    );  // NOLINT
+  }
+
+  template <int static_channels, DALIInterpType static_interp>
+  void RunAffineRows(
+      const OutTensorCPU<OutputType, 3> &output,
+      const InTensorCPU<InputType, 3> &input,
+      const AffineMapping<2> &mapping,
+      const BorderType &border,
+      int64_t row_begin, int64_t row_end) {
     int out_w = output.shape[1];
-    int out_h = output.shape[0];
-    int c     = output.shape[2];
 
     Surface2D<const InputType> in = as_surface_channel_last(input);
 
     Sampler2D<static_interp, InputType> sampler(in);
 
     // Optimization: instead of naively calculating source coordinates for each destination pixel,
-    // we can exploit the linearity of the affine transform and just add ds/dx derivative
-    // for each x.
+    // we can exploit the linearity of the affine transform and just add x * ds/dx to the source
+    // coordinates of the first pixel in the row.
     vec2 dsdx = mapping.transform.col(0);
 
-    // use tiles to produce "checkpoints" to avoid excessive accumulation error
-    constexpr int tile_w = 256;
-    vec2 dsdx_tile = tile_w * dsdx;
-
-    for (int y = 0; y < out_h; y++) {
+    for (int y = row_begin; y < row_end; y++) {
       OutputType *out_row = output(y, 0);
-      auto src_tile = warp::map_coords(mapping, ivec2(0, y));
-      for (int x_tile = 0; x_tile < out_w; x_tile += tile_w, src_tile += dsdx_tile) {
-        int x_tile_end = std::min(x_tile + tile_w, out_w);
-        auto src = src_tile;
-        for (int x = x_tile; x < x_tile_end; x++, src += dsdx) {
-          sampler(&out_row[c*x], src, border);
-        }
-      }
+      auto src_row = warp::map_coords(mapping, ivec2(0, y));
+      warp::WarpAffineRow<static_channels>(out_row, out_w, sampler, src_row, dsdx, border);
     }
   }
 
 
   template <DALIInterpType static_interp>
   void RunImpl(
-      KernelContext &context,
       const OutTensorCPU<OutputType, 4> &output,
       const InTensorCPU<InputType, 4> &input,
       AffineMapping<3> &mapping,
-      BorderType border = {}) {
+      BorderType border,
+      int64_t row_begin, int64_t row_end) {
     int out_w = output.shape[2];
     int out_h = output.shape[1];
-    int out_d = output.shape[0];
     int c     = output.shape[3];
 
     Surface3D<const InputType> in = as_surface_channel_last(input);
@@ -203,16 +324,16 @@ class WarpCPU {
     constexpr int tile_w = 256;
     vec3 dsdx_tile = tile_w * dsdx;
 
-    for (int z = 0; z < out_d; z++) {
-      for (int y = 0; y < out_h; y++) {
-        OutputType *out_row = output(z, y, 0);
-        auto src_tile = warp::map_coords(mapping, ivec3(0, y, z));
-        for (int x_tile = 0; x_tile < out_w; x_tile += tile_w, src_tile += dsdx_tile) {
-          int x_tile_end = std::min(x_tile + tile_w, out_w);
-          auto src = src_tile;
-          for (int x = x_tile; x < x_tile_end; x++, src += dsdx) {
-            sampler(&out_row[c*x], src, border);
-          }
+    for (int64_t row = row_begin; row < row_end; row++) {
+      int z = row / out_h;
+      int y = row % out_h;
+      OutputType *out_row = output(z, y, 0);
+      auto src_tile = warp::map_coords(mapping, ivec3(0, y, z));
+      for (int x_tile = 0; x_tile < out_w; x_tile += tile_w, src_tile += dsdx_tile) {
+        int x_tile_end = std::min(x_tile + tile_w, out_w);
+        auto src = src_tile;
+        for (int x = x_tile; x < x_tile_end; x++, src += dsdx) {
+          sampler(&out_row[c*x], src, border);
         }
       }
     }
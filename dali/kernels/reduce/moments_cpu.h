@@ -0,0 +1,199 @@
+// Copyright (c) 2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef DALI_KERNELS_REDUCE_MOMENTS_CPU_H_
+#define DALI_KERNELS_REDUCE_MOMENTS_CPU_H_
+
+#include <cstdint>
+#include <vector>
+#include "dali/core/error_handling.h"
+#include "dali/core/format.h"
+#include "dali/core/small_vector.h"
+#include "dali/core/span.h"
+#include "dali/core/tensor_shape.h"
+#include "dali/core/tensor_view.h"
+
+namespace dali {
+namespace kernels {
+
+/**
+ * @brief The number of values, their mean and the sum of their squared deviations from the mean.
+ *
+ * The moments of disjoint sets of values can be merged, which allows them to be calculated
+ * in parts (e.g. per sample, in parallel) and accumulated over any number of values without
+ * the loss of precision caused by summing the squares directly.
+ *
+ * The merge is not associative in floating point, so for reproducible results the partial
+ * moments should be merged in a fixed order.
+ */
+struct Moments {
+  int64_t count = 0;
+  double mean = 0;
+  double m2 = 0;
+
+  /**
+   * @brief Adds a single value (Welford's update).
+   */
+  void Add(double x) {
+    count++;
+    double delta = x - mean;
+    mean += delta / count;
+    m2 += delta * (x - mean);
+  }
+
+  /**
+   * @brief Adds the values described by other moments (Chan et al. update).
+   */
+  void Merge(const Moments &other) {
+    if (other.count == 0)
+      return;
+    if (count == 0) {
+      *this = other;
+      return;
+    }
+    int64_t n = count + other.count;
+    double delta = other.mean - mean;
+    double w = static_cast<double>(other.count) / n;
+    mean += delta * w;
+    m2 += other.m2 + delta * delta * count * w;
+    count = n;
+  }
+
+  /**
+   * @brief Returns the variance, with `ddof` delta degrees of freedom, or 0 if there are not
+   *        enough values.
+   */
+  double Variance(int ddof = 0) const {
+    return count > ddof ? m2 / (count - ddof) : 0;
+  }
+};
+
+/**
+ * @brief Moments accumulated over a number of batches - the state of a statistics collector.
+ */
+struct MomentsSnapshot {
+  int64_t iterations = 0;
+  TensorShape<> shape;
+  std::vector<Moments> moments;
+};
+
+namespace moments_impl {
+
+/**
+ * @brief Calls `func(out_index, value)` for each element of a (strided) tensor.
+ *
+ * The innermost dimension must be dense.
+ */
+template <typename In, typename Func>
+void ForEachElement(const In *in, const int64_t *shape, const int64_t *in_strides,
+                    const int64_t *out_strides, int ndim, int64_t out_offset, Func &func) {
+  if (ndim == 1) {
+    for (int64_t i = 0; i < shape[0]; i++)
+      func(out_offset + i * out_strides[0], in[i]);
+  } else {
+    for (int64_t i = 0; i < shape[0]; i++)
+      ForEachElement(in + i * in_strides[0], shape + 1, in_strides + 1, out_strides + 1,
+                     ndim - 1, out_offset + i * out_strides[0], func);
+  }
+}
+
+}  // namespace moments_impl
+
+/**
+ * @brief Returns the shape of the moments of a tensor of given shape, reduced along `axes`.
+ *
+ * The reduced dimensions are kept, with an extent of 1.
+ */
+inline TensorShape<> MomentsShape(const TensorShape<> &in_shape, span<const int> axes) {
+  TensorShape<> shape = in_shape;
+  for (int a : axes) {
+    DALI_ENFORCE(a >= 0 && a < in_shape.sample_dim(), make_string(
+      "Axis index ", a, " is out of valid range 0..", in_shape.sample_dim() - 1));
+    shape[a] = 1;
+  }
+  return shape;
+}
+
+/**
+ * @brief Calculates the moments of a tensor, reduced along given axes.
+ *
+ * The result is stored in `out`, which must have the volume of `MomentsShape(in.shape, axes)`,
+ * in row-major order. The moments are calculated in two passes over the data (the mean first,
+ * then the squared deviations), which is more accurate than Welford's update and doesn't need
+ * a division per element.
+ */
+template <typename In, int ndim>
+void CalcMoments(span<Moments> out, const TensorView<StorageCPU, In, ndim> &in,
+                 span<const int> axes) {
+  TensorShape<> in_shape = in.shape;
+  TensorShape<> out_shape = MomentsShape(in_shape, axes);
+  int64_t nout = volume(out_shape);
+  DALI_ENFORCE(out.size() == nout, make_string("Expected ", nout, " output elements, got ",
+               out.size()));
+  int64_t nreduced = nout ? volume(in_shape) / nout : 0;
+  for (auto &m : out) {
+    m.count = nreduced;
+    m.mean = 0;
+    m.m2 = 0;
+  }
+  if (nreduced == 0)
+    return;
+
+  int dim = in_shape.sample_dim();
+  if (dim == 0) {  // a scalar
+    out[0].mean = static_cast<double>(*in.data);
+    return;
+  }
+  SmallVector<int64_t, 6> in_strides, out_strides;
+  in_strides.resize(dim);
+  out_strides.resize(dim);
+  int64_t in_stride = 1, out_stride = 1;
+  for (int d = dim - 1; d >= 0; d--) {
+    in_strides[d] = in_stride;
+    in_stride *= in_shape[d];
+    out_strides[d] = out_shape[d] == 1 ? 0 : out_stride;
+    out_stride *= out_shape[d];
+  }
+
+  std::vector<double> sum(nout);
+  auto add = [&](int64_t idx, auto x) {
+    sum[idx] += static_cast<double>(x);
+  };
+  moments_impl::ForEachElement(in.data, in_shape.data(), in_strides.data(), out_strides.data(),
+                               dim, 0, add);
+  for (int64_t i = 0; i < nout; i++)
+    out[i].mean = sum[i] / nreduced;
+
+  auto add_sq_dev = [&](int64_t idx, auto x) {
+    double d = static_cast<double>(x) - out[idx].mean;
+    out[idx].m2 += d * d;
+  };
+  moments_impl::ForEachElement(in.data, in_shape.data(), in_strides.data(), out_strides.data(),
+                               dim, 0, add_sq_dev);
+}
+
+/**
+ * @brief Merges element-wise `in` moments into `acc`.
+ */
+inline void MergeMoments(span<Moments> acc, span<const Moments> in) {
+  DALI_ENFORCE(acc.size() == in.size(), make_string(
+    "Cannot merge moments of different sizes: ", acc.size(), " and ", in.size()));
+  for (int64_t i = 0; i < acc.size(); i++)
+    acc[i].Merge(in[i]);
+}
+
+}  // namespace kernels
+}  // namespace dali
+
+#endif  // DALI_KERNELS_REDUCE_MOMENTS_CPU_H_
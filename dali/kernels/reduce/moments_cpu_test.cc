@@ -0,0 +1,123 @@
+// Copyright (c) 2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+#include <random>
+#include <vector>
+#include "dali/kernels/reduce/moments_cpu.h"
+
+namespace dali {
+namespace kernels {
+
+TEST(MomentsTest, AddVsMerge) {
+  std::mt19937_64 rng(1234);
+  std::normal_distribution<double> dist(1000, 3);
+  std::vector<double> values(1000);
+  for (auto &v : values)
+    v = dist(rng);
+
+  Moments all;
+  for (double v : values)
+    all.Add(v);
+
+  Moments merged;
+  for (size_t start = 0, len = 1; start < values.size(); start += len, len = len * 2 + 1) {
+    Moments part;
+    for (size_t i = start; i < std::min(start + len, values.size()); i++)
+      part.Add(values[i]);
+    merged.Merge(part);
+  }
+  merged.Merge(Moments{});
+
+  double mean = 0, m2 = 0;
+  for (double v : values)
+    mean += v;
+  mean /= values.size();
+  for (double v : values)
+    m2 += (v - mean) * (v - mean);
+
+  EXPECT_EQ(all.count, 1000);
+  EXPECT_EQ(merged.count, 1000);
+  EXPECT_NEAR(all.mean, mean, 1e-9);
+  EXPECT_NEAR(merged.mean, mean, 1e-9);
+  EXPECT_NEAR(all.m2, m2, 1e-6 * m2);
+  EXPECT_NEAR(merged.m2, m2, 1e-6 * m2);
+  EXPECT_NEAR(merged.Variance(1), m2 / 999, 1e-6 * m2 / 999);
+  EXPECT_EQ(Moments{}.Variance(), 0);
+}
+
+TEST(MomentsTest, CalcMomentsAxes) {
+  TensorShape<> shape = { 7, 9, 3 };
+  std::vector<uint8_t> data(volume(shape));
+  std::mt19937_64 rng(4321);
+  std::uniform_int_distribution<int> dist(0, 255);
+  for (auto &v : data)
+    v = dist(rng);
+  auto in = make_tensor_cpu(data.data(), shape);
+
+  for (auto axes : std::vector<std::vector<int>>{ {0, 1}, {2}, {0, 2}, {0, 1, 2}, {} }) {
+    TensorShape<> out_shape = MomentsShape(shape, make_cspan(axes));
+    std::vector<Moments> out(volume(out_shape));
+    CalcMoments(make_span(out), in, make_cspan(axes));
+
+    std::vector<Moments> ref(out.size());
+    for (int64_t y = 0; y < shape[0]; y++) {
+      for (int64_t x = 0; x < shape[1]; x++) {
+        for (int64_t c = 0; c < shape[2]; c++) {
+          int64_t i0 = out_shape[0] == 1 ? 0 : y;
+          int64_t i1 = out_shape[1] == 1 ? 0 : x;
+          int64_t i2 = out_shape[2] == 1 ? 0 : c;
+          int64_t idx = (i0 * out_shape[1] + i1) * out_shape[2] + i2;
+          ref[idx].Add(data[(y * shape[1] + x) * shape[2] + c]);
+        }
+      }
+    }
+    for (size_t i = 0; i < out.size(); i++) {
+      EXPECT_EQ(out[i].count, ref[i].count);
+      EXPECT_NEAR(out[i].mean, ref[i].mean, 1e-9);
+      EXPECT_NEAR(out[i].m2, ref[i].m2, 1e-9 * ref[i].m2);
+    }
+  }
+}
+
+TEST(MomentsTest, MergeSamples) {
+  // Merging per-sample moments gives the same result as reducing the concatenated samples
+  std::mt19937_64 rng(42);
+  std::uniform_real_distribution<float> dist(-100, 100);
+  std::vector<int> axes = { 0 };
+  std::vector<float> all_data;
+  std::vector<Moments> merged(4);
+  for (int s = 0; s < 5; s++) {
+    TensorShape<> shape = { 10 + s * 7, 4 };
+    std::vector<float> data(volume(shape));
+    for (auto &v : data)
+      v = dist(rng);
+    all_data.insert(all_data.end(), data.begin(), data.end());
+    std::vector<Moments> partial(4);
+    CalcMoments(make_span(partial), make_tensor_cpu(data.data(), shape), make_cspan(axes));
+    MergeMoments(make_span(merged), make_cspan(partial));
+  }
+
+  TensorShape<> all_shape = { static_cast<int64_t>(all_data.size() / 4), 4 };
+  std::vector<Moments> ref(4);
+  CalcMoments(make_span(ref), make_tensor_cpu(all_data.data(), all_shape), make_cspan(axes));
+  for (int i = 0; i < 4; i++) {
+    EXPECT_EQ(merged[i].count, ref[i].count);
+    EXPECT_NEAR(merged[i].mean, ref[i].mean, 1e-9);
+    EXPECT_NEAR(merged[i].m2, ref[i].m2, 1e-9 * ref[i].m2);
+  }
+}
+
+}  // namespace kernels
+}  // namespace dali
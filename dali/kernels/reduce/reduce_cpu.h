@@ -1,4 +1,4 @@
-// Copyright (c) 2020-2023, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+// Copyright (c) 2020-2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
 //
 // Licensed under the Apache License, Version 2.0 (the "License");
 // you may not use this file except in compliance with the License.
@@ -15,13 +15,16 @@
 #ifndef DALI_KERNELS_REDUCE_REDUCE_CPU_H_
 #define DALI_KERNELS_REDUCE_REDUCE_CPU_H_
 
+#include <algorithm>
 #include <cassert>
 #include <utility>
 #include <vector>
+#include "dali/core/exec/engine.h"
 #include "dali/kernels/kernel.h"
 #include "dali/kernels/common/utils.h"
 #include "dali/kernels/reduce/reduce_setup_utils.h"
 #include "dali/kernels/reduce/reductions.h"
+#include "dali/pipeline/util/cost_scheduler.h"
 #include "dali/core/format.h"
 #include "dali/core/small_vector.h"
 #include "dali/core/span.h"
@@ -37,12 +40,21 @@ namespace reduce_impl {
 
 constexpr int kTreeReduceThreshold = 32;
 
+/// The number of independent accumulators used at the leaves of 1D reduction
+constexpr int kReduceLanes = 8;
+
+/**
+ * The maximum number of elements reduced at a leaf of 1D reduction - each accumulator
+ * gets at most kTreeReduceThreshold values.
+ */
+constexpr int kLeafReduceSize = kTreeReduceThreshold * kReduceLanes;
+
 template <int static_stride, typename Dst, typename Src, typename Preprocessor, typename Reduction>
 void reduce1D_stride(Dst &reduced, const Src *data, int64_t dynamic_stride, int64_t n,
                      const Preprocessor &P, const Reduction &R) {
   const int64_t stride = static_stride < 0 ? dynamic_stride : static_stride;
   const Dst neutral = R.template neutral<Dst>();
-  if (n > kTreeReduceThreshold) {
+  if (n > kLeafReduceSize) {
     int64_t m = n >> 1;
     Dst tmp1 = neutral, tmp2 = neutral;
     // reduce first half and accumulate
@@ -52,12 +64,23 @@ void reduce1D_stride(Dst &reduced, const Src *data, int64_t dynamic_stride, int6
     R(tmp1, tmp2);
     R(reduced, tmp1);
   } else {
-    // reduce to a temporary
-    Dst tmp = neutral;
-    for (int64_t i = 0; i < n; i++)
-       R(tmp, P(data[i * stride]));
+    // Reduce to independent accumulators - this breaks the dependency chain and allows
+    // the loop to be vectorized. The accumulators are then combined pairwise.
+    constexpr int kLanes = kReduceLanes;
+    Dst acc[kLanes];
+    for (int j = 0; j < kLanes; j++)
+      acc[j] = neutral;
+    int64_t i = 0;
+    for (; i + kLanes <= n; i += kLanes)
+      for (int j = 0; j < kLanes; j++)
+        R(acc[j], P(data[(i + j) * stride]));
+    for (int j = 0; i < n; i++, j++)
+      R(acc[j], P(data[i * stride]));
+    for (int w = kLanes / 2; w > 0; w >>= 1)
+      for (int j = 0; j < w; j++)
+        R(acc[j], acc[j + w]);
     // accumulate in target value
-    R(reduced, tmp);
+    R(reduced, acc[0]);
   }
 }
 
@@ -114,6 +137,99 @@ void reduce(Dst &reduced, const StridedTensor<StorageCPU, Src> &in,
   reduce(reduced, in, P, R, 0, in.size[0], offset);
 }
 
+/**
+ * @brief Splits a 1D reduction into parts, following the reduction tree of `reduce1D`.
+ *
+ * The subtrees of the reduction tree which don't exceed `max_volume` are handed over to
+ * `leaf(tmp, volume, compute)`, where `compute(tmp)` is the reduction of the subtree to a
+ * temporary `tmp` (initially neutral). The results are combined in the same order as in
+ * `reduce1D` - if `leaf` calls `compute(tmp)` (at any time before `tmp` is used), the result
+ * is exactly the same.
+ *
+ * @remarks `n` must be greater than `max_volume` and `max_volume` must not be less than
+ *          kLeafReduceSize.
+ */
+template <typename Dst, typename Src, typename Preprocessor, typename Reduction, typename Leaf>
+void reduce1D_split(Dst &reduced, const Src *data, int64_t stride, int64_t n,
+                    const Preprocessor &P, const Reduction &R, int64_t max_volume, Leaf &leaf) {
+  assert(n > max_volume && max_volume >= kLeafReduceSize);
+  const Dst neutral = R.template neutral<Dst>();
+  auto part = [&](Dst &tmp, const Src *part_data, int64_t part_n) {
+    if (part_n <= max_volume) {
+      leaf(tmp, part_n, [=](Dst &r) {
+        reduce1D(r, part_data, stride, part_n, P, R);
+      });
+    } else {
+      reduce1D_split(tmp, part_data, stride, part_n, P, R, max_volume, leaf);
+    }
+  };
+  int64_t m = n >> 1;
+  Dst tmp1 = neutral, tmp2 = neutral;
+  part(tmp1, data, m);
+  part(tmp2, data + m * stride, n - m);
+  R(tmp1, tmp2);
+  R(reduced, tmp1);
+}
+
+/**
+ * @brief Splits a reduction of a strided tensor slice into parts, following the reduction tree
+ *        of `reduce`.
+ *
+ * @see reduce1D_split
+ *
+ * @remarks The tensor `in` is referenced by the computations passed to `leaf`, so it must
+ *          outlive them.
+ */
+template <typename Dst, typename Src, typename Preprocessor, typename Reduction, typename Leaf>
+void reduce_split(Dst &reduced, const StridedTensor<StorageCPU, Src> &in,
+                  const Preprocessor &P, const Reduction &R,
+                  int axis, int64_t extent, int64_t offset,
+                  int64_t max_volume, Leaf &leaf) {
+  assert(max_volume >= kLeafReduceSize);
+  int64_t stride = in.stride[axis];
+  const Dst neutral = R.template neutral<Dst>();
+  if (axis == in.dim() - 1) {
+    Dst tmp = neutral;
+    int64_t n = in.size[axis];
+    if (n <= max_volume) {
+      leaf(tmp, n, [=, &in](Dst &r) {
+        reduce1D(r, in.data + offset, stride, n, P, R);
+      });
+    } else {
+      reduce1D_split(tmp, in.data + offset, stride, n, P, R, max_volume, leaf);
+    }
+    R(reduced, tmp);
+    return;
+  }
+
+  auto part = [&](Dst &tmp, int part_axis, int64_t part_extent, int64_t part_offset) {
+    int64_t v = part_extent * volume(in.size.begin() + part_axis + 1, in.size.end());
+    if (v <= max_volume) {
+      leaf(tmp, v, [=, &in](Dst &r) {
+        reduce(r, in, P, R, part_axis, part_extent, part_offset);
+      });
+    } else {
+      reduce_split(tmp, in, P, R, part_axis, part_extent, part_offset, max_volume, leaf);
+    }
+  };
+
+  int64_t sub_v = volume(in.size.begin() + axis + 1, in.size.end());
+  if (extent >= 2 && extent * sub_v > kTreeReduceThreshold) {
+    Dst tmp1 = neutral, tmp2 = neutral;
+    int64_t mid = extent / 2;
+    part(tmp1, axis, mid, offset);
+    part(tmp2, axis, extent - mid, offset + mid * stride);
+    R(tmp1, tmp2);
+    R(reduced, tmp1);
+  } else {
+    for (int64_t i = 0; i < extent; i++) {
+      Dst tmp = neutral;
+      part(tmp, axis + 1, in.size[axis + 1], offset + i * stride);
+      R(reduced, tmp);
+    }
+  }
+}
+
 }  // namespace reduce_impl
 
 /**
@@ -127,6 +243,10 @@ void reduce(Dst &reduced, const StridedTensor<StorageCPU, Src> &in,
  * The default postprocessing is an elementwise call to Actual::Postprocess. If different kind of
  * postprocessing is required, Actual should replace the PostprocessAll method instead.
  *
+ * The reduction can be split into parts processed by an execution engine (see Schedule).
+ * The parts follow the pairwise reduction tree, so the result is exactly the same as that of
+ * Run, regardless of the number of threads or parts.
+ *
  * @tparam Actual - provides `GetPreprocessor`, `GetReduction`, `PostSetup` and `Postprocess`
  *         functions
  *         `GetPreprocessor` returns a unary functor that transforms an input value.
@@ -182,6 +302,97 @@ struct ReduceBaseCPU {
     Run(clear, postprocess);
   }
 
+  /**
+   * @brief Adds the work of the reduction to an execution engine.
+   *
+   * When the reduced volume per output element is small, the output elements are distributed
+   * among the work items. Otherwise, the reduction of each output element is split into parts
+   * whose partial results are stored and combined afterwards.
+   *
+   * The work is not complete until the engine runs it (e.g. `engine.RunAll()`) and then
+   * `Combine` is called.
+   *
+   * @param req_nblocks Requested number of work items. By default, it's `8 * engine.NumThreads()`
+   *                    or 1, for a single-threaded engine; limited by kMinBlockVolume.
+   */
+  template <typename ExecutionEngine>
+  void Schedule(ExecutionEngine &engine, bool clear = true, int req_nblocks = -1) {
+    partials.clear();
+    scheduled_clear = clear;
+    int64_t in_volume = input.num_elements();
+    int64_t out_volume = output.num_elements();
+    if (out_volume == 0)
+      return;
+    if (req_nblocks < 0)
+      req_nblocks = engine.NumThreads() > 1 ? engine.NumThreads() * 8 : 1;
+    int64_t block_volume = std::max(div_ceil(in_volume, std::max(req_nblocks, 1)),
+                                    kMinBlockVolume);
+
+    if (axes.empty()) {
+      engine.AddWork([this](int) {
+        SmallVector<int64_t, 6> pos;
+        pos.resize(output.dim());
+        ReduceForEmptyAxes(make_span(pos));
+      }, in_volume, false);
+      return;
+    }
+
+    int64_t reduced_volume = std::max<int64_t>(in_volume / out_volume, 1);
+    if (reduced_volume <= block_volume) {
+      // whole output elements
+      int64_t outputs_per_block = std::max<int64_t>(block_volume / reduced_volume, 1);
+      for (int64_t begin = 0; begin < out_volume; begin += outputs_per_block) {
+        int64_t end = std::min(begin + outputs_per_block, out_volume);
+        engine.AddWork([this, clear, begin, end](int) {
+          ReduceOutputRange(clear, begin, end);
+        }, (end - begin) * reduced_volume, false);
+      }
+      return;
+    }
+
+    // parts of output elements
+    const auto R = This().GetReduction();
+    ForEachOutput([&](span<int64_t> pos, int64_t offset) {
+      Dst tmp = R.template neutral<Dst>();
+      auto leaf = [&](Dst &, int64_t part_volume, auto &&compute) {
+        int64_t idx = partials.size();
+        partials.push_back(R.template neutral<Dst>());
+        engine.AddWork([this, idx, compute](int) {
+          compute(partials[idx]);
+        }, part_volume, false);
+      };
+      reduce_impl::reduce_split(tmp, strided_in, This().GetPreprocessor(pos), R,
+                                0, strided_in.size[0], offset, block_volume, leaf);
+    });
+    split_volume = block_volume;
+  }
+
+  /**
+   * @brief Completes the reduction scheduled with Schedule.
+   *
+   * Combines the partial results (if any) and applies postprocessing.
+   */
+  void Combine(bool postprocess = true) {
+    if (!partials.empty()) {
+      const auto R = This().GetReduction();
+      int64_t idx = 0;
+      auto leaf = [&](Dst &tmp, int64_t, auto &&) {
+        tmp = partials[idx++];
+      };
+      ForEachOutput([&](span<int64_t> pos, int64_t offset) {
+        Dst &r = *output(pos);
+        if (scheduled_clear)
+          r = R.template neutral<Dst>();
+        reduce_impl::reduce_split(r, strided_in, This().GetPreprocessor(pos), R,
+                                  0, strided_in.size[0], offset, split_volume, leaf);
+      });
+      assert(idx == static_cast<int64_t>(partials.size()));
+      partials.clear();
+    }
+    if (postprocess)
+      This().PostprocessAll();
+  }
+
   void PostprocessAll() {
     if (reinterpret_cast<decltype(&ReduceBaseCPU::Postprocess)>(&Actual::Postprocess) ==
         &ReduceBaseCPU::Postprocess)
@@ -211,14 +422,18 @@ struct ReduceBaseCPU {
   Dst Postprocess(const Dst &x) const { return x; }
 
  protected:
-  void ReduceAxis(bool clear, span<int64_t> pos, int axis, int64_t offset = 0) {
+  void ReduceOutput(bool clear, span<int64_t> pos, int64_t offset) {
     auto R = This().GetReduction();
+    Dst &r = *output(pos);
+    if (clear) {
+      r = R.template neutral<Dst>();
+    }
+    reduce_impl::reduce(r, strided_in, This().GetPreprocessor(pos), R, offset);
+  }
+
+  void ReduceAxis(bool clear, span<int64_t> pos, int axis, int64_t offset = 0) {
     if (axis == output.dim()) {
-      Dst &r = *output(pos);
-      if (clear) {
-        r = R.template neutral<Dst>();
-      }
-      reduce_impl::reduce(r, strided_in, This().GetPreprocessor(pos), R, offset);
+      ReduceOutput(clear, pos, offset);
     } else {
       for (int64_t i = 0; i < output.shape[axis]; i++) {
         pos[axis] = i;
@@ -227,6 +442,45 @@ struct ReduceBaseCPU {
     }
   }
 
+  /**
+   * @brief Calls `func(pos, offset)` for consecutive output elements in range [begin, end)
+   *
+   * `pos` is the position in the output and `offset` is the offset of the first reduced element
+   * in the input.
+   */
+  template <typename Func>
+  void ForEachOutput(Func &&func, int64_t begin = 0, int64_t end = -1) {
+    if (end < 0)
+      end = output.num_elements();
+    SmallVector<int64_t, 6> pos;
+    pos.resize(output.dim());
+    // in case of full reduction, there's a single output element and no steps
+    int odim = step.size();
+    int64_t offset = 0;
+    int64_t idx = begin;
+    for (int a = odim - 1; a >= 0; a--) {
+      pos[a] = idx % output.shape[a];
+      idx /= output.shape[a];
+      offset += pos[a] * step[a];
+    }
+    for (int64_t i = begin; i < end; i++) {
+      func(make_span(pos), offset);
+      for (int a = odim - 1; a >= 0; a--) {
+        offset += step[a];
+        if (++pos[a] < output.shape[a])
+          break;
+        offset -= pos[a] * step[a];
+        pos[a] = 0;
+      }
+    }
+  }
+
+  void ReduceOutputRange(bool clear, int64_t begin, int64_t end) {
+    ForEachOutput([&](span<int64_t> pos, int64_t offset) {
+      ReduceOutput(clear, pos, offset);
+    }, begin, end);
+  }
+
   void ReduceForEmptyAxes(span<int64_t> pos) {
     auto P = This().GetPreprocessor(pos);
     for (int64_t i = 0; i < output.num_elements(); i++) {
@@ -330,6 +584,11 @@ struct ReduceBaseCPU {
   reduce_impl::StridedTensor<StorageCPU, const Src> strided_in;
   SmallVector<int64_t, 6> step;
   uint64_t axis_mask = 0;
+
+  // partial results of the reduction split by Schedule
+  std::vector<Dst> partials;
+  int64_t split_volume = 0;
+  bool scheduled_clear = true;
 };
 
 template <typename Dst, typename Src>
@@ -1,4 +1,4 @@
-// Copyright (c) 2020-2021, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+// Copyright (c) 2020-2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
 //
 // Licensed under the Apache License, Version 2.0 (the "License");
 // you may not use this file except in compliance with the License.
@@ -15,11 +15,15 @@
 #include <gtest/gtest.h>
 #include <random>
 #include <chrono>
+#include <vector>
 #include "dali/kernels/reduce/reduce_cpu.h"
+#include "dali/kernels/test/test_execution_engine.h"
 
 namespace dali {
 namespace kernels {
 
+using dali::testing::ReverseExecutionEngine;
+
 using perfclock = std::chrono::high_resolution_clock;
 
 template <typename Out = double, typename R, typename P>
@@ -242,5 +246,72 @@ TEST(ReduceTest, StdDev) {
   EXPECT_NEAR(s3[0], dev2, 1);
 }
 
+namespace {
+
+template <typename Reduce, typename... MeanArg>
+void TestScheduledReduction(const TensorShape<> &shape, span<const int> axes,
+                            const TensorShape<> &out_shape, const MeanArg &... mean) {
+  std::mt19937_64 rng(4321);
+  std::uniform_real_distribution<float> dist(-100, 1000);
+  std::vector<float> in_v(volume(shape));
+  for (auto &x : in_v)
+    x = dist(rng);
+  auto in = make_tensor_cpu(in_v.data(), shape);
+
+  std::vector<float> ref_v(volume(out_shape)), out_v(volume(out_shape));
+  auto ref = make_tensor_cpu(ref_v.data(), out_shape);
+  auto out = make_tensor_cpu(out_v.data(), out_shape);
+
+  Reduce ref_kernel;
+  ref_kernel.Setup(ref, in, axes, mean...);
+  ref_kernel.Run();
+
+  for (int num_threads : { 1, 3, 16 }) {
+    for (int req_nblocks : { -1, 1, 7, 1000 }) {
+      Reduce kernel;
+      kernel.Setup(out, in, axes, mean...);
+      std::fill(out_v.begin(), out_v.end(), -1.0f);
+      ReverseExecutionEngine engine(num_threads);
+      kernel.Schedule(engine, true, req_nblocks);
+      engine.RunAll();
+      kernel.Combine();
+      if (req_nblocks > 1)
+        EXPECT_GT(engine.num_blocks_, 1);
+      // the result must not depend on how the work is split
+      for (int64_t i = 0; i < ref.num_elements(); i++)
+        ASSERT_EQ(out_v[i], ref_v[i]) << "at index " << i << ", " << num_threads
+                                      << " threads, req_nblocks = " << req_nblocks;
+    }
+  }
+}
+
+}  // namespace
+
+TEST(ReduceTest, ScheduleFull) {
+  int axes[] = { 0 };
+  TestScheduledReduction<SumCPU<float, float>>({ 1000003 }, make_cspan(axes), { 1 });
+  TestScheduledReduction<MeanCPU<float, float>>({ 1000003 }, make_cspan(axes), { 1 });
+  int axes3[] = { 0, 1, 2 };
+  TestScheduledReduction<SumCPU<float, float>>({ 7, 300, 501 }, make_cspan(axes3), { 1 });
+}
+
+TEST(ReduceTest, SchedulePartial) {
+  TensorShape<> shape = { 50, 1000, 3 };
+  int axes0[] = { 0 }, axes1[] = { 1 }, axes2[] = { 2 }, axes01[] = { 0, 1 }, axes02[] = { 0, 2 };
+  TestScheduledReduction<SumCPU<float, float>>(shape, make_cspan(axes0), { 1000, 3 });
+  TestScheduledReduction<SumCPU<float, float>>(shape, make_cspan(axes1), { 50, 3 });
+  TestScheduledReduction<SumCPU<float, float>>(shape, make_cspan(axes2), { 50, 1000 });
+  TestScheduledReduction<MaxCPU<float, float>>(shape, make_cspan(axes01), { 3 });
+  TestScheduledReduction<MeanSquareCPU<float, float>>(shape, make_cspan(axes02), { 1000 });
+}
+
+TEST(ReduceTest, ScheduleStdDev) {
+  TensorShape<> shape = { 100, 1000, 3 };
+  int axes[] = { 0, 1 };
+  float mean_v[3] = { 400, 450, 500 };
+  auto mean = make_tensor_cpu<-1>(mean_v, { 3 });
+  TestScheduledReduction<StdDevCPU<float, float>>(shape, make_cspan(axes), { 3 }, mean);
+}
+
 }  // namespace kernels
 }  // namespace dali
@@ -0,0 +1,167 @@
+// Copyright (c) 2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "dali/kernels/signal/fft/batched_real_fft_cpu.h"
+#include <atomic>
+#include <cassert>
+#include <cmath>
+#include <cstdlib>
+#include "dali/core/error_handling.h"
+#include "dali/core/format.h"
+#include "dali/core/util.h"
+
+namespace dali {
+namespace kernels {
+namespace signal {
+namespace fft {
+
+namespace {
+
+constexpr int kLanes = BatchedRealFftCpu::kLanes;
+
+/**
+ * @brief Radix-2 butterfly on all lanes: (a, b) -> (a + w*b, a - w*b)
+ */
+inline void Butterfly(float *__restrict__ a_re, float *__restrict__ a_im,
+                      float *__restrict__ b_re, float *__restrict__ b_im,
+                      float w_re, float w_im) {
+  for (int l = 0; l < kLanes; l++) {
+    float t_re = b_re[l] * w_re - b_im[l] * w_im;
+    float t_im = b_re[l] * w_im + b_im[l] * w_re;
+    b_re[l] = a_re[l] - t_re;
+    b_im[l] = a_im[l] - t_im;
+    a_re[l] += t_re;
+    a_im[l] += t_im;
+  }
+}
+
+/**
+ * @brief Computes X[k] from Z[k] and Z[m - k], where Z is the spectrum of the signal with even
+ *        samples as the real part and odd samples as the imaginary part.
+ *
+ * X[k] = (Z[k] + conj(Z[m-k])) / 2  +  W^k * (Z[k] - conj(Z[m-k])) / 2i
+ */
+inline void Split(float *__restrict__ x_re, float *__restrict__ x_im,
+                  const float *__restrict__ zk_re, const float *__restrict__ zk_im,
+                  const float *__restrict__ zm_re, const float *__restrict__ zm_im,
+                  float w_re, float w_im) {
+  for (int l = 0; l < kLanes; l++) {
+    float e_re = 0.5f * (zk_re[l] + zm_re[l]);
+    float e_im = 0.5f * (zk_im[l] - zm_im[l]);
+    float o_re = 0.5f * (zk_im[l] + zm_im[l]);
+    float o_im = 0.5f * (zm_re[l] - zk_re[l]);
+    x_re[l] = e_re + w_re * o_re - w_im * o_im;
+    x_im[l] = e_im + w_re * o_im + w_im * o_re;
+  }
+}
+
+}  // namespace
+
+void BatchedRealFftCpu::Init(int nfft) {
+  DALI_ENFORCE(nfft >= 2 && is_pow2(nfft),
+               make_string("The size of the batched real FFT must be a power of 2, got: ", nfft));
+  if (nfft == nfft_)
+    return;
+  nfft_ = nfft;
+  int m = nfft / 2;
+  int log2m = ilog2(m);
+
+  bitrev_.resize(m);
+  for (int k = 0; k < m; k++) {
+    int r = 0;
+    for (int b = 0; b < log2m; b++)
+      r |= ((k >> b) & 1) << (log2m - 1 - b);
+    bitrev_[k] = r;
+  }
+
+  twiddle_re_.resize(m / 2);
+  twiddle_im_.resize(m / 2);
+  for (int j = 0; j < m / 2; j++) {
+    double a = 2 * M_PI * j / m;
+    twiddle_re_[j] = std::cos(a);
+    twiddle_im_[j] = -std::sin(a);
+  }
+
+  split_re_.resize(m + 1);
+  split_im_.resize(m + 1);
+  for (int k = 0; k <= m; k++) {
+    double a = 2 * M_PI * k / nfft;
+    split_re_[k] = std::cos(a);
+    split_im_[k] = -std::sin(a);
+  }
+}
+
+void BatchedRealFftCpu::Run(float *out_re, float *out_im,
+                            const float *in, float *scratch) const {
+  assert(nfft_ >= 2);
+  int m = nfft_ / 2;
+  float *z_re = scratch;
+  float *z_im = scratch + m * kLanes;
+
+  for (int k = 0; k < m; k++) {
+    int64_t dst = bitrev_[k] * kLanes;
+    const float *even = in + 2 * k * kLanes;
+    const float *odd = even + kLanes;
+    for (int l = 0; l < kLanes; l++) {
+      z_re[dst + l] = even[l];
+      z_im[dst + l] = odd[l];
+    }
+  }
+
+  // Iterative decimation-in-time radix-2 transform
+  for (int half = 1; half < m; half *= 2) {
+    int twiddle_step = m / (2 * half);
+    for (int start = 0; start < m; start += 2 * half) {
+      for (int j = 0; j < half; j++) {
+        int64_t a = (start + j) * kLanes;
+        int64_t b = a + half * kLanes;
+        Butterfly(z_re + a, z_im + a, z_re + b, z_im + b,
+                  twiddle_re_[j * twiddle_step], twiddle_im_[j * twiddle_step]);
+      }
+    }
+  }
+
+  // Recover the spectrum of the real signal
+  for (int k = 0; k <= m; k++) {
+    int64_t zk = (k & (m - 1)) * kLanes;
+    int64_t zm = ((m - k) & (m - 1)) * kLanes;
+    Split(out_re + k * kLanes, out_im + k * kLanes, z_re + zk, z_im + zk, z_re + zm, z_im + zm,
+          split_re_[k], split_im_[k]);
+  }
+}
+
+namespace {
+
+std::atomic<bool> &BatchedRealFftFlag() {
+  static std::atomic<bool> enabled{[]() {
+    const char *env = std::getenv("DALI_CPU_BATCHED_FFT");
+    return env && atoi(env) != 0;
+  }()};
+  return enabled;
+}
+
+}  // namespace
+
+bool BatchedRealFftEnabled() {
+  return BatchedRealFftFlag().load(std::memory_order_relaxed);
+}
+
+void SetBatchedRealFftEnabled(bool enabled) {
+  BatchedRealFftFlag().store(enabled, std::memory_order_relaxed);
+}
+
+}  // namespace fft
+}  // namespace signal
+}  // namespace kernels
+}  // namespace dali
@@ -0,0 +1,98 @@
+// Copyright (c) 2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef DALI_KERNELS_SIGNAL_FFT_BATCHED_REAL_FFT_CPU_H_
+#define DALI_KERNELS_SIGNAL_FFT_BATCHED_REAL_FFT_CPU_H_
+
+#include <cstdint>
+#include <vector>
+#include "dali/core/api_helper.h"
+
+namespace dali {
+namespace kernels {
+namespace signal {
+namespace fft {
+
+/**
+ * @brief Forward real-to-complex FFT of `kLanes` signals at once.
+ *
+ * The signals are interleaved - sample `t` of signal `l` is stored at `t * kLanes + l` - and so
+ * is the spectrum. Each step of the transform is applied to all the signals at the same time,
+ * with the innermost loop running over the signals, which makes it trivially vectorizable.
+ * This layout is what a batch of STFT windows naturally has when the windows are extracted
+ * in the frequency-major ("ft") layout.
+ *
+ * The size of the transform must be a power of 2.
+ */
+class DLL_PUBLIC BatchedRealFftCpu {
+ public:
+  static constexpr int kLanes = 16;
+
+  BatchedRealFftCpu() = default;
+  explicit BatchedRealFftCpu(int nfft) {
+    Init(nfft);
+  }
+
+  void Init(int nfft);
+
+  int nfft() const {
+    return nfft_;
+  }
+
+  /**
+   * @brief The number of floats in the scratch buffer passed to `Run`.
+   */
+  int64_t ScratchSize() const {
+    return static_cast<int64_t>(nfft_) * kLanes;
+  }
+
+  /**
+   * @brief Computes the first `nfft/2+1` bins of the spectra of `kLanes` signals.
+   *
+   * @param out_re   real parts of the spectra, `(nfft/2+1) * kLanes` floats
+   * @param out_im   imaginary parts of the spectra, `(nfft/2+1) * kLanes` floats
+   * @param in       interleaved signals, `nfft * kLanes` floats
+   * @param scratch  a buffer of `ScratchSize()` floats
+   */
+  void Run(float *out_re, float *out_im, const float *in, float *scratch) const;
+
+ private:
+  int nfft_ = 0;
+  std::vector<int> bitrev_;
+  // twiddle factors of the half-size complex transform: exp(-2*pi*i * j / (nfft/2))
+  std::vector<float> twiddle_re_, twiddle_im_;
+  // factors used to obtain the real spectrum from the half-size complex transform:
+  // exp(-2*pi*i * k / nfft)
+  std::vector<float> split_re_, split_im_;
+};
+
+/**
+ * @brief Tells whether Fft1DCpu may use BatchedRealFftCpu instead of ffts.
+ *
+ * The batched path is opt-in until it's benchmarked against ffts on the supported CPUs.
+ * The initial value is taken from the DALI_CPU_BATCHED_FFT environment variable (off by default).
+ */
+DLL_PUBLIC bool BatchedRealFftEnabled();
+
+/**
+ * @brief Enables or disables the batched path in Fft1DCpu for the whole process.
+ */
+DLL_PUBLIC void SetBatchedRealFftEnabled(bool enabled);
+
+}  // namespace fft
+}  // namespace signal
+}  // namespace kernels
+}  // namespace dali
+
+#endif  // DALI_KERNELS_SIGNAL_FFT_BATCHED_REAL_FFT_CPU_H_
@@ -0,0 +1,71 @@
+// Copyright (c) 2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+#include <cmath>
+#include <complex>
+#include <random>
+#include <vector>
+#include "dali/kernels/signal/fft/batched_real_fft_cpu.h"
+
+namespace dali {
+namespace kernels {
+namespace signal {
+namespace fft {
+namespace test {
+
+class BatchedRealFftCpuTest : public ::testing::TestWithParam<int> {};
+
+TEST_P(BatchedRealFftCpuTest, CompareWithDft) {
+  constexpr int kLanes = BatchedRealFftCpu::kLanes;
+  int nfft = GetParam();
+  int nbins = nfft / 2 + 1;
+  BatchedRealFftCpu fft(nfft);
+
+  std::mt19937_64 rng(nfft);
+  std::uniform_real_distribution<float> dist(-1, 1);
+  std::vector<float> in(nfft * kLanes);
+  for (auto &x : in)
+    x = dist(rng);
+
+  std::vector<float> re(nbins * kLanes), im(nbins * kLanes), scratch(fft.ScratchSize());
+  fft.Run(re.data(), im.data(), in.data(), scratch.data());
+
+  double eps = 1e-5 * nfft;
+  for (int l = 0; l < kLanes; l++) {
+    for (int k = 0; k < nbins; k++) {
+      std::complex<double> ref = 0;
+      for (int t = 0; t < nfft; t++)
+        ref += static_cast<double>(in[t * kLanes + l]) *
+               std::polar(1.0, -2 * M_PI * (static_cast<int64_t>(k) * t % nfft) / nfft);
+      ASSERT_NEAR(re[k * kLanes + l], ref.real(), eps) << "lane " << l << " bin " << k;
+      ASSERT_NEAR(im[k * kLanes + l], ref.imag(), eps) << "lane " << l << " bin " << k;
+    }
+  }
+}
+
+INSTANTIATE_TEST_SUITE_P(BatchedRealFftCpuTest, BatchedRealFftCpuTest,
+                         testing::Values(2, 4, 8, 64, 512, 2048));
+
+TEST(BatchedRealFftCpuTest, NonPow2) {
+  BatchedRealFftCpu fft;
+  EXPECT_THROW(fft.Init(100), std::exception);
+  EXPECT_THROW(fft.Init(1), std::exception);
+}
+
+}  // namespace test
+}  // namespace fft
+}  // namespace signal
+}  // namespace kernels
+}  // namespace dali
@@ -1,4 +1,4 @@
-// Copyright (c) 2019-2022, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+// Copyright (c) 2019-2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
 //
 // Licensed under the Apache License, Version 2.0 (the "License");
 // you may not use this file except in compliance with the License.
@@ -25,6 +25,7 @@
 #include "dali/core/util.h"
 #include "dali/kernels/kernel.h"
 #include "dali/kernels/signal/fft/fft_cpu_impl_utils.h"
+#include "dali/kernels/signal/fft/ffts_plan_cache.h"
 #include "dali/kernels/common/for_axis.h"
 #include "dali/kernels/common/utils.h"
 
@@ -53,6 +54,13 @@ inline int64_t size_out_buf(int64_t n) {
   return can_use_real_impl(n) ? n+2 : 2*n;
 }
 
+inline bool can_use_batched_impl(int64_t n, FftSpectrumType spectrum_type) {
+  return can_use_real_impl(n) && n >= 2 &&
+         (spectrum_type == FFT_SPECTRUM_COMPLEX ||
+          spectrum_type == FFT_SPECTRUM_MAGNITUDE ||
+          spectrum_type == FFT_SPECTRUM_POWER);
+}
+
 }  // namespace
 
 template <typename OutputType, typename InputType, int Dims>
@@ -79,17 +87,118 @@ KernelRequirements Fft1DImplFfts<OutputType, InputType, Dims>::Setup(
   out_shape[transform_axis_] = nfft / 2 + 1;
   req.output_shapes = {TensorListShape<DynamicDimensions>({out_shape})};
 
-  if (!plan_ || nfft != nfft_) {
-    if (can_use_real_impl(nfft)) {
-      plan_ = {ffts_init_1d_real(nfft, FFTS_FORWARD), ffts_free};
+  nfft_ = nfft;
+  if (BatchedRealFftEnabled() && can_use_batched_impl(nfft_, args.spectrum_type))
+    batched_fft_.Init(nfft_);
+
+  return req;
+}
+
+template <typename OutputType, typename InputType, int Dims>
+void Fft1DImplFfts<OutputType, InputType, Dims>::RunBatched(
+    KernelContext &context,
+    const OutTensorCPU<OutputType, Dims> &out,
+    const InTensorCPU<InputType, Dims> &in,
+    const FftArgs &args) {
+  constexpr int kLanes = BatchedRealFftCpu::kLanes;
+  const int64_t n = in.shape[transform_axis_];
+  const int64_t nbins = nfft_ / 2 + 1;
+  int in_win_start = n < nfft_ ? (nfft_ - n) / 2 : 0;
+
+  float *in_buf = context.scratchpad->AllocateHost<float>(nfft_ * kLanes, 64);
+  float *re_buf = context.scratchpad->AllocateHost<float>(nbins * kLanes, 64);
+  float *im_buf = context.scratchpad->AllocateHost<float>(nbins * kLanes, 64);
+  float *fft_scratch = context.scratchpad->AllocateHost<float>(batched_fft_.ScratchSize(), 64);
+  // The padding is never overwritten - zero it once
+  memset(in_buf, 0, in_win_start * kLanes * sizeof(float));
+  memset(in_buf + (in_win_start + n) * kLanes, 0,
+         (nfft_ - in_win_start - n) * kLanes * sizeof(float));
+
+  // The rows are gathered in groups of kLanes, interleaved so that the transform can process
+  // all of them at once. The stride along the transform axis is the same for all rows.
+  const InputType *in_rows[kLanes];
+  OutputType *out_rows[kLanes];
+  int64_t in_stride = 1, out_stride = 1;
+  int nrows = 0;
+
+  // Checks whether the rows are adjacent, e.g. consecutive windows in the frequency-major layout
+  auto adjacent = [&](auto *const *rows) {
+    if (nrows < kLanes)
+      return false;
+    for (int l = 1; l < kLanes; l++)
+      if (rows[l] != rows[0] + l)
+        return false;
+    return true;
+  };
+
+  auto flush = [&]() {
+    if (adjacent(in_rows)) {
+      for (int64_t t = 0; t < n; t++) {
+        float *dst = in_buf + (in_win_start + t) * kLanes;
+        const InputType *src = in_rows[0] + t * in_stride;
+        for (int l = 0; l < kLanes; l++)
+          dst[l] = ConvertSat<float>(src[l]);
+      }
     } else {
-      plan_ = {ffts_init_1d(nfft, FFTS_FORWARD), ffts_free};
+      for (int64_t t = 0; t < n; t++) {
+        float *dst = in_buf + (in_win_start + t) * kLanes;
+        for (int l = 0; l < nrows; l++)
+          dst[l] = ConvertSat<float>(in_rows[l][t * in_stride]);
+      }
     }
-    DALI_ENFORCE(plan_ != nullptr, "Could not initialize ffts plan");
-    nfft_ = nfft;
-  }
 
-  return req;
+    batched_fft_.Run(re_buf, im_buf, in_buf, fft_scratch);
+
+    bool out_adjacent = adjacent(out_rows);
+    for (int64_t k = 0; k < nbins; k++) {
+      const float *re = re_buf + k * kLanes;
+      const float *im = im_buf + k * kLanes;
+      int64_t out_offset = k * out_stride;
+      if (args.spectrum_type == FFT_SPECTRUM_COMPLEX) {
+        for (int l = 0; l < nrows; l++) {
+          auto *complex_out = reinterpret_cast<std::complex<float> *>(out_rows[l]);
+          complex_out[out_offset] = {re[l], im[l]};
+        }
+      } else {
+        float mag[kLanes];
+        for (int l = 0; l < kLanes; l++)
+          mag[l] = re[l] * re[l] + im[l] * im[l];
+        if (args.spectrum_type == FFT_SPECTRUM_MAGNITUDE) {
+          for (int l = 0; l < kLanes; l++)
+            mag[l] = std::sqrt(mag[l]);
+        }
+        if (out_adjacent) {
+          auto *dst = reinterpret_cast<float *>(out_rows[0]) + out_offset;
+          for (int l = 0; l < kLanes; l++)
+            dst[l] = mag[l];
+        } else {
+          for (int l = 0; l < nrows; l++)
+            reinterpret_cast<float *>(out_rows[l])[out_offset] = mag[l];
+        }
+      }
+    }
+    nrows = 0;
+  };
+
+  auto in_shape = in.shape;
+  auto in_strides = GetStrides(in_shape);
+  auto out_shape = out.shape;
+  auto out_strides = GetStrides(out_shape);
+
+  ForAxis(
+    out.data, in.data, out_shape.data(), out_strides.data(), in_shape.data(), in_strides.data(),
+    transform_axis_, out.dim(),
+    [&](OutputType *out_data, const InputType *in_data,
+        int64_t out_size, int64_t row_out_stride, int64_t in_size, int64_t row_in_stride) {
+      in_rows[nrows] = in_data;
+      out_rows[nrows] = out_data;
+      in_stride = row_in_stride;
+      out_stride = row_out_stride;
+      if (++nrows == kLanes)
+        flush();
+    });
+  if (nrows > 0)
+    flush();
 }
 
 template <typename OutputType, typename InputType, int Dims>
@@ -109,7 +218,18 @@ void Fft1DImplFfts<OutputType, InputType, Dims>::Run(
   // (padding with zeros on both side)
   int in_win_start = n < nfft_ ? (nfft_ - n) / 2 : 0;
 
+  int64_t num_transforms = n > 0 ? volume(in.shape) / n : 0;
+  // the batched FFT is prepared in Setup - only if it was enabled at that time
+  if (BatchedRealFftEnabled() && batched_fft_.nfft() == nfft_ &&
+      num_transforms >= BatchedRealFftCpu::kLanes &&
+      can_use_batched_impl(nfft_, args.spectrum_type)) {
+    RunBatched(context, out, in, args);
+    return;
+  }
+
   bool use_real_impl = can_use_real_impl(nfft_);
+  auto plan_type = use_real_impl ? FftsPlanCache::Type::Real : FftsPlanCache::Type::Complex;
+  auto plan = FftsPlanCache::Instance().Get(nfft_, FFTS_FORWARD, plan_type);
 
   auto in_buf_sz = size_in_buf(nfft_);
   // ffts requires 32-byte aligned memory
@@ -129,7 +249,7 @@ void Fft1DImplFfts<OutputType, InputType, Dims>::Run(
   ForAxis(
     out.data, in.data, out_shape.data(), out_strides.data(), in_shape.data(), in_strides.data(),
     transform_axis_, out.dim(),
-    [this, &args, use_real_impl, out_buf, in_buf, in_win_start](
+    [this, &args, &plan, use_real_impl, out_buf, in_buf, in_win_start](
       OutputType *out_data, const InputType *in_data,
       int64_t out_size, int64_t out_stride, int64_t in_size, int64_t in_stride) {
         int64_t in_idx = 0;
@@ -147,7 +267,7 @@ void Fft1DImplFfts<OutputType, InputType, Dims>::Run(
           }
         }
 
-        ffts_execute(plan_.get(), in_buf, out_buf);
+        ffts_execute(plan.get(), in_buf, out_buf);
 
         // For complex impl, out_buf_sz contains the whole spectrum,
         // for real impl, the second half of the spectrum is ommited
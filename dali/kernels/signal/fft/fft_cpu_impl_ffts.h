@@ -1,4 +1,4 @@
-// Copyright (c) 2019, NVIDIA CORPORATION. All rights reserved.
+// Copyright (c) 2019-2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
 //
 // Licensed under the Apache License, Version 2.0 (the "License");
 // you may not use this file except in compliance with the License.
@@ -23,6 +23,7 @@
 #include "dali/core/format.h"
 #include "dali/core/util.h"
 #include "dali/kernels/kernel.h"
+#include "dali/kernels/signal/fft/batched_real_fft_cpu.h"
 #include "dali/kernels/signal/fft/fft_cpu.h"
 
 namespace dali {
@@ -49,9 +50,14 @@ class DLL_PUBLIC Fft1DImplFfts : public FftImpl<OutputType, InputType, Dims> {
                       const OutTensorCPU<OutputType, Dims> &out,
                       const InTensorCPU<InputType, Dims> &in,
                       const FftArgs &args) override;
+
  private:
-  using FftsPlanPtr = std::unique_ptr<ffts_plan_t, decltype(&ffts_free)>;
-  FftsPlanPtr plan_{nullptr, ffts_free};
+  void RunBatched(KernelContext &context,
+                  const OutTensorCPU<OutputType, Dims> &out,
+                  const InTensorCPU<InputType, Dims> &in,
+                  const FftArgs &args);
+
+  BatchedRealFftCpu batched_fft_;
   int nfft_ = -1;
   int transform_axis_ = -1;
 };
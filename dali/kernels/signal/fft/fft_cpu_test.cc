@@ -17,6 +17,7 @@
 #include <vector>
 #include <complex>
 #include <cmath>
+#include "dali/kernels/signal/fft/batched_real_fft_cpu.h"
 #include "dali/kernels/signal/fft/fft_cpu.h"
 #include "dali/test/test_tensors.h"
 #include "dali/test/tensor_test_utils.h"
@@ -243,12 +244,13 @@ INSTANTIATE_TEST_SUITE_P(Fft1DCpuTest, PowerSpectrum1DCpuTest, testing::Combine(
                     std::array<int64_t, 2>{1, 4096})));
 
 class Fft1DCpuOtherLayoutTest : public::testing::TestWithParam<
-  std::tuple<FftSpectrumType, std::array<int64_t, 3>, int>> {
+  std::tuple<FftSpectrumType, std::array<int64_t, 3>, int, bool>> {
  public:
   Fft1DCpuOtherLayoutTest()
     : spectrum_type_(std::get<0>(GetParam()))
     , data_shape_(std::get<1>(GetParam()))
     , transform_axis_(std::get<2>(GetParam()))
+    , batched_(std::get<3>(GetParam()))
     , data_(volume(data_shape_))
     , in_view_(data_.data(), data_shape_) {}
 
@@ -258,10 +260,17 @@ class Fft1DCpuOtherLayoutTest : public::testing::TestWithParam<
   void SetUp() final {
     std::mt19937_64 rng;
     UniformRandomFill(in_view_, rng, 0., 1.);
+    batched_was_enabled_ = BatchedRealFftEnabled();
+    SetBatchedRealFftEnabled(batched_);
+  }
+  void TearDown() final {
+    SetBatchedRealFftEnabled(batched_was_enabled_);
   }
   FftSpectrumType spectrum_type_;
   TensorShape<3> data_shape_;
   int transform_axis_;
+  bool batched_;
+  bool batched_was_enabled_ = false;
   std::vector<float> data_;
   OutTensorCPU<float, 3> in_view_;
 };
@@ -287,7 +296,7 @@ TEST_P(ComplexFft1DCpuOtherLayoutTest, LayoutTest) {
 
   LOG_LINE <<
     make_string("Test n=", n, " nfft=", nfft, " axis=", args.transform_axis,
-                " spectrum_type=", args.spectrum_type) << std::endl;
+                " spectrum_type=", args.spectrum_type, " batched=", batched_) << std::endl;
 
   KernelRequirements reqs = kernel.Setup(ctx, in_view_, args);
 
@@ -424,8 +433,10 @@ TEST_P(ComplexFft1DCpuOtherLayoutTest, LayoutTest) {
 INSTANTIATE_TEST_SUITE_P(ComplexFft1DCpuOtherLayoutTest, ComplexFft1DCpuOtherLayoutTest,
   testing::Combine(
     testing::Values(FFT_SPECTRUM_COMPLEX),
-    testing::Values(std::array<int64_t, 3>{6, 8, 4}),
-    testing::Values(0, 1, 2)));
+    testing::Values(std::array<int64_t, 3>{6, 8, 4},
+                    std::array<int64_t, 3>{32, 16, 8}),
+    testing::Values(0, 1, 2),
+    testing::Values(false, true)));
 
 
 
@@ -0,0 +1,91 @@
+// Copyright (c) 2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "dali/kernels/signal/fft/ffts_plan_cache.h"
+#include "dali/core/error_handling.h"
+#include "dali/core/format.h"
+
+namespace dali {
+namespace kernels {
+namespace signal {
+namespace fft {
+
+void FftsPlanCache::PlanReturner::operator()(ffts_plan_t *plan) const {
+  if (!plan)
+    return;
+  if (cache)
+    cache->Return(plan, n, sign, type);
+  else
+    ffts_free(plan);
+}
+
+FftsPlanCache &FftsPlanCache::Instance() {
+  // intentionally leaked - kernels (and the plans they hold) may outlive static objects
+  static FftsPlanCache *instance = new FftsPlanCache();
+  return *instance;
+}
+
+FftsPlanCache::PlanPtr FftsPlanCache::Get(int64_t n, int sign, Type type) {
+  PlanReturner returner{this, n, sign, type};
+  {
+    std::lock_guard<std::mutex> g(mtx_);
+    auto it = idle_.find(Key(n, sign, type));
+    if (it != idle_.end() && !it->second.empty()) {
+      ffts_plan_t *plan = it->second.back();
+      it->second.pop_back();
+      return PlanPtr(plan, returner);
+    }
+  }
+  // Plan creation can take a while - don't block the other threads
+  ffts_plan_t *plan = type == Type::Real ? ffts_init_1d_real(n, sign) : ffts_init_1d(n, sign);
+  DALI_ENFORCE(plan != nullptr, make_string("Could not initialize ffts plan of size ", n));
+  {
+    std::lock_guard<std::mutex> g(mtx_);
+    num_created_++;
+  }
+  return PlanPtr(plan, returner);
+}
+
+void FftsPlanCache::Return(ffts_plan_t *plan, int64_t n, int sign, Type type) {
+  {
+    std::lock_guard<std::mutex> g(mtx_);
+    auto &plans = idle_[Key(n, sign, type)];
+    if (plans.size() < kMaxIdlePlans) {
+      plans.push_back(plan);
+      return;
+    }
+  }
+  ffts_free(plan);
+}
+
+void FftsPlanCache::Clear() {
+  std::map<Key, std::vector<ffts_plan_t *>> idle;
+  {
+    std::lock_guard<std::mutex> g(mtx_);
+    idle.swap(idle_);
+  }
+  for (auto &kv : idle)
+    for (auto *plan : kv.second)
+      ffts_free(plan);
+}
+
+int64_t FftsPlanCache::NumCreated() const {
+  std::lock_guard<std::mutex> g(mtx_);
+  return num_created_;
+}
+
+}  // namespace fft
+}  // namespace signal
+}  // namespace kernels
+}  // namespace dali
@@ -0,0 +1,101 @@
+// Copyright (c) 2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef DALI_KERNELS_SIGNAL_FFT_FFTS_PLAN_CACHE_H_
+#define DALI_KERNELS_SIGNAL_FFT_FFTS_PLAN_CACHE_H_
+
+#include <ffts.h>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <tuple>
+#include <vector>
+#include "dali/core/api_helper.h"
+
+namespace dali {
+namespace kernels {
+namespace signal {
+namespace fft {
+
+/**
+ * @brief A process-wide cache of ffts plans, keyed by the transform size, direction and type.
+ *
+ * ffts plans contain working buffers, so a plan must not be executed by multiple threads at the
+ * same time. For that reason the cache lends the plans out: `Get` returns an exclusively owned
+ * plan, which goes back to the cache when the pointer is destroyed. A new plan is only created
+ * when all the cached plans with a given key are in use - typically, there are as many plans as
+ * there are threads which run transforms of a given size.
+ */
+class DLL_PUBLIC FftsPlanCache {
+ public:
+  enum class Type {
+    Complex,
+    Real
+  };
+
+  struct PlanReturner {
+    FftsPlanCache *cache = nullptr;
+    int64_t n = 0;
+    int sign = 0;
+    Type type = Type::Complex;
+    void operator()(ffts_plan_t *plan) const;
+  };
+
+  using PlanPtr = std::unique_ptr<ffts_plan_t, PlanReturner>;
+
+  /**
+   * @brief The maximum number of idle plans kept for a single key; surplus plans are freed.
+   */
+  static constexpr int kMaxIdlePlans = 64;
+
+  /**
+   * @brief Returns the process-wide instance.
+   *
+   * The instance is never destroyed, so plans can be safely returned to it at any time.
+   */
+  static FftsPlanCache &Instance();
+
+  /**
+   * @brief Gets a plan for a 1D transform of size `n`.
+   *
+   * @param sign  FFTS_FORWARD or FFTS_BACKWARD
+   * @param type  real-to-complex (forward) / complex-to-real (backward) or complex transform
+   */
+  PlanPtr Get(int64_t n, int sign, Type type);
+
+  /**
+   * @brief Frees the idle plans.
+   */
+  void Clear();
+
+  /**
+   * @brief The number of plans created by the cache so far.
+   */
+  int64_t NumCreated() const;
+
+ private:
+  void Return(ffts_plan_t *plan, int64_t n, int sign, Type type);
+
+  using Key = std::tuple<int64_t, int, Type>;
+  mutable std::mutex mtx_;
+  std::map<Key, std::vector<ffts_plan_t *>> idle_;
+  int64_t num_created_ = 0;
+};
+
+}  // namespace fft
+}  // namespace signal
+}  // namespace kernels
+}  // namespace dali
+
+#endif  // DALI_KERNELS_SIGNAL_FFT_FFTS_PLAN_CACHE_H_
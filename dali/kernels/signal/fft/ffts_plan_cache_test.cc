@@ -0,0 +1,89 @@
+// Copyright (c) 2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+#include <thread>
+#include <vector>
+#include "dali/kernels/signal/fft/ffts_plan_cache.h"
+
+namespace dali {
+namespace kernels {
+namespace signal {
+namespace fft {
+namespace test {
+
+TEST(FftsPlanCacheTest, ReuseReleasedPlan) {
+  auto &cache = FftsPlanCache::Instance();
+  ffts_plan_t *raw = nullptr;
+  {
+    auto plan = cache.Get(256, FFTS_FORWARD, FftsPlanCache::Type::Real);
+    ASSERT_NE(plan, nullptr);
+    raw = plan.get();
+  }
+  int64_t created = cache.NumCreated();
+  auto plan = cache.Get(256, FFTS_FORWARD, FftsPlanCache::Type::Real);
+  EXPECT_EQ(plan.get(), raw);
+  EXPECT_EQ(cache.NumCreated(), created);
+}
+
+TEST(FftsPlanCacheTest, PlansInUseAreNotShared) {
+  auto &cache = FftsPlanCache::Instance();
+  auto plan1 = cache.Get(128, FFTS_FORWARD, FftsPlanCache::Type::Real);
+  auto plan2 = cache.Get(128, FFTS_FORWARD, FftsPlanCache::Type::Real);
+  EXPECT_NE(plan1.get(), plan2.get());
+}
+
+TEST(FftsPlanCacheTest, DistinctKeys) {
+  auto &cache = FftsPlanCache::Instance();
+  ffts_plan_t *real = nullptr;
+  {
+    auto plan = cache.Get(64, FFTS_FORWARD, FftsPlanCache::Type::Real);
+    real = plan.get();
+  }
+  auto complex = cache.Get(64, FFTS_FORWARD, FftsPlanCache::Type::Complex);
+  auto other_size = cache.Get(32, FFTS_FORWARD, FftsPlanCache::Type::Real);
+  EXPECT_NE(complex.get(), real);
+  EXPECT_NE(other_size.get(), real);
+}
+
+TEST(FftsPlanCacheTest, ConcurrentUse) {
+  auto &cache = FftsPlanCache::Instance();
+  cache.Clear();
+  int64_t created = cache.NumCreated();
+  constexpr int kThreads = 4;
+  std::vector<std::thread> threads;
+  for (int t = 0; t < kThreads; t++) {
+    threads.emplace_back([&]() {
+      // ffts requires 32-byte aligned memory
+      alignas(32) float in[512], out[514];
+      for (auto &x : in)
+        x = 1.0f;
+      for (int i = 0; i < 100; i++) {
+        auto plan = cache.Get(512, FFTS_FORWARD, FftsPlanCache::Type::Real);
+        ffts_execute(plan.get(), in, out);
+        ASSERT_FLOAT_EQ(out[0], 512.0f);
+      }
+    });
+  }
+  for (auto &t : threads)
+    t.join();
+  // There are never more plans than concurrent users
+  EXPECT_LE(cache.NumCreated() - created, kThreads);
+}
+
+}  // namespace test
+}  // namespace fft
+}  // namespace signal
+}  // namespace kernels
+}  // namespace dali
@@ -1,4 +1,4 @@
-// Copyright (c) 2022, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+// Copyright (c) 2022-2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
 //
 // Licensed under the Apache License, Version 2.0 (the "License");
 // you may not use this file except in compliance with the License.
@@ -16,18 +16,25 @@
 
 #ifdef __SSE2__
 #include <emmintrin.h>
+#include <immintrin.h>
 #endif
 #ifdef __ARM_NEON
 #include <arm_neon.h>
 #endif
 #include <cmath>
 #include <functional>
+#include <memory>
+#include <numeric>
+#include <type_traits>
 #include <utility>
 #include <vector>
 #include "dali/core/convert.h"
 #include "dali/core/math_util.h"
 #include "dali/core/small_vector.h"
 #include "dali/core/static_switch.h"
+#include "dali/core/util.h"
+#include "dali/kernels/common/cpu_dispatch.h"
+#include "dali/kernels/signal/downmixing.h"
 
 namespace dali {
 namespace kernels {
@@ -259,11 +266,325 @@ void ResampleCPUImpl(ResamplingWindow window, Out *__restrict__ out, int64_t out
       in, n_in, in_rate, num_channels)));
 }
 
+namespace {
+
+/**
+ * @brief Calculates `n` consecutive outputs of a single-channel signal with a polyphase filter.
+ *
+ * @param src   points to the input sample at the integral part of the position of the first
+ *              output; the taps are read from `src + bank.tap_begin` onwards
+ * @param phase the phase of the first output
+ */
+using PolyphaseFilterFunc = void (*)(float *out, int64_t n, const float *src, int64_t phase,
+                                     const PolyphaseFilterBank &bank);
+
+#define DALI_POLYPHASE_FILTER_LOOP(dot)                          \
+  const int64_t adv = bank.in_step / bank.out_step;              \
+  const int64_t rem = bank.in_step % bank.out_step;              \
+  const int num_taps = bank.num_taps;                            \
+  src += bank.tap_begin;                                         \
+  for (int64_t i = 0; i < n; i++) {                              \
+    out[i] = dot(src, bank.phase(phase), num_taps);              \
+    src += adv;                                                  \
+    phase += rem;                                                \
+    if (phase >= bank.out_step) {                                \
+      phase -= bank.out_step;                                    \
+      src++;                                                     \
+    }                                                            \
+  }
+
+#if defined(__ARM_NEON)
+
+inline float dot_default(const float *x, const float *c, int num_taps) {
+  float32x4_t acc0 = vdupq_n_f32(0), acc1 = vdupq_n_f32(0);
+  float32x4_t acc2 = vdupq_n_f32(0), acc3 = vdupq_n_f32(0);
+  for (int t = 0; t < num_taps; t += 16) {
+    acc0 = vfmaq_f32(acc0, vld1q_f32(x + t), vld1q_f32(c + t));
+    acc1 = vfmaq_f32(acc1, vld1q_f32(x + t + 4), vld1q_f32(c + t + 4));
+    acc2 = vfmaq_f32(acc2, vld1q_f32(x + t + 8), vld1q_f32(c + t + 8));
+    acc3 = vfmaq_f32(acc3, vld1q_f32(x + t + 12), vld1q_f32(c + t + 12));
+  }
+  float32x4_t acc = vaddq_f32(vaddq_f32(acc0, acc1), vaddq_f32(acc2, acc3));
+  float32x2_t f2 = vpadd_f32(vget_low_f32(acc), vget_high_f32(acc));
+  f2 = vpadd_f32(f2, f2);
+  return vget_lane_f32(f2, 0);
+}
+
+#elif defined(__SSE2__)
+
+inline float dot_default(const float *x, const float *c, int num_taps) {
+  __m128 acc0 = _mm_setzero_ps(), acc1 = _mm_setzero_ps();
+  __m128 acc2 = _mm_setzero_ps(), acc3 = _mm_setzero_ps();
+  for (int t = 0; t < num_taps; t += 16) {
+    acc0 = _mm_add_ps(acc0, _mm_mul_ps(_mm_loadu_ps(x + t), _mm_loadu_ps(c + t)));
+    acc1 = _mm_add_ps(acc1, _mm_mul_ps(_mm_loadu_ps(x + t + 4), _mm_loadu_ps(c + t + 4)));
+    acc2 = _mm_add_ps(acc2, _mm_mul_ps(_mm_loadu_ps(x + t + 8), _mm_loadu_ps(c + t + 8)));
+    acc3 = _mm_add_ps(acc3, _mm_mul_ps(_mm_loadu_ps(x + t + 12), _mm_loadu_ps(c + t + 12)));
+  }
+  __m128 acc = _mm_add_ps(_mm_add_ps(acc0, acc1), _mm_add_ps(acc2, acc3));
+  acc = _mm_add_ps(acc, _mm_shuffle_ps(acc, acc, _MM_SHUFFLE(1, 0, 3, 2)));
+  acc = _mm_add_ps(acc, _mm_shuffle_ps(acc, acc, _MM_SHUFFLE(0, 1, 0, 1)));
+  return _mm_cvtss_f32(acc);
+}
+
+#else
+
+inline float dot_default(const float *x, const float *c, int num_taps) {
+  float acc[4] = {};
+  for (int t = 0; t < num_taps; t += 4) {
+    for (int l = 0; l < 4; l++)
+      acc[l] += x[t + l] * c[t + l];
+  }
+  return (acc[0] + acc[1]) + (acc[2] + acc[3]);
+}
+
+#endif
+
+void PolyphaseFilterDefault(float *out, int64_t n, const float *src, int64_t phase,
+                            const PolyphaseFilterBank &bank) {
+  DALI_POLYPHASE_FILTER_LOOP(dot_default);
+}
+
+#if DALI_X86_DISPATCH
+
+DALI_TARGET_AVX2
+inline float dot_avx2(const float *x, const float *c, int num_taps) {
+  __m256 acc0 = _mm256_setzero_ps(), acc1 = _mm256_setzero_ps();
+  for (int t = 0; t < num_taps; t += 16) {
+    acc0 = _mm256_fmadd_ps(_mm256_loadu_ps(x + t), _mm256_loadu_ps(c + t), acc0);
+    acc1 = _mm256_fmadd_ps(_mm256_loadu_ps(x + t + 8), _mm256_loadu_ps(c + t + 8), acc1);
+  }
+  __m256 acc = _mm256_add_ps(acc0, acc1);
+  __m128 acc4 = _mm_add_ps(_mm256_castps256_ps128(acc), _mm256_extractf128_ps(acc, 1));
+  acc4 = _mm_add_ps(acc4, _mm_movehl_ps(acc4, acc4));
+  acc4 = _mm_add_ss(acc4, _mm_movehdup_ps(acc4));
+  return _mm_cvtss_f32(acc4);
+}
+
+DALI_TARGET_AVX2
+void PolyphaseFilterAVX2(float *out, int64_t n, const float *src, int64_t phase,
+                         const PolyphaseFilterBank &bank) {
+  DALI_POLYPHASE_FILTER_LOOP(dot_avx2);
+}
+
+DALI_TARGET_AVX512
+inline float dot_avx512(const float *x, const float *c, int num_taps) {
+  __m512 acc = _mm512_setzero_ps();
+  for (int t = 0; t < num_taps; t += 16)
+    acc = _mm512_fmadd_ps(_mm512_loadu_ps(x + t), _mm512_loadu_ps(c + t), acc);
+  return _mm512_reduce_add_ps(acc);
+}
+
+DALI_TARGET_AVX512
+void PolyphaseFilterAVX512(float *out, int64_t n, const float *src, int64_t phase,
+                           const PolyphaseFilterBank &bank) {
+  DALI_POLYPHASE_FILTER_LOOP(dot_avx512);
+}
+
+#endif  // DALI_X86_DISPATCH
+
+#undef DALI_POLYPHASE_FILTER_LOOP
+
+/**
+ * @brief Selects the variant of the polyphase filter for the current instruction set level.
+ */
+PolyphaseFilterFunc GetPolyphaseFilter() {
+#if DALI_X86_DISPATCH
+  static constexpr simd::IsaDispatch<PolyphaseFilterFunc> variants = {
+    PolyphaseFilterDefault, PolyphaseFilterAVX2, PolyphaseFilterAVX512
+  };
+#else
+  static constexpr simd::IsaDispatch<PolyphaseFilterFunc> variants = { PolyphaseFilterDefault };
+#endif
+  return variants.Select();
+}
+
+}  // namespace
+
+static_assert(PolyphaseFilterBank::kTapAlignment % 16 == 0,
+              "The vectorized filters process the taps in groups of 16");
+
+bool PolyphaseFilterBank::GetRatio(double in_rate, double out_rate, int lobes,
+                                   int64_t &in_step, int64_t &out_step) {
+  constexpr double kMaxRate = 1 << 30;
+  if (!(in_rate > 0 && out_rate > 0 && in_rate <= kMaxRate && out_rate <= kMaxRate))
+    return false;
+  if (in_rate != std::floor(in_rate) || out_rate != std::floor(out_rate))
+    return false;
+  int64_t in_i = in_rate, out_i = out_rate;
+  int64_t g = std::gcd(in_i, out_i);
+  in_step = in_i / g;
+  out_step = out_i / g;
+  int64_t num_taps = align_up(2 * lobes, kTapAlignment);
+  return out_step * num_taps <= kMaxCoeffs;
+}
+
+void PolyphaseFilterBank::Initialize(const ResamplingWindow &window,
+                                     int64_t in_step, int64_t out_step) {
+  assert(in_step > 0 && out_step > 0);
+  this->in_step = in_step;
+  this->out_step = out_step;
+  int lobes = window.lobes;
+  tap_begin = 1 - lobes;
+  num_taps = align_up(2 * lobes, kTapAlignment);
+  coeffs.clear();
+  coeffs.resize(out_step * num_taps, 0.0f);
+  for (int64_t p = 0; p < out_step; p++) {
+    double frac = static_cast<double>(p) / out_step;
+    float *c = &coeffs[p * num_taps];
+    // ResampleCPUImpl uses taps [ceil(pos) - lobes, ceil(pos) + lobes); for phase 0,
+    // the tap at -lobes falls on the zero of the window, so it's omitted.
+    int end = p > 0 ? lobes + 1 : lobes;
+    for (int i = tap_begin; i < end; i++)
+      c[i - tap_begin] = window(static_cast<float>(i - frac));
+  }
+}
+
+/**
+ * @brief Copies the input range [begin, end) to a planar (or downmixed) buffer.
+ *
+ * The samples outside of the signal are zero.
+ *
+ * @tparam static_channels   number of channels, if known at compile time, or -1
+ */
+template <int static_channels>
+void StagePolyphaseInput(float *staging, int64_t begin, int64_t end,
+                         const float *__restrict__ in, int64_t n_in,
+                         int dynamic_num_channels, bool downmix) {
+  const int num_channels = static_channels < 0 ? dynamic_num_channels : static_channels;
+  int64_t len = end - begin;
+  int64_t valid_begin = clamp<int64_t>(begin, 0, n_in);
+  int64_t valid_end = clamp<int64_t>(end, valid_begin, n_in);
+  int planes = downmix ? 1 : num_channels;
+  for (int p = 0; p < planes; p++) {
+    float *plane = staging + p * len;
+    for (int64_t i = begin; i < valid_begin; i++)
+      plane[i - begin] = 0;
+    for (int64_t i = valid_end; i < end; i++)
+      plane[i - begin] = 0;
+  }
+  staging -= begin;
+  if (num_channels == 1) {
+    for (int64_t i = valid_begin; i < valid_end; i++)
+      staging[i] = in[i];
+  } else if (downmix) {
+    float norm = 1.0f / num_channels;
+    for (int64_t i = valid_begin; i < valid_end; i++) {
+      const float *frame = in + i * num_channels;
+      float sum = frame[0];
+      for (int c = 1; c < num_channels; c++)
+        sum += frame[c];
+      staging[i] = sum * norm;
+    }
+  } else {
+    for (int64_t i = valid_begin; i < valid_end; i++) {
+      const float *frame = in + i * num_channels;
+      for (int c = 0; c < num_channels; c++)
+        staging[c * len + i] = frame[c];
+    }
+  }
+}
+
+template <typename Out>
+void ResamplePolyphaseCPU(const PolyphaseFilterBank &bank, Out *__restrict__ out,
+                          int64_t out_begin, int64_t out_end,
+                          const float *__restrict__ in, int64_t n_in,
+                          int num_channels, bool downmix) {
+  assert(num_channels > 0);
+  if (num_channels == 1)
+    downmix = false;
+  const PolyphaseFilterFunc filter = GetPolyphaseFilter();
+  const int out_channels = downmix ? 1 : num_channels;
+  const int planes = out_channels;
+  constexpr int64_t kBlock = 256;
+  float tmp[kBlock];
+  std::vector<float> staging;
+
+  for (int64_t k0 = out_begin; k0 < out_end; k0 += kBlock) {
+    int64_t k1 = std::min(k0 + kBlock, out_end);
+    int64_t n = k1 - k0;
+    int64_t base = k0 * bank.in_step / bank.out_step;
+    int64_t phase = k0 * bank.in_step % bank.out_step;
+    int64_t last_base = (k1 - 1) * bank.in_step / bank.out_step;
+    // the range of input samples used by the block
+    int64_t first = base + bank.tap_begin;
+    int64_t last = last_base + bank.tap_begin + bank.num_taps;
+    Out *block_out = out + (k0 - out_begin) * out_channels;
+
+    const float *src;
+    int64_t plane_stride = 0;
+    if (num_channels == 1 && first >= 0 && last <= n_in) {
+      src = in + base;  // use the input in place
+    } else {
+      // edges, multiple channels or downmixing - prepare planar, zero-padded input
+      plane_stride = last - first;
+      staging.resize(plane_stride * planes);
+      VALUE_SWITCH(num_channels, static_channels, (1, 2, 3, 4, 5, 6, 7, 8),
+        (StagePolyphaseInput<static_channels>(staging.data(), first, last, in, n_in,
+                                              static_channels, downmix);),
+        (StagePolyphaseInput<-1>(staging.data(), first, last, in, n_in, num_channels, downmix);));
+      src = staging.data() + (base - first);
+    }
+
+    for (int p = 0; p < planes; p++, src += plane_stride) {
+      if (std::is_same<Out, float>::value && out_channels == 1) {
+        filter(reinterpret_cast<float *>(block_out), n, src, phase, bank);
+      } else {
+        filter(tmp, n, src, phase, bank);
+        for (int64_t i = 0; i < n; i++)
+          block_out[i * out_channels + p] = ConvertSatNorm<Out>(tmp[i]);
+      }
+    }
+  }
+}
+
+std::shared_ptr<const PolyphaseFilterBank> ResamplerCPU::GetFilterBank(double in_rate,
+                                                                      double out_rate) {
+  int64_t in_step, out_step;
+  if (!window.lookup ||
+      !PolyphaseFilterBank::GetRatio(in_rate, out_rate, window.lobes, in_step, out_step))
+    return nullptr;
+  std::lock_guard<std::mutex> g(banks_lock_);
+  auto &bank = banks_[{in_step, out_step}];
+  if (!bank) {
+    auto new_bank = std::make_shared<PolyphaseFilterBank>();
+    new_bank->Initialize(window, in_step, out_step);
+    bank = std::move(new_bank);
+  }
+  return bank;
+}
+
+template <typename Out>
+void ResamplerCPU::ResampleDownmix(Out *__restrict__ out, int64_t out_begin, int64_t out_end,
+                                   double out_rate, const float *__restrict__ in, int64_t n_in,
+                                   double in_rate, int num_channels) {
+  double scale = in_rate / out_rate;
+  int lobes = window.lobes;
+  // Only the part of the downmixed signal that's actually used is calculated; the margins
+  // cover the rounding of the positions in ResampleCPUImpl.
+  int64_t in_begin = clamp<int64_t>(std::floor(out_begin * scale) - lobes - 2, 0, n_in);
+  int64_t in_end = clamp<int64_t>(std::ceil(out_end * scale) + lobes + 2, in_begin, n_in);
+  // The buffer holds only [in_begin, in_end) - it's addressed with the positions in the whole
+  // signal, so the pointer passed to ResampleCPUImpl is shifted back by in_begin.
+  std::unique_ptr<float[]> downmixed(new float[in_end - in_begin]);
+  Downmix(downmixed.get(), in + in_begin * num_channels, in_end - in_begin, num_channels);
+  ResampleCPUImpl(window, out, out_begin, out_end, out_rate, downmixed.get() - in_begin, in_end,
+                  in_rate, 1);
+}
+
 #define DALI_INSTANTIATE_RESAMPLER_CPU_OUT(Out)                                             \
   template void ResampleCPUImpl(ResamplingWindow window, Out *__restrict__ out,             \
                                 int64_t out_begin, int64_t out_end, double out_rate,        \
                                 const float *__restrict__ in, int64_t n_in, double in_rate, \
-                                int num_channels);
+                                int num_channels);                                          \
+  template void ResamplePolyphaseCPU(const PolyphaseFilterBank &bank,                       \
+                                     Out *__restrict__ out, int64_t out_begin,              \
+                                     int64_t out_end, const float *__restrict__ in,         \
+                                     int64_t n_in, int num_channels, bool downmix);         \
+  template void ResamplerCPU::ResampleDownmix(Out *__restrict__ out, int64_t out_begin,     \
+                                              int64_t out_end, double out_rate,             \
+                                              const float *__restrict__ in, int64_t n_in,   \
+                                              double in_rate, int num_channels);
 
 #define DALI_INSTANTIATE_RESAMPLER_CPU()        \
   DALI_INSTANTIATE_RESAMPLER_CPU_OUT(float);    \
@@ -1,4 +1,4 @@
-// Copyright (c) 2022, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+// Copyright (c) 2022-2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
 //
 // Licensed under the Apache License, Version 2.0 (the "License");
 // you may not use this file except in compliance with the License.
@@ -15,6 +15,11 @@
 #ifndef DALI_KERNELS_SIGNAL_RESAMPLING_CPU_H_
 #define DALI_KERNELS_SIGNAL_RESAMPLING_CPU_H_
 
+#include <map>
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
 #include "dali/kernels/signal/resampling.h"
 #include "dali/core/api_helper.h"
 
@@ -29,11 +34,68 @@ DLL_PUBLIC void ResampleCPUImpl(ResamplingWindow window, Out *__restrict__ out,
                                 int64_t out_end, double out_rate, const float *__restrict__ in,
                                 int64_t n_in, double in_rate, int num_channels);
 
+/**
+ * @brief Filter bank of a polyphase resampler
+ *
+ * When the ratio of sampling rates is rational, `in_rate / out_rate == in_step / out_step`,
+ * the output sample `k` is located at input position `k * in_step / out_step`. The fractional
+ * part of the position can take only `out_step` distinct values (phases), so the filter
+ * coefficients are calculated once for each phase and resampling reduces to dot products
+ * of the input with the coefficients. The position is tracked with integers, so it doesn't
+ * drift, regardless of the length of the signal.
+ *
+ * The coefficients are sampled from the same window as the one used by ResampleCPUImpl.
+ */
+struct DLL_PUBLIC PolyphaseFilterBank {
+  /** The number of taps per phase is padded to a multiple of this value */
+  static constexpr int kTapAlignment = 16;
+  /** Maximum total number of coefficients for which a filter bank is created */
+  static constexpr int64_t kMaxCoeffs = 1 << 20;
+
+  int64_t in_step = 0, out_step = 0;
+  /** Offset of the first tap relative to the integral part of the input position */
+  int tap_begin = 0;
+  /** Number of taps per phase, including zero padding */
+  int num_taps = 0;
+  /** Coefficients, `out_step` phases of `num_taps` each */
+  std::vector<float> coeffs;
+
+  void Initialize(const ResamplingWindow &window, int64_t in_step, int64_t out_step);
+
+  const float *phase(int64_t p) const {
+    return &coeffs[p * num_taps];
+  }
+
+  /**
+   * @brief Calculates the reduced ratio of the sampling rates.
+   *
+   * @return true, if the rates are integers and the resulting filter bank wouldn't exceed
+   *         kMaxCoeffs coefficients.
+   */
+  static bool GetRatio(double in_rate, double out_rate, int lobes,
+                       int64_t &in_step, int64_t &out_step);
+};
+
+/**
+ * @brief Resample multi-channel (or single channel) signal with a polyphase filter bank
+ *
+ * Calculates the range [out_begin, out_end) of the resampled signal; `out` points to the
+ * beginning of that range. If `downmix` is true, the channels are averaged on the fly and the
+ * output has a single channel.
+ */
+template <typename Out>
+DLL_PUBLIC void ResamplePolyphaseCPU(const PolyphaseFilterBank &bank, Out *__restrict__ out,
+                                     int64_t out_begin, int64_t out_end,
+                                     const float *__restrict__ in, int64_t n_in,
+                                     int num_channels, bool downmix);
+
 struct DLL_PUBLIC ResamplerCPU {
   ResamplingWindowCPU window;
 
   inline void Initialize(int lobes = 16, int lookup_size = 2048) {
     windowed_sinc(window, lookup_size, lobes);
+    std::lock_guard<std::mutex> g(banks_lock_);
+    banks_.clear();
   }
 
   /**
@@ -42,12 +104,39 @@ struct DLL_PUBLIC ResamplerCPU {
    * Calculates a range of resampled signal.
    * The function can resample a region-of-interest (ROI) of the output, specified by `out_begin` and
    * `out_end`. In this case, the output pointer points to the beginning of the ROI.
+   * Disjoint ROIs of the same signal can be calculated concurrently.
+   *
+   * If `downmix` is true, the channels are averaged and the output has a single channel.
+   *
+   * Integral sampling rates with a reasonably small reduced ratio (e.g. 44100 -> 16000) are
+   * processed with a polyphase filter bank, which is created on first use and cached.
    */
   template <typename Out>
   void Resample(Out *__restrict__ out, int64_t out_begin, int64_t out_end, double out_rate,
-                const float *__restrict__ in, int64_t n_in, double in_rate, int num_channels) {
-    ResampleCPUImpl(window, out, out_begin, out_end, out_rate, in, n_in, in_rate, num_channels);
+                const float *__restrict__ in, int64_t n_in, double in_rate, int num_channels,
+                bool downmix = false) {
+    if (auto bank = GetFilterBank(in_rate, out_rate)) {
+      ResamplePolyphaseCPU(*bank, out, out_begin, out_end, in, n_in, num_channels, downmix);
+    } else if (downmix && num_channels > 1) {
+      ResampleDownmix(out, out_begin, out_end, out_rate, in, n_in, in_rate, num_channels);
+    } else {
+      ResampleCPUImpl(window, out, out_begin, out_end, out_rate, in, n_in, in_rate, num_channels);
+    }
   }
+
+  /**
+   * @brief Returns a polyphase filter bank for given rates or null, if the ratio is not suitable.
+   */
+  std::shared_ptr<const PolyphaseFilterBank> GetFilterBank(double in_rate, double out_rate);
+
+ private:
+  template <typename Out>
+  void ResampleDownmix(Out *__restrict__ out, int64_t out_begin, int64_t out_end, double out_rate,
+                       const float *__restrict__ in, int64_t n_in, double in_rate,
+                       int num_channels);
+
+  std::mutex banks_lock_;
+  std::map<std::pair<int64_t, int64_t>, std::shared_ptr<const PolyphaseFilterBank>> banks_;
 };
 
 }  // namespace resampling
@@ -1,4 +1,4 @@
-// Copyright (c) 2019-2022, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+// Copyright (c) 2019-2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
 //
 // Licensed under the Apache License, Version 2.0 (the "License");
 // you may not use this file except in compliance with the License.
@@ -16,7 +16,10 @@
 #include <gtest/gtest.h>
 #include <vector>
 #include <numeric>
+#include <utility>
 #include "dali/core/cuda_error.h"
+#include "dali/kernels/common/cpu_dispatch.h"
+#include "dali/kernels/signal/downmixing.h"
 #include "dali/kernels/signal/resampling_test.h"
 
 namespace dali {
@@ -194,6 +197,118 @@ TEST_F(ResamplingCPUTest, ThreeChannelNeedHighPrecision) {
   this->RunTest();
 }
 
+namespace {
+
+std::vector<float> TestSignal(int64_t length, int nchannels) {
+  std::vector<float> signal(length * nchannels);
+  for (int c = 0; c < nchannels; c++)
+    TestWave(signal.data() + c, length, nchannels, 0.1 + 0.013 * c);
+  return signal;
+}
+
+const std::pair<double, double> kPolyphaseRates[] = {
+  {44100, 16000}, {48000, 16000}, {22050, 16000}, {16000, 44100}, {44100, 48000}, {8000, 16000}
+};
+
+}  // namespace
+
+class ResamplingPolyphaseIsaTest : public ::testing::TestWithParam<simd::CpuIsa> {};
+
+TEST_P(ResamplingPolyphaseIsaTest, MatchesGeneric) {
+  if (!simd::CpuIsaSupported(GetParam()))
+    GTEST_SKIP() << simd::CpuIsaName(GetParam()) << " is not supported by this CPU";
+  simd::ScopedCpuIsa scoped_isa(GetParam());
+  ResamplerCPU R;
+  R.Initialize(16);
+  for (auto rates : kPolyphaseRates) {
+    double in_rate = rates.first, out_rate = rates.second;
+    ASSERT_NE(R.GetFilterBank(in_rate, out_rate), nullptr);
+    for (int nchannels : {1, 2, 5}) {
+      int64_t n_in = 10000 + 17 * nchannels;
+      int64_t n_out = resampled_length(n_in, in_rate, out_rate);
+      auto in = TestSignal(n_in, nchannels);
+      std::vector<float> out(n_out * nchannels), ref(n_out * nchannels);
+      R.Resample(out.data(), 0, n_out, out_rate, in.data(), n_in, in_rate, nchannels);
+      ResampleCPUImpl(R.window, ref.data(), 0, n_out, out_rate, in.data(), n_in, in_rate,
+                      nchannels);
+      // the generic implementation tracks the position in single precision, hence the tolerance
+      for (int64_t i = 0; i < n_out * nchannels; i++)
+        ASSERT_NEAR(out[i], ref[i], 5e-4) << "@ " << i << " rates " << in_rate << " -> "
+                                          << out_rate << " channels " << nchannels;
+    }
+  }
+}
+
+INSTANTIATE_TEST_SUITE_P(ResamplingPolyphaseCPUTest, ResamplingPolyphaseIsaTest,
+                         ::testing::Values(simd::CpuIsa::Baseline, simd::CpuIsa::AVX2,
+                                           simd::CpuIsa::AVX512),
+                         [](const auto &info) { return simd::CpuIsaName(info.param); });
+
+TEST(ResamplingPolyphaseCPUTest, Chunks) {
+  ResamplerCPU R;
+  R.Initialize(16);
+  int nchannels = 2;
+  double in_rate = 44100, out_rate = 16000;
+  int64_t n_in = 50000;
+  int64_t n_out = resampled_length(n_in, in_rate, out_rate);
+  auto in = TestSignal(n_in, nchannels);
+  std::vector<float> out(n_out * nchannels), ref(n_out * nchannels);
+  R.Resample(ref.data(), 0, n_out, out_rate, in.data(), n_in, in_rate, nchannels);
+  int64_t bounds[] = {0, 7, 1000, 1001, 9999, n_out};
+  for (int i = 0; i + 1 < 6; i++) {
+    R.Resample(out.data() + bounds[i] * nchannels, bounds[i], bounds[i + 1], out_rate,
+               in.data(), n_in, in_rate, nchannels);
+  }
+  for (int64_t i = 0; i < n_out * nchannels; i++)
+    ASSERT_EQ(out[i], ref[i]) << "@ " << i;
+}
+
+TEST(ResamplingPolyphaseCPUTest, Downmix) {
+  ResamplerCPU R;
+  R.Initialize(16);
+  int nchannels = 3;
+  // the last pair is not an integer ratio and uses the generic resampler
+  for (auto rates : {std::make_pair(44100.0, 16000.0), std::make_pair(22050.5, 16000.0)}) {
+    double in_rate = rates.first, out_rate = rates.second;
+    int64_t n_in = 20000;
+    int64_t n_out = resampled_length(n_in, in_rate, out_rate);
+    auto in = TestSignal(n_in, nchannels);
+    std::vector<float> mono(n_in), out(n_out), ref(n_out);
+    Downmix(mono.data(), in.data(), n_in, nchannels);
+    R.Resample(ref.data(), 0, n_out, out_rate, mono.data(), n_in, in_rate, 1);
+    int64_t mid = n_out / 3;
+    R.Resample(out.data(), 0, mid, out_rate, in.data(), n_in, in_rate, nchannels, true);
+    R.Resample(out.data() + mid, mid, n_out, out_rate, in.data(), n_in, in_rate, nchannels, true);
+    for (int64_t i = 0; i < n_out; i++)
+      ASSERT_NEAR(out[i], ref[i], 1e-4) << "@ " << i << " in_rate " << in_rate;
+  }
+}
+
+TEST(ResamplingPolyphaseCPUTest, ConvertOutput) {
+  ResamplerCPU R;
+  R.Initialize(16);
+  double in_rate = 48000, out_rate = 16000;
+  int64_t n_in = 4800;
+  int64_t n_out = resampled_length(n_in, in_rate, out_rate);
+  auto in = TestSignal(n_in, 1);
+  std::vector<float> ref(n_out);
+  std::vector<int16_t> out(n_out);
+  R.Resample(ref.data(), 0, n_out, out_rate, in.data(), n_in, in_rate, 1);
+  R.Resample(out.data(), 0, n_out, out_rate, in.data(), n_in, in_rate, 1);
+  for (int64_t i = 0; i < n_out; i++)
+    ASSERT_EQ(out[i], ConvertSatNorm<int16_t>(ref[i])) << "@ " << i;
+}
+
+TEST(ResamplingPolyphaseCPUTest, RatioSelection) {
+  int64_t in_step, out_step;
+  ASSERT_TRUE(PolyphaseFilterBank::GetRatio(44100, 16000, 16, in_step, out_step));
+  EXPECT_EQ(in_step, 441);
+  EXPECT_EQ(out_step, 160);
+  EXPECT_FALSE(PolyphaseFilterBank::GetRatio(44100.5, 16000, 16, in_step, out_step));
+  // too many phases
+  EXPECT_FALSE(PolyphaseFilterBank::GetRatio(1000003, 999983, 16, in_step, out_step));
+}
+
 }  // namespace test
 }  // namespace resampling
 }  // namespace signal
@@ -0,0 +1,259 @@
+// Copyright (c) 2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "dali/kernels/slice/slice_flip_normalize_hwc_cpu.h"
+
+#ifdef __SSE2__
+#include <immintrin.h>
+#endif
+#include <algorithm>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include "dali/core/convert.h"
+#include "dali/kernels/common/cpu_dispatch.h"
+#include "dali/kernels/slice/slice_kernel_utils.h"
+
+namespace dali {
+namespace kernels {
+namespace slice_impl {
+
+namespace {
+
+/**
+ * @brief A rectangle of pixels which lie within the input bounds.
+ */
+template <typename Out>
+struct HWCRegion {
+  Out *out;
+  int64_t out_row_stride, out_pixel_stride, out_channel_stride;
+  const uint8_t *in;
+  int64_t in_row_stride, in_pixel_stride;
+  int64_t height, width;
+  int nchannels;
+  const float *mean, *inv_stddev;
+};
+
+template <typename Out>
+inline void NormalizePixels(const HWCRegion<Out> &r, Out *out, const uint8_t *in, int64_t n) {
+  if (r.out_pixel_stride == 1) {  // planar output - go plane by plane
+    for (int c = 0; c < r.nchannels; c++) {
+      Out *out_c = out + c * r.out_channel_stride;
+      const uint8_t *in_c = in + c;
+      float m = r.mean[c], k = r.inv_stddev[c];
+      for (int64_t x = 0; x < n; x++)
+        out_c[x] = ConvertSat<Out>((in_c[x * r.in_pixel_stride] - m) * k);
+    }
+  } else {
+    for (int64_t x = 0; x < n; x++, out += r.out_pixel_stride, in += r.in_pixel_stride) {
+      for (int c = 0; c < r.nchannels; c++)
+        out[c] = ConvertSat<Out>((in[c] - r.mean[c]) * r.inv_stddev[c]);
+    }
+  }
+}
+
+template <typename Out>
+void NormalizeRegion(const HWCRegion<Out> &r) {
+  for (int64_t y = 0; y < r.height; y++)
+    NormalizePixels(r, r.out + y * r.out_row_stride, r.in + y * r.in_row_stride, r.width);
+}
+
+#if DALI_X86_DISPATCH
+
+DALI_TARGET_AVX2 inline void Store8(float *out, __m256 v) {
+  _mm256_storeu_ps(out, v);
+}
+
+DALI_TARGET_AVX2 inline void Store8(float16 *out, __m256 v) {
+  // saturate, like ConvertSat does
+  v = _mm256_min_ps(_mm256_max_ps(v, _mm256_set1_ps(-65504.0f)), _mm256_set1_ps(65504.0f));
+  _mm_storeu_si128(reinterpret_cast<__m128i *>(out),
+                   _mm256_cvtps_ph(v, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC));
+}
+
+/**
+ * @brief Normalizes 3-channel pixels, 8 at a time.
+ *
+ * 8 pixels occupy 24 bytes of the input. The bytes are rearranged (with pshufb) into 3 groups
+ * of 8, in the output order: for planar output, a group contains one channel; for interleaved
+ * output, the groups are just consecutive. Flipping reverses the order of pixels in the groups.
+ * Each group is then widened to 8 floats and normalized with per-element mean and scale.
+ */
+template <bool Planar, typename Out>
+DALI_TARGET_AVX2 void NormalizeRGB_AVX2(const HWCRegion<Out> &r) {
+  bool flip = r.in_pixel_stride < 0;
+  __m128i lo_mask[3], hi_mask[3];
+  __m256 mean[3], scale[3];
+  for (int g = 0; g < 3; g++) {
+    alignas(16) int8_t lo[16], hi[16];
+    alignas(32) float m[8], k[8];
+    for (int i = 0; i < 16; i++) {
+      lo[i] = hi[i] = -1;  // zero the byte
+      if (i >= 8)
+        continue;
+      int px = Planar ? i : (g * 8 + i) / 3;
+      int c = Planar ? g : (g * 8 + i) % 3;
+      int src = 3 * (flip ? 7 - px : px) + c;
+      if (src < 16)
+        lo[i] = src;
+      else
+        hi[i] = src - 16;
+      m[i] = r.mean[c];
+      k[i] = r.inv_stddev[c];
+    }
+    lo_mask[g] = _mm_load_si128(reinterpret_cast<const __m128i *>(lo));
+    hi_mask[g] = _mm_load_si128(reinterpret_cast<const __m128i *>(hi));
+    mean[g] = _mm256_load_ps(m);
+    scale[g] = _mm256_load_ps(k);
+  }
+
+  // the 8 pixels starting at x are stored at in[3 * x] or, if flipped, at in[-3 * (x + 7)]
+  int64_t window_offset = flip ? -21 : 0;
+  for (int64_t y = 0; y < r.height; y++) {
+    Out *out = r.out + y * r.out_row_stride;
+    const uint8_t *in = r.in + y * r.in_row_stride;
+    int64_t x = 0;
+    for (; x + 8 <= r.width; x += 8) {
+      const uint8_t *window = in + x * r.in_pixel_stride + window_offset;
+      __m128i lo = _mm_loadu_si128(reinterpret_cast<const __m128i *>(window));
+      __m128i hi = _mm_loadl_epi64(reinterpret_cast<const __m128i *>(window + 16));
+      for (int g = 0; g < 3; g++) {
+        __m128i bytes = _mm_or_si128(_mm_shuffle_epi8(lo, lo_mask[g]),
+                                     _mm_shuffle_epi8(hi, hi_mask[g]));
+        __m256 v = _mm256_cvtepi32_ps(_mm256_cvtepu8_epi32(bytes));
+        // (x - mean) * scale, rather than a fused multiply-add, gives bit-exact results
+        v = _mm256_mul_ps(_mm256_sub_ps(v, mean[g]), scale[g]);
+        Store8(Planar ? out + g * r.out_channel_stride + x : out + 3 * x + 8 * g, v);
+      }
+    }
+    if (x < r.width)
+      NormalizePixels(r, out + x * r.out_pixel_stride, in + x * r.in_pixel_stride, r.width - x);
+  }
+}
+
+template <typename Out>
+DALI_TARGET_AVX2 void NormalizeRegionAVX2(const HWCRegion<Out> &r) {
+  if (r.nchannels == 3 && (r.in_pixel_stride == 3 || r.in_pixel_stride == -3)) {
+    if (r.out_pixel_stride == 1)
+      return NormalizeRGB_AVX2<true>(r);
+    if (r.out_pixel_stride == 3 && r.out_channel_stride == 1)
+      return NormalizeRGB_AVX2<false>(r);
+  }
+  NormalizeRegion(r);
+}
+
+#endif  // DALI_X86_DISPATCH
+
+template <typename Out>
+void NormalizeRegionDispatch(const HWCRegion<Out> &r) {
+  using Func = void (*)(const HWCRegion<Out> &);
+#if DALI_X86_DISPATCH
+  static constexpr simd::IsaDispatch<Func> variants = {
+    NormalizeRegion<Out>, NormalizeRegionAVX2<Out>
+  };
+#else
+  static constexpr simd::IsaDispatch<Func> variants = { NormalizeRegion<Out> };
+#endif
+  variants.Select()(r);
+}
+
+}  // namespace
+
+template <typename OutputType>
+bool SliceFlipNormalizeHWC(
+    OutputType *output, const uint8_t *input, const int64_t *in_strides,
+    const int64_t *out_strides, const int64_t *anchor, const int64_t *in_shape,
+    const int64_t *out_shape, const OutputType *fill_values, const float *mean,
+    const float *inv_stddev, int channel_dim) {
+  // The channels must be the outermost (planar) or the innermost (interleaved) output dimension
+  // and they must be stored contiguously in the input.
+  if (channel_dim != 0 && channel_dim != 2)
+    return false;
+  if (in_strides[channel_dim] != 1 || anchor[channel_dim] != 0)
+    return false;
+  int ydim = channel_dim == 0 ? 1 : 0;
+  int xdim = ydim + 1;
+
+  int nch_out = out_shape[channel_dim];
+  int nch = std::min<int64_t>(nch_out, in_shape[channel_dim]);
+
+  std::vector<float> no_mean, no_scale;
+  if (!mean || !inv_stddev) {
+    no_mean.resize(nch, 0.0f);
+    no_scale.resize(nch, 1.0f);
+    mean = no_mean.data();
+    inv_stddev = no_scale.data();
+  }
+
+  int64_t y_before, y_slice, y_after, x_before, x_slice, x_after;
+  std::tie(y_before, y_slice, y_after) = CalcPadCopyExtents(anchor[ydim], in_shape[ydim],
+                                                            out_shape[ydim]);
+  std::tie(x_before, x_slice, x_after) = CalcPadCopyExtents(anchor[xdim], in_shape[xdim],
+                                                            out_shape[xdim]);
+  if (in_strides[ydim] < 0) std::swap(y_before, y_after);
+  if (in_strides[xdim] < 0) std::swap(x_before, x_after);
+
+  int64_t out_row_stride = out_strides[ydim];
+  int64_t out_pixel_stride = out_strides[xdim];
+  int64_t out_channel_stride = out_strides[channel_dim];
+  auto fill = [&](OutputType *out, int64_t n, int c_start) {
+    for (int c = c_start; c < nch_out; c++) {
+      OutputType *out_c = out + c * out_channel_stride;
+      for (int64_t i = 0; i < n; i++)
+        out_c[i * out_pixel_stride] = fill_values[c];
+    }
+  };
+
+  for (int64_t y = 0; y < out_shape[ydim]; y++) {
+    OutputType *out_row = output + y * out_row_stride;
+    if (y < y_before || y >= y_before + y_slice) {
+      fill(out_row, out_shape[xdim], 0);
+      continue;
+    }
+    fill(out_row, x_before, 0);
+    fill(out_row + x_before * out_pixel_stride, x_slice, nch);  // padded channels
+    fill(out_row + (x_before + x_slice) * out_pixel_stride, x_after, 0);
+  }
+
+  if (y_slice > 0 && x_slice > 0 && nch > 0) {
+    HWCRegion<OutputType> region;
+    region.out = output + y_before * out_row_stride + x_before * out_pixel_stride;
+    region.out_row_stride = out_row_stride;
+    region.out_pixel_stride = out_pixel_stride;
+    region.out_channel_stride = out_channel_stride;
+    region.in = input + y_before * in_strides[ydim] + x_before * in_strides[xdim];
+    region.in_row_stride = in_strides[ydim];
+    region.in_pixel_stride = in_strides[xdim];
+    region.height = y_slice;
+    region.width = x_slice;
+    region.nchannels = nch;
+    region.mean = mean;
+    region.inv_stddev = inv_stddev;
+    NormalizeRegionDispatch(region);
+  }
+  return true;
+}
+
+template DLL_PUBLIC bool SliceFlipNormalizeHWC<float>(
+    float *, const uint8_t *, const int64_t *, const int64_t *, const int64_t *, const int64_t *,
+    const int64_t *, const float *, const float *, const float *, int);
+
+template DLL_PUBLIC bool SliceFlipNormalizeHWC<float16>(
+    float16 *, const uint8_t *, const int64_t *, const int64_t *, const int64_t *,
+    const int64_t *, const int64_t *, const float16 *, const float *, const float *, int);
+
+}  // namespace slice_impl
+}  // namespace kernels
+}  // namespace dali
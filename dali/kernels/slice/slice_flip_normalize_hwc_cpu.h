@@ -0,0 +1,91 @@
+// Copyright (c) 2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef DALI_KERNELS_SLICE_SLICE_FLIP_NORMALIZE_HWC_CPU_H_
+#define DALI_KERNELS_SLICE_SLICE_FLIP_NORMALIZE_HWC_CPU_H_
+
+#include <cstdint>
+#include <type_traits>
+#include "dali/core/api_helper.h"
+#include "dali/core/float16.h"
+#include "dali/core/tensor_shape.h"
+
+namespace dali {
+namespace kernels {
+namespace slice_impl {
+
+/**
+ * @brief Slice, flip, normalize and (optionally) transpose to planar layout an interleaved
+ *        uint8 image - a fast path of SliceFlipNormalizePermutePadKernel.
+ *
+ * The arguments are the same as those of SliceFlipNormalizePermutePadKernel for a 3D tensor
+ * (i.e. already permuted to the output order and with flips expressed as negative strides).
+ * The fast path handles the inputs with the channels stored innermost and contiguously and
+ * outputs with the channels either outermost (HWC -> CHW) or innermost (HWC -> HWC).
+ * The spatial dimensions can be flipped and padded; the channels can be padded at the end.
+ *
+ * Interleaved 3-channel images are processed 8 pixels at a time with AVX2, if available.
+ * The results are the same as those of the generic kernel.
+ *
+ * @return false if the arguments are not supported by the fast path - in that case, nothing
+ *         is written and the generic kernel should be used.
+ */
+template <typename OutputType>
+DLL_PUBLIC bool SliceFlipNormalizeHWC(
+    OutputType *output, const uint8_t *input, const int64_t *in_strides,
+    const int64_t *out_strides, const int64_t *anchor, const int64_t *in_shape,
+    const int64_t *out_shape, const OutputType *fill_values, const float *mean,
+    const float *inv_stddev, int channel_dim);
+
+extern template DLL_PUBLIC bool SliceFlipNormalizeHWC<float>(
+    float *, const uint8_t *, const int64_t *, const int64_t *, const int64_t *, const int64_t *,
+    const int64_t *, const float *, const float *, const float *, int);
+
+extern template DLL_PUBLIC bool SliceFlipNormalizeHWC<float16>(
+    float16 *, const uint8_t *, const int64_t *, const int64_t *, const int64_t *,
+    const int64_t *, const int64_t *, const float16 *, const float *, const float *, int);
+
+template <int Dims, typename OutputType, typename InputType>
+constexpr bool HasSliceFlipNormalizeHWC =
+    Dims == 3 && std::is_same_v<InputType, uint8_t> &&
+    (std::is_same_v<OutputType, float> || std::is_same_v<OutputType, float16>);
+
+/**
+ * @brief Runs SliceFlipNormalizeHWC, if the types are supported.
+ *
+ * @return true, if the fast path was used
+ */
+template <int Dims, typename OutputType, typename InputType>
+bool TrySliceFlipNormalizeHWC(
+    OutputType *output, const InputType *input, const TensorShape<Dims> &in_strides,
+    const TensorShape<Dims> &out_strides, const TensorShape<Dims> &anchor,
+    const TensorShape<Dims> &in_shape, const TensorShape<Dims> &out_shape,
+    const OutputType *fill_values, const float *mean, const float *inv_stddev,
+    int channel_dim) {
+  if constexpr (HasSliceFlipNormalizeHWC<Dims, OutputType, InputType>) {
+    if (!fill_values)
+      return false;
+    return SliceFlipNormalizeHWC(output, input, in_strides.data(), out_strides.data(),
+                                 anchor.data(), in_shape.data(), out_shape.data(), fill_values,
+                                 mean, inv_stddev, channel_dim);
+  } else {
+    return false;
+  }
+}
+
+}  // namespace slice_impl
+}  // namespace kernels
+}  // namespace dali
+
+#endif  // DALI_KERNELS_SLICE_SLICE_FLIP_NORMALIZE_HWC_CPU_H_
@@ -0,0 +1,148 @@
+// Copyright (c) 2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+#include <cstring>
+#include <random>
+#include <vector>
+#include "dali/core/tensor_view.h"
+#include "dali/kernels/common/cpu_dispatch.h"
+#include "dali/kernels/slice/slice_flip_normalize_hwc_cpu.h"
+#include "dali/kernels/slice/slice_flip_normalize_permute_pad_cpu.h"
+
+namespace dali {
+namespace kernels {
+namespace test {
+
+namespace {
+
+struct HWCTestCase {
+  bool planar;
+  bool flip_x, flip_y;
+  int64_t anchor_y, anchor_x, out_h, out_w;
+  int out_channels;
+  bool normalize;
+};
+
+template <typename Out, typename In>
+std::vector<Out> RunKernel(const std::vector<In> &in, TensorShape<3> in_shape,
+                           const SliceFlipNormalizePermutePadArgs<3> &args) {
+  SliceFlipNormalizePermutePadCpu<Out, In, 3> kernel;
+  KernelContext ctx;
+  auto in_view = make_tensor_cpu<3>(in.data(), in_shape);
+  auto req = kernel.Setup(ctx, in_view, args);
+  TensorShape<3> out_shape = req.output_shapes[0][0].template to_static<3>();
+  std::vector<Out> out(volume(out_shape));
+  kernel.Run(ctx, make_tensor_cpu<3>(out.data(), out_shape), in_view, args);
+  return out;
+}
+
+template <typename Out>
+void TestFastPath(const HWCTestCase &tc) {
+  const int H = 37, W = 45, C = 3;
+  TensorShape<3> in_shape{H, W, C};
+  std::vector<uint8_t> in(volume(in_shape));
+  std::mt19937 rng(1234);
+  std::uniform_int_distribution<int> dist(0, 255);
+  for (auto &v : in)
+    v = dist(rng);
+  // the same values, but an input type not handled by the fast path
+  std::vector<int16_t> in16(in.begin(), in.end());
+
+  SliceFlipNormalizePermutePadArgs<3> args(TensorShape<3>{tc.out_h, tc.out_w, tc.out_channels},
+                                           in_shape);
+  args.anchor = {tc.anchor_y, tc.anchor_x, 0};
+  args.flip = {tc.flip_y, tc.flip_x, false};
+  args.channel_dim = 2;
+  if (tc.planar)
+    args.permuted_dims = {2, 0, 1};
+  args.fill_values.clear();
+  for (int c = 0; c < tc.out_channels; c++)
+    args.fill_values.push_back(10.0f * c + 1);
+  if (tc.normalize) {
+    for (int c = 0; c < tc.out_channels; c++) {
+      args.mean.push_back(123.675f + 3.1f * c);
+      args.inv_stddev.push_back(1 / (58.395f - 1.2f * c));
+    }
+  }
+
+  auto processed = slice_impl::ProcessArgs(args, in_shape);
+  std::vector<Out> tmp(volume(processed.out_shape));
+  SmallVector<Out, 8> fill_values;
+  for (auto v : processed.fill_values)
+    fill_values.push_back(static_cast<Out>(v));
+  ASSERT_TRUE(slice_impl::TrySliceFlipNormalizeHWC(
+      tmp.data(), in.data() + processed.input_offset, processed.in_strides,
+      processed.out_strides, processed.anchor, processed.in_shape, processed.out_shape,
+      fill_values.data(), GetPtr<float>(processed.mean), GetPtr<float>(processed.inv_stddev),
+      processed.channel_dim)) << "The fast path should be used in this case";
+
+  auto ref = RunKernel<Out>(in16, in_shape, args);
+  for (auto isa : simd::SupportedCpuIsas()) {
+    simd::ScopedCpuIsa scoped_isa(isa);
+    auto out = RunKernel<Out>(in, in_shape, args);
+    ASSERT_EQ(out.size(), ref.size());
+    for (size_t i = 0; i < out.size(); i++) {
+      ASSERT_EQ(static_cast<float>(out[i]), static_cast<float>(ref[i]))
+          << "at index " << i << " with ISA " << simd::CpuIsaName(isa);
+    }
+  }
+}
+
+const HWCTestCase kTestCases[] = {
+  // planar, flip_x, flip_y, anchor_y, anchor_x, out_h, out_w, out_channels, normalize
+  { true,  false, false,  0,  0, 37, 45, 3, true },
+  { true,  true,  false,  3,  5, 30, 33, 3, true },
+  { true,  true,  true,  -4, -7, 50, 60, 3, true },
+  { true,  false, true,   2,  1, 20, 17, 4, true },
+  { true,  false, false,  0,  0, 37, 45, 3, false },
+  { false, false, false,  0,  0, 37, 45, 3, true },
+  { false, true,  false,  3,  5, 30, 33, 3, true },
+  { false, true,  true,  -4, -7, 50, 60, 3, true },
+  { false, false, true,   2,  1, 20, 17, 4, true },
+  { false, true,  false,  0,  0, 37, 45, 3, false },
+};
+
+}  // namespace
+
+TEST(SliceFlipNormalizeHWCCpuTest, Float) {
+  for (auto &tc : kTestCases)
+    TestFastPath<float>(tc);
+}
+
+TEST(SliceFlipNormalizeHWCCpuTest, Float16) {
+  for (auto &tc : kTestCases)
+    TestFastPath<float16>(tc);
+}
+
+TEST(SliceFlipNormalizeHWCCpuTest, NotApplicable) {
+  TensorShape<3> in_shape{4, 5, 3};
+  std::vector<uint8_t> in(volume(in_shape));
+  std::vector<float> out(volume(in_shape));
+  float fill[3] = {};
+  TensorShape<3> anchor{0, 0, 0};
+  // channels not stored contiguously in the input
+  EXPECT_FALSE(slice_impl::SliceFlipNormalizeHWC(
+      out.data(), in.data(), TensorShape<3>{5, 1, 20}.data(), TensorShape<3>{15, 3, 1}.data(),
+      anchor.data(), TensorShape<3>{4, 5, 3}.data(), TensorShape<3>{4, 5, 3}.data(), fill,
+      nullptr, nullptr, 2));
+  // no channel dimension
+  EXPECT_FALSE(slice_impl::SliceFlipNormalizeHWC(
+      out.data(), in.data(), TensorShape<3>{15, 3, 1}.data(), TensorShape<3>{15, 3, 1}.data(),
+      anchor.data(), in_shape.data(), in_shape.data(), fill, nullptr, nullptr, -1));
+}
+
+}  // namespace test
+}  // namespace kernels
+}  // namespace dali
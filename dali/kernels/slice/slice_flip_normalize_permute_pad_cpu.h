@@ -1,4 +1,4 @@
-// Copyright (c) 2019-2022, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+// Copyright (c) 2019-2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
 //
 // Licensed under the Apache License, Version 2.0 (the "License");
 // you may not use this file except in compliance with the License.
@@ -24,6 +24,7 @@
 #include "dali/core/static_switch.h"
 #include "dali/kernels/common/split_shape.h"
 #include "dali/kernels/kernel.h"
+#include "dali/kernels/slice/slice_flip_normalize_hwc_cpu.h"
 #include "dali/kernels/slice/slice_flip_normalize_permute_pad_common.h"
 #include "dali/kernels/slice/slice_kernel_utils.h"
 
@@ -222,6 +223,10 @@ void SliceFlipNormalizePermutePadKernel(
     const OutputType *fill_values = nullptr, const float *mean = nullptr,
     const float *inv_stddev = nullptr,
     int channel_dim = -1) {  // negative if no channel dim or already processed
+  if (slice_impl::TrySliceFlipNormalizeHWC(output, input, in_strides, out_strides, anchor,
+                                           in_shape, out_shape, fill_values, mean, inv_stddev,
+                                           channel_dim))
+    return;
   bool need_pad = NeedPad(Dims, anchor.data(), in_shape.data(), out_shape.data());
   bool has_channels = channel_dim >= 0;
   bool need_normalize = (mean != nullptr && inv_stddev != nullptr);
@@ -14,12 +14,15 @@
 
 #include <gtest/gtest.h>
 #include <opencv2/imgcodecs.hpp>
+#include <random>
+#include <vector>
 #include "dali/kernels/test/test_data.h"
 #include "dali/test/tensor_test_utils.h"
 #include "dali/kernels/imgproc/resample/resampling_filters.cuh"
 #include "dali/kernels/imgproc/resample/resampling_impl_cpu.h"
 #include "dali/test/mat2tensor.h"
 #include "dali/core/tensor_shape_print.h"
+#include "dali/kernels/common/cpu_dispatch.h"
 
 namespace dali {
 namespace kernels {
@@ -156,6 +159,52 @@ TEST(ResampleCPU, Vertical) {
   Check(out_tensor, ref_tensor, EqualEps(1));
 }
 
+template <typename Out, typename In>
+void TestVerticalIsa(simd::CpuIsa isa) {
+  simd::ScopedCpuIsa scoped_isa(isa);
+  const int in_h = 23, out_h = 10, w = 37, channels = 3;
+  std::mt19937_64 rng(1234);
+  std::uniform_real_distribution<float> dist(0, 100);
+  std::vector<In> in(in_h * w * channels);
+  for (auto &x : in)
+    x = ConvertSat<In>(dist(rng));
+
+  auto filter = GetResamplingFiltersCPU()->Gaussian(3.0f);
+  int support = filter.support();
+  std::vector<float> coeffs(out_h * support);
+  std::vector<int> idx(out_h);
+  InitializeResamplingFilter(idx.data(), coeffs.data(), out_h, 0,
+                             static_cast<float>(in_h) / out_h, filter);
+
+  std::vector<Out> out(out_h * w * channels);
+  Surface2D<const In> in_surf = {in.data(), w, in_h, channels, channels, w * channels, 1};
+  Surface2D<Out> out_surf = {out.data(), w, out_h, channels, channels, w * channels, 1};
+  ResampleVert(out_surf, in_surf, idx.data(), coeffs.data(), support);
+
+  double eps = std::is_integral<Out>::value ? 1 : 1e-3;
+  for (int y = 0; y < out_h; y++) {
+    for (int x = 0; x < w * channels; x++) {
+      double ref = 0;
+      for (int k = 0; k < support; k++) {
+        int sy = std::min(std::max(idx[y] + k, 0), in_h - 1);
+        ref += static_cast<double>(in[sy * w * channels + x]) * coeffs[y * support + k];
+      }
+      ASSERT_NEAR(out[y * w * channels + x], ConvertSat<Out>(ref), eps)
+          << "at y = " << y << " x = " << x << ", isa = " << simd::CpuIsaName(isa);
+    }
+  }
+}
+
+TEST(ResampleCPU, VerticalAllIsas) {
+  for (auto isa : simd::SupportedCpuIsas()) {
+    TestVerticalIsa<uint8_t, uint8_t>(isa);
+    TestVerticalIsa<float, uint8_t>(isa);
+    TestVerticalIsa<int16_t, int16_t>(isa);
+    TestVerticalIsa<uint16_t, float>(isa);
+    TestVerticalIsa<float, float>(isa);
+  }
+}
+
 TEST(ResampleCPU, NN) {
   auto img = testing::data::image("imgproc/blobs.png");
   auto ref = testing::data::image("imgproc/dots.png");
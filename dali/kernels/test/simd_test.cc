@@ -1,4 +1,4 @@
-// Copyright (c) 2020, NVIDIA CORPORATION. All rights reserved.
+// Copyright (c) 2020-2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
 //
 // Licensed under the Apache License, Version 2.0 (the "License");
 // you may not use this file except in compliance with the License.
@@ -129,6 +129,54 @@ TEST(SSE2Test, ConvertLoad) {
 
 #endif  // __SSE2__
 
+#if DALI_X86_DISPATCH
+
+template <typename In>
+DALI_TARGET_AVX2 void TestConvertLoadAVX2(In lo, In hi) {
+  In in[8];  // NOLINT
+  for (int64_t i = 0; i < 8; i++)
+    in[i] = lo + (hi - lo) * i / 7;
+  float out[8];  // NOLINT
+  _mm256_storeu_ps(out, avx2::load8_f(in));
+  for (int i = 0; i < 8; i++)
+    EXPECT_EQ(out[i], static_cast<float>(in[i]));
+}
+
+template <typename Out>
+DALI_TARGET_AVX2 void TestConvertStoreAVX2(float lo, float hi) {
+  constexpr int nvec = sizeof(Out) == 1 ? 2 : 1;
+  float in[8 * nvec];  // NOLINT
+  for (int i = 0; i < 8 * nvec; i++)
+    in[i] = lo + (hi - lo) * i / (8 * nvec - 1);
+  __m256 v[nvec];  // NOLINT
+  for (int i = 0; i < nvec; i++)
+    v[i] = _mm256_loadu_ps(in + 8 * i);
+  Out out[8 * nvec];  // NOLINT
+  avx2::store(out, v);
+  for (int i = 0; i < 8 * nvec; i++)
+    EXPECT_EQ(out[i], ConvertSat<Out>(in[i]));
+}
+
+TEST(AVX2Test, ConvertLoadStore) {
+  if (!CpuIsaSupported(CpuIsa::AVX2))
+    GTEST_SKIP() << "AVX2 is not supported by this CPU";
+  TestConvertLoadAVX2<int8_t>(-128, 127);
+  TestConvertLoadAVX2<uint8_t>(0, 255);
+  TestConvertLoadAVX2<int16_t>(-32768, 32767);
+  TestConvertLoadAVX2<uint16_t>(0, 65535);
+  TestConvertLoadAVX2<int32_t>(-1000000, 1000000);
+  TestConvertLoadAVX2<float>(-1.5f, 2.5f);
+
+  TestConvertStoreAVX2<int8_t>(-200, 200);
+  TestConvertStoreAVX2<uint8_t>(-100, 300);
+  TestConvertStoreAVX2<int16_t>(-40000, 40000);
+  TestConvertStoreAVX2<uint16_t>(-1000, 70000);
+  TestConvertStoreAVX2<int32_t>(-1e6, 1e6);
+  TestConvertStoreAVX2<float>(-1.5f, 2.5f);
+}
+
+#endif  // DALI_X86_DISPATCH
+
 }  // namespace test
 }  // namespace simd
 }  // namespace kernels
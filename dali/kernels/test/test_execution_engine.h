@@ -0,0 +1,60 @@
+// Copyright (c) 2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef DALI_KERNELS_TEST_TEST_EXECUTION_ENGINE_H_
+#define DALI_KERNELS_TEST_TEST_EXECUTION_ENGINE_H_
+
+#include <cstdint>
+#include <functional>
+#include <utility>
+#include <vector>
+
+namespace dali {
+namespace testing {
+
+/**
+ * @brief An execution engine which collects the work and runs it in reverse order.
+ *
+ * Used in place of SequentialExecutionEngine or a thread pool to check that the blocks
+ * scheduled by a kernel are independent. It reports `num_threads` threads, but runs all
+ * the work in the calling thread.
+ */
+struct ReverseExecutionEngine {
+  explicit ReverseExecutionEngine(int num_threads = 4) : num_threads_(num_threads) {}
+
+  template <typename Work>
+  void AddWork(Work &&work, int64_t priority = 0, bool start_immediately = false) {
+    work_.emplace_back(std::forward<Work>(work));
+  }
+
+  void RunAll() {
+    for (auto it = work_.rbegin(); it != work_.rend(); ++it)
+      (*it)(0);
+    num_blocks_ += work_.size();
+    work_.clear();
+  }
+
+  int NumThreads() const noexcept {
+    return num_threads_;
+  }
+
+  std::vector<std::function<void(int)>> work_;
+  int num_threads_ = 4;
+  int num_blocks_ = 0;
+};
+
+}  // namespace testing
+}  // namespace dali
+
+#endif  // DALI_KERNELS_TEST_TEST_EXECUTION_ENGINE_H_
@@ -1,4 +1,4 @@
-// Copyright (c) 2019-2021, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+// Copyright (c) 2019-2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
 //
 // Licensed under the Apache License, Version 2.0 (the "License");
 // you may not use this file except in compliance with the License.
@@ -15,6 +15,7 @@
 #include <gtest/gtest.h>
 #include <opencv2/imgcodecs.hpp>
 #include <opencv2/imgproc.hpp>
+#include <random>
 #include <string>
 #include <vector>
 #include "dali/kernels/imgproc/warp_cpu.h"
@@ -27,10 +28,13 @@
 #include "dali/core/geom/transform.h"
 #include "dali/kernels/test/warp_test/warp_test_helper.h"
 #include "dali/kernels/dynamic_scratchpad.h"
+#include "dali/kernels/test/test_execution_engine.h"
 
 namespace dali {
 namespace kernels {
 
+using dali::testing::ReverseExecutionEngine;
+
 TEST(WarpCPU, check_kernel) {
   check_kernel<WarpCPU<AffineMapping2D, 2, float, uint8_t, float>>();
   SUCCEED();
@@ -145,5 +149,84 @@ TEST(WarpCPU, Affine_RotateScale) {
   }
 }
 
+namespace {
+
+/**
+ * @brief Compares the (scheduled) affine warp with a naive, per-pixel use of the sampler.
+ */
+template <DALIInterpType interp, typename Out, typename In, typename Border>
+void TestAffineVsSampler(const AffineMapping2D &mapping, int channels, Border border,
+                         double eps = 0) {
+  TestTensorList<In, 3> in;
+  TestTensorList<Out, 3> out, ref;
+  TensorShape<3> in_shape = { 151, 237, channels };
+  TensorShape<2> out_size = { 173, 219 };
+  TensorShape<3> out_shape = shape_cat(out_size, channels);
+  in.reshape(uniform_list_shape<3>(1, in_shape));
+  out.reshape(uniform_list_shape<3>(1, out_shape));
+  ref.reshape(uniform_list_shape<3>(1, out_shape));
+  std::mt19937_64 rng(1234);
+  UniformRandomFill(in.cpu()[0], rng, 0, 255);
+  auto in_tv = in.cpu()[0];
+  auto out_tv = out.cpu()[0];
+  auto ref_tv = ref.cpu()[0];
+
+  Sampler2D<interp, In> sampler(as_surface_channel_last(in_tv));
+  for (int y = 0; y < out_size[0]; y++)
+    for (int x = 0; x < out_size[1]; x++)
+      sampler(ref_tv(y, x), warp::map_coords(mapping, ivec2(x, y)), border);
+
+  WarpCPU<AffineMapping2D, 2, Out, In, Border> warp;
+  KernelContext ctx = {};
+  warp.Setup(ctx, in_tv, mapping, out_size, interp, border);
+  ReverseExecutionEngine engine;
+  warp.Schedule(ctx, out_tv, in_tv, mapping, out_size, interp, border, engine, 5);
+  engine.RunAll();
+  EXPECT_GT(engine.num_blocks_, 1);
+  Check(out_tv, ref_tv, EqualEps(eps));
+
+  // single-threaded
+  memset(out_tv.data, 0, out_tv.num_elements() * sizeof(Out));
+  warp.Run(ctx, out_tv, in_tv, mapping, out_size, interp, border);
+  Check(out_tv, ref_tv, EqualEps(eps));
+}
+
+// The coefficients are exactly representable and so are the source coordinates,
+// so the results are bit-exact, regardless of the order of operations.
+const AffineMapping2D kExactMapping = mat2x3{{
+  { 0.75f, -0.125f, -12.25f },
+  { 0.25f,  0.625f,  20.5f }
+}};
+
+}  // namespace
+
+TEST(WarpCPU, Affine_Schedule_NN) {
+  for (int channels : { 1, 2, 3, 4, 5 }) {
+    TestAffineVsSampler<DALI_INTERP_NN, uint8_t, uint8_t>(kExactMapping, channels, uint8_t(42));
+    TestAffineVsSampler<DALI_INTERP_NN, float, uint8_t>(kExactMapping, channels, BorderClamp());
+    TestAffineVsSampler<DALI_INTERP_NN, float, float>(kExactMapping, channels, 7.0f);
+  }
+}
+
+TEST(WarpCPU, Affine_Schedule_Linear) {
+  for (int channels : { 1, 2, 3, 4, 5 }) {
+    TestAffineVsSampler<DALI_INTERP_LINEAR, uint8_t, uint8_t>(kExactMapping, channels,
+                                                              uint8_t(42));
+    TestAffineVsSampler<DALI_INTERP_LINEAR, float, uint8_t>(kExactMapping, channels,
+                                                            BorderClamp());
+    TestAffineVsSampler<DALI_INTERP_LINEAR, float, float>(kExactMapping, channels, 7.0f);
+  }
+}
+
+TEST(WarpCPU, Affine_Schedule_Rotate) {
+  // The source coordinates are calculated in a different order than in the naive approach,
+  // so the interpolation weights may differ slightly.
+  auto tr = translation(vec2(118, 75)) * rotation2D(0.3f) * scaling(vec2(1.1f, 1.1f)) *
+            translation(vec2(-109, -86));
+  AffineMapping2D mapping = sub<2, 3>(tr, 0, 0);
+  TestAffineVsSampler<DALI_INTERP_LINEAR, uint8_t, uint8_t>(mapping, 3, uint8_t(0), 1);
+  TestAffineVsSampler<DALI_INTERP_LINEAR, float, float>(mapping, 3, 0.0f, 0.05);
+}
+
 }  // namespace kernels
 }  // namespace dali
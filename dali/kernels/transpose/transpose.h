@@ -1,4 +1,4 @@
-// Copyright (c) 2020, NVIDIA CORPORATION. All rights reserved.
+// Copyright (c) 2020-2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
 //
 // Licensed under the Apache License, Version 2.0 (the "License");
 // you may not use this file except in compliance with the License.
@@ -163,6 +163,48 @@ void TransposeGrouped(const TensorView<StorageCPU, T> &dst,
             make_cspan(collapsed_perm));
 }
 
+/**
+ * @brief Transpose the part of `src` that goes to the range [begin, end) of the outermost
+ *        dimension of `dst`
+ *
+ * The ranges are independent, so this can be used to split the transposition of a large
+ * tensor into several jobs. `dst` and `src` describe the whole tensors.
+ *
+ * Source dimension `perm[i]` goes to destination dimension `i`.
+ */
+template <typename T>
+void TransposeGrouped(const TensorView<StorageCPU, T> &dst,
+                      const TensorView<StorageCPU, const T> &src, span<const int> perm,
+                      int64_t begin, int64_t end) {
+  if (dst.shape.sample_dim() == 0 || (begin == 0 && end == dst.shape[0])) {
+    TransposeGrouped(dst, src, perm);
+    return;
+  }
+  if (begin >= end || volume(dst.shape) == 0)
+    return;
+  TensorShape<> collapsed_src_shape;
+  SmallVector<int, DynamicTensorShapeContainer::static_size> collapsed_perm;
+  transpose_impl::SimplifyPermute(collapsed_src_shape, collapsed_perm, src.shape, perm);
+  auto collapsed_dst_shape = permute(collapsed_src_shape, collapsed_perm);
+  // the outermost destination dimension is the leading part of the outermost collapsed one
+  int64_t group = collapsed_dst_shape[0] / dst.shape[0];
+  assert(group * dst.shape[0] == collapsed_dst_shape[0]);
+  auto dst_strides = GetStrides(collapsed_dst_shape);
+  auto src_strides = GetStrides(collapsed_src_shape);
+  T *dst_data = dst.data + begin * group * dst_strides[0];
+  const T *src_data = src.data + begin * group * src_strides[collapsed_perm[0]];
+  auto size = collapsed_dst_shape;
+  size[0] = (end - begin) * group;
+  int N = size.sample_dim();
+  VALUE_SWITCH(N, static_dims, (1, 2, 3), (
+    transpose_impl::TransposeImplStatic<static_dims, static_dims>(
+        dst_data, src_data, static_dims, make_span(dst_strides), make_span(src_strides), size,
+        make_cspan(collapsed_perm));),
+  (
+    transpose_impl::TransposeImpl(dst_data, src_data, 0, N,
+        make_span(dst_strides), make_span(src_strides), size, make_cspan(collapsed_perm));));
+}
+
 }  // namespace kernels
 }  // namespace dali
 
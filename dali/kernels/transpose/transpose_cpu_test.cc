@@ -0,0 +1,56 @@
+// Copyright (c) 2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <numeric>
+#include <vector>
+#include "dali/core/tensor_shape_print.h"
+#include "dali/kernels/transpose/transpose.h"
+#include "dali/kernels/transpose/transpose_test.h"
+
+namespace dali {
+namespace kernels {
+
+TEST(TransposeCPU, Ranges) {
+  TensorShape<> shapes[] = {
+    { 5, 7, 3, 4 },
+    { 1, 6, 5, 2 },
+    { 8, 1, 1, 3 },
+    { 3, 4, 0, 2 },
+  };
+  for (auto &in_shape : shapes) {
+    int64_t vol = volume(in_shape);
+    std::vector<int> in(vol), ref(vol), out(vol);
+    std::iota(in.begin(), in.end(), 0);
+    for (auto &perm_arr : testing::Permutations4) {
+      span<const int> perm = make_cspan(perm_arr);
+      auto out_shape = permute(in_shape, perm);
+      testing::RefTranspose(ref.data(), in.data(), in_shape.data(), perm.data(), 4);
+      TensorView<StorageCPU, const int> in_view{in.data(), in_shape};
+      TensorView<StorageCPU, int> out_view{out.data(), out_shape};
+      for (int64_t step = 1; step <= out_shape[0]; step++) {
+        std::fill(out.begin(), out.end(), -1);
+        for (int64_t begin = 0; begin < out_shape[0]; begin += step) {
+          int64_t end = std::min(begin + step, out_shape[0]);
+          TransposeGrouped(out_view, in_view, perm, begin, end);
+        }
+        ASSERT_EQ(out, ref) << "shape " << in_shape << ", step " << step;
+      }
+    }
+  }
+}
+
+}  // namespace kernels
+}  // namespace dali
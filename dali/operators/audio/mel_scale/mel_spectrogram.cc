@@ -0,0 +1,276 @@
+// Copyright (c) 2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "dali/operators/audio/mel_scale/mel_spectrogram.h"
+#include <cmath>
+#include <string>
+#include <vector>
+#include "dali/kernels/signal/window/window_functions.h"
+#include "dali/pipeline/data/views.h"
+
+namespace dali {
+
+DALI_SCHEMA(MelSpectrogram)
+  .DocStr(R"(Computes a (log) mel spectrogram or the MFCCs of a 1D signal (for example, audio).
+
+The result is equivalent to applying :meth:`Spectrogram`, :meth:`MelFilterBank`,
+:meth:`ToDecibels` and, if `n_mfcc` is positive, :meth:`MFCC`, but the signal is processed one
+window at a time, without storing the intermediate spectrograms, which is considerably faster.
+
+Input data is expected to be one channel (shape being ``(nsamples,)``, ``(nsamples, 1)``, or
+``(1, nsamples)``) of type float32.)")
+  .NumInput(1)
+  .NumOutput(1)
+  .AddOptionalArg<int>("nfft",
+    R"(Size of the FFT.
+
+If not provided, `window_length` is used.)",
+    nullptr)
+  .AddOptionalArg("window_length",
+    R"(Window size in number of samples.)",
+    512)
+  .AddOptionalArg("window_step",
+    R"(Step between the STFT windows in number of samples.)",
+    256)
+  .AddOptionalArg("window_fn",
+    R"(Samples of the window function that will be multiplied to each extracted window.
+
+If a value is provided, it should be a list of floating point numbers of size `window_length`.
+If a value is not provided, a Hann window will be used.)",
+    std::vector<float>{})
+  .AddOptionalArg("power",
+    R"(Exponent of the magnitude of the spectrum.
+
+Supported values:
+
+- ``1`` - amplitude,
+- ``2`` - power (faster to compute).
+)",
+    2)
+  .AddOptionalArg("center_windows",
+    R"(Indicates whether extracted windows should be padded so that the window function is
+centered at multiples of `window_step`.)",
+    true)
+  .AddOptionalArg("reflect_padding",
+    R"(Indicates whether the signal is mirrored (as opposed to padded with zeros) when sampling
+outside of its bounds.
+
+.. note::
+  When `center_windows` is set to False, this option is ignored.
+)",
+    true)
+  .AddOptionalArg("nfilter",
+    R"(Number of mel filters.)",
+    128)
+  .AddOptionalArg("sample_rate",
+    R"(Sampling rate of the audio signal.)",
+    44100.0f)
+  .AddOptionalArg("freq_low",
+    R"(The minimum frequency.)",
+    0.0f)
+  .AddOptionalArg("freq_high",
+    R"(The maximum frequency.
+
+If this value is not provided, ``sample_rate/2`` is used.)",
+    0.0f)
+  .AddOptionalArg("normalize",
+    R"(Determines whether to normalize the triangular filter weights by the width
+of their frequency bands.
+
+See :meth:`MelFilterBank` for details.)",
+    true)
+  .AddOptionalArg("mel_formula",
+    R"(Determines the formula that will be used to convert frequencies from hertz to mel
+and from mel to hertz: ``slaney`` or ``htk``.
+
+See :meth:`MelFilterBank` for details.)",
+    "slaney")
+  .AddOptionalArg("to_decibels",
+    R"(If set to True, the mel spectrogram is converted to decibels, as in :meth:`ToDecibels`.)",
+    true)
+  .AddOptionalArg("multiplier",
+    R"(Factor by which the logarithm is multiplied, when converting to decibels.)",
+    10.0f)
+  .AddOptionalArg("reference",
+    R"(Reference magnitude, when converting to decibels.
+
+If a value is not provided, the maximum of the mel spectrogram of each sample will be used.)",
+    0.0f)
+  .AddOptionalArg("cutoff_db",
+    R"(Minimum or cut-off ratio in dB. Any value below this value will saturate.)",
+    -200.0f)
+  .AddOptionalArg("n_mfcc",
+    R"(Number of MFCC coefficients.
+
+If set to 0, no DCT is applied and the output is the (log) mel spectrogram.)",
+    0)
+  .AddOptionalArg("dct_type",
+    R"(Discrete Cosine Transform type used to compute the MFCCs: 1, 2, 3 or 4.)",
+    2)
+  .AddOptionalArg("dct_normalize",
+    R"(If set to True, the DCT uses an ortho-normal basis.
+
+.. note::
+  Normalization is not supported when dct_type=1.)",
+    false)
+  .AddOptionalArg("lifter",
+    R"(Cepstral filtering coefficient, which is also known as the liftering coefficient.
+
+See :meth:`MFCC` for details.)",
+    0.0f)
+  .AddOptionalArg("layout", R"(Output layout: "ft" (feature-major) or "tf" (time-major).)",
+    TensorLayout("ft"));
+
+template <>
+MelSpectrogram<CPUBackend>::MelSpectrogram(const OpSpec &spec)
+    : StatelessOperator<CPUBackend>(spec) {
+  auto &wargs = args_.window;
+  wargs.window_length = spec.GetArgument<int>("window_length");
+  wargs.window_step = spec.GetArgument<int>("window_step");
+  DALI_ENFORCE(wargs.window_length > 0,
+               make_string("Invalid window length: ", wargs.window_length));
+  DALI_ENFORCE(wargs.window_step > 0, make_string("Invalid window step: ", wargs.window_step));
+  wargs.axis = 0;
+  if (spec.GetArgument<bool>("center_windows")) {
+    wargs.window_center = wargs.window_length / 2;
+    wargs.padding = spec.GetArgument<bool>("reflect_padding") ? kernels::signal::Padding::Reflect
+                                                              : kernels::signal::Padding::Zero;
+  } else {
+    wargs.window_center = 0;
+    wargs.padding = kernels::signal::Padding::None;
+  }
+  args_.nfft = spec.HasArgument("nfft") ? spec.GetArgument<int>("nfft") : wargs.window_length;
+  args_.power = spec.GetArgument<int>("power");
+
+  window_fn_ = spec.GetRepeatedArgument<float>("window_fn");
+  if (window_fn_.empty()) {
+    window_fn_.resize(wargs.window_length);
+    kernels::signal::HannWindow(make_span(window_fn_));
+  }
+  DALI_ENFORCE(window_fn_.size() == static_cast<size_t>(wargs.window_length),
+    "Window function should match the specified `window_length`");
+
+  auto &mel = args_.mel;
+  mel.nfilter = spec.GetArgument<int>("nfilter");
+  DALI_ENFORCE(mel.nfilter > 0, "number of filters should be > 0");
+  mel.sample_rate = spec.GetArgument<float>("sample_rate");
+  DALI_ENFORCE(mel.sample_rate > 0.0f, "sample rate should be > 0");
+  mel.freq_low = spec.GetArgument<float>("freq_low");
+  DALI_ENFORCE(mel.freq_low >= 0.0f, "freq_low should be >= 0");
+  mel.freq_high = spec.GetArgument<float>("freq_high");
+  if (mel.freq_high <= 0.0f)
+    mel.freq_high = 0.5f * mel.sample_rate;
+  DALI_ENFORCE(mel.freq_high > mel.freq_low && mel.freq_high <= 0.5f * mel.sample_rate,
+    "freq_high should be within the range (freq_low, sample_rate/2]");
+  auto mel_formula = spec.GetArgument<std::string>("mel_formula");
+  if (mel_formula == "htk") {
+    mel.mel_formula = kernels::audio::MelScaleFormula::HTK;
+  } else if (mel_formula == "slaney") {
+    mel.mel_formula = kernels::audio::MelScaleFormula::Slaney;
+  } else {
+    DALI_FAIL(make_string("Unsupported mel_formula value \"", mel_formula,
+      "\". Supported values are: \"slaney\", \"htk\""));
+  }
+  mel.normalize = spec.GetArgument<bool>("normalize");
+
+  args_.to_db = spec.GetArgument<bool>("to_decibels");
+  auto &db = args_.db;
+  db.multiplier = spec.GetArgument<float>("multiplier");
+  db.ref_max = !spec.HasArgument("reference");
+  if (!db.ref_max) {
+    db.s_ref = spec.GetArgument<float>("reference");
+    DALI_ENFORCE(db.s_ref != 0, "`reference` argument can't be zero");
+  }
+  db.min_ratio = std::pow(10.0f, spec.GetArgument<float>("cutoff_db") / db.multiplier);
+  if (db.min_ratio == 0)
+    db.min_ratio = std::nextafter(0.0f, 1.0f);
+
+  int n_mfcc = spec.GetArgument<int>("n_mfcc");
+  DALI_ENFORCE(n_mfcc >= 0, "number of MFCCs should be >= 0");
+  args_.dct = n_mfcc > 0;
+  if (args_.dct) {
+    DALI_ENFORCE(n_mfcc <= mel.nfilter, make_string(
+      "The number of MFCCs (", n_mfcc, ") can't exceed the number of mel filters (",
+      mel.nfilter, ")"));
+    args_.dct_args.ndct = n_mfcc;
+    args_.dct_args.dct_type = spec.GetArgument<int>("dct_type");
+    args_.dct_args.normalize = spec.GetArgument<bool>("dct_normalize");
+    args_.lifter = spec.GetArgument<float>("lifter");
+  }
+
+  layout_ = spec.GetArgument<TensorLayout>("layout");
+  DALI_ENFORCE(layout_ == "tf" || layout_ == "ft", make_string("Unexpected layout: ", layout_));
+  args_.time_major = layout_ == "tf";
+}
+
+template <>
+bool MelSpectrogram<CPUBackend>::SetupImpl(std::vector<OutputDesc> &output_desc,
+                                           const Workspace &ws) {
+  using Kernel = kernels::audio::MelSpectrogramCpu;
+  const auto &input = ws.Input<CPUBackend>(0);
+  DALI_ENFORCE(input.type() == DALI_FLOAT,
+               make_string("Unsupported data type: ", input.type()));
+  auto in_shape = input.shape();
+  int nsamples = input.num_samples();
+  int nthreads = ws.GetThreadPool().NumThreads();
+
+  // Check that input is 1-D (allowing having extra dims with extent 1)
+  for (int i = 0; i < nsamples; i++) {
+    auto shape = in_shape.tensor_shape_span(i);
+    auto n = volume(shape);
+    for (auto extent : shape) {
+      DALI_ENFORCE(extent == 1 || extent == n, make_string("Input data must be 1D or all "
+        "but one dimensions must be degenerate (extent 1). Got: ", in_shape[i]));
+    }
+  }
+
+  kmgr_.Resize<Kernel>(nthreads);
+  output_desc.resize(1);
+  output_desc[0].type = DALI_FLOAT;
+  output_desc[0].shape.resize(nsamples, 2);
+  kernels::KernelContext ctx;
+  auto window_fn = make_tensor_cpu<1>(window_fn_.data(), args_.window.window_length);
+  for (int i = 0; i < nsamples; i++) {
+    auto signal = make_tensor_cpu<1>(input.tensor<float>(i), {in_shape.tensor_size(i)});
+    auto &req = kmgr_.Setup<Kernel>(0, ctx, signal, window_fn, args_);
+    output_desc[0].shape.set_tensor_shape(i, req.output_shapes[0][0]);
+  }
+  return true;
+}
+
+template <>
+void MelSpectrogram<CPUBackend>::RunImpl(Workspace &ws) {
+  using Kernel = kernels::audio::MelSpectrogramCpu;
+  const auto &input = ws.Input<CPUBackend>(0);
+  auto &output = ws.Output<CPUBackend>(0);
+  auto &tp = ws.GetThreadPool();
+  output.SetLayout(layout_);
+  auto window_fn = make_tensor_cpu<1>(window_fn_.data(), args_.window.window_length);
+
+  for (int i = 0; i < input.num_samples(); i++) {
+    int64_t length = input.shape().tensor_size(i);
+    tp.AddWork([&, i, length](int thread_id) {
+      kernels::KernelContext ctx;
+      auto signal = make_tensor_cpu<1>(input.tensor<float>(i), {length});
+      // builds the per-thread state (FFT plan, filter bank) when needed
+      kmgr_.Setup<Kernel>(thread_id, ctx, signal, window_fn, args_);
+      kmgr_.Run<Kernel>(thread_id, ctx, view<float, 2>(output[i]), signal, window_fn);
+    }, length);
+  }
+  tp.RunAll();
+}
+
+DALI_REGISTER_OPERATOR(MelSpectrogram, MelSpectrogram<CPUBackend>, CPU);
+
+}  // namespace dali
@@ -0,0 +1,56 @@
+// Copyright (c) 2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef DALI_OPERATORS_AUDIO_MEL_SCALE_MEL_SPECTROGRAM_H_
+#define DALI_OPERATORS_AUDIO_MEL_SCALE_MEL_SPECTROGRAM_H_
+
+#include <vector>
+#include "dali/core/common.h"
+#include "dali/kernels/kernel_manager.h"
+#include "dali/kernels/audio/mel_scale/mel_spectrogram_cpu.h"
+#include "dali/pipeline/operator/common.h"
+#include "dali/pipeline/operator/checkpointing/stateless_operator.h"
+#include "dali/pipeline/operator/operator.h"
+
+namespace dali {
+
+/**
+ * @brief Computes log-mel spectrograms (or MFCCs) of audio signals in a single, fused pass.
+ *
+ * Equivalent to Spectrogram -> MelFilterBank -> ToDecibels (-> MFCC), without materializing
+ * the intermediate spectrograms.
+ */
+template <typename Backend>
+class MelSpectrogram : public StatelessOperator<Backend> {
+ public:
+  explicit MelSpectrogram(const OpSpec &spec);
+
+ protected:
+  bool SetupImpl(std::vector<OutputDesc> &output_desc, const Workspace &ws) override;
+  void RunImpl(Workspace &ws) override;
+
+  USE_OPERATOR_MEMBERS();
+  using Operator<Backend>::RunImpl;
+
+ private:
+  // one kernel instance per thread - the instances hold the FFT plan and the filter bank
+  kernels::KernelManager kmgr_;
+  kernels::audio::MelSpectrogramArgs args_;
+  std::vector<float> window_fn_;
+  TensorLayout layout_;
+};
+
+}  // namespace dali
+
+#endif  // DALI_OPERATORS_AUDIO_MEL_SCALE_MEL_SPECTROGRAM_H_
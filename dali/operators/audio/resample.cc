@@ -1,4 +1,4 @@
-// Copyright (c) 2022-2024, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+// Copyright (c) 2022-2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
 //
 // Licensed under the Apache License, Version 2.0 (the "License");
 // you may not use this file except in compliance with the License.
@@ -19,6 +19,7 @@
 #include "dali/kernels/kernel_params.h"
 #include "dali/kernels/signal/resampling_cpu.h"
 #include "dali/operators/audio/resampling_params.h"
+#include "dali/pipeline/util/cost_scheduler.h"
 
 namespace dali {
 
@@ -135,26 +136,63 @@ class ResampleCPU : public ResampleBase<CPUBackend> {
 
     auto &tp = ws.GetThreadPool();
     in_fp32.resize(tp.NumThreads());
+    split_in_fp32_.resize(N);
+    split_in_views_.resize(N);
+    split_samples_.clear();
+    int64_t total_cost = out_shape.num_elements();
     for (int s = 0; s < N; s++) {
-      tp.AddWork([&, this, s](int thread_idx) {
+      int64_t cost = out_shape[s].num_elements();
+      // Signals which are long compared to the rest of the batch are only converted here
+      // and resampled in chunks afterwards, so they don't become stragglers.
+      bool split = out_shape[s][0] >= 2 * kMinResampleChunk &&
+                   CostScheduler::NumChunks(cost, total_cost, tp.NumThreads()) > 1;
+      if (split)
+        split_samples_.push_back(s);
+      tp.AddWork([&, this, s, split](int thread_idx) {
+        auto &tmp = split ? split_in_fp32_[s] : in_fp32[thread_idx];
         InTensorCPU<float> in_view;
         TYPE_SWITCH(in.type(), type2id, T, (AUDIO_RESAMPLE_TYPES),
-          (in_view = ConvertInput(in_fp32[thread_idx], view<const T>(in[s]));),
+          (in_view = ConvertInput(tmp, view<const T>(in[s]));),
           (DALI_FAIL(
               make_string("Unsupported output type: ", dtype_,
                           "\nSupported types are : ", ListTypeNames<AUDIO_RESAMPLE_TYPES>()));));
+        if (split) {
+          split_in_views_[s] = in_view;
+          return;
+        }
         TYPE_SWITCH(dtype_, type2id, T, (AUDIO_RESAMPLE_TYPES),
           (ResampleTyped<T>(view<T>(out[s]), in_view, args_[s]);),
           (assert(!"Unreachable code.")));
-      });
+      }, cost);
     }
     tp.RunAll();
+
+    if (split_samples_.empty())
+      return;
+
+    CostScheduler sched(tp);
+    for (int s : split_samples_) {
+      sched.AddWork(out_shape[s].num_elements(), out_shape[s][0],
+        [&, this, s](int, int64_t begin, int64_t end) {
+          TYPE_SWITCH(dtype_, type2id, T, (AUDIO_RESAMPLE_TYPES),
+            (ResampleTyped<T>(view<T>(out[s]), split_in_views_[s], args_[s], begin, end);),
+            (assert(!"Unreachable code.")));
+        }, kMinResampleChunk);
+    }
+    sched.Run();
   }
 
+  /**
+   * @brief Calculates the range [begin, end) of the output; end < 0 means the whole signal.
+   */
   template <typename T>
-  void ResampleTyped(const OutTensorCPU<T> &out, const InTensorCPU<float> &in, const Args& args) {
+  void ResampleTyped(const OutTensorCPU<T> &out, const InTensorCPU<float> &in, const Args& args,
+                     int64_t begin = 0, int64_t end = -1) {
     int ch = out.shape.sample_dim() > 1 ? out.shape[1] : 1;
-    R.Resample(out.data, 0, out.shape[0], args.out_rate, in.data, in.shape[0], args.in_rate, ch);
+    if (end < 0)
+      end = out.shape[0];
+    R.Resample(out.data + begin * ch, begin, end, args.out_rate, in.data, in.shape[0],
+               args.in_rate, ch);
   }
 
   template <typename T>
@@ -191,8 +229,14 @@ class ResampleCPU : public ResampleBase<CPUBackend> {
   }
 
  private:
+  /** The minimum number of output samples resampled by one task, when resampling in chunks */
+  static constexpr int64_t kMinResampleChunk = 1 << 14;
+
   kernels::signal::resampling::ResamplerCPU R;
   std::vector<std::vector<float>> in_fp32;
+  std::vector<int> split_samples_;
+  std::vector<std::vector<float>> split_in_fp32_;
+  std::vector<InTensorCPU<float>> split_in_views_;
 };
 
 
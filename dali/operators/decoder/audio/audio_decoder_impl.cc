@@ -1,4 +1,4 @@
-// Copyright (c) 2020-2022, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+// Copyright (c) 2020-2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
 //
 // Licensed under the Apache License, Version 2.0 (the "License");
 // you may not use this file except in compliance with the License.
@@ -50,7 +50,6 @@ template <typename T>
 void DecodeAudio(TensorView<StorageCPU, T, DynamicDimensions> audio, AudioDecoderBase &decoder,
                  const AudioMetadata &meta, kernels::signal::resampling::ResamplerCPU &resampler,
                  span<float> decode_scratch_mem,
-                 span<float> resample_scratch_mem,
                  float target_sample_rate, bool downmix,
                  const char *audio_filepath) {  // audio_filepath for debug purposes
   assert(meta.sample_rate > 0 && "Invalid sampling rate");
@@ -78,24 +77,13 @@ void DecodeAudio(TensorView<StorageCPU, T, DynamicDimensions> audio, AudioDecode
   assert(decode_scratch_mem.size() <= meta.length * meta.channels &&
          "Requested to decode more data than available.");
   int64_t decoded_audio_len = decode_scratch_mem.size() / meta.channels;
-  if (should_resample && should_downmix) {
-    // When downmixing, we need an extra buffer for the input of resampling
-    assert(resample_scratch_mem.size() == decoded_audio_len &&
-           "Downmixing and resampling is required but resampler scratch is either empty or doesn't "
-           "have the expected size");
-  }
 
   int64_t ret = decoder.DecodeFrames(decode_scratch_mem.data(), decoded_audio_len);
   DALI_ENFORCE(ret == decoded_audio_len, make_string("Error decoding audio file ", audio_filepath));
 
-  if (should_resample && should_downmix) {
-    kernels::signal::Downmix(resample_scratch_mem.data(), decode_scratch_mem.data(),
-                             decoded_audio_len, meta.channels);
-    resampler.Resample(audio.data, 0, audio.shape[0], target_sample_rate,
-                       resample_scratch_mem.data(), decoded_audio_len, meta.sample_rate, 1);
-  } else if (should_resample) {  // No downmix
+  if (should_resample) {  // the resampler downmixes on the fly, if needed
     resampler.Resample(audio.data, 0, audio.shape[0], target_sample_rate, decode_scratch_mem.data(),
-                       decoded_audio_len, meta.sample_rate, meta.channels);
+                       decoded_audio_len, meta.sample_rate, meta.channels, should_downmix);
   } else if (should_downmix) {  // downmix only
     kernels::signal::Downmix(audio.data, decode_scratch_mem.data(), decoded_audio_len,
                              meta.channels);
@@ -108,8 +96,8 @@ void DecodeAudio(TensorView<StorageCPU, T, DynamicDimensions> audio, AudioDecode
   template void DecodeAudio<OutType>(                                                             \
       TensorView<StorageCPU, OutType, DynamicDimensions> audio, AudioDecoderBase & decoder,       \
       const AudioMetadata &meta, kernels::signal::resampling::ResamplerCPU &resampler,            \
-      span<float> decode_scratch_mem, span<float> resample_scratch_mem,                           \
-      float target_sample_rate, bool downmix, const char *audio_filepath);
+      span<float> decode_scratch_mem, float target_sample_rate, bool downmix,                     \
+      const char *audio_filepath);
 
 DECLARE_IMPL(float);
 DECLARE_IMPL(int16_t);
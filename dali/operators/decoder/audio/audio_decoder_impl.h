@@ -1,4 +1,4 @@
-// Copyright (c) 2020-2022, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+// Copyright (c) 2020-2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
 //
 // Licensed under the Apache License, Version 2.0 (the "License");
 // you may not use this file except in compliance with the License.
@@ -56,10 +56,6 @@ DLL_PUBLIC TensorShape<> DecodedAudioShape(const AudioMetadata &meta, float targ
  * @param decode_scratch_mem Scratch memory used for decoding, when decoding can't be done directly to the output buffer.
  *                           If downmixing or resampling is required, this buffer should have a positive length, representing
  *                           decoded audio length at the original sampling rate: ``length * nchannels``
- * @param resample_scratch_mem Scratch memory used for the input of resampling.
- *                             If resampling is required, the buffer should have a positive length, representing the
- *                             decoded audio length, ``length`` if downmixing is enabled, or the decoded audio length including
- *                             channels, ``length * nchannels``, otherwise.
  * @param target_sample_rate If a positive value is provided, the signal will be resampled except when its original sampling rate
  *                           is equal to the target.
  * @param downmix If true, the audio channes will be downmixed to a single one
@@ -69,8 +65,8 @@ template <typename T>
 DLL_PUBLIC void DecodeAudio(TensorView<StorageCPU, T, DynamicDimensions> audio,
                             AudioDecoderBase &decoder, const AudioMetadata &meta,
                             kernels::signal::resampling::ResamplerCPU &resampler,
-                            span<float> decode_scratch_mem, span<float> resample_scratch_mem,
-                            float target_sample_rate, bool downmix, const char *audio_filepath);
+                            span<float> decode_scratch_mem, float target_sample_rate,
+                            bool downmix, const char *audio_filepath);
 
 }  // namespace dali
 
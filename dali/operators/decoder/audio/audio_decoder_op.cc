@@ -1,4 +1,4 @@
-// Copyright (c) 2019-2022, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+// Copyright (c) 2019-2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
 //
 // Licensed under the Apache License, Version 2.0 (the "License");
 // you may not use this file except in compliance with the License.
@@ -16,6 +16,7 @@
 #include "dali/operators/decoder/audio/audio_decoder_impl.h"
 #include "dali/pipeline/operator/op_schema.h"
 #include "dali/pipeline/data/views.h"
+#include "dali/pipeline/util/cost_scheduler.h"
 
 namespace dali {
 
@@ -112,28 +113,17 @@ AudioDecoderCpu::DecodeSample(const TensorView<StorageCPU, OutputType, DynamicDi
   bool should_resample = target_sr != meta.sample_rate;
   bool should_downmix = meta.channels > 1 && downmix_;
   int64_t decode_scratch_sz = 0;
-  int64_t resample_scratch_sz = 0;
   if (should_resample || should_downmix)
     decode_scratch_sz = meta.length * meta.channels;
 
-  // resample scratch is used to prepare a single or multiple (depending if
-  // downmixing is needed) channel float input, required by the resampling
-  // kernel
-  if (should_resample)
-    resample_scratch_sz = should_downmix ? meta.length : meta.length * meta.channels;
-
   auto &scratch_decoder = scratch_decoder_[thread_idx];
   scratch_decoder.resize(decode_scratch_sz);
 
-  auto &scratch_resampler = scratch_resampler_[thread_idx];
-  scratch_resampler.resize(resample_scratch_sz);
-
   // TODO(janton): handle offset and duration
 
   DecodeAudio<OutputType>(
     audio, *decoders_[sample_idx], meta, resampler_,
     {scratch_decoder.data(), decode_scratch_sz},
-    {scratch_resampler.data(), resample_scratch_sz},
     target_sr, downmix_,
     files_names_[sample_idx].c_str());
 }
@@ -146,22 +136,65 @@ void AudioDecoderCpu::DecodeBatch(Workspace &ws) {
   auto &tp = ws.GetThreadPool();
 
   scratch_decoder_.resize(tp.NumThreads());
-  scratch_resampler_.resize(tp.NumThreads());
+  split_scratch_.resize(batch_size);
+  split_samples_.clear();
+
+  int64_t total_cost = 0;
+  for (int i = 0; i < batch_size; i++)
+    total_cost += sample_meta_[i].length * sample_meta_[i].channels;
 
   for (int i = 0; i < batch_size; i++) {
+    auto &meta = sample_meta_[i];
+    int64_t cost = meta.length * meta.channels;
+    sample_rate_output[i].data[0] = use_resampling_ ? target_sample_rates_[i] : meta.sample_rate;
+    // Resampling a clip which is long compared to the rest of the batch would make it
+    // a straggler - such clips are only decoded here and resampled in chunks afterwards.
+    if (ShouldResample(i) && decoded_output.shape[i][0] >= 2 * kMinResampleChunk &&
+        CostScheduler::NumChunks(cost, total_cost, tp.NumThreads()) > 1) {
+      split_samples_.push_back(i);
+      tp.AddWork([&, i](int) {
+        try {
+          auto &meta = sample_meta_[i];
+          auto &scratch = split_scratch_[i];
+          scratch.resize(meta.length * meta.channels);
+          int64_t ret = decoders_[i]->DecodeFrames(scratch.data(), meta.length);
+          DALI_ENFORCE(ret == meta.length, make_string("Error decoding audio file ",
+                                                       files_names_[i], ". Requested ",
+                                                       meta.length, " samples but got ", ret,
+                                                       " samples."));
+        } catch (const DALIException &e) {
+          DALI_FAIL(make_string("Error decoding file ", files_names_[i], ". Error: ", e.what()));
+        }
+      }, cost);
+      continue;
+    }
     tp.AddWork([&, i](int thread_id) {
       try {
         DecodeSample<OutputType>(decoded_output[i], thread_id, i);
-        sample_rate_output[i].data[0] = use_resampling_
-          ? target_sample_rates_[i]
-          : sample_meta_[i].sample_rate;
       } catch (const DALIException &e) {
         DALI_FAIL(make_string("Error decoding file ", files_names_[i], ". Error: ", e.what()));
       }
-    }, sample_meta_[i].length * sample_meta_[i].channels);
+    }, cost);
   }
 
   tp.RunAll();
+
+  if (split_samples_.empty())
+    return;
+
+  CostScheduler sched(tp);
+  for (int i : split_samples_) {
+    auto out = decoded_output[i];
+    int out_channels = out.shape.sample_dim() > 1 ? out.shape[1] : 1;
+    sched.AddWork(volume(out.shape), out.shape[0],
+      [&, i, out, out_channels](int, int64_t begin, int64_t end) {
+        auto &meta = sample_meta_[i];
+        resampler_.Resample(out.data + begin * out_channels, begin, end, target_sample_rates_[i],
+                            split_scratch_[i].data(), meta.length, meta.sample_rate,
+                            meta.channels, downmix_ && meta.channels > 1);
+      }, kMinResampleChunk);
+  }
+  sched.Run();
 }
 
 
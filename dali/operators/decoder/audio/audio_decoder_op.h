@@ -1,4 +1,4 @@
-// Copyright (c) 2019-2023, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+// Copyright (c) 2019-2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
 //
 // Licensed under the Apache License, Version 2.0 (the "License");
 // you may not use this file except in compliance with the License.
@@ -68,6 +68,14 @@ class AudioDecoderCpu : public StatelessOperator<CPUBackend> {
   template <typename OutputType>
   void DecodeBatch(Workspace &ws);
 
+  bool ShouldResample(int sample_idx) const {
+    return use_resampling_ &&
+           target_sample_rates_[sample_idx] != sample_meta_[sample_idx].sample_rate;
+  }
+
+  /** The minimum number of output samples resampled by one task, when resampling in chunks */
+  static constexpr int64_t kMinResampleChunk = 1 << 14;
+
   int64_t OutputLength(int64_t in_length, double in_rate, int sample_idx) const {
     if (use_resampling_) {
       return kernels::signal::resampling::resampled_length(
@@ -85,7 +93,9 @@ class AudioDecoderCpu : public StatelessOperator<CPUBackend> {
   std::vector<std::string> files_names_;
   std::vector<AudioMetadata> sample_meta_;
   std::vector<vector<float>> scratch_decoder_;
-  std::vector<vector<float>> scratch_resampler_;
+  // Long clips are decoded first and then resampled in chunks, by multiple threads
+  std::vector<int> split_samples_;
+  std::vector<vector<float>> split_scratch_;
   std::vector<std::unique_ptr<AudioDecoderBase>> decoders_;
 };
 
@@ -1,4 +1,4 @@
-// Copyright (c) 2017-2024, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+// Copyright (c) 2017-2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
 //
 // Licensed under the Apache License, Version 2.0 (the "License");
 // you may not use this file except in compliance with the License.
@@ -37,6 +37,7 @@ void HostDecoder::RunImpl(SampleWorkspace &ws) {
     img = ImageFactory::CreateImage(input.data<uint8_t>(), input.size(), output_type_);
     img->SetCropWindowGenerator(GetCropWindowGenerator(ws.data_idx()));
     img->SetUseFastIdct(use_fast_idct_);
+    img->SetDecodeSizeHint(decode_size_hint_[0], decode_size_hint_[1]);
     img->Decode();
   } catch (std::exception &e) {
     DALI_FAIL(e.what(), ". File: ", file_name);
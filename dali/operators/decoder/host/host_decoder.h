@@ -1,4 +1,4 @@
-// Copyright (c) 2017-2024, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+// Copyright (c) 2017-2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
 //
 // Licensed under the Apache License, Version 2.0 (the "License");
 // you may not use this file except in compliance with the License.
@@ -15,6 +15,7 @@
 #ifndef DALI_OPERATORS_DECODER_HOST_HOST_DECODER_H_
 #define DALI_OPERATORS_DECODER_HOST_HOST_DECODER_H_
 
+#include <array>
 #include <vector>
 
 #include "dali/core/common.h"
@@ -30,8 +31,16 @@ class HostDecoder : public StatelessOperator<CPUBackend> {
   explicit inline HostDecoder(const OpSpec &spec) :
       StatelessOperator<CPUBackend>(spec),
       output_type_(spec.GetArgument<DALIImageType>("output_type")),
-      use_fast_idct_(spec.GetArgument<bool>("use_fast_idct"))
-  {}
+      use_fast_idct_(spec.GetArgument<bool>("use_fast_idct")) {
+    auto size_hint = spec.GetRepeatedArgument<int>("decode_size_hint");
+    DALI_ENFORCE(size_hint.size() <= 2, make_string(
+        "`decode_size_hint` must have at most 2 elements (height, width), got ",
+        size_hint.size(), "."));
+    if (!size_hint.empty()) {
+      decode_size_hint_[0] = size_hint[0];
+      decode_size_hint_[1] = size_hint.back();
+    }
+  }
 
   inline ~HostDecoder() override = default;
   DISABLE_COPY_MOVE_ASSIGN(HostDecoder);
@@ -55,6 +64,7 @@ class HostDecoder : public StatelessOperator<CPUBackend> {
 
   DALIImageType output_type_;
   bool use_fast_idct_ = false;
+  std::array<int, 2> decode_size_hint_ = {0, 0};
 };
 
 }  // namespace dali
@@ -1,4 +1,4 @@
-// Copyright (c) 2017-2024, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+// Copyright (c) 2017-2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
 //
 // Licensed under the Apache License, Version 2.0 (the "License");
 // you may not use this file except in compliance with the License.
@@ -98,6 +98,20 @@ class Image {
     return use_fast_idct_;
   }
 
+  /**
+   * Sets the minimum size (height, width) of the decoded image (or the crop window).
+   * The decoders that can cheaply produce a downscaled image (i.e. JPEG) may then decode
+   * the image at a reduced size, which is not smaller than the hint.
+   * A non-positive value disables the downscaling.
+   */
+  inline void SetDecodeSizeHint(int min_height, int min_width) {
+    decode_size_hint_ = {min_height, min_width};
+  }
+
+  inline std::array<int, 2> DecodeSizeHint() const {
+    return decode_size_hint_;
+  }
+
   virtual ~Image() = default;
   DISABLE_COPY_MOVE_ASSIGN(Image);
 
@@ -135,6 +149,7 @@ class Image {
   const DALIImageType image_type_;
   bool decoded_ = false;
   bool use_fast_idct_ = false;
+  std::array<int, 2> decode_size_hint_ = {0, 0};
   Shape shape_;
   CropWindowGenerator crop_window_generator_;
   std::shared_ptr<uint8_t> decoded_image_ = nullptr;
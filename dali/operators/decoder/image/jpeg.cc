@@ -1,4 +1,4 @@
-// Copyright (c) 2017-2024, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+// Copyright (c) 2017-2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
 //
 // Licensed under the Apache License, Version 2.0 (the "License");
 // you may not use this file except in compliance with the License.
@@ -13,6 +13,7 @@
 // limitations under the License.
 
 #include "dali/operators/decoder/image/jpeg.h"
+#include <algorithm>
 #include <cmath>
 #include <memory>
 #include "dali/operators/decoder/jpeg/jpeg_mem.h"
@@ -100,6 +101,36 @@ JpegImage::DecodeImpl(DALIImageType type, const uint8_t *jpeg, size_t length) co
     flags.crop_width  = target_shape[1] = crop.shape[1];
   }
 
+  // Decode at a reduced size (DCT-domain scaling by M/8), if the consumer doesn't need more
+  auto size_hint = DecodeSizeHint();
+  if (size_hint[0] > 0 && size_hint[1] > 0) {
+    int region_h = flags.crop ? flags.crop_height : h;
+    int region_w = flags.crop ? flags.crop_width : w;
+    int scale_num = jpeg::ChooseScaleNum(region_h, region_w, size_hint[0], size_hint[1]);
+    if (scale_num < 8) {
+      flags.ratio = 8;
+      flags.scale_num = scale_num;
+      int scaled_h = jpeg::ScaledDim(h, scale_num, 8);
+      int scaled_w = jpeg::ScaledDim(w, scale_num, 8);
+      if (flags.crop) {
+        // the crop window is expressed in the coordinates of the scaled image
+        int y0 = flags.crop_y * scale_num / 8;
+        int x0 = flags.crop_x * scale_num / 8;
+        int y1 = std::min(jpeg::ScaledDim(flags.crop_y + flags.crop_height, scale_num, 8),
+                          scaled_h);
+        int x1 = std::min(jpeg::ScaledDim(flags.crop_x + flags.crop_width, scale_num, 8),
+                          scaled_w);
+        flags.crop_y = y0;
+        flags.crop_x = x0;
+        flags.crop_height = target_shape[0] = y1 - y0;
+        flags.crop_width  = target_shape[1] = x1 - x0;
+      } else {
+        target_shape[0] = scaled_h;
+        target_shape[1] = scaled_w;
+      }
+    }
+  }
+
   DALI_ENFORCE(type == DALI_RGB || type == DALI_BGR || type == DALI_GRAY,
                "Color space not supported by libjpeg-turbo");
   flags.color_space = type;
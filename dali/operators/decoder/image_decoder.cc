@@ -1,4 +1,4 @@
-// Copyright (c) 2019-2024, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+// Copyright (c) 2019-2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
 //
 // Licensed under the Apache License, Version 2.0 (the "License");
 // you may not use this file except in compliance with the License.
@@ -144,6 +144,20 @@ the GPU implementation.
 According to the libjpeg-turbo documentation, decompression performance is improved by up to 14%
 with little reduction in quality.)code",
       false)
+  .AddOptionalArg("decode_size_hint",
+      R"code(Applies **only** to the ``cpu`` backend type and JPEG images.
+
+The minimum size of the decoded image (or the region of interest), given as ``(height, width)``
+or as a single value applying to both dimensions.
+
+When set, the decoder uses the DCT-domain downscaling of *libjpeg-turbo* and picks the smallest
+scaling factor ``M/8`` for which the decoded image is not smaller than the hint. This skips most
+of the IDCT and color conversion work when the decoder is followed by a resize to a much smaller
+size - in that case, set it to the size produced by the resize.
+
+.. note::
+  The shape of the output is then smaller than the shape of the encoded image.)code",
+      std::vector<int>{})
   .AddOptionalArg("jpeg_fancy_upsampling",
       R"code(Make the ``mixed`` backend use the same chroma upsampling approach as the ``cpu`` one.
 
@@ -1,6 +1,6 @@
 /* Copyright 2015 The TensorFlow Authors. All Rights Reserved.
 
-Copyright 2019, 2021, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+Copyright 2019, 2021, 2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
 
 Licensed under the Apache License, Version 2.0 (the "License");
 you may not use this file except in compliance with the License.
@@ -86,6 +86,11 @@ std::unique_ptr<uint8_t[]> UncompressLow(const void* srcdata, FewerArgsForCompil
   if ((ratio != 1) && (ratio != 2) && (ratio != 4) && (ratio != 8)) {
     return nullptr;
   }
+  // libjpeg-turbo supports scaling by M/8, M = 1..16
+  if (flags.scale_num < 1 || flags.scale_num > 16 ||
+      (flags.scale_num != 1 && flags.scale_num * (8 / ratio) > 16)) {
+    return nullptr;
+  }
 
   // Channels must be autodetect, grayscale, or rgb.
   if (!(components == 0 || components == 1 || components == 3)) {
@@ -162,7 +167,7 @@ std::unique_ptr<uint8_t[]> UncompressLow(const void* srcdata, FewerArgsForCompil
   }
 
   cinfo.do_fancy_upsampling = boolean(flags.fancy_upscaling);
-  cinfo.scale_num = 1;
+  cinfo.scale_num = flags.scale_num;
   cinfo.scale_denom = ratio;
   cinfo.dct_method = flags.dct_method;
 
@@ -1,6 +1,6 @@
 /* Copyright 2015 The TensorFlow Authors. All Rights Reserved.
 
-Copyright 2019, NVIDIA CORPORATION. All rights reserved.
+Copyright 2019, 2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
 
 Licensed under the Apache License, Version 2.0 (the "License");
 you may not use this file except in compliance with the License.
@@ -39,6 +39,12 @@ struct UncompressFlags {
   // size in both directions).
   int ratio = 1;
 
+  // The numerator of the scaling factor, scale_num / ratio. libjpeg-turbo
+  // scales in the DCT domain by M/8, M = 1..16, so with ratio = 8 any scale_num
+  // in that range can be used. The crop window (if any) is given in the
+  // coordinates of the scaled image.
+  int scale_num = 1;
+
   // The number of bytes per pixel (1, 3 or 4), or 0 for autodetect.
   int components = 0;
 
@@ -85,6 +91,22 @@ struct UncompressFlags {
 std::unique_ptr<uint8_t[]> Uncompress(const void* srcdata, int datasize,
                                     const UncompressFlags& flags);
 
+// The size of a dimension scaled by scale_num / scale_denom, as calculated by libjpeg.
+inline int ScaledDim(int dim, int scale_num, int scale_denom) {
+  return static_cast<int>((static_cast<int64_t>(dim) * scale_num + scale_denom - 1) / scale_denom);
+}
+
+// Chooses the smallest scaling factor M/8 (M = 1..8) for which the region of
+// size (height, width) is, after scaling, not smaller than (min_height, min_width).
+// Returns M - a value of 8 means that the image should be decoded at full size.
+inline int ChooseScaleNum(int height, int width, int min_height, int min_width) {
+  for (int m = 1; m < 8; m++) {
+    if (ScaledDim(height, m, 8) >= min_height && ScaledDim(width, m, 8) >= min_width)
+      return m;
+  }
+  return 8;
+}
+
 // Read jpeg header and get image information.  Returns true on success.
 // The width, height, and components points may be null.
 bool GetImageInfo(const void* srcdata, int datasize, int* width, int* height,
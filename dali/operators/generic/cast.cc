@@ -1,4 +1,4 @@
-// Copyright (c) 2017-2024, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+// Copyright (c) 2017-2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
 //
 // Licensed under the Apache License, Version 2.0 (the "License");
 // you may not use this file except in compliance with the License.
@@ -15,6 +15,7 @@
 
 #include "dali/operators/generic/cast.h"
 #include "dali/core/static_switch.h"
+#include "dali/pipeline/util/cost_scheduler.h"
 
 namespace dali {
 
@@ -45,7 +46,9 @@ void CastCPU::RunImpl(Workspace &ws) {
 
   auto num_samples = input_shape.num_samples();
 
-  auto &tp = ws.GetThreadPool();
+  CostScheduler sched(ws.GetThreadPool());
+  // elements; smaller chunks are not worth the scheduling overhead
+  constexpr int64_t kMinChunkSize = 1 << 14;
   TYPE_SWITCH(output.type(), type2id, OType, CAST_ALLOWED_TYPES, (
     TYPE_SWITCH(input.type(), type2id, IType, CAST_ALLOWED_TYPES, (
 
@@ -53,13 +56,14 @@ void CastCPU::RunImpl(Workspace &ws) {
         auto *out = output.mutable_tensor<OType>(sample_id);
         const auto *in = input.tensor<IType>(sample_id);
         auto size = input_shape.tensor_size(sample_id);
-        tp.AddWork([out, in, size](int thread_id) { CpuHelper<OType, IType>(out, in, size); },
-                   size);
+        sched.AddWork(size, size, [out, in](int thread_id, int64_t begin, int64_t end) {
+          CpuHelper<OType, IType>(out + begin, in + begin, end - begin);
+        }, kMinChunkSize);
       }
 
     ), DALI_FAIL(make_string("Invalid input type: ", input.type())););  // NOLINT(whitespace/parens)
   ), DALI_FAIL(make_string("Invalid output type", output.type())););  // NOLINT(whitespace/parens)
-  tp.RunAll();
+  sched.Run();
 }
 
 DALI_REGISTER_OPERATOR(Cast, CastCPU, CPU);
@@ -1,4 +1,4 @@
-// Copyright (c) 2019-2022, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+// Copyright (c) 2019-2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
 //
 // Licensed under the Apache License, Version 2.0 (the "License");
 // you may not use this file except in compliance with the License.
@@ -12,6 +12,7 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+#include <algorithm>
 #include <vector>
 #include "dali/core/static_switch.h"
 #include "dali/core/error_handling.h"
@@ -21,6 +22,7 @@
 #include "dali/pipeline/data/views.h"
 #include "dali/util/ocv.h"
 #include "dali/operators/generic/flip_util.h"
+#include "dali/pipeline/util/cost_scheduler.h"
 
 namespace dali {
 
@@ -41,39 +43,39 @@ template <>
 Flip<CPUBackend>::Flip(const OpSpec &spec)
     : StatelessOperator<CPUBackend>(spec) {}
 
-void RunFlip(Tensor<CPUBackend> &output, const Tensor<CPUBackend> &input,
-             const TensorLayout &layout,
-             bool horizontal, bool vertical, bool depthwise) {
-  TYPE_SWITCH(input.type(), type2id, DType, (DALI_NUMERIC_TYPES), (
-      auto output_ptr = output.mutable_data<DType>();
-      auto input_ptr = input.data<DType>();
-      auto kernel = kernels::FlipCPU<DType>();
-      kernels::KernelContext ctx;
-      auto shape_dims = TensorListShape<>{{input.shape()}};
-      auto shape = TransformShapes(shape_dims, layout)[0];
-      auto in_view = kernels::InTensorCPU<DType, flip_ndim>(input_ptr, shape);
-      auto reqs = kernel.Setup(ctx, in_view);
-      auto out_shape = reqs.output_shapes[0][0].to_static<flip_ndim>();
-      auto out_view = kernels::OutTensorCPU<DType, flip_ndim>(output_ptr, out_shape);
-      kernel.Run(ctx, out_view, in_view, depthwise, vertical, horizontal);
-  ), (DALI_FAIL(make_string("The element type ", input.type(), " is not supported."))));  // NOLINT
-}
-
 template <>
-void Flip<CPUBackend>::RunImpl(SampleWorkspace &ws) {
+void Flip<CPUBackend>::RunImpl(Workspace &ws) {
   const auto &input = ws.Input<CPUBackend>(0);
   auto &output = ws.Output<CPUBackend>(0);
   auto layout = input.GetLayout();
   output.SetLayout(layout);
-  output.Resize(input.shape(), input.type());
-  auto _horizontal = GetHorizontal(ws, ws.data_idx());
-  auto _vertical = GetVertical(ws, ws.data_idx());
-  auto _depthwise = GetDepthwise(ws, ws.data_idx());
-  if (!_horizontal && !_vertical && !_depthwise) {
-    output.Copy(input);
-  } else {
-    RunFlip(output, input, layout, _horizontal, _vertical, _depthwise);
-  }
+  int curr_batch_size = input.num_samples();
+  auto horizontal = GetHorizontal(ws, curr_batch_size);
+  auto vertical = GetVertical(ws, curr_batch_size);
+  auto depthwise = GetDepthwise(ws, curr_batch_size);
+  auto shapes = TransformShapes(input.shape(), layout);
+  CostScheduler sched(ws.GetThreadPool());
+  // elements; smaller chunks are not worth the scheduling overhead
+  constexpr int64_t kMinChunkSize = 1 << 14;
+  TYPE_SWITCH(input.type(), type2id, DType, (DALI_NUMERIC_TYPES), (
+    using Kernel = kernels::FlipCPU<DType>;
+    for (int i = 0; i < curr_batch_size; i++) {
+      auto shape = shapes[i];
+      auto in_view = kernels::InTensorCPU<DType, flip_ndim>(input.tensor<DType>(i), shape);
+      auto out_view = kernels::OutTensorCPU<DType, flip_ndim>(output.mutable_tensor<DType>(i),
+                                                              shape);
+      bool flip_x = horizontal[i], flip_y = vertical[i], flip_z = depthwise[i];
+      // the samples are split into ranges of rows
+      int64_t row_size = shape[3] * shape[4];
+      int64_t min_rows = div_ceil(kMinChunkSize, std::max<int64_t>(row_size, 1));
+      sched.AddWork(volume(shape), Kernel::NumRows(shape),
+        [=](int thread_idx, int64_t begin, int64_t end) mutable {
+          kernels::KernelContext ctx;
+          Kernel().Run(ctx, out_view, in_view, flip_z, flip_y, flip_x, begin, end);
+        }, min_rows);
+    }
+  ), (DALI_FAIL(make_string("The element type ", input.type(), " is not supported."))));  // NOLINT
+  sched.Run();
 }
 
 DALI_REGISTER_OPERATOR(Flip, Flip<CPUBackend>, CPU);
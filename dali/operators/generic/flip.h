@@ -1,4 +1,4 @@
-// Copyright (c) 2019-2022, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+// Copyright (c) 2019-2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
 //
 // Licensed under the Apache License, Version 2.0 (the "License");
 // you may not use this file except in compliance with the License.
@@ -40,19 +40,7 @@ class Flip: public StatelessOperator<Backend> {
     return true;
   }
 
-  void RunImpl(legacy_workspace_t<Backend> &ws) override;
-
-  int GetHorizontal(const ArgumentWorkspace &ws, int idx) {
-    return this->spec_.template GetArgument<int>("horizontal", &ws, idx);
-  }
-
-  int GetVertical(const ArgumentWorkspace &ws, int idx) {
-    return this->spec_.template GetArgument<int>("vertical", &ws, idx);
-  }
-
-  int GetDepthwise(const ArgumentWorkspace &ws, int idx) {
-    return this->spec_.template GetArgument<int>("depthwise", &ws, idx);
-  }
+  void RunImpl(Workspace &ws) override;
 
   std::vector<int> GetHorizontal(const Workspace &ws, int curr_batch_size) {
     std::vector<int> result;
@@ -1,4 +1,4 @@
-// Copyright (c) 2020-2024, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+// Copyright (c) 2020-2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
 //
 // Licensed under the Apache License, Version 2.0 (the "License");
 // you may not use this file except in compliance with the License.
@@ -20,6 +20,7 @@
 #include "dali/kernels/slice/slice_cpu.h"
 #include "dali/operators/generic/pad.h"
 #include "dali/pipeline/data/views.h"
+#include "dali/pipeline/util/cost_scheduler.h"
 
 namespace dali {
 
@@ -234,15 +235,16 @@ void Pad<CPUBackend>::RunImpl(Workspace &ws) {
       using Kernel = kernels::SliceCPU<T, T, Dims>;
       using Args = kernels::SliceArgs<T, Dims>;
 
+      auto &kernel_sample_args = std::any_cast<std::vector<Args>&>(kernel_sample_args_);
+      // The kernel splits the samples into blocks - large samples get proportionally more of them
+      int64_t total_cost = out_shape.num_elements();
+      kernels::KernelContext ctx;
       for (int i = 0; i < nsamples; i++) {
-        thread_pool.AddWork(
-          [this, &input, &output, i](int thread_id) {
-            kernels::KernelContext ctx;
-            auto in_view = view<const T, Dims>(input[i]);
-            auto out_view = view<T, Dims>(output[i]);
-            auto &kernel_sample_args = std::any_cast<std::vector<Args>&>(kernel_sample_args_);
-            kmgr_.Run<Kernel>(i, ctx, out_view, in_view, kernel_sample_args[i]);
-          }, out_shape.tensor_size(i));
+        int req_nblocks = CostScheduler::NumChunks(out_shape.tensor_size(i), total_cost,
+                                                   thread_pool.NumThreads());
+        Kernel().Schedule(ctx, view<T, Dims>(output[i]), view<const T, Dims>(input[i]),
+                          kernel_sample_args[i], thread_pool, kernels::kSliceMinBlockSize,
+                          req_nblocks);
       }
       thread_pool.RunAll();
     ), DALI_FAIL(make_string("Unsupported number of dimensions ", ndim)));  // NOLINT
@@ -1,4 +1,4 @@
-// Copyright (c) 2020-2023, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+// Copyright (c) 2020-2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
 //
 // Licensed under the Apache License, Version 2.0 (the "License");
 // you may not use this file except in compliance with the License.
@@ -26,6 +26,7 @@
 #include "dali/operators/generic/reduce/layout_util.h"
 #include "dali/operators/util/axes_utils.h"
 #include "dali/pipeline/operator/checkpointing/stateless_operator.h"
+#include "dali/pipeline/util/cost_scheduler.h"
 
 #define REDUCE_TYPES (uint8_t, int8_t, uint16_t, int16_t, uint32_t, int32_t, uint64_t, int64_t, float)  // NOLINT
 
@@ -87,12 +88,25 @@ class Reduce : public StatelessOperator<Backend>, AxesHelper {
 
     auto &thread_pool = ws.GetThreadPool();
     int num_threads = thread_pool.NumThreads();
+    int nsamples = in_view.num_samples();
 
     using Kernel = ReductionType<OutputType, InputType>;
-    kmgr_.template Resize<Kernel>(num_threads);
+    kmgr_.template Resize<Kernel>(nsamples);
 
-    for (int sample = 0; sample < in_view.num_samples(); sample++) {
+    // Large samples are reduced in parts, which are combined after the thread pool completes.
+    // The result doesn't depend on the number of parts.
+    int64_t total_volume = in_view.num_elements();
+    split_samples_.clear();
+    for (int sample = 0; sample < nsamples; sample++) {
       int64_t priority = volume(in_view.shape.tensor_shape_span(sample));
+      int nblocks = CostScheduler::NumChunks(priority, total_volume, num_threads);
+      if (nblocks > 1) {
+        kernels::KernelContext ctx;
+        kmgr_.Setup<Kernel>(sample, ctx, out_view[sample], in_view[sample], make_cspan(axes_));
+        kmgr_.Get<Kernel>(sample).Schedule(thread_pool, true, nblocks);
+        split_samples_.push_back(sample);
+        continue;
+      }
       thread_pool.AddWork(
         [&, sample](int thread_id) {
           auto in_sample_view = in_view[sample];
@@ -100,12 +114,14 @@ class Reduce : public StatelessOperator<Backend>, AxesHelper {
           kernels::KernelContext ctx;
 
           kmgr_.Setup<Kernel>(
-            thread_id, ctx, out_sample_view, in_sample_view, make_cspan(axes_));
-          kmgr_.Run<Kernel>(thread_id, ctx);
+            sample, ctx, out_sample_view, in_sample_view, make_cspan(axes_));
+          kmgr_.Run<Kernel>(sample, ctx);
         },
         priority);
     }
     thread_pool.RunAll();
+    for (int sample : split_samples_)
+      kmgr_.Get<Kernel>(sample).Combine();
   }
 
   template <typename OutputType, typename InputType>
@@ -150,6 +166,7 @@ class Reduce : public StatelessOperator<Backend>, AxesHelper {
   USE_OPERATOR_MEMBERS();
   bool keep_dims_;
   kernels::KernelManager kmgr_;
+  std::vector<int> split_samples_;
 };
 
 
@@ -1,4 +1,4 @@
-// Copyright (c) 2020-2023, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+// Copyright (c) 2020-2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
 //
 // Licensed under the Apache License, Version 2.0 (the "License");
 // you may not use this file except in compliance with the License.
@@ -27,6 +27,7 @@
 #include "dali/operators/util/axes_utils.h"
 #include "dali/pipeline/operator/checkpointing/stateless_operator.h"
 #include "dali/pipeline/operator/operator.h"
+#include "dali/pipeline/util/cost_scheduler.h"
 
 
 #define REDUCE_WITH_MEAN_INPUT_TYPES ( \
@@ -100,12 +101,26 @@ class ReduceWithMeanInput : public StatelessOperator<Backend>, AxesHelper {
 
     auto &thread_pool = ws.GetThreadPool();
     int num_threads = thread_pool.NumThreads();
+    int nsamples = in_view.num_samples();
 
     using Kernel = ReductionType<OutputType, InputType, OutputType>;
-    kmgr_.template Resize<Kernel>(num_threads);
+    kmgr_.template Resize<Kernel>(nsamples);
 
-    for (int sample = 0; sample < in_view.num_samples(); sample++) {
+    // Large samples are reduced in parts, which are combined after the thread pool completes.
+    // The result doesn't depend on the number of parts.
+    int64_t total_volume = in_view.num_elements();
+    split_samples_.clear();
+    for (int sample = 0; sample < nsamples; sample++) {
       int64_t priority = volume(in_view.shape.tensor_shape_span(sample));
+      int nblocks = CostScheduler::NumChunks(priority, total_volume, num_threads);
+      if (nblocks > 1 && !has_empty_axes_arg_) {
+        kernels::KernelContext ctx;
+        kmgr_.Setup<Kernel>(sample, ctx, out_view[sample], in_view[sample], make_cspan(axes_),
+                            mean_view[sample], ddof_);
+        kmgr_.Get<Kernel>(sample).Schedule(thread_pool, true, nblocks);
+        split_samples_.push_back(sample);
+        continue;
+      }
       thread_pool.AddWork(
         [&, sample](int thread_id) {
           auto in_sample_view = in_view[sample];
@@ -114,7 +129,7 @@ class ReduceWithMeanInput : public StatelessOperator<Backend>, AxesHelper {
           kernels::KernelContext ctx;
 
           kmgr_.Setup<Kernel>(
-            thread_id,
+            sample,
             ctx,
             out_sample_view,
             in_sample_view,
@@ -122,7 +137,7 @@ class ReduceWithMeanInput : public StatelessOperator<Backend>, AxesHelper {
             mean_sample_view,
             ddof_);
           if (!has_empty_axes_arg_) {
-            kmgr_.Run<Kernel>(thread_id, ctx);
+            kmgr_.Run<Kernel>(sample, ctx);
           } else {
             OutputType *data = out_sample_view.data;
             std::fill(data, data + out_sample_view.num_elements(), 0);
@@ -131,6 +146,8 @@ class ReduceWithMeanInput : public StatelessOperator<Backend>, AxesHelper {
         priority);
     }
     thread_pool.RunAll();
+    for (int sample : split_samples_)
+      kmgr_.Get<Kernel>(sample).Combine();
   }
 
   template <typename OutputType, typename InputType>
@@ -182,6 +199,7 @@ class ReduceWithMeanInput : public StatelessOperator<Backend>, AxesHelper {
   bool keep_dims_;
   int ddof_;
   kernels::KernelManager kmgr_;
+  std::vector<int> split_samples_;
 };
 
 }  // namespace dali
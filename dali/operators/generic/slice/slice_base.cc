@@ -1,4 +1,4 @@
-// Copyright (c) 2019-2022, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+// Copyright (c) 2019-2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
 //
 // Licensed under the Apache License, Version 2.0 (the "License");
 // you may not use this file except in compliance with the License.
@@ -16,6 +16,7 @@
 #include <memory>
 #include <vector>
 #include "dali/kernels/slice/slice_cpu.h"
+#include "dali/pipeline/util/cost_scheduler.h"
 
 namespace dali {
 
@@ -80,10 +81,13 @@ void SliceBaseCpu<OutputType, InputType, Dims>::RunImpl(Workspace &ws) {
   auto in_view = view<const InputType, Dims>(input);
   auto out_view = view<OutputType, Dims>(output);
 
-  int req_nblocks = std::max(1, 10 * thread_pool.NumThreads() / nsamples);
+  // The kernel splits the samples into blocks - large samples get proportionally more of them
+  int64_t total_cost = out_shape.num_elements();
   int block_threshold = 16000;
   kernels::KernelContext ctx;
   for (int sample_idx = 0; sample_idx < nsamples; sample_idx++) {
+    int req_nblocks = CostScheduler::NumChunks(out_shape.tensor_size(sample_idx), total_cost,
+                                               thread_pool.NumThreads());
     Kernel().Schedule(ctx, out_view[sample_idx], in_view[sample_idx],
                       args_[sample_idx], thread_pool, block_threshold, req_nblocks);
   }
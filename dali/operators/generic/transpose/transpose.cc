@@ -1,4 +1,4 @@
-// Copyright (c) 2019-2024, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+// Copyright (c) 2019-2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
 //
 // Licensed under the Apache License, Version 2.0 (the "License");
 // you may not use this file except in compliance with the License.
@@ -18,6 +18,7 @@
 #include "dali/core/tensor_layout.h"
 #include "dali/operators/generic/transpose/transpose.h"
 #include "dali/pipeline/data/views.h"
+#include "dali/pipeline/util/cost_scheduler.h"
 
 namespace dali {
 
@@ -33,7 +34,9 @@ class TransposeCPU : public Transpose<CPUBackend> {
     const auto& input = ws.Input<CPUBackend>(0);
     auto& output = ws.Output<CPUBackend>(0);
     output.SetLayout(output_layout_);
-    auto& thread_pool = ws.GetThreadPool();
+    CostScheduler sched(ws.GetThreadPool());
+    // elements; smaller chunks are not worth the scheduling overhead
+    constexpr int64_t kMinChunkSize = 1 << 14;
     auto input_type = input.type();
     auto ndim = input.shape().sample_dim();
 
@@ -42,18 +45,23 @@ class TransposeCPU : public Transpose<CPUBackend> {
 
     TYPE_SWITCH(input_type, type2id, T, TRANSPOSE_ALLOWED_TYPES, (
       for (int i = 0; i < nsamples; i++) {
-        thread_pool.AddWork(
-          [this, &input, &output, i](int thread_id) {
+        // the samples are split along the outermost output dimension
+        int64_t size = out_shape.tensor_size(i);
+        int64_t extent = ndim > 0 ? out_shape.tensor_shape_span(i)[0] : 1;
+        int64_t min_extent = extent > 0 ? kMinChunkSize * extent / std::max<int64_t>(size, 1) : 1;
+        sched.AddWork(size, extent,
+          [this, &input, &output, i](int thread_id, int64_t begin, int64_t end) {
             TensorShape<> src_ts = input.shape()[i];
 
             auto dst_ts = permute(src_ts, perm_);
             kernels::TransposeGrouped(
                 TensorView<StorageCPU, T>{output.mutable_tensor<T>(i), dst_ts},
-                TensorView<StorageCPU, const T>{input.tensor<T>(i), src_ts}, make_cspan(perm_));
-          }, out_shape.tensor_size(i));
+                TensorView<StorageCPU, const T>{input.tensor<T>(i), src_ts}, make_cspan(perm_),
+                begin, end);
+          }, min_extent);
       }
     ), DALI_FAIL(make_string("Unsupported input type: ", input_type)));  // NOLINT
-    thread_pool.RunAll();
+    sched.Run();
   }
 };
 
@@ -1,4 +1,4 @@
-// Copyright (c) 2023-2024, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+// Copyright (c) 2023-2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
 //
 // Licensed under the Apache License, Version 2.0 (the "License");
 // you may not use this file except in compliance with the License.
@@ -12,6 +12,7 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+#include <algorithm>
 #include <limits>
 #include <vector>
 
@@ -21,6 +22,7 @@
 #include "dali/pipeline/data/sequence_utils.h"
 #include "dali/pipeline/operator/arg_helper.h"
 #include "dali/pipeline/operator/common.h"
+#include "dali/pipeline/util/cost_scheduler.h"
 #include "dali/util/ocv.h"
 
 namespace dali {
@@ -122,12 +124,24 @@ namespace filter {
 
 namespace ocv {
 using namespace boundary;  // NOLINT(build/namespaces)
+
+/*
+ * The handlers compute the rows [row_begin, row_end) of the output image. OpenCV uses the
+ * pixels outside of a ROI (when there are any) instead of the border, so filtering a band of rows
+ * gives the same results as filtering the whole image. The handlers with `kSupportsBands` can
+ * process the bands of one image independently.
+ */
+
 struct BorderSimple {
+  static constexpr bool kSupportsBands = true;
+
   BorderSimple(int border_type) : border_type_{border_type} {}  // NOLINT(runtime/explicit)
 
   void operator()(const cv::Mat& in_img, cv::Mat& out_img, int d_depth, const cv::Mat& filter_mat,
-                  int anchor_x, int anchor_y) {
-    cv::filter2D(in_img, out_img, d_depth, filter_mat, {anchor_x, anchor_y}, 0, border_type_);
+                  int anchor_x, int anchor_y, int row_begin, int row_end) {
+    cv::Mat out_band = out_img.rowRange(row_begin, row_end);
+    cv::filter2D(in_img.rowRange(row_begin, row_end), out_band, d_depth, filter_mat,
+                 {anchor_x, anchor_y}, 0, border_type_);
   }
 
  protected:
@@ -137,22 +151,27 @@ struct BorderSimple {
 
 template <typename In>
 struct BorderConstant {
+  static constexpr bool kSupportsBands = true;
+
   BorderConstant(In fill_val) : fill_val_{fill_val} {}  // NOLINT(runtime/explicit)
 
   void operator()(const cv::Mat& in_img, cv::Mat& out_img, int d_depth, const cv::Mat& filter_mat,
-                  int anchor_x, int anchor_y) {
+                  int anchor_x, int anchor_y, int row_begin, int row_end) {
+    cv::Mat out_band = out_img.rowRange(row_begin, row_end);
+    cv::Mat in_band = in_img.rowRange(row_begin, row_end);
     if (fill_val_ == 0) {
-      cv::filter2D(in_img, out_img, d_depth, filter_mat, {anchor_x, anchor_y}, 0,
+      cv::filter2D(in_band, out_band, d_depth, filter_mat, {anchor_x, anchor_y}, 0,
                    cv::BORDER_CONSTANT);
     } else {
       cv::Mat in_padded;
       int top = anchor_y, bottom = filter_mat.rows - anchor_y - 1;
       int left = anchor_x, right = filter_mat.cols - anchor_x - 1;
-      cv::copyMakeBorder(in_img, in_padded, top, bottom, left, right, cv::BORDER_CONSTANT,
+      // the rows of the image adjacent to the band are used for padding, if there are any
+      cv::copyMakeBorder(in_band, in_padded, top, bottom, left, right, cv::BORDER_CONSTANT,
                          cv::Scalar(fill_val_, fill_val_, fill_val_));
-      auto roi = cv::Rect(left, top, in_img.cols, in_img.rows);
+      auto roi = cv::Rect(left, top, in_band.cols, in_band.rows);
       auto in_roi = in_padded(roi);
-      cv::filter2D(in_roi, out_img, d_depth, filter_mat, {anchor_x, anchor_y}, 0);
+      cv::filter2D(in_roi, out_band, d_depth, filter_mat, {anchor_x, anchor_y}, 0);
     }
   }
 
@@ -162,8 +181,12 @@ struct BorderConstant {
 
 
 struct BorderWrap {
+  // the whole image is needed to wrap the rows
+  static constexpr bool kSupportsBands = false;
+
   void operator()(const cv::Mat& in_img, cv::Mat& out_img, int d_depth, const cv::Mat& filter_mat,
-                  int anchor_x, int anchor_y) {
+                  int anchor_x, int anchor_y, int row_begin, int row_end) {
+    assert(row_begin == 0 && row_end == out_img.rows);
     cv::Mat in_padded;
     int top = anchor_y, bottom = filter_mat.rows - anchor_y - 1;
     int left = anchor_x, right = filter_mat.cols - anchor_x - 1;
@@ -175,12 +198,15 @@ struct BorderWrap {
 };
 
 struct BorderValidOnly {
+  static constexpr bool kSupportsBands = true;
+
   void operator()(const cv::Mat& in_img, cv::Mat& out_img, int d_depth, const cv::Mat& filter_mat,
-                  int anchor_x, int anchor_y) {
-    auto roi = cv::Rect(anchor_x, anchor_y, in_img.cols - filter_mat.cols + 1,
-                        in_img.rows - filter_mat.rows + 1);
+                  int anchor_x, int anchor_y, int row_begin, int row_end) {
+    auto roi = cv::Rect(anchor_x, anchor_y + row_begin, in_img.cols - filter_mat.cols + 1,
+                        row_end - row_begin);
     auto in_roi = in_img(roi);
-    cv::filter2D(in_roi, out_img, d_depth, filter_mat, {anchor_x, anchor_y}, 0);
+    cv::Mat out_band = out_img.rowRange(row_begin, row_end);
+    cv::filter2D(in_roi, out_band, d_depth, filter_mat, {anchor_x, anchor_y}, 0);
   }
 };
 
@@ -205,6 +231,8 @@ void with_border_handler(bool is_valid_mode, BoundaryType border_type, int sampl
 template <typename Out, typename In, int num_seq_dims>
 class FilterOpCpuImpl : public OpImplBase<CPUBackend> {
   static constexpr int axes = 2;
+  // The minimal number of rows in a band of a plane processed by a single work item
+  static constexpr int kMinBandRows = 16;
 
  public:
   /**
@@ -242,6 +270,11 @@ class FilterOpCpuImpl : public OpImplBase<CPUBackend> {
     if (ws.NumInput() >= 3) {
       fill_values = view<const In, 0>(ws.template Input<CPUBackend>(2));
     }
+    int64_t total_cost = 0;
+    for (int sample_idx = 0; sample_idx < num_samples; sample_idx++) {
+      total_cost += out_view.shape.tensor_size(sample_idx) *
+                    filter_view.shape.tensor_size(sample_idx);
+    }
     for (int sample_idx = 0; sample_idx < num_samples; sample_idx++) {
       auto planes_range = sequence_utils::unfolded_views_range<num_seq_dims>(out_view[sample_idx],
                                                                              in_view[sample_idx]);
@@ -275,13 +308,28 @@ class FilterOpCpuImpl : public OpImplBase<CPUBackend> {
       }
       ocv::with_border_handler(
           input_desc_.is_valid_mode, border_type_, sample_idx, fill_values, [&](auto ocv_handler) {
+            constexpr bool supports_bands = decltype(ocv_handler)::kSupportsBands;
             for (auto&& views : planes_range) {
-              tp.AddWork(
-                  [this, views, sample_filter, sample_anchor, ocv_handler](int) {
-                    auto& [sample_out, sample_in] = views;
-                    RunSample(sample_out, sample_filter, sample_in, sample_anchor, ocv_handler);
-                  },
-                  in_range.SliceSize());
+              int num_rows = std::get<0>(views).shape[0];
+              int64_t plane_cost = in_range.SliceSize() * sample_filter.num_elements();
+              // Large planes are split into bands of rows processed by different threads
+              int num_bands = 1;
+              if (supports_bands) {
+                num_bands = CostScheduler::NumChunks(plane_cost, total_cost, tp.NumThreads());
+                num_bands = std::max(1, std::min(num_bands, num_rows / kMinBandRows));
+              }
+              for (int band = 0; band < num_bands; band++) {
+                int row_begin = static_cast<int64_t>(num_rows) * band / num_bands;
+                int row_end = static_cast<int64_t>(num_rows) * (band + 1) / num_bands;
+                tp.AddWork(
+                    [this, views, sample_filter, sample_anchor, ocv_handler, row_begin,
+                     row_end](int) {
+                      auto& [sample_out, sample_in] = views;
+                      RunSample(sample_out, sample_filter, sample_in, sample_anchor, ocv_handler,
+                                row_begin, row_end);
+                    },
+                    in_range.SliceSize() / num_bands);
+              }
             }
           });
     }
@@ -293,7 +341,8 @@ class FilterOpCpuImpl : public OpImplBase<CPUBackend> {
   void RunSample(TensorView<StorageCPU, Out, ndim> out,
                  TensorView<StorageCPU, const float, axes> filter,
                  TensorView<StorageCPU, const In, ndim> in,
-                 TensorView<StorageCPU, const int, 1> anchor, OcvHandler handler) {
+                 TensorView<StorageCPU, const int, 1> anchor, OcvHandler handler,
+                 int row_begin, int row_end) {
     auto& filter_shape = filter.shape;
     int sample_dim = in.shape.sample_dim();
     int num_channels = sample_dim == 2 ? 1 : in.shape[2];
@@ -308,7 +357,7 @@ class FilterOpCpuImpl : public OpImplBase<CPUBackend> {
     int d_depth = std::is_same_v<In, Out> ? -1 : CV_32F;
     int anchor_y = anchor.data[0] < 0 ? filter_shape[0] / 2 : anchor.data[0];
     int anchor_x = anchor.data[1] < 0 ? filter_shape[1] / 2 : anchor.data[1];
-    handler(in_img, out_img, d_depth, filter_mat, anchor_x, anchor_y);
+    handler(in_img, out_img, d_depth, filter_mat, anchor_x, anchor_y, row_begin, row_end);
   }
 
   const OpSpec& spec_;
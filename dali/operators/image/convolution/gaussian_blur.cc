@@ -1,4 +1,4 @@
-// Copyright (c) 2020-2024, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+// Copyright (c) 2020-2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
 //
 // Licensed under the Apache License, Version 2.0 (the "License");
 // you may not use this file except in compliance with the License.
@@ -18,12 +18,14 @@
 #include <utility>
 #include <vector>
 
+#include "dali/core/small_vector.h"
 #include "dali/core/static_switch.h"
 #include "dali/kernels/imgproc/convolution/separable_convolution_cpu.h"
 #include "dali/kernels/kernel_manager.h"
 #include "dali/operators/image/convolution/gaussian_blur.h"
 #include "dali/pipeline/data/views.h"
 #include "dali/pipeline/operator/common.h"
+#include "dali/pipeline/util/cost_scheduler.h"
 
 namespace dali {
 
@@ -115,8 +117,15 @@ class GaussianBlurOpCpu : public OpImplBase<CPUBackend> {
     auto& thread_pool = ws.GetThreadPool();
 
     int nsamples = input.num_samples();
+    int64_t total_volume = input.shape().num_elements();
+    SmallVector<int, 4> tiled_samples;
     for (int sample_idx = 0; sample_idx < nsamples; sample_idx++) {
       auto elem_volume = volume(input.tensor_shape(sample_idx));
+      // Samples larger than a fair share of a thread are split into tiles (below)
+      if (CostScheduler::NumChunks(elem_volume, total_volume, thread_pool.NumThreads(), 1) > 1) {
+        tiled_samples.push_back(sample_idx);
+        continue;
+      }
       thread_pool.AddWork(
           [this, &input, &output, sample_idx](int thread_id) {
             auto gaussian_windows = windows_[sample_idx].GetWindows();
@@ -132,6 +141,20 @@ class GaussianBlurOpCpu : public OpImplBase<CPUBackend> {
           },
           elem_volume);
     }
+    // The passes of the separable convolution depend on each other, so scheduling waits for
+    // the preceding passes - the per-sample work added above runs in the meantime.
+    kernels::DynamicScratchpad scratchpad(AccessOrder::host());
+    for (int sample_idx : tiled_samples) {
+      const auto &shape = input.tensor_shape(sample_idx);
+      auto in_view = TensorView<StorageCPU, const In, ndim>{
+          input.template tensor<In>(sample_idx), shape};
+      auto out_view = TensorView<StorageCPU, Out, ndim>{
+          output.template mutable_tensor<Out>(sample_idx), shape};
+      auto ctx = ctx_;
+      ctx.scratchpad = &scratchpad;
+      kmgr_.Get<Kernel>(sample_idx).Schedule(ctx, out_view, in_view,
+                                             windows_[sample_idx].GetWindows(), thread_pool);
+    }
     thread_pool.RunAll();
   }
 
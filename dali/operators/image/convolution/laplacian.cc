@@ -1,4 +1,4 @@
-// Copyright (c) 2021-2024, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+// Copyright (c) 2021-2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
 //
 // Licensed under the Apache License, Version 2.0 (the "License");
 // you may not use this file except in compliance with the License.
@@ -18,6 +18,7 @@
 #include <utility>
 #include <vector>
 
+#include "dali/core/small_vector.h"
 #include "dali/core/static_switch.h"
 #include "dali/kernels/imgproc/convolution/laplacian_cpu.h"
 #include "dali/kernels/imgproc/convolution/laplacian_windows.h"
@@ -25,6 +26,7 @@
 #include "dali/operators/image/convolution/laplacian.h"
 #include "dali/pipeline/data/views.h"
 #include "dali/pipeline/operator/common.h"
+#include "dali/pipeline/util/cost_scheduler.h"
 
 namespace dali {
 
@@ -151,8 +153,18 @@ class LaplacianOpCpu : public OpImplBase<CPUBackend> {
     auto& thread_pool = ws.GetThreadPool();
     int nsamples = input.num_samples();
 
+    int64_t total_cost = 0;
+    for (int sample_idx = 0; sample_idx < nsamples; sample_idx++)
+      total_cost += volume(input.tensor_shape(sample_idx)) * args.GetTotalWindowSizes(sample_idx);
+
+    SmallVector<int, 4> tiled_samples;
     for (int sample_idx = 0; sample_idx < nsamples; sample_idx++) {
       auto priority = volume(input.tensor_shape(sample_idx)) * args.GetTotalWindowSizes(sample_idx);
+      // Samples larger than a fair share of a thread are split into tiles (below)
+      if (CostScheduler::NumChunks(priority, total_cost, thread_pool.NumThreads(), 1) > 1) {
+        tiled_samples.push_back(sample_idx);
+        continue;
+      }
 
       thread_pool.AddWork(
           [this, &input, &output, sample_idx](int thread_id) {
@@ -168,6 +180,20 @@ class LaplacianOpCpu : public OpImplBase<CPUBackend> {
           },
           priority);
     }
+    // The partial derivatives are accumulated in order, so scheduling waits for the preceding
+    // steps - the per-sample work added above runs in the meantime.
+    kernels::DynamicScratchpad scratchpad(AccessOrder::host());
+    for (int sample_idx : tiled_samples) {
+      const auto& shape = input.tensor_shape(sample_idx);
+      auto in_view = TensorView<StorageCPU, const In, ndim>{
+          input.template tensor<In>(sample_idx), shape};
+      auto out_view = TensorView<StorageCPU, Out, ndim>{
+          output.template mutable_tensor<Out>(sample_idx), shape};
+      auto ctx = ctx_;
+      ctx.scratchpad = &scratchpad;
+      kmgr_.Get<Kernel>(sample_idx).Schedule(ctx, out_view, in_view, windows_[sample_idx],
+                                             args.GetScales(sample_idx), thread_pool);
+    }
     thread_pool.RunAll();
   }
 
@@ -1,4 +1,4 @@
-// Copyright (c) 2019-2024, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+// Copyright (c) 2019-2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
 //
 // Licensed under the Apache License, Version 2.0 (the "License");
 // you may not use this file except in compliance with the License.
@@ -17,6 +17,7 @@
 #include "dali/core/tensor_layout.h"
 #include "dali/kernels/slice/slice_flip_normalize_permute_pad_cpu.h"
 #include "dali/pipeline/data/views.h"
+#include "dali/pipeline/util/cost_scheduler.h"
 
 namespace dali {
 
@@ -123,9 +124,11 @@ void CropMirrorNormalize<CPUBackend>::RunImpl(Workspace &ws) {
         auto &kernel_sample_args = std::any_cast<std::vector<Args>&>(kernel_sample_args_);
         auto in_view = view<const InputType, Dims>(input);
         auto out_view = view<OutputType, Dims>(output);
-        int req_nblocks = std::max(1, 10 * thread_pool.NumThreads() / nsamples);
+        int64_t total_cost = out_shape.num_elements();
         kernels::KernelContext ctx;
         for (int sample_idx = 0; sample_idx < nsamples; sample_idx++) {
+          int req_nblocks = CostScheduler::NumChunks(out_shape.tensor_size(sample_idx),
+                                                     total_cost, thread_pool.NumThreads());
           Kernel().Schedule(ctx, out_view[sample_idx], in_view[sample_idx],
                             kernel_sample_args[sample_idx],
                             thread_pool, kernels::kSliceMinBlockSize, req_nblocks);
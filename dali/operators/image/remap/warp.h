@@ -1,4 +1,4 @@
-// Copyright (c) 2019-2022, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+// Copyright (c) 2019-2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
 //
 // Licensed under the Apache License, Version 2.0 (the "License");
 // you may not use this file except in compliance with the License.
@@ -31,6 +31,7 @@
 #include "dali/pipeline/data/views.h"
 #include "dali/pipeline/operator/checkpointing/stateless_operator.h"
 #include "dali/pipeline/operator/sequence_operator.h"
+#include "dali/pipeline/util/cost_scheduler.h"
 
 namespace dali {
 namespace detail {
@@ -166,9 +167,27 @@ class WarpOpImpl : public OpImplInterface<Backend> {
     ThreadPool &pool = ws.GetThreadPool();
     auto interp_types = param_provider_->InterpTypes();
 
+    // Large samples are split into bands of rows, so that a few large images in the batch
+    // don't end up being processed by a single thread each.
+    int64_t total_size = output.shape.num_elements();
     for (int i = 0; i < input_.num_samples(); i++) {
-      pool.AddWork([&, i](int tid) {
-        DALIInterpType interp_type = interp_types.size() > 1 ? interp_types[i] : interp_types[0];
+      DALIInterpType interp_type = interp_types.size() > 1 ? interp_types[i] : interp_types[0];
+      int64_t sample_size = output.shape.tensor_size(i);
+      int nblocks = CostScheduler::NumChunks(sample_size, total_size, pool.NumThreads());
+      if (nblocks > 1) {
+        auto context = GetContext(ws);
+        kmgr_.Get<Kernel>(i).Schedule(
+            context,
+            output[i],
+            input_[i],
+            *param_provider_->ParamsCPU()(i),
+            param_provider_->OutputSizes()[i],
+            interp_type,
+            param_provider_->Border(),
+            pool, nblocks);
+        continue;
+      }
+      pool.AddWork([&, i, interp_type](int tid) {
         auto context = GetContext(ws);
         kmgr_.Run<Kernel>(
             i, context,
@@ -178,7 +197,7 @@ class WarpOpImpl : public OpImplInterface<Backend> {
             param_provider_->OutputSizes()[i],
             interp_type,
             param_provider_->Border());
-      }, output.shape.tensor_size(i));
+      }, sample_size);
     }
     pool.RunAll();
   }
@@ -0,0 +1,163 @@
+// Copyright (c) 2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "dali/operators/io/shm_ring/shm_ring_input.h"
+#include <cstring>
+#include <utility>
+#include "dali/pipeline/operator/error_reporting.h"
+
+namespace dali {
+
+DALI_SCHEMA(experimental__inputs__SharedMemoryRing)
+    .DocStr(R"code(Reads batches from a ring buffer in shared memory, written by another process.
+
+The ring is a single-producer/single-consumer queue of batches in a named POSIX shared memory
+object. It is created and written by the producer (for example, an ingest service), using the
+``dali::shm_ring::Producer`` class from the DALI core library or its Python counterpart,
+``nvidia.dali.backend.ShmRingProducer``; the ring must exist when the pipeline is built.
+
+The batches are not copied - the output of the operator is a view of the ring slot and the slot
+is returned to the producer only after the pipeline stops using the data. When all the slots
+are in use, the producer has to wait, so the pipeline throttles the producer rather than
+buffering the data. The number of slots should exceed the prefetch queue depth of the pipeline.
+
+When the output is consumed by a GPU operator, the data is copied to pinned memory and the slot
+is released immediately.
+
+When the producer closes the ring, the pipeline raises ``StopIteration`` after the remaining
+batches are read.)code")
+    .NumInput(0)
+    .NumOutput(1)
+    .AddArg("ring_name", R"code(The name of the shared memory object of the ring,
+for example ``"/my_ring"``.)code", DALI_STRING)
+    .AddOptionalArg("blocking", R"code(If ``True``, the operator waits until the producer
+publishes the next batch.
+If ``False``, the operator raises an error if the batch is not ready.)code", true)
+    .AddOptionalTypeArg("dtype", R"code(The expected type of the data.
+
+If provided, the type of the batches read from the ring is validated.)code")
+    .AddOptionalArg<int>("ndim", R"code(The expected number of dimensions of the data.
+
+Number of dimensions can be also inferred from the ``layout`` argument if provided.)code",
+                         nullptr)
+    .AddOptionalArg<TensorLayout>("layout", R"code(The layout of the data.
+
+If the producer specifies the layout of a batch, it must match this value.)code", nullptr)
+    .AddParent("InputOperatorBase");
+
+ShmRingInput::ShmRingInput(const OpSpec &spec)
+    : InputOperator<CPUBackend>(spec),
+      consumer_(std::make_shared<shm_ring::Consumer>(spec.GetArgument<std::string>("ring_name"))) {
+  spec.TryGetArgument(dtype_, "dtype");
+  if (spec.TryGetArgument(ndim_, "ndim")) {
+    DALI_ENFORCE(ndim_ >= 0, make_string("Incorrect number of dimensions (", ndim_,
+                 "). Use positive values for tensors or 0 for scalars."));
+  }
+  spec.TryGetArgument(layout_, "layout");
+  if (!layout_.empty()) {
+    DALI_ENFORCE(ndim_ == -1 || ndim_ == layout_.ndim(), make_string(
+        "Number of dimensions in the provided layout does not match the ndim argument. "
+        "The arguments provided:\n ndim = ", ndim_, ",\n layout: \"", layout_, "\"."));
+    ndim_ = layout_.ndim();
+  }
+  // Start with the batches which haven't been consumed yet.
+  prophet_ = read_pos_ = consumer_->first_unreleased();
+}
+
+ShmRingInput::~ShmRingInput() {
+  consumer_->Interrupt();
+}
+
+void ShmRingInput::BreakWaiting() {
+  InputOperator<CPUBackend>::BreakWaiting();
+  consumer_->Interrupt();
+}
+
+void ShmRingInput::WaitForBatch(uint32_t seq) {
+  auto timeout = blocking_ ? std::chrono::microseconds::max() : std::chrono::microseconds(0);
+  if (consumer_->WaitForBatch(seq, timeout))
+    return;
+  if (consumer_->closed())
+    throw DaliStopIteration(make_string("The ring \"", consumer_->name(), "\" is closed."));
+  if (!blocking_)
+    DALI_FAIL(make_string("No data is available in the ring \"", consumer_->name(), "\"."));
+  DALI_FAIL(make_string("Waiting for the ring \"", consumer_->name(), "\" was interrupted."));
+}
+
+int ShmRingInput::NextBatchSize() {
+  WaitForBatch(prophet_);
+  return consumer_->Get(prophet_).shape.num_samples();
+}
+
+void ShmRingInput::Advance() {
+  prophet_++;
+}
+
+void ShmRingInput::ValidateBatch(const shm_ring::BatchView &batch) const {
+  DALI_ENFORCE(dtype_ == DALI_NO_TYPE || dtype_ == batch.type, make_string(
+      "The ring \"", consumer_->name(), "\" contains data of type ", batch.type,
+      ", expected ", dtype_, "."));
+  DALI_ENFORCE(ndim_ == -1 || ndim_ == batch.shape.sample_dim(), make_string(
+      "The ring \"", consumer_->name(), "\" contains data with ", batch.shape.sample_dim(),
+      " dimensions, expected ", ndim_, "."));
+  DALI_ENFORCE(layout_.empty() || batch.layout.empty() || layout_ == batch.layout, make_string(
+      "The ring \"", consumer_->name(), "\" contains data with layout \"", batch.layout,
+      "\", expected \"", layout_, "\"."));
+}
+
+bool ShmRingInput::SetupImpl(std::vector<OutputDesc> &output_desc, const Workspace &ws) {
+  WaitForBatch(read_pos_);
+  ValidateBatch(consumer_->Get(read_pos_));
+  return false;
+}
+
+void ShmRingInput::RunImpl(Workspace &ws) {
+  auto &output = ws.Output<CPUBackend>(0);
+  uint32_t seq = read_pos_;
+  auto batch = consumer_->Get(seq);
+  const TensorLayout &layout = batch.layout.empty() ? layout_ : batch.layout;
+
+  if (output.is_pinned()) {
+    // The ring isn't pinned - copy the samples and return the slot right away.
+    output.Resize(batch.shape, batch.type);
+    output.SetLayout(layout);
+    size_t element_size = TypeTable::GetTypeInfo(batch.type).size();
+    auto &thread_pool = ws.GetThreadPool();
+    const uint8_t *src = batch.data;
+    for (int sample_id = 0; sample_id < batch.shape.num_samples(); sample_id++) {
+      size_t sample_bytes = batch.shape.tensor_size(sample_id) * element_size;
+      thread_pool.AddWork([&output, sample_id, src, sample_bytes](int) {
+        memcpy(output.raw_mutable_tensor(sample_id), src, sample_bytes);
+      }, sample_bytes);
+      src += sample_bytes;
+    }
+    thread_pool.RunAll();
+    consumer_->Release(seq);
+  } else {
+    // The slot is released when the last reference to the data is dropped. The deleter keeps
+    // the ring mapped, so the output may outlive the operator.
+    std::shared_ptr<void> data(batch.data, [consumer = consumer_, seq](void *) {
+      consumer->Release(seq);
+    });
+    output.ShareData(std::move(data), batch.size, false, batch.shape, batch.type,
+                     CPU_ONLY_DEVICE_ID, AccessOrder::host(), layout);
+  }
+  read_pos_++;
+  SetDepletedOperatorTrace(ws, consumer_->closed() &&
+                               !consumer_->WaitForBatch(read_pos_, std::chrono::microseconds(0)));
+}
+
+DALI_REGISTER_OPERATOR(experimental__inputs__SharedMemoryRing, ShmRingInput, CPU);
+
+}  // namespace dali
@@ -0,0 +1,87 @@
+// Copyright (c) 2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef DALI_OPERATORS_IO_SHM_RING_SHM_RING_INPUT_H_
+#define DALI_OPERATORS_IO_SHM_RING_SHM_RING_INPUT_H_
+
+#include <memory>
+#include <string>
+#include <vector>
+#include "dali/core/os/shm_ring.h"
+#include "dali/pipeline/operator/builtin/input_operator.h"
+
+namespace dali {
+
+/**
+ * @brief Reads batches from a single-producer/single-consumer ring in shared memory.
+ *
+ * The batches are written by an external process with shm_ring::Producer. The output is a view
+ * of the ring slot - the slot is returned to the producer when the last reference to the output
+ * (and to the batches derived from it without a copy) is dropped. When all the slots are in use,
+ * the producer waits - this is how the pipeline exerts backpressure on the producer.
+ *
+ * The operator feeds itself - it doesn't use the queue of the InputOperator.
+ */
+class ShmRingInput : public InputOperator<CPUBackend> {
+ public:
+  explicit ShmRingInput(const OpSpec &spec);
+  ~ShmRingInput() override;
+
+  int NextBatchSize() override;
+  void Advance() override;
+
+  const TensorLayout &in_layout() const override {
+    return layout_;
+  }
+
+  int in_ndim() const override {
+    return ndim_;
+  }
+
+  DALIDataType in_dtype() const override {
+    return dtype_;
+  }
+
+  void BreakWaiting() override;
+
+ protected:
+  bool SetupImpl(std::vector<OutputDesc> &output_desc, const Workspace &ws) override;
+  void RunImpl(Workspace &ws) override;
+
+ private:
+  /**
+   * @brief Waits for the batch `seq`.
+   *
+   * Throws DaliStopIteration when the producer has closed the ring and the batch will not come.
+   * If the operator is not blocking and the batch is not ready, an error is raised.
+   */
+  void WaitForBatch(uint32_t seq);
+
+  /** Checks the batch against the declared type, dimensionality and layout. */
+  void ValidateBatch(const shm_ring::BatchView &batch) const;
+
+  // Shared with the deleters of the outputs - the mapping outlives the operator
+  // while the outputs are in use.
+  std::shared_ptr<shm_ring::Consumer> consumer_;
+  uint32_t prophet_ = 0;    // the next batch reported by NextBatchSize
+  uint32_t read_pos_ = 0;   // the next batch returned by RunImpl
+
+  DALIDataType dtype_ = DALI_NO_TYPE;
+  int ndim_ = -1;
+  TensorLayout layout_;
+};
+
+}  // namespace dali
+
+#endif  // DALI_OPERATORS_IO_SHM_RING_SHM_RING_INPUT_H_
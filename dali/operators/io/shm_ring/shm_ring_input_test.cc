@@ -0,0 +1,129 @@
+// Copyright (c) 2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+#include <unistd.h>
+#include <memory>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+#include "dali/core/os/shm_ring.h"
+#include "dali/pipeline/operator/error_reporting.h"
+#include "dali/pipeline/pipeline.h"
+
+namespace dali::test {
+
+namespace {
+
+std::string RingName(const char *suffix) {
+  return make_string("/dali_shm_ring_input_test_", getpid(), "_", suffix);
+}
+
+std::unique_ptr<Pipeline> CreateRingPipeline(const std::string &ring_name, int batch_size) {
+  auto pipe = std::make_unique<Pipeline>(batch_size, 2, CPU_ONLY_DEVICE_ID);
+  pipe->AddOperator(OpSpec("experimental__inputs__SharedMemoryRing")
+                        .AddArg("device", "cpu")
+                        .AddArg("ring_name", ring_name)
+                        .AddArg("dtype", DALI_INT32)
+                        .AddArg("layout", TensorLayout("HW"))
+                        .AddOutput("data", StorageDevice::CPU), "ring");
+  pipe->Build({{"data", "cpu"}});
+  return pipe;
+}
+
+}  // namespace
+
+TEST(ShmRingInputTest, ReadBatches) {
+  constexpr int kBatchSize = 4;
+  constexpr int kNumBatches = 20;
+  constexpr int kNumSlots = 3;
+  shm_ring::Producer producer(RingName("read"), kNumSlots, 1 << 16);
+
+  std::thread producer_thread([&]() {
+    for (int i = 0; i < kNumBatches; i++) {
+      TensorListShape<> shape = uniform_list_shape(kBatchSize, TensorShape<>{ 1 + i % 3, 5 });
+      ASSERT_TRUE(producer.WaitForSlot());
+      auto *data = reinterpret_cast<int32_t *>(producer.BeginWrite(shape, DALI_INT32, "HW"));
+      for (int64_t j = 0; j < shape.num_elements(); j++)
+        data[j] = i * 1000 + j;
+      producer.Publish();
+    }
+  });
+
+  {
+    auto pipe = CreateRingPipeline(producer.name(), kBatchSize);
+    Workspace ws;
+    for (int i = 0; i < kNumBatches; i++) {
+      pipe->Run();
+      pipe->Outputs(&ws);
+      auto &out = ws.Output<CPUBackend>(0);
+      ASSERT_EQ(out.num_samples(), kBatchSize);
+      EXPECT_EQ(out.GetLayout(), "HW");
+      EXPECT_EQ(out.type(), DALI_INT32);
+      int64_t offset = 0;
+      for (int s = 0; s < kBatchSize; s++) {
+        ASSERT_EQ(out.tensor_shape(s), TensorShape<>(1 + i % 3, 5));
+        const int32_t *sample = out.tensor<int32_t>(s);
+        for (int64_t j = 0; j < out.tensor_shape(s).num_elements(); j++, offset++)
+          ASSERT_EQ(sample[j], i * 1000 + offset);
+      }
+    }
+  }
+  producer_thread.join();
+  // All the outputs are gone - all the slots must be back with the producer.
+  EXPECT_EQ(producer.free_slots(), kNumSlots);
+}
+
+TEST(ShmRingInputTest, StopIterationWhenClosed) {
+  constexpr int kNumBatches = 2;
+  shm_ring::Producer producer(RingName("closed"), kNumBatches, 4096);
+  for (int i = 0; i < kNumBatches; i++) {
+    int32_t x = i;
+    ASSERT_TRUE(producer.Push(&x, uniform_list_shape(1, TensorShape<>{1, 1}), DALI_INT32));
+  }
+  producer.Close();
+
+  auto pipe = CreateRingPipeline(producer.name(), 1);
+  Workspace ws;
+  // The batches published before closing are still read...
+  for (int i = 0; i < kNumBatches; i++) {
+    pipe->Run();
+    pipe->Outputs(&ws);
+    EXPECT_EQ(*ws.Output<CPUBackend>(0).tensor<int32_t>(0), i);
+  }
+  // ...and then the pipeline reports the end of data.
+  EXPECT_THROW({
+    pipe->Run();
+    pipe->Outputs(&ws);
+  }, DaliStopIteration);
+}
+
+TEST(ShmRingInputTest, TypeMismatch) {
+  shm_ring::Producer producer(RingName("type"), 2, 4096);
+  float x = 1;
+  ASSERT_TRUE(producer.Push(&x, uniform_list_shape(1, TensorShape<>{1, 1}), DALI_FLOAT));
+  auto pipe = CreateRingPipeline(producer.name(), 1);
+  Workspace ws;
+  EXPECT_THROW({
+    pipe->Run();
+    pipe->Outputs(&ws);
+  }, std::exception);
+}
+
+TEST(ShmRingInputTest, NoRing) {
+  EXPECT_THROW(CreateRingPipeline(RingName("missing"), 1), std::exception);
+}
+
+}  // namespace dali::test
@@ -1,4 +1,4 @@
-// Copyright (c) 2019-2022, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+// Copyright (c) 2019-2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
 //
 // Licensed under the Apache License, Version 2.0 (the "License");
 // you may not use this file except in compliance with the License.
@@ -21,44 +21,84 @@ namespace dali {
 namespace expr {
 
 template <>
-void ArithmeticGenericOp<CPUBackend>::RunImpl(Workspace &ws) {
-  PrepareSamplesPerTask<CPUBackend>(samples_per_task_, exec_order_, ws, constant_storage_, spec_);
-  auto &pool = ws.GetThreadPool();
-  ws.Output<CPUBackend>(0).SetLayout(result_layout_);
-
-  int ndim = 1;
-  for (const auto &samples : samples_per_task_) {
-    for (const auto &sample : samples) {
-      ndim = std::max(ndim, sample.output.shape.sample_dim());
+void ArithmeticGenericOp<CPUBackend>::RunFused(Workspace &ws) {
+  auto &output = ws.Output<CPUBackend>(0);
+  auto operands = fused_->Operands();
+  int batch_size = ws.GetInputBatchSize(0);
+  fused_samples_.resize(batch_size);
+  for (int s = 0; s < batch_size; s++) {
+    auto &sample = fused_samples_[s];
+    sample.output = output.raw_mutable_tensor(s);
+    sample.operands.resize(operands.size());
+    for (int o = 0; o < operands.size(); o++) {
+      auto &operand = sample.operands[o];
+      if (operands[o]->GetNodeType() == NodeType::Constant) {
+        auto &constant = dynamic_cast<const ExprConstant &>(*operands[o]);
+        operand.data = constant_storage_.GetPointer(constant.GetConstIndex(),
+                                                    constant.GetTypeId());
+        operand.scalar = true;
+      } else {
+        auto &tensor = dynamic_cast<const ExprTensor &>(*operands[o]);
+        auto &input = ws.Input<CPUBackend>(tensor.GetInputIndex());
+        operand.data = input.raw_tensor(s);
+        operand.scalar = input.tensor_shape(s).num_elements() == 1;
+      }
     }
   }
-  if (ndim == 1) {
-    std::tie(tile_cover_, tile_range_) = GetTiledCover(result_shape_, kTileSize, kTaskSize);
-  } else {
-    std::tie(tile_cover_, tile_range_) = GetOneTilePerSample(result_shape_);
-  }
 
-  int batch_size = ws.GetInputBatchSize(0);
+  auto &pool = ws.GetThreadPool();
+  std::tie(tile_cover_, tile_range_) = GetTiledCover(result_shape_, kTileSize, kTaskSize);
   for (size_t task_idx = 0; task_idx < tile_range_.size(); task_idx++) {
     pool.AddWork(
         [=](int thread_idx) {
           auto range = tile_range_[task_idx];
-          // Go over "tiles"
           for (int extent_idx = range.begin; extent_idx < range.end; extent_idx++) {
-            // Go over expression tree in some provided order
-            for (size_t i = 0; i < exec_order_.size(); i++) {
-              assert(batch_size == static_cast<int>(samples_per_task_[i].size()));
-              auto samples = make_cspan(samples_per_task_[i]);
-              exec_order_[i].impl->Execute(exec_order_[i].ctx, samples,
-                                           make_cspan(&tile_cover_[extent_idx], 1));
-            }
+            const auto &tile = tile_cover_[extent_idx];
+            fused_->Execute(fused_samples_[tile.sample_idx], tile.offset, tile.size);
           }
         },
-        -task_idx);  // FIFO order, since the work is already divided to similarly sized chunks
+        -task_idx);
   }
   pool.RunAll();
 }
 
+template <>
+void ArithmeticGenericOp<CPUBackend>::RunImpl(Workspace &ws) {
+  ws.Output<CPUBackend>(0).SetLayout(result_layout_);
+  if (use_fused_) {
+    RunFused(ws);
+    return;
+  }
+
+  PrepareSamplesPerTask<CPUBackend>(samples_per_task_, exec_order_, ws, constant_storage_, spec_,
+                                    &intermediates_);
+  auto &pool = ws.GetThreadPool();
+  int batch_size = ws.GetInputBatchSize(0);
+  // The nodes are evaluated one at a time, as a node may need the whole result of its
+  // subexpression when broadcasting it.
+  for (size_t i = 0; i < exec_order_.size(); i++) {
+    // The tiles are flat ranges of the output; multi-dimensional (broadcasting) implementations
+    // map them to the operands with strides, so the work is balanced regardless of the shapes.
+    std::tie(tile_cover_, tile_range_) =
+        GetTiledCover(exec_order_[i].ctx.node->GetShape(), kTileSize, kTaskSize);
+    for (size_t task_idx = 0; task_idx < tile_range_.size(); task_idx++) {
+      pool.AddWork(
+          [=](int thread_idx) {
+            assert(batch_size == static_cast<int>(samples_per_task_[i].size()));
+            auto samples = make_cspan(samples_per_task_[i]);
+            auto range = tile_range_[task_idx];
+            // Go over "tiles"
+            for (int extent_idx = range.begin; extent_idx < range.end; extent_idx++) {
+              exec_order_[i].impl->Execute(exec_order_[i].ctx, samples,
+                                           make_cspan(&tile_cover_[extent_idx], 1));
+            }
+          },
+          -task_idx);  // FIFO order, since the work is already divided to similarly sized chunks
+    }
+    pool.RunAll();
+  }
+}
+
 }  // namespace expr
 
 DALI_SCHEMA(ArithmeticGenericOp)
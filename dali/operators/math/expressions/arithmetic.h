@@ -1,4 +1,4 @@
-// Copyright (c) 2019-2023, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+// Copyright (c) 2019-2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
 //
 // Licensed under the Apache License, Version 2.0 (the "License");
 // you may not use this file except in compliance with the License.
@@ -19,6 +19,7 @@
 #include <memory>
 #include <string>
 #include <tuple>
+#include <type_traits>
 #include <utility>
 #include <vector>
 
@@ -30,6 +31,7 @@
 #include "dali/kernels/type_tag.h"
 #include "dali/operators/math/expressions/broadcasting.h"
 #include "dali/operators/math/expressions/arithmetic_meta.h"
+#include "dali/operators/math/expressions/expression_fused_cpu.h"
 #include "dali/operators/math/expressions/expression_impl_factory.h"
 #include "dali/pipeline/operator/checkpointing/stateless_operator.h"
 
@@ -69,21 +71,6 @@ inline TileCover GetTiledCover(const TensorListShape<> &shape, int tile_size,
   return std::make_tuple(std::move(descs), std::move(ranges));
 }
 
-inline TileCover GetOneTilePerSample(const TensorListShape<> &shape) {
-  std::vector<TileDesc> descs;
-  descs.reserve(shape.num_samples());
-  for (int sample_idx = 0; sample_idx < shape.num_samples(); sample_idx++) {
-    descs.push_back({sample_idx, 0, shape.tensor_size(sample_idx)});
-  }
-  std::vector<TileRange> ranges;
-  int ntasks = descs.size();
-  ranges.reserve(ntasks);
-  for (int task = 0; task < ntasks; task++) {
-    ranges.push_back({task, task+1});
-  }
-  return std::make_tuple(std::move(descs), std::move(ranges));
-}
-
 /**
  * @brief Checks if the child is a (possibly improper) suffix of the parent.
  */
@@ -314,7 +301,11 @@ inline void CheckAllowedOperations(ExprNode &expr) {
  * @brief Arithmetic operator capable of executing expression tree of element-wise
  *        arithmetic operations.
  *
- * Only expressions consisting of one function node with tensor inputs are now supported.
+ * The GPU backend supports only expressions consisting of one function node.
+ *
+ * On the CPU, whole expression trees are supported. Where possible (see FusedExprCpu), the tree
+ * is evaluated in one pass over the data. Otherwise, it's evaluated one node at a time and the
+ * results of the inner nodes are stored in intermediate buffers.
  *
  * There are 3 levels for unit of work.
  * - Thread (CPUBackend) or CUDA kernel invokation (GPUBackend)
@@ -363,6 +354,8 @@ class ArithmeticGenericOp : public StatelessOperator<Backend> {
       AccessOrder order = ws.has_stream() ? ws.stream() : AccessOrder::host();
       constant_storage_.Initialize(spec_, order, constant_nodes);
       CheckAllowedOperations(*expr_);
+      if (std::is_same<Backend, CPUBackend>::value)
+        fused_ = FusedExprCpu::Create(*expr_);
       types_layout_inferred_ = true;
     }
 
@@ -379,20 +372,61 @@ class ArithmeticGenericOp : public StatelessOperator<Backend> {
  private:
   void AllocateIntermediateNodes() {
     auto &expr = *expr_;
-    bool is_simple_expression = expr.GetNodeType() == NodeType::Function &&
-                                expr.GetSubexpressionCount() > 0 &&
+    DALI_ENFORCE(expr.GetNodeType() == NodeType::Function,
+                 "The expression must contain at least one function node.");
+    bool is_simple_expression = expr.GetSubexpressionCount() > 0 &&
                                 expr.GetSubexpressionCount() <= kMaxArity;
     auto &func = dynamic_cast<ExprFunc &>(expr);
     for (int i = 0; i < func.GetSubexpressionCount(); i++) {
       is_simple_expression = is_simple_expression && func[i].GetNodeType() != NodeType::Function;
     }
 
-    DALI_ENFORCE(is_simple_expression,
-                 "Complex expression trees are not yet supported. Only expressions containing one "
-                 "function node with one or two inputs are supported.");
-    // TODO(klecki): allocate memory for intermediate results and point the threads to them
+    if (!std::is_same<Backend, CPUBackend>::value) {
+      DALI_ENFORCE(is_simple_expression,
+                   "Complex expression trees are not yet supported. Only expressions containing "
+                   "one function node with one or two inputs are supported.");
+      return;
+    }
+
+    use_fused_ = CanUseFused();
+    if (!use_fused_ && !is_simple_expression)
+      AllocateIntermediateResults(expr, true);
   }
 
+  /**
+   * @brief Checks if the fused evaluation can be used for the current shapes.
+   *
+   * The fused evaluation doesn't support broadcasting, so every tensor operand must either
+   * have the size of the output or be scalar-like.
+   */
+  bool CanUseFused() const {
+    if (!fused_)
+      return false;
+    for (auto *node : fused_->Operands()) {
+      if (node->GetNodeType() != NodeType::Tensor)
+        continue;
+      const auto &shape = node->GetShape();
+      for (int s = 0; s < shape.num_samples(); s++) {
+        auto size = shape.tensor_size(s);
+        if (size != 1 && size != result_shape_.tensor_size(s))
+          return false;
+      }
+    }
+    return true;
+  }
+
+  void AllocateIntermediateResults(const ExprNode &expr, bool is_root) {
+    if (expr.GetNodeType() != NodeType::Function)
+      return;
+    auto &func = dynamic_cast<const ExprFunc &>(expr);
+    if (!is_root)
+      intermediates_[&func].Resize(func.GetShape(), func.GetTypeId());
+    for (int i = 0; i < func.GetSubexpressionCount(); i++)
+      AllocateIntermediateResults(func[i], false);
+  }
+
+  void RunFused(Workspace &ws);
+
   std::unique_ptr<ExprNode> expr_;
   TensorListShape<> result_shape_;
   bool types_layout_inferred_ = false;
@@ -404,6 +438,10 @@ class ArithmeticGenericOp : public StatelessOperator<Backend> {
   std::vector<std::vector<SampleDesc>> samples_per_task_;
   ConstantStorage<Backend> constant_storage_;
   ExprImplCache cache_;
+  IntermediateResults<Backend> intermediates_;
+  std::unique_ptr<FusedExprCpu> fused_;
+  bool use_fused_ = false;
+  std::vector<FusedSampleDesc> fused_samples_;
   // For CPU we limit the tile size to limit the sizes of intermediate buffers
   // For GPU it's better to execute more at one time.
   static constexpr int kTileSize =
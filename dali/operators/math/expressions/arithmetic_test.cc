@@ -13,6 +13,7 @@
 // limitations under the License.
 
 #include <gtest/gtest.h>
+#include <algorithm>
 #include <string>
 #include <tuple>
 #include <utility>
@@ -21,6 +22,7 @@
 #include "dali/core/static_switch.h"
 #include "dali/operators/math/expressions/arithmetic.h"
 #include "dali/operators/math/expressions/arithmetic_meta.h"
+#include "dali/operators/math/expressions/expression_impl_cpu.h"
 #include "dali/pipeline/data/types.h"
 #include "dali/pipeline/pipeline.h"
 #include "dali/test/dali_operator_test.h"
@@ -221,9 +223,125 @@ void FillBatch(TensorList<CPUBackend> &batch, const TensorListShape<> shape) {
   }
 }
 
+/**
+ * @brief Fills the descriptor of a sample the same way ExtractSampleDescs does.
+ *        The operand shapes must have the same number of dimensions as the output.
+ *        Only the shapes of binary operations are simplified.
+ */
+SampleDesc MakeSampleDesc(void *out, const TensorShape<> &out_shape, DALIDataType dtype,
+                          const std::vector<const void *> &args,
+                          const std::vector<TensorShape<>> &arg_shapes) {
+  SampleDesc sample;
+  sample.output.data = out;
+  sample.output.dtype = dtype;
+  sample.output.shape = out_shape;
+  sample.args.resize(args.size());
+  for (size_t a = 0; a < args.size(); a++) {
+    sample.args[a].data = args[a];
+    sample.args[a].dtype = dtype;
+    sample.args[a].shape = arg_shapes[a];
+  }
+  if (args.size() == 2)
+    SimplifyShapesForBroadcasting(sample.output.shape, sample.args[0].shape,
+                                  sample.args[1].shape);
+  int ndim = sample.output.shape.sample_dim();
+  kernels::CalcStrides(sample.output.strides, sample.output.shape);
+  for (auto &arg : sample.args) {
+    ExpandToNDims(arg.shape, ndim);
+    kernels::CalcStrides(arg.strides, arg.shape);
+    arg.strides = StridesForBroadcasting(sample.output.shape, arg.shape, arg.strides);
+  }
+  return sample;
+}
+
+/**
+ * @brief Returns the offset, in a (possibly broadcast) operand, of the output element `flat`
+ */
+int64_t BroadcastOffset(const TensorShape<> &out_shape, const TensorShape<> &arg_shape,
+                        int64_t flat) {
+  int64_t offset = 0, stride = 1;
+  for (int d = out_shape.sample_dim() - 1; d >= 0; d--) {
+    int64_t idx = flat % out_shape[d];
+    flat /= out_shape[d];
+    if (arg_shape[d] > 1)
+      offset += idx * stride;
+    stride *= arg_shape[d];
+  }
+  return offset;
+}
+
+/**
+ * @brief Runs the implementation over tiles which don't match the rows of the sample
+ */
+void RunTiled(ExprImplBase &impl, const SampleDesc &sample, int tile_size) {
+  TensorListShape<> out_shape({sample.output.shape});
+  std::vector<TileDesc> tiles;
+  std::tie(tiles, std::ignore) = GetTiledCover(out_shape, tile_size, 4);
+  ExprImplContext ctx{};
+  for (auto &tile : tiles)
+    impl.Execute(ctx, make_cspan(&sample, 1), make_cspan(&tile, 1));
+}
 
 }  // namespace
 
+TEST(ArithmeticOpsTest, CpuBinaryBroadcastTiles) {
+  std::vector<std::pair<TensorShape<>, TensorShape<>>> cases = {
+    {{48, 64, 3}, {1, 1, 3}},     // trailing-axis broadcast, right
+    {{1, 1, 3}, {64, 50, 3}},     // trailing-axis broadcast, left
+    {{16, 7, 3}, {16, 1, 3}},     // broadcast in the middle
+    {{4, 5000}, {4, 1}},          // broadcast along rows longer than a tile
+    {{3, 100, 7}, {1, 100, 1}},   // both operands broadcast
+    {{2, 200}, {1, 200}},         // trailing-axis broadcast of a long row
+  };
+  ExprImplCpuTT<ArithmeticOp::sub, int, int, int> impl;
+  for (auto &c : cases) {
+    auto &left_sh = c.first;
+    auto &right_sh = c.second;
+    TensorShape<> out_sh = left_sh;
+    for (int d = 0; d < out_sh.sample_dim(); d++)
+      out_sh[d] = std::max(left_sh[d], right_sh[d]);
+
+    std::vector<int> left(volume(left_sh)), right(volume(right_sh));
+    for (auto &x : left) x = GenerateData<int>(0, 0);
+    for (auto &x : right) x = GenerateData<int>(0, 0);
+    std::vector<int> out(volume(out_sh), -1);
+
+    auto sample = MakeSampleDesc(out.data(), out_sh, DALI_INT32,
+                                 {left.data(), right.data()}, {left_sh, right_sh});
+    for (int tile_size : {1, 97, 4096}) {
+      std::fill(out.begin(), out.end(), -1);
+      RunTiled(impl, sample, tile_size);
+      for (int64_t i = 0; i < volume(out_sh); i++) {
+        int ref = left[BroadcastOffset(out_sh, left_sh, i)] -
+                  right[BroadcastOffset(out_sh, right_sh, i)];
+        ASSERT_EQ(out[i], ref) << "shapes: " << left_sh << " - " << right_sh
+                               << ", tile size: " << tile_size << ", element: " << i;
+      }
+    }
+  }
+}
+
+TEST(ArithmeticOpsTest, CpuTernaryBroadcastTiles) {
+  TensorShape<> out_sh = {50, 20, 3};
+  TensorShape<> lo_sh = {1, 20, 1};
+  TensorShape<> hi_sh = {50, 1, 3};
+  std::vector<float> in(volume(out_sh)), lo(volume(lo_sh)), hi(volume(hi_sh));
+  for (auto &x : in) x = GenerateData<float>(0, 0);
+  for (auto &x : lo) x = GenerateData<float>(0, 0) - 1024;
+  for (auto &x : hi) x = GenerateData<float>(0, 0) + 1024;
+  std::vector<float> out(volume(out_sh));
+
+  auto sample = MakeSampleDesc(out.data(), out_sh, DALI_FLOAT,
+                               {in.data(), lo.data(), hi.data()}, {out_sh, lo_sh, hi_sh});
+  ExprImplCpuTernary<ArithmeticOp::clamp, float, true, true, true> impl;
+  RunTiled(impl, sample, 97);
+  for (int64_t i = 0; i < volume(out_sh); i++) {
+    float ref = std::min(std::max(in[i], lo[BroadcastOffset(out_sh, lo_sh, i)]),
+                         hi[BroadcastOffset(out_sh, hi_sh, i)]);
+    ASSERT_EQ(out[i], ref) << "element: " << i;
+  }
+}
+
 
 
 template <typename T>
@@ -584,6 +702,79 @@ TEST(ArithmeticOpsTest, ConstantsPipeline) {
   }
 }
 
+TEST(ArithmeticOpsTest, TreePipeline) {
+  constexpr float magic_float = 0.5f;
+  constexpr int batch_size = 8;
+  constexpr int num_threads = 4;
+  constexpr int rows = 7, cols = 300;
+  Pipeline pipe(batch_size, num_threads, 0);
+
+  pipe.AddExternalInput("data0");
+  pipe.AddExternalInput("data1");
+  pipe.AddExternalInput("row");
+
+  // fused
+  pipe.AddOperator(OpSpec("ArithmeticGenericOp")
+                       .AddArg("device", "cpu")
+                       .AddArg("expression_desc", "mul(sub(&0 &1) $0:float32)")
+                       .AddArg("real_constants", std::vector<float>{magic_float})
+                       .AddInput("data0", StorageDevice::CPU)
+                       .AddInput("data1", StorageDevice::CPU)
+                       .AddOutput("result0", StorageDevice::CPU),
+                   "arithm_cpu_fused");
+
+  // integer result - evaluated node by node
+  pipe.AddOperator(OpSpec("ArithmeticGenericOp")
+                       .AddArg("device", "cpu")
+                       .AddArg("expression_desc", "add(mul(&0 &0) &1)")
+                       .AddInput("data1", StorageDevice::CPU)
+                       .AddInput("data1", StorageDevice::CPU)
+                       .AddOutput("result1", StorageDevice::CPU),
+                   "arithm_cpu_int_tree");
+
+  // broadcasting - evaluated node by node
+  pipe.AddOperator(OpSpec("ArithmeticGenericOp")
+                       .AddArg("device", "cpu")
+                       .AddArg("expression_desc", "mul(sub(&0 &1) $0:float32)")
+                       .AddArg("real_constants", std::vector<float>{magic_float})
+                       .AddInput("data0", StorageDevice::CPU)
+                       .AddInput("row", StorageDevice::CPU)
+                       .AddOutput("result2", StorageDevice::CPU),
+                   "arithm_cpu_broadcast_tree");
+
+  vector<std::pair<string, string>> outputs = {
+      {"result0", "cpu"}, {"result1", "cpu"}, {"result2", "cpu"}};
+
+  pipe.Build(outputs);
+
+  TensorList<CPUBackend> batch0, batch1, row;
+  FillBatch<float>(batch0, uniform_list_shape(batch_size, {rows, cols}));
+  FillBatch<int>(batch1, uniform_list_shape(batch_size, {rows, cols}));
+  FillBatch<float>(row, uniform_list_shape(batch_size, {1, cols}));
+
+  pipe.SetExternalInput("data0", batch0);
+  pipe.SetExternalInput("data1", batch1);
+  pipe.SetExternalInput("row", row);
+  pipe.Run();
+  Workspace ws;
+  pipe.Outputs(&ws);
+
+  for (int sample_id = 0; sample_id < batch_size; sample_id++) {
+    const auto *data0 = batch0.tensor<float>(sample_id);
+    const auto *data1 = batch1.tensor<int>(sample_id);
+    const auto *row_data = row.tensor<float>(sample_id);
+    auto *result0 = ws.Output<CPUBackend>(0).tensor<float>(sample_id);
+    auto *result1 = ws.Output<CPUBackend>(1).tensor<int32_t>(sample_id);
+    auto *result2 = ws.Output<CPUBackend>(2).tensor<float>(sample_id);
+
+    for (int i = 0; i < rows * cols; i++) {
+      EXPECT_EQ(result0[i], (data0[i] - static_cast<float>(data1[i])) * magic_float);
+      EXPECT_EQ(result1[i], data1[i] * data1[i] + data1[i]);
+      EXPECT_EQ(result2[i], (data0[i] - row_data[i % cols]) * magic_float);
+    }
+  }
+}
+
 using shape_sequence = std::vector<std::array<TensorListShape<>, 3>>;
 
 int GetBatchSize(const shape_sequence &seq) {
@@ -1,5 +1,5 @@
 
-// Copyright (c) 2019-2022, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+// Copyright (c) 2019-2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
 //
 // Licensed under the Apache License, Version 2.0 (the "License");
 // you may not use this file except in compliance with the License.
@@ -44,7 +44,7 @@ std::unique_ptr<ExprImplBase> ExprImplFactoryUnOp(const ExprFunc &expr) {
   auto input_type = expr[0].GetTypeId();
   TYPE_SWITCH(input_type, type2id, Input_t, ARITHMETIC_ALLOWED_TYPES, (
     using Out_t = typename arithm_meta<op, Backend>::template result_t<Input_t>;
-    if (expr[0].GetNodeType() == NodeType::Tensor) {
+    if (expr[0].GetNodeType() != NodeType::Constant) {
       result.reset(new ImplTensor<op, Out_t, Input_t>());
     } else {
       DALI_FAIL("Expression cannot have a constant operand");
@@ -87,8 +87,9 @@ std::unique_ptr<ExprImplBase> ExprImplFactoryBinOp(const ExprFunc &expr) {
   std::unique_ptr<ExprImplBase> result;
   auto left_type = expr[0].GetTypeId();
   auto right_type = expr[1].GetTypeId();
+  // The results of function subexpressions are tensors
   auto is_non_scalar = [](const ExprNode& node) {
-    return node.GetNodeType() == NodeType::Tensor && !IsScalarLike(node);
+    return node.GetNodeType() != NodeType::Constant && !IsScalarLike(node);
   };
   auto is_scalar = [](const ExprNode& node) {
     return IsScalarLike(node);
@@ -0,0 +1,221 @@
+// Copyright (c) 2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "dali/operators/math/expressions/expression_fused_cpu.h"
+#include <algorithm>
+#include <cassert>
+#include <memory>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include "dali/core/static_switch.h"
+#include "dali/operators/math/expressions/arithmetic_meta.h"
+#include "dali/pipeline/data/backend.h"
+
+namespace dali {
+namespace expr {
+
+namespace {
+
+/**
+ * @brief Operations which convert all their operands to the result type before computing
+ *        the result, so that converting the leaves upfront doesn't change the result.
+ */
+#define FUSED_OPS                                                                            \
+  (ArithmeticOp::plus, ArithmeticOp::minus, ArithmeticOp::exp, ArithmeticOp::sqrt,           \
+  ArithmeticOp::rsqrt, ArithmeticOp::cbrt, ArithmeticOp::log, ArithmeticOp::log2,            \
+  ArithmeticOp::log10, ArithmeticOp::abs, ArithmeticOp::fabs, ArithmeticOp::floor,           \
+  ArithmeticOp::ceil, ArithmeticOp::sin, ArithmeticOp::cos, ArithmeticOp::tan,               \
+  ArithmeticOp::asin, ArithmeticOp::acos, ArithmeticOp::atan, ArithmeticOp::sinh,            \
+  ArithmeticOp::cosh, ArithmeticOp::tanh, ArithmeticOp::asinh, ArithmeticOp::acosh,          \
+  ArithmeticOp::atanh, ArithmeticOp::add, ArithmeticOp::sub, ArithmeticOp::mul,              \
+  ArithmeticOp::div, ArithmeticOp::fdiv, ArithmeticOp::min, ArithmeticOp::max,               \
+  ArithmeticOp::pow, ArithmeticOp::fpow, ArithmeticOp::atan2, ArithmeticOp::clamp)
+
+// The number of elements processed at a time
+constexpr int kBlockSize = 128;
+// The maximum total number of operands and function nodes, each of them needs a block buffer
+constexpr int kMaxBuffers = 24;
+
+template <typename T>
+using StepFn = void (*)(T *out, const T *const *args, int n);
+
+template <typename T>
+using ConvertFn = void (*)(T *out, const void *in, int64_t offset, int n);
+
+template <ArithmeticOp op, typename T>
+void Step(T *out, const T *const *args, int n) {
+  using meta_t = arithm_meta<op, CPUBackend>;
+  constexpr int arity = GetOpArity(op);
+  const T *a = args[0];
+  if constexpr (arity == 1) {
+    static_assert(std::is_same_v<typename meta_t::template result_t<T>, T>);
+    for (int i = 0; i < n; i++)
+      out[i] = meta_t::impl(a[i]);
+  } else if constexpr (arity == 2) {  // NOLINT
+    static_assert(std::is_same_v<typename meta_t::template result_t<T, T>, T>);
+    const T *b = args[1];
+    for (int i = 0; i < n; i++)
+      out[i] = meta_t::impl(a[i], b[i]);
+  } else {
+    static_assert(std::is_same_v<typename meta_t::template result_t<T, T, T>, T>);
+    const T *b = args[1], *c = args[2];
+    for (int i = 0; i < n; i++)
+      out[i] = meta_t::impl(a[i], b[i], c[i]);
+  }
+}
+
+template <typename T, typename In>
+void Convert(T *out, const void *in, int64_t offset, int n) {
+  const In *src = static_cast<const In *>(in) + offset;
+  for (int i = 0; i < n; i++)
+    out[i] = static_cast<T>(src[i]);
+}
+
+template <typename T>
+class FusedExprCpuImpl : public FusedExprCpu {
+ public:
+  bool Build(const ExprNode &root) {
+    int ref;
+    return AddNode(root, ref);
+  }
+
+  void Execute(const FusedSampleDesc &sample, int64_t offset, int64_t extent) const override {
+    int num_operands = converters_.size();
+    int num_nodes = nodes_.size();
+    assert(static_cast<int>(sample.operands.size()) == num_operands);
+    T buffers[kMaxBuffers][kBlockSize];
+    const T *operand_data[kMaxBuffers];
+    const T *node_data[kMaxBuffers];
+
+    // Scalars are broadcast to the whole buffer once
+    for (int o = 0; o < num_operands; o++) {
+      auto &operand = sample.operands[o];
+      if (!operand.scalar)
+        continue;
+      T value;
+      if (converters_[o])
+        converters_[o](&value, operand.data, 0, 1);
+      else
+        value = *static_cast<const T *>(operand.data);
+      std::fill(buffers[o], buffers[o] + kBlockSize, value);
+      operand_data[o] = buffers[o];
+    }
+
+    auto *out = static_cast<T *>(sample.output);
+    for (int64_t start = offset, end = offset + extent; start < end; start += kBlockSize) {
+      int n = std::min<int64_t>(kBlockSize, end - start);
+      for (int o = 0; o < num_operands; o++) {
+        auto &operand = sample.operands[o];
+        if (operand.scalar)
+          continue;
+        if (converters_[o]) {
+          converters_[o](buffers[o], operand.data, start, n);
+          operand_data[o] = buffers[o];
+        } else {
+          operand_data[o] = static_cast<const T *>(operand.data) + start;
+        }
+      }
+      for (int k = 0; k < num_nodes; k++) {
+        auto &node = nodes_[k];
+        const T *args[kMaxArity];
+        for (int a = 0; a < node.arity; a++)
+          args[a] = node.args[a] >= 0 ? node_data[node.args[a]] : operand_data[~node.args[a]];
+        // the root is the last node and it's written directly to the output
+        T *node_out = k == num_nodes - 1 ? out + start : buffers[num_operands + k];
+        node.fn(node_out, args, n);
+        node_data[k] = node_out;
+      }
+    }
+  }
+
+ private:
+  struct Node {
+    StepFn<T> fn = nullptr;
+    int arity = 0;
+    int args[kMaxArity] = {};  // index of the node or bitwise negation of the operand index
+  };
+
+  bool AddNode(const ExprNode &expr, int &ref) {
+    if (expr.GetNodeType() != NodeType::Function) {
+      ConvertFn<T> convert = nullptr;
+      auto type = expr.GetTypeId();
+      if (type != type2id<T>::value) {
+        TYPE_SWITCH(type, type2id, In, ARITHMETIC_ALLOWED_TYPES, (
+          convert = Convert<T, In>;
+        ), return false;);  // NOLINT(whitespace/parens)
+      }
+      if (NumBuffers() >= kMaxBuffers)
+        return false;
+      ref = ~static_cast<int>(operands_.size());
+      operands_.push_back(&expr);
+      converters_.push_back(convert);
+      return true;
+    }
+
+    auto &func = dynamic_cast<const ExprFunc &>(expr);
+    if (func.GetTypeId() != type2id<T>::value)
+      return false;
+    Node node;
+    node.arity = func.GetSubexpressionCount();
+    if (node.arity < 1 || node.arity > kMaxArity)
+      return false;
+    auto op = NameToOp(func.GetFuncName());
+    if (GetOpArity(op) != node.arity)
+      return false;
+    VALUE_SWITCH(op, op_static, FUSED_OPS, (
+      node.fn = Step<op_static, T>;
+    ), return false;);  // NOLINT(whitespace/parens)
+    for (int a = 0; a < node.arity; a++) {
+      if (!AddNode(func[a], node.args[a]))
+        return false;
+    }
+    if (NumBuffers() >= kMaxBuffers)
+      return false;
+    ref = nodes_.size();
+    nodes_.push_back(node);
+    return true;
+  }
+
+  int NumBuffers() const {
+    return converters_.size() + nodes_.size();
+  }
+
+  std::vector<ConvertFn<T>> converters_;  // for each operand; nullptr if it's already of type T
+  std::vector<Node> nodes_;               // in post-order
+};
+
+}  // namespace
+
+std::unique_ptr<FusedExprCpu> FusedExprCpu::Create(const ExprNode &expr) {
+  if (expr.GetNodeType() != NodeType::Function)
+    return nullptr;
+  auto &func = dynamic_cast<const ExprFunc &>(expr);
+  bool is_single_node = true;
+  for (int i = 0; i < func.GetSubexpressionCount(); i++)
+    is_single_node = is_single_node && func[i].GetNodeType() != NodeType::Function;
+  if (is_single_node)
+    return nullptr;
+
+  std::unique_ptr<FusedExprCpu> result;
+  TYPE_SWITCH(expr.GetTypeId(), type2id, T, (float, double), (
+    auto impl = std::make_unique<FusedExprCpuImpl<T>>();
+    if (impl->Build(expr))
+      result = std::move(impl);
+  ), return nullptr;);  // NOLINT(whitespace/parens)
+  return result;
+}
+
+}  // namespace expr
+}  // namespace dali
@@ -0,0 +1,90 @@
+// Copyright (c) 2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef DALI_OPERATORS_MATH_EXPRESSIONS_EXPRESSION_FUSED_CPU_H_
+#define DALI_OPERATORS_MATH_EXPRESSIONS_EXPRESSION_FUSED_CPU_H_
+
+#include <memory>
+#include <vector>
+
+#include "dali/core/common.h"
+#include "dali/core/small_vector.h"
+#include "dali/core/span.h"
+#include "dali/operators/math/expressions/expression_tree.h"
+
+namespace dali {
+namespace expr {
+
+/**
+ * @brief A leaf of a fused expression, in one sample
+ */
+struct FusedOperand {
+  const void *data = nullptr;
+  bool scalar = false;  // a single value, broadcast over the whole sample
+};
+
+/**
+ * @brief Sample descriptor for the fused evaluation
+ */
+struct FusedSampleDesc {
+  void *output = nullptr;
+  SmallVector<FusedOperand, 8> operands;  // in the order of FusedExprCpu::Operands()
+};
+
+/**
+ * @brief Evaluates a whole expression tree over a tile, without materializing the results
+ *        of the inner nodes.
+ *
+ * The tile is processed in small blocks. For each block, the nodes are evaluated one after
+ * another by loops specialized for the operation and the type, with the intermediate results
+ * kept in buffers small enough to stay in L1 cache. Evaluating the nodes in separate loops
+ * keeps the results identical to evaluating the nodes one by one.
+ *
+ * Supported are trees in which all the function nodes compute floating point values of the
+ * same type, with operations that convert their operands to the result type. The operands
+ * must either have the shape of the output or be scalar-like - broadcasting is not supported.
+ */
+class DLL_PUBLIC FusedExprCpu {
+ public:
+  virtual ~FusedExprCpu() = default;
+
+  /**
+   * @brief Returns a fused evaluator for the expression or nullptr, if it's not supported.
+   *
+   * The types of the nodes must be already propagated. Expressions consisting of one function
+   * node are not fused. The evaluator refers to the nodes, so the tree must outlive it.
+   */
+  static std::unique_ptr<FusedExprCpu> Create(const ExprNode &expr);
+
+  /**
+   * @brief The leaves of the expression (tensor inputs and constants), in the order
+   *        in which FusedSampleDesc::operands are expected.
+   */
+  span<const ExprNode *const> Operands() const {
+    return make_cspan(operands_);
+  }
+
+  /**
+   * @brief Evaluates the expression for the elements [offset, offset + extent) of the sample.
+   */
+  virtual void Execute(const FusedSampleDesc &sample, int64_t offset, int64_t extent) const = 0;
+
+ protected:
+  std::vector<const ExprNode *> operands_;
+};
+
+}  // namespace expr
+}  // namespace dali
+
+#endif  // DALI_OPERATORS_MATH_EXPRESSIONS_EXPRESSION_FUSED_CPU_H_
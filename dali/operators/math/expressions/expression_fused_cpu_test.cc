@@ -0,0 +1,127 @@
+// Copyright (c) 2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "dali/core/small_vector.h"
+#include "dali/operators/math/expressions/arithmetic_meta.h"
+#include "dali/operators/math/expressions/expression_fused_cpu.h"
+#include "dali/operators/math/expressions/expression_tree.h"
+
+namespace dali {
+namespace expr {
+
+namespace {
+
+/**
+ * @brief Parses the expression and propagates the types, like ArithmeticGenericOp does.
+ */
+std::unique_ptr<ExprNode> ParseTyped(const std::string &desc,
+                                     const std::vector<DALIDataType> &input_types) {
+  auto expr = ParseExpressionString(desc);
+  std::function<DALIDataType(ExprNode &)> propagate = [&](ExprNode &node) {
+    if (node.GetNodeType() == NodeType::Tensor) {
+      node.SetTypeId(input_types[dynamic_cast<ExprTensor &>(node).GetInputIndex()]);
+    } else if (node.GetNodeType() == NodeType::Function) {
+      auto &func = dynamic_cast<ExprFunc &>(node);
+      SmallVector<DALIDataType, kMaxArity> types;
+      for (int i = 0; i < func.GetSubexpressionCount(); i++)
+        types.push_back(propagate(func[i]));
+      node.SetTypeId(TypePromotion(NameToOp(func.GetFuncName()), make_span(types)));
+    }
+    return node.GetTypeId();
+  };
+  propagate(*expr);
+  return expr;
+}
+
+}  // namespace
+
+TEST(FusedExprCpuTest, Eligibility) {
+  // single function node - nothing to fuse
+  EXPECT_EQ(FusedExprCpu::Create(*ParseTyped("add(&0 &1)", {DALI_FLOAT, DALI_FLOAT})), nullptr);
+  // integer result
+  EXPECT_EQ(FusedExprCpu::Create(*ParseTyped("mul(add(&0 &1) &1)", {DALI_INT32, DALI_INT32})),
+            nullptr);
+  // the comparison produces a boolean
+  EXPECT_EQ(FusedExprCpu::Create(*ParseTyped("lt(add(&0 &1) &1)", {DALI_FLOAT, DALI_FLOAT})),
+            nullptr);
+  // an integer inner node
+  EXPECT_EQ(FusedExprCpu::Create(*ParseTyped("mul(add(&0 &0) &1)", {DALI_INT32, DALI_FLOAT})),
+            nullptr);
+
+  // the evaluator refers to the nodes of the tree, so it must outlive it
+  auto expr = ParseTyped("mul(sub(&0 $0:float32) $1:float32)", {DALI_UINT8});
+  auto fused = FusedExprCpu::Create(*expr);
+  ASSERT_NE(fused, nullptr);
+  ASSERT_EQ(fused->Operands().size(), 3);
+  EXPECT_EQ(fused->Operands()[0]->GetNodeType(), NodeType::Tensor);
+  EXPECT_EQ(fused->Operands()[1]->GetNodeType(), NodeType::Constant);
+  EXPECT_EQ(fused->Operands()[2]->GetNodeType(), NodeType::Constant);
+
+  EXPECT_NE(FusedExprCpu::Create(
+      *ParseTyped("sqrt(fdiv(&0 &1))", {DALI_FLOAT64, DALI_INT16})), nullptr);
+}
+
+TEST(FusedExprCpuTest, Execute) {
+  auto expr = ParseTyped("clamp(add(mul(fdiv(sub(&0 &1) &2) $0:float32) &3) $1:float32 &4)",
+                         {DALI_UINT8, DALI_FLOAT, DALI_INT32, DALI_FLOAT, DALI_FLOAT});
+  auto fused = FusedExprCpu::Create(*expr);
+  ASSERT_NE(fused, nullptr);
+  ASSERT_EQ(fused->Operands().size(), 7);
+
+  constexpr int N = 1000;
+  std::vector<uint8_t> x(N);
+  std::vector<float> shift(N), out(N);
+  for (int i = 0; i < N; i++) {
+    x[i] = i * 7;
+    shift[i] = (i % 13) * 0.25f;
+  }
+  float mean = 127.5f, a = 0.75f, lo = -1, hi = 1.5f;
+  int32_t stddev = 64;
+
+  FusedSampleDesc sample;
+  sample.output = out.data();
+  sample.operands.resize(fused->Operands().size());
+  // operands in the order of the leaves: &0 &1 &2 $0 &3 $1 &4
+  sample.operands[0] = {x.data(), false};
+  sample.operands[1] = {&mean, true};
+  sample.operands[2] = {&stddev, true};
+  sample.operands[3] = {&a, true};
+  sample.operands[4] = {shift.data(), false};
+  sample.operands[5] = {&lo, true};
+  sample.operands[6] = {&hi, true};
+
+  // process the sample in uneven parts
+  for (int64_t offset = 0, tile = 1; offset < N; offset += tile, tile = tile * 3 + 1)
+    fused->Execute(sample, offset, std::min<int64_t>(tile, N - offset));
+
+  for (int i = 0; i < N; i++) {
+    float v = x[i] - mean;
+    v = v / static_cast<float>(stddev);
+    v = v * a;
+    v = v + shift[i];
+    v = std::min(std::max(v, lo), hi);
+    EXPECT_EQ(out[i], v) << " at index " << i;
+  }
+}
+
+}  // namespace expr
+}  // namespace dali
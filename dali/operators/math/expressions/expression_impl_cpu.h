@@ -1,4 +1,4 @@
-// Copyright (c) 2019-2022, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+// Copyright (c) 2019-2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
 //
 // Licensed under the Apache License, Version 2.0 (the "License");
 // you may not use this file except in compliance with the License.
@@ -15,6 +15,8 @@
 #ifndef DALI_OPERATORS_MATH_EXPRESSIONS_EXPRESSION_IMPL_CPU_H_
 #define DALI_OPERATORS_MATH_EXPRESSIONS_EXPRESSION_IMPL_CPU_H_
 
+#include <algorithm>
+#include <array>
 #include <vector>
 
 #include "dali/pipeline/data/types.h"
@@ -28,6 +30,59 @@
 namespace dali {
 namespace expr {
 
+namespace expression_detail {
+
+/**
+ * @brief Visits the flat range [offset, offset + extent) of a dense output of shape
+ *        `shape`, one (possibly partial) innermost row at a time.
+ *
+ * For each row, `row(out_offset, arg_offsets, length)` is called, where `arg_offsets`
+ * are the offsets of the first element of the row in each of the (possibly broadcast)
+ * operands described by `strides`.
+ */
+template <int nargs, typename RowFunc>
+void ForEachRow(int ndim, const int64_t *shape, const std::array<const int64_t *, nargs> &strides,
+                int64_t offset, int64_t extent, RowFunc &&row) {
+  if (extent <= 0)
+    return;
+  int64_t idx[6];  // see ARITHM_OPS_ALLOWED_DIMS
+  assert(ndim >= 1 && ndim <= 6);
+  std::array<int64_t, nargs> arg_offsets = {};
+  int64_t flat = offset;
+  for (int d = ndim - 1; d >= 0; d--) {
+    idx[d] = flat % shape[d];
+    flat /= shape[d];
+    for (int a = 0; a < nargs; a++)
+      arg_offsets[a] += idx[d] * strides[a][d];
+  }
+
+  int inner = ndim - 1;
+  int64_t out_offset = offset;
+  for (;;) {
+    int64_t length = std::min(shape[inner] - idx[inner], extent);
+    row(out_offset, arg_offsets, length);
+    extent -= length;
+    if (extent == 0)
+      break;
+    out_offset += length;
+    // move to the beginning of the next row
+    for (int a = 0; a < nargs; a++)
+      arg_offsets[a] -= idx[inner] * strides[a][inner];
+    idx[inner] = 0;
+    for (int d = inner - 1; d >= 0; d--) {
+      for (int a = 0; a < nargs; a++)
+        arg_offsets[a] += strides[a][d];
+      if (++idx[d] < shape[d])
+        break;
+      for (int a = 0; a < nargs; a++)
+        arg_offsets[a] -= shape[d] * strides[a][d];
+      idx[d] = 0;
+    }
+  }
+}
+
+}  // namespace expression_detail
+
 template <ArithmeticOp op, typename Result, typename Input>
 class ExprImplCpuT : public ExprImplBase {
  public:
@@ -73,21 +128,50 @@ class ExprImplCpuTT : public ExprImplBase {
 
     // Shapes are simplified so that we end up with 1D operands when both operands
     // have the same shape.
-    if (sample.args[0].shape.sample_dim() == 1) {
+    int ndim = output.shape.sample_dim();
+    if (ndim == 1) {
       assert(sample.args[1].shape.sample_dim() == 1);
       Execute(output_ptr, left_ptr, right_ptr, tile.offset, tile.size);
-    } else {
-      assert(tile.offset == 0);
-      assert(tile.size == volume(sample.output.shape));
-      Execute(output_ptr, output.shape.data(), output.strides.data(),
-              left_ptr, left.strides.data(), right_ptr, right.strides.data(),
-              sample.output.shape.sample_dim());
+      return;
     }
+
+    // A trailing-axis broadcast (e.g. an HWC image and a per-channel vector) is simplified
+    // to 2D, with short rows. Instead of visiting the rows one by one, the broadcast operand
+    // is replicated to fill a buffer and the tile is processed in long contiguous runs.
+    int64_t inner = output.shape[1];
+    if (ndim == 2 && inner <= kMaxPeriod) {
+      bool left_full = left.strides[0] == inner && left.strides[1] == 1;
+      bool right_full = right.strides[0] == inner && right.strides[1] == 1;
+      bool left_periodic = left.strides[0] == 0 && left.strides[1] == 1;
+      bool right_periodic = right.strides[0] == 0 && right.strides[1] == 1;
+      if (left_full && right_periodic) {
+        ExecutePeriodic<false>(output_ptr, left_ptr, right_ptr, inner, tile.offset, tile.size);
+        return;
+      }
+      if (left_periodic && right_full) {
+        ExecutePeriodic<true>(output_ptr, left_ptr, right_ptr, inner, tile.offset, tile.size);
+        return;
+      }
+    }
+
+    expression_detail::ForEachRow<2>(
+        ndim, output.shape.data(), {left.strides.data(), right.strides.data()},
+        tile.offset, tile.size,
+        [&](int64_t out_offset, const std::array<int64_t, 2> &arg_offsets, int64_t length) {
+          ExecuteRow(output_ptr + out_offset,
+                     left_ptr + arg_offsets[0], left.strides[ndim - 1],
+                     right_ptr + arg_offsets[1], right.strides[ndim - 1], length);
+        });
   }
 
  private:
   using meta_t = arithm_meta<op, CPUBackend>;
 
+  // The number of elements of the buffer holding the replicated broadcast operand
+  static constexpr int kPeriodicBufferSize = 256;
+  // Longer rows are processed directly
+  static constexpr int kMaxPeriod = kPeriodicBufferSize / 4;
+
   static void Execute(Result *result, const Left *l, const Right *r,
                       int64_t offset, int64_t extent) {
     int64_t end = offset + extent;
@@ -96,44 +180,62 @@ class ExprImplCpuTT : public ExprImplBase {
     }
   }
 
-  template <int ndim>
-  static void Execute(Result *out, const int64_t *out_shape, const int64_t *out_strides,
-                      const Left* in0, const int64_t *in0_strides,
-                      const Right* in1, const int64_t *in1_strides,
-                      std::integral_constant<int, ndim>) {
-    static_assert(ndim > 1);
-    for (int64_t i = 0; i < *out_shape; i++) {
-      Execute(out, out_shape + 1, out_strides + 1,
-              in0, in0_strides + 1, in1, in1_strides + 1,
-              std::integral_constant<int, ndim - 1>());
-      in0 += *in0_strides;
-      in1 += *in1_strides;
-      out += *out_strides;
+  /**
+   * @brief Processes one row; the loops for contiguous and inner-broadcast operands
+   *        are separate, so that they can be vectorized.
+   */
+  static void ExecuteRow(Result *out, const Left *l, int64_t l_stride,
+                         const Right *r, int64_t r_stride, int64_t length) {
+    if (l_stride == 1 && r_stride == 1) {
+      for (int64_t i = 0; i < length; i++)
+        out[i] = meta_t::impl(l[i], r[i]);
+    } else if (l_stride == 1 && r_stride == 0) {
+      Right r_value = *r;
+      for (int64_t i = 0; i < length; i++)
+        out[i] = meta_t::impl(l[i], r_value);
+    } else if (l_stride == 0 && r_stride == 1) {
+      Left l_value = *l;
+      for (int64_t i = 0; i < length; i++)
+        out[i] = meta_t::impl(l_value, r[i]);
+    } else {
+      for (int64_t i = 0; i < length; i++)
+        out[i] = meta_t::impl(l[i * l_stride], r[i * r_stride]);
     }
   }
 
-  static void Execute(Result *out, const int64_t *out_shape, const int64_t *out_strides,
-                      const Left* in0, const int64_t *in0_strides,
-                      const Right* in1, const int64_t *in1_strides,
-                      std::integral_constant<int, 1>) {
-    for (int64_t i = 0; i < *out_shape; i++) {
-      *out = meta_t::impl(*in0, *in1);
-      in0 += *in0_strides;
-      in1 += *in1_strides;
-      out += *out_strides;
-    }
-  }
+  /**
+   * @brief Processes the flat range [offset, offset + extent) of a 2D output, where one of
+   *        the operands has the shape of the output and the other one is a single row
+   *        of length `period`, broadcast over the outer dimension.
+   */
+  template <bool broadcast_left>
+  static void ExecutePeriodic(Result *out, const Left *l, const Right *r, int64_t period,
+                              int64_t offset, int64_t extent) {
+    using Periodic = std::conditional_t<broadcast_left, Left, Right>;
+    const Periodic *row;
+    if constexpr (broadcast_left)
+      row = l;
+    else
+      row = r;
+    Periodic buf[kPeriodicBufferSize];
+    int64_t block = kPeriodicBufferSize / period * period;
+    for (int64_t i = 0; i < block; i++)
+      buf[i] = row[i % period];
 
-  static void Execute(Result *out, const int64_t *out_shape, const int64_t *out_strides,
-                      const Left* in0, const int64_t *in0_strides,
-                      const Right* in1, const int64_t *in1_strides, int ndim) {
-    VALUE_SWITCH(ndim, Dims, ARITHM_OPS_ALLOWED_DIMS, (
-      return Execute(
-        out, out_shape, out_strides,
-        in0, in0_strides,
-        in1, in1_strides,
-        std::integral_constant<int, Dims>());
-    ), assert(false););  // NOLINT
+    int64_t end = offset + extent;
+    for (int64_t i = offset; i < end; ) {
+      int64_t phase = i % period;  // non-zero only at the start of the tile
+      int64_t n = std::min(block - phase, end - i);
+      const Periodic *p = buf + phase;
+      if constexpr (broadcast_left) {
+        for (int64_t j = 0; j < n; j++)
+          out[i + j] = meta_t::impl(p[j], r[i + j]);
+      } else {
+        for (int64_t j = 0; j < n; j++)
+          out[i + j] = meta_t::impl(l[i + j], p[j]);
+      }
+      i += n;
+    }
   }
 };
 
@@ -219,16 +321,22 @@ class ExprImplCpuTernary : public ExprImplBase {
               expression_detail::Pass<IsThirdTensor, Result>(third.data, third.dtype),
               third.dtype, tile.offset, tile.size);
     } else {
-      assert(tile.offset == 0);
-      assert(tile.size == volume(sample.output.shape));
-      Execute(output, sample.output.shape.data(), sample.output.strides.data(),
-              expression_detail::Pass<IsFirstTensor, Result>(first.data, first.dtype),
-              first.dtype, first.strides.data(),
-              expression_detail::Pass<IsSecondTensor, Result>(second.data, second.dtype),
-              second.dtype, second.strides.data(),
-              expression_detail::Pass<IsThirdTensor, Result>(third.data, third.dtype),
-              third.dtype, third.strides.data(),
-              sample.output.shape.sample_dim());
+      int ndim = sample.output.shape.sample_dim();
+      auto first_arg = expression_detail::Pass<IsFirstTensor, Result>(first.data, first.dtype);
+      auto second_arg = expression_detail::Pass<IsSecondTensor, Result>(second.data,
+                                                                         second.dtype);
+      auto third_arg = expression_detail::Pass<IsThirdTensor, Result>(third.data, third.dtype);
+      expression_detail::ForEachRow<3>(
+          ndim, sample.output.shape.data(),
+          {first.strides.data(), second.strides.data(), third.strides.data()},
+          tile.offset, tile.size,
+          [&](int64_t out_offset, const std::array<int64_t, 3> &arg_offsets, int64_t length) {
+            ExecuteRow(output + out_offset,
+                       first_arg, first.dtype, arg_offsets[0], first.strides[ndim - 1],
+                       second_arg, second.dtype, arg_offsets[1], second.strides[ndim - 1],
+                       third_arg, third.dtype, arg_offsets[2], third.strides[ndim - 1],
+                       length);
+          });
     }
   }
 
@@ -251,71 +359,24 @@ class ExprImplCpuTernary : public ExprImplBase {
     }
   }
 
-  template <int ndim>
-  static void Execute(Result *out, const int64_t *out_shape, const int64_t *out_strides,
-                      expression_detail::param_t<IsFirstTensor, Result> first,
-                      DALIDataType first_type, int64_t first_offset,
-                      const int64_t *first_strides,
-                      expression_detail::param_t<IsSecondTensor, Result> second,
-                      DALIDataType second_type, int64_t second_offset,
-                      const int64_t *second_strides,
-                      expression_detail::param_t<IsThirdTensor, Result> third,
-                      DALIDataType third_type, int64_t third_offset,
-                      const int64_t *third_strides,
-                      std::integral_constant<int, ndim>) {
-    static_assert(ndim > 1);
-    for (int64_t i = 0; i < *out_shape; i++) {
-      Execute(out, out_shape + 1, out_strides + 1,
-              first, first_type, first_offset, first_strides + 1,
-              second, second_type, second_offset, second_strides + 1,
-              third, third_type, third_offset, third_strides + 1,
-              std::integral_constant<int, ndim - 1>());
-      first_offset += *first_strides;
-      second_offset += *second_strides;
-      third_offset += *third_strides;
-      out += *out_strides;
+  static void ExecuteRow(Result *out,
+                         expression_detail::param_t<IsFirstTensor, Result> first,
+                         DALIDataType first_type, int64_t first_offset, int64_t first_stride,
+                         expression_detail::param_t<IsSecondTensor, Result> second,
+                         DALIDataType second_type, int64_t second_offset,
+                         int64_t second_stride,
+                         expression_detail::param_t<IsThirdTensor, Result> third,
+                         DALIDataType third_type, int64_t third_offset, int64_t third_stride,
+                         int64_t length) {
+    for (int64_t i = 0; i < length; i++) {
+      out[i] = meta_t::impl(expression_detail::Access<Result>(first, first_offset, first_type),
+                            expression_detail::Access<Result>(second, second_offset, second_type),
+                            expression_detail::Access<Result>(third, third_offset, third_type));
+      first_offset += first_stride;
+      second_offset += second_stride;
+      third_offset += third_stride;
     }
   }
-
-  static void Execute(Result *out, const int64_t *out_shape, const int64_t *out_strides,
-                      expression_detail::param_t<IsFirstTensor, Result> first,
-                      DALIDataType first_type, int64_t first_offset,
-                      const int64_t *first_strides,
-                      expression_detail::param_t<IsSecondTensor, Result> second,
-                      DALIDataType second_type, int64_t second_offset,
-                      const int64_t *second_strides,
-                      expression_detail::param_t<IsThirdTensor, Result> third,
-                      DALIDataType third_type, int64_t third_offset,
-                      const int64_t *third_strides,
-                      std::integral_constant<int, 1>) {
-    for (int64_t i = 0; i < *out_shape; i++) {
-      *out = meta_t::impl(expression_detail::Access<Result>(first, first_offset, first_type),
-                          expression_detail::Access<Result>(second, second_offset, second_type),
-                          expression_detail::Access<Result>(third, third_offset, third_type));
-      first_offset += *first_strides;
-      second_offset += *second_strides;
-      third_offset += *third_strides;
-      out += *out_strides;
-    }
-  }
-
-  static void Execute(Result *out, const int64_t *out_shape, const int64_t *out_strides,
-                      expression_detail::param_t<IsFirstTensor, Result> first,
-                      DALIDataType first_type, const int64_t *first_strides,
-                      expression_detail::param_t<IsSecondTensor, Result> second,
-                      DALIDataType second_type, const int64_t *second_strides,
-                      expression_detail::param_t<IsThirdTensor, Result> third,
-                      DALIDataType third_type, const int64_t *third_strides,
-                      int ndim) {
-    VALUE_SWITCH(ndim, Dims, ARITHM_OPS_ALLOWED_DIMS, (
-      return Execute(
-        out, out_shape, out_strides,
-        first, first_type, 0, first_strides,
-        second, second_type, 0, second_strides,
-        third, third_type, 0, third_strides,
-        std::integral_constant<int, Dims>());
-    ), assert(false););  // NOLINT
-  }
 };
 
 }  // namespace expr
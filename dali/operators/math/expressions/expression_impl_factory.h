@@ -1,4 +1,4 @@
-// Copyright (c) 2019-2022, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+// Copyright (c) 2019-2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
 //
 // Licensed under the Apache License, Version 2.0 (the "License");
 // you may not use this file except in compliance with the License.
@@ -131,17 +131,30 @@ struct ExprImplTask {
   ExprImplContext ctx;
 };
 
+/**
+ * @brief Results of the inner function nodes of an expression tree, when it is evaluated
+ *        one node at a time
+ */
+template <typename Backend>
+using IntermediateResults = std::map<const ExprNode *, TensorList<Backend>>;
+
 template <typename Backend>
-inline OutputData GetOutput(const ExprFunc &func, Workspace &ws, int sample_idx) {
-  auto &out = ws.Output<Backend>(0);
-  void *out_ptr = out.raw_mutable_tensor(sample_idx);
-  auto shape = out.shape()[sample_idx];
+inline OutputData GetOutput(const ExprFunc &func, Workspace &ws, int sample_idx,
+                            IntermediateResults<Backend> *intermediates = nullptr) {
+  auto *out = &ws.Output<Backend>(0);
+  if (intermediates) {
+    auto it = intermediates->find(&func);
+    if (it != intermediates->end())
+      out = &it->second;
+  }
+  void *out_ptr = out->raw_mutable_tensor(sample_idx);
+  auto shape = out->shape()[sample_idx];
   TensorShape<> strides;
   kernels::CalcStrides(strides, shape);
 
   OutputData ret;
   ret.data = out_ptr;
-  ret.dtype = out.type();
+  ret.dtype = out->type();
   ret.shape = shape;
   ret.strides = strides;
   return ret;
@@ -152,13 +165,22 @@ inline OutputData GetOutput(const ExprFunc &func, Workspace &ws, int sample_idx)
  */
 template <typename Backend>
 inline ArgPack GetArgPack(const ExprFunc &func, Workspace &ws,
-                          const ConstantStorage<Backend> &st, const OpSpec &spec, int sample_idx) {
+                          const ConstantStorage<Backend> &st, const OpSpec &spec, int sample_idx,
+                          const IntermediateResults<Backend> *intermediates = nullptr) {
   ArgPack result;
   result.resize(func.GetSubexpressionCount());
   for (int i = 0; i < func.GetSubexpressionCount(); i++) {
-    DALI_ENFORCE(func[i].GetNodeType() != NodeType::Function,
-                 "Function nodes are not supported as subexpressions");
-    if (func[i].GetNodeType() == NodeType::Constant) {
+    if (func[i].GetNodeType() == NodeType::Function) {
+      DALI_ENFORCE(intermediates != nullptr,
+                   "Function nodes are not supported as subexpressions");
+      auto it = intermediates->find(&func[i]);
+      DALI_ENFORCE(it != intermediates->end(), "The result of the subexpression is missing.");
+      auto &in = it->second;
+      result[i].data = in.raw_tensor(sample_idx);
+      result[i].dtype = in.type();
+      result[i].shape = in.tensor_shape(sample_idx);
+      kernels::CalcStrides(result[i].strides, result[i].shape);
+    } else if (func[i].GetNodeType() == NodeType::Constant) {
       const auto &constant = dynamic_cast<const ExprConstant &>(func[i]);
       result[i].data = st.GetPointer(constant.GetConstIndex(), constant.GetTypeId());
       result[i].dtype = constant.GetTypeId();
@@ -184,7 +206,8 @@ template <typename Backend>
 void ExtractSampleDescs(std::vector<SampleDesc> &out_samples,
                         const ExprFunc &func,
                         Workspace &ws, const ConstantStorage<Backend> &st,
-                        const OpSpec &spec) {
+                        const OpSpec &spec,
+                        IntermediateResults<Backend> *intermediates = nullptr) {
   int nsamples =  ws.GetInputBatchSize(0);
   out_samples.clear();
   out_samples.reserve(nsamples);
@@ -192,7 +215,8 @@ void ExtractSampleDescs(std::vector<SampleDesc> &out_samples,
     return;
 
   for (int s = 0; s < nsamples; s++) {
-    out_samples.emplace_back(GetOutput<Backend>(func, ws, s), GetArgPack(func, ws, st, spec, s));
+    out_samples.emplace_back(GetOutput<Backend>(func, ws, s, intermediates),
+                             GetArgPack(func, ws, st, spec, s, intermediates));
 
     SmallVector<TensorShape<>*, kMaxArity + 1> shape_ptrs;
     shape_ptrs.push_back(&(out_samples.back().output.shape));
@@ -230,19 +254,23 @@ void ExtractSampleDescs(std::vector<SampleDesc> &out_samples,
  * @brief Prepare data needed for execution.
  *        Fills vector of SampleDesc for every task that we have to execute, including
  *        the pointers to data, shapes, etc.
+ *
+ * @param intermediates The results of the inner function nodes, if the expression is a tree
  */
 template <typename Backend>
 void PrepareSamplesPerTask(std::vector<std::vector<SampleDesc>> &samples_per_task,
                            const std::vector<ExprImplTask> &task_exec_order,
                            Workspace &ws,
                            const ConstantStorage<Backend> &constant_storage,
-                           const OpSpec &spec) {
+                           const OpSpec &spec,
+                           IntermediateResults<Backend> *intermediates = nullptr) {
   int ntasks = task_exec_order.size();
   samples_per_task.resize(ntasks);
   for (int i = 0; i < ntasks; i++) {
     const auto &expr_task = task_exec_order[i];
     const auto &expr_func = dynamic_cast<const ExprFunc &>(*expr_task.ctx.node);
-    ExtractSampleDescs<Backend>(samples_per_task[i], expr_func, ws, constant_storage, spec);
+    ExtractSampleDescs<Backend>(samples_per_task[i], expr_func, ws, constant_storage, spec,
+                                intermediates);
   }
 }
 
@@ -0,0 +1,203 @@
+// Copyright (c) 2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <cmath>
+#include <string>
+#include <vector>
+#include "dali/core/static_switch.h"
+#include "dali/kernels/reduce/moments_cpu.h"
+#include "dali/operators/util/axes_utils.h"
+#include "dali/pipeline/data/views.h"
+#include "dali/pipeline/operator/checkpointing/op_checkpoint.h"
+#include "dali/pipeline/operator/checkpointing/snapshot_serializer.h"
+#include "dali/pipeline/operator/operator.h"
+
+#define DATASET_STATISTICS_INPUT_TYPES \
+  (uint8_t, int8_t, uint16_t, int16_t, uint32_t, int32_t, uint64_t, int64_t, float16, float, double)
+
+namespace dali {
+
+DALI_SCHEMA(DatasetStatistics)
+  .DocStr(R"code(Accumulates the mean and the standard deviation of the data over many iterations.
+
+The statistics are calculated along the specified axes (all axes by default), over all the samples
+seen so far, and returned as two outputs - the mean and the standard deviation - which can be
+passed directly as the `mean` and `stddev` arguments of :meth:`nvidia.dali.fn.normalize`.
+The outputs have the same dimensionality as the input, with an extent of 1 in the reduced axes,
+and are the same for all samples in the batch. The extents of the non-reduced axes must be the
+same in all the samples.
+
+The statistics can be collected over a fixed number of iterations (for example, one epoch),
+specified with `num_iterations`. After that, they are frozen and the input is no longer
+inspected, so the pipeline normalizes the data with dataset-wide constants. The accumulated
+state is saved in the pipeline checkpoints, so the statistics calculated once can be restored
+in the subsequent runs, without another pass over the data.
+
+The moments (count, mean and the sum of squared deviations) are calculated for each sample in
+parallel and merged in the order of samples, so the result doesn't depend on the number of
+threads.)code")
+  .NumInput(1)
+  .InputDox(0, "data", "TensorList", "The data whose statistics are collected.")
+  .NumOutput(2)
+  .SupportVolumetric()
+  .AllowSequences()
+  .MakeStateful()
+  .AddOptionalArg<std::vector<int>>("axes", R"code(Indices of the reduced dimensions.
+
+Accepted range is [-ndim, ndim-1]. Negative indices are counted from the back.
+By default, all axes are reduced.)code", nullptr)
+  .AddOptionalArg<TensorLayout>("axis_names", R"code(Names of the reduced dimensions.
+
+Axis indices are taken from the input layout, and this argument cannot be used with `axes`.)code",
+    nullptr)
+  .AddOptionalArg("ddof", R"code(Delta Degrees of Freedom for Bessel's correction.
+
+The variance is estimated as ``sum(Xi - mean)**2 / (N - ddof)``.)code", 0)
+  .AddOptionalArg("num_iterations", R"code(The number of iterations after which the statistics
+are frozen.
+
+A negative value means that the statistics are updated in every iteration.)code", -1);
+
+class DatasetStatistics : public Operator<CPUBackend>, AxesHelper {
+ public:
+  explicit DatasetStatistics(const OpSpec &spec)
+  : Operator<CPUBackend>(spec), AxesHelper(spec) {
+    ddof_ = spec.GetArgument<int>("ddof");
+    num_iterations_ = spec.GetArgument<int>("num_iterations");
+    DALI_ENFORCE(ddof_ >= 0, make_string("`ddof` must not be negative, got ", ddof_));
+    DALI_ENFORCE(num_iterations_ != 0, "`num_iterations` must not be 0");
+  }
+
+  void SaveState(OpCheckpoint &cpt, AccessOrder order) override {
+    cpt.MutableCheckpointState() = state_;
+  }
+
+  void RestoreState(const OpCheckpoint &cpt) override {
+    const auto &restored = cpt.CheckpointState<kernels::MomentsSnapshot>();
+    DALI_ENFORCE(static_cast<int64_t>(restored.moments.size()) == volume(restored.shape),
+                 "The checkpointed statistics don't match their shape");
+    state_ = restored;
+    has_shape_ = state_.iterations > 0;
+    UpdateResult();
+  }
+
+  std::string SerializeCheckpoint(const OpCheckpoint &cpt) const override {
+    return SnapshotSerializer().Serialize(cpt.CheckpointState<kernels::MomentsSnapshot>());
+  }
+
+  void DeserializeCheckpoint(OpCheckpoint &cpt, const std::string &data) const override {
+    cpt.MutableCheckpointState() =
+        SnapshotSerializer().Deserialize<kernels::MomentsSnapshot>(data);
+  }
+
+ protected:
+  bool SetupImpl(std::vector<OutputDesc> &output_desc, const Workspace &ws) override {
+    const auto &input = ws.Input<CPUBackend>(0);
+    const auto &in_shape = input.shape();
+    int nsamples = in_shape.num_samples();
+    int ndim = in_shape.sample_dim();
+    PrepareAxes(input.GetLayout(), ndim);
+
+    if (!Frozen()) {
+      for (int i = 0; i < nsamples; i++) {
+        auto shape = kernels::MomentsShape(in_shape[i], make_cspan(axes_));
+        if (!has_shape_) {
+          state_.shape = shape;
+          state_.moments.resize(volume(shape));
+          has_shape_ = true;
+        }
+        DALI_ENFORCE(shape == state_.shape, make_string(
+          "The extents of the non-reduced dimensions must be the same in all samples. Got "
+          "a sample of shape ", in_shape[i], " while the statistics have a shape of ",
+          state_.shape));
+      }
+    }
+    DALI_ENFORCE(has_shape_, "Cannot produce the statistics - no data has been seen.");
+    DALI_ENFORCE(state_.shape.sample_dim() == ndim, make_string(
+      "The input has ", ndim, " dimensions, but the statistics were calculated for data with ",
+      state_.shape.sample_dim(), " dimensions."));
+
+    output_desc.resize(2);
+    for (auto &desc : output_desc) {
+      desc.type = DALI_FLOAT;
+      desc.shape = uniform_list_shape(nsamples, state_.shape);
+    }
+    return true;
+  }
+
+  void RunImpl(Workspace &ws) override {
+    const auto &input = ws.Input<CPUBackend>(0);
+    if (!Frozen()) {
+      TYPE_SWITCH(input.type(), type2id, T, DATASET_STATISTICS_INPUT_TYPES, (
+        Accumulate<T>(ws);
+      ), DALI_FAIL(make_string("DatasetStatistics: unsupported input type: ",  // NOLINT
+                               input.type())));
+      state_.iterations++;
+      UpdateResult();
+    }
+
+    auto &mean_out = ws.Output<CPUBackend>(0);
+    auto &stddev_out = ws.Output<CPUBackend>(1);
+    for (int i = 0; i < mean_out.num_samples(); i++) {
+      std::copy(mean_.begin(), mean_.end(), mean_out.mutable_tensor<float>(i));
+      std::copy(stddev_.begin(), stddev_.end(), stddev_out.mutable_tensor<float>(i));
+    }
+    mean_out.SetLayout(input.GetLayout());
+    stddev_out.SetLayout(input.GetLayout());
+  }
+
+ private:
+  bool Frozen() const {
+    return num_iterations_ > 0 && state_.iterations >= num_iterations_;
+  }
+
+  template <typename T>
+  void Accumulate(Workspace &ws) {
+    auto in_view = view<const T>(ws.Input<CPUBackend>(0));
+    int nsamples = in_view.num_samples();
+    int64_t nmoments = state_.moments.size();
+    partial_.resize(nsamples);
+    auto &tp = ws.GetThreadPool();
+    for (int i = 0; i < nsamples; i++) {
+      partial_[i].resize(nmoments);
+      tp.AddWork([&, i](int) {
+        kernels::CalcMoments(make_span(partial_[i]), in_view[i], make_cspan(axes_));
+      }, in_view.shape.tensor_size(i));
+    }
+    tp.RunAll();
+    // merge in a fixed order, for deterministic results
+    for (int i = 0; i < nsamples; i++)
+      kernels::MergeMoments(make_span(state_.moments), make_cspan(partial_[i]));
+  }
+
+  void UpdateResult() {
+    mean_.resize(state_.moments.size());
+    stddev_.resize(state_.moments.size());
+    for (size_t i = 0; i < state_.moments.size(); i++) {
+      mean_[i] = state_.moments[i].mean;
+      stddev_[i] = std::sqrt(state_.moments[i].Variance(ddof_));
+    }
+  }
+
+  int ddof_ = 0;
+  int num_iterations_ = -1;
+  bool has_shape_ = false;
+  kernels::MomentsSnapshot state_;
+  std::vector<std::vector<kernels::Moments>> partial_;
+  std::vector<float> mean_, stddev_;
+};
+
+DALI_REGISTER_OPERATOR(DatasetStatistics, DatasetStatistics, CPU);
+
+}  // namespace dali
@@ -1,4 +1,4 @@
-// Copyright (c) 2020-2024, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+// Copyright (c) 2020-2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
 //
 // Licensed under the Apache License, Version 2.0 (the "License");
 // you may not use this file except in compliance with the License.
@@ -18,6 +18,7 @@
 #include "dali/kernels/normalize/normalize_cpu.h"
 #include "dali/kernels/reduce/reduce_cpu.h"
 #include "dali/operators/math/normalize/normalize_utils.h"
+#include "dali/pipeline/util/cost_scheduler.h"
 
 namespace dali {
 
@@ -245,7 +246,7 @@ void Normalize<CPUBackend>::FoldStdDev() {
 
 template <typename OutputType, typename InputType>
 void Normalize<CPUBackend>::RunTyped(Workspace &ws) {
-  ThreadPool &tp = ws.GetThreadPool();
+  CostScheduler sched(ws.GetThreadPool());
 
   auto &input = ws.Input<CPUBackend>(0);
   TensorListView<StorageCPU, const InputType> in_view = view<const InputType>(input);
@@ -320,14 +321,14 @@ void Normalize<CPUBackend>::RunTyped(Workspace &ws) {
   if (batch_norm_) {
     if (ShouldCalcMean()) {
       for (int i = 0; i < nsamples; i++) {
-        tp.AddWork([&, i](int thread_idx) {
+        sched.AddWork(in_shape.tensor_size(i), [&, i](int thread_idx) {
           kernels::MeanCPU<float, InputType> mean;
           mean.Setup(mutable_mean[i], in_view[i], make_span(axes_));
           // Reset per-sample values, but don't postprocess
           mean.Run(true, false);
-        }, in_shape.tensor_size(i));
+        });
       }
-      tp.RunAll();
+      sched.Run();
       // Aggregate and postprocess now
       FoldMeans();
     }
@@ -335,14 +336,14 @@ void Normalize<CPUBackend>::RunTyped(Workspace &ws) {
     if (ShouldCalcStdDev()) {
       auto sample_mean = mean_view[0];
       for (int i = 0; i < nsamples; i++) {
-        tp.AddWork([&, i](int thread_idx) {
+        sched.AddWork(in_shape.tensor_size(i), [&, i](int thread_idx) {
           kernels::VarianceCPU<float, InputType> stddev;
           stddev.Setup(mutable_stddev[i], in_view[i], make_span(axes_), sample_mean);
           // Reset per-sample values, but don't postprocess
           stddev.Run(true, false);
-        }, in_shape.tensor_size(i));
+        });
       }
-      tp.RunAll();
+      sched.Run();
       // Aggregate and postprocess now - use inverse square root.
       FoldStdDev();
     }
@@ -353,7 +354,7 @@ void Normalize<CPUBackend>::RunTyped(Workspace &ws) {
 
 
   for (int i = 0; i < nsamples; i++) {
-    tp.AddWork([&, i](int thread_idx) {
+    sched.AddWork(in_shape.tensor_size(i), [&, i](int thread_idx) {
       auto sample_mean = mean_view.num_samples() == 1 || batch_norm_
                               ? mean_view[0]
                               : mean_view[i];
@@ -386,10 +387,10 @@ void Normalize<CPUBackend>::RunTyped(Workspace &ws) {
       using Kernel = kernels::NormalizeCPU<OutputType, InputType, float>;
       kmgr_.Run<Kernel>(i, ctx,
           out_view[i], in_view[i], sample_mean, sample_inv_stddev, shift_);
-    }, in_shape.tensor_size(i));
+    });
   }
 
-  tp.RunAll();
+  sched.Run();
 }
 
 
@@ -1,4 +1,4 @@
-// Copyright (c) 2020-2021, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+// Copyright (c) 2020-2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
 //
 // Licensed under the Apache License, Version 2.0 (the "License");
 // you may not use this file except in compliance with the License.
@@ -17,10 +17,15 @@
 
 #ifdef __SSE__
 #include <xmmintrin.h>
+#include <immintrin.h>
+#endif
+#ifdef __ARM_NEON
+#include <arm_neon.h>
 #endif
 #include <algorithm>
 #include "dali/core/tensor_view.h"
 #include "dali/core/math_util.h"
+#include "dali/kernels/common/cpu_dispatch.h"
 #include "dali/pipeline/data/tensor_list.h"
 
 namespace dali {
@@ -122,15 +127,24 @@ static void CalcInvStdDev(const TensorListView<StorageCPU, float> &inv,
 }
 
 /**
- * @brief Calculates `mul/sqrt(data[i] * rdiv + eps)` for nonzero argument of sqrt and 0 otherwise
- *
- * @param rdiv reciprocal of the divisor
- * @param mul scaling factor
- * @param eps epsilon added to data[i] * rdiv to avoid reciprocals of small numbers
- *
- * @remarks The scaling is split into these two values for precision.
+ * @brief Scalar variant of ScaleRSqrtKeepZero
  */
-static void ScaleRSqrtKeepZero(float *data, int64_t n, float eps, float rdiv, float mul) {
+static void ScaleRSqrtKeepZeroScalar(float *data, int64_t n, float eps, float rdiv, float mul) {
+  if (eps) {
+    for (int64_t i = 0; i < n; i++)
+      data[i] = rsqrt(data[i] * rdiv + eps) * mul;
+  } else {
+    for (int64_t i = 0; i < n; i++) {
+      float x = data[i] * rdiv;
+      data[i] = x ? rsqrt(x) * mul : 0;
+    }
+  }
+}
+
+/**
+ * @brief Baseline (SSE / NEON) variant of ScaleRSqrtKeepZero
+ */
+static void ScaleRSqrtKeepZeroBaseline(float *data, int64_t n, float eps, float rdiv, float mul) {
   int64_t i = 0;
 
 #ifdef __SSE__
@@ -178,17 +192,94 @@ static void ScaleRSqrtKeepZero(float *data, int64_t n, float eps, float rdiv, fl
       _mm_storeu_ps(&data[i], y);
     }
   }
+#elif defined(__ARM_NEON)
+  // vrsqrte is accurate to about 8 bits, so two Newton-Raphson steps are needed;
+  // vrsqrts(a, b) calculates (3 - a * b) / 2
+  float32x4_t rdivx4 = vdupq_n_f32(rdiv);
+  float32x4_t epsx4 = vdupq_n_f32(eps);
+  float32x4_t mulx4 = vdupq_n_f32(mul);
+  float32x4_t zero = vdupq_n_f32(0);
+  for (; i + 4 <= n; i += 4) {
+    float32x4_t x = vaddq_f32(vmulq_f32(vld1q_f32(&data[i]), rdivx4), epsx4);
+    uint32x4_t mask = vmvnq_u32(vceqq_f32(x, zero));
+    float32x4_t y = vrsqrteq_f32(x);
+    y = vreinterpretq_f32_u32(vandq_u32(vreinterpretq_u32_f32(y), mask));  // force zeros
+    y = vmulq_f32(y, vrsqrtsq_f32(vmulq_f32(x, y), y));
+    y = vmulq_f32(y, vrsqrtsq_f32(vmulq_f32(x, y), y));
+    vst1q_f32(&data[i], vmulq_f32(y, mulx4));
+  }
 #endif
 
-  if (eps) {
-    for (; i < n; i++)
-      data[i] = rsqrt(data[i] * rdiv + eps) * mul;
-  } else {
-    for (; i < n; i++) {
-      float x = data[i] * rdiv;
-      data[i] = x ? rsqrt(x) * mul : 0;
-    }
+  ScaleRSqrtKeepZeroScalar(data + i, n - i, eps, rdiv, mul);
+}
+
+#if DALI_X86_DISPATCH
+
+/**
+ * @brief AVX2 variant of ScaleRSqrtKeepZero
+ */
+DALI_TARGET_AVX2
+static void ScaleRSqrtKeepZeroAVX2(float *data, int64_t n, float eps, float rdiv, float mul) {
+  int64_t i = 0;
+  __m256 rdivx8 = _mm256_set1_ps(rdiv);
+  __m256 epsx8 = _mm256_set1_ps(eps);
+  __m256 mulx8 = _mm256_set1_ps(mul * 0.5f);
+  __m256 three = _mm256_set1_ps(3.0f);
+  __m256 zero = _mm256_setzero_ps();
+  for (; i + 8 <= n; i += 8) {
+    __m256 x = _mm256_fmadd_ps(_mm256_loadu_ps(&data[i]), rdivx8, epsx8);
+    __m256 mask = _mm256_cmp_ps(x, zero, _CMP_NEQ_OQ);
+    __m256 y = _mm256_and_ps(_mm256_rsqrt_ps(x), mask);
+    // one Newton-Raphson step: y * (3 - x*y*y) / 2
+    y = _mm256_mul_ps(y, _mm256_fnmadd_ps(_mm256_mul_ps(x, y), y, three));
+    _mm256_storeu_ps(&data[i], _mm256_mul_ps(y, mulx8));
   }
+  ScaleRSqrtKeepZeroBaseline(data + i, n - i, eps, rdiv, mul);
+}
+
+/**
+ * @brief AVX-512 variant of ScaleRSqrtKeepZero
+ */
+DALI_TARGET_AVX512
+static void ScaleRSqrtKeepZeroAVX512(float *data, int64_t n, float eps, float rdiv, float mul) {
+  int64_t i = 0;
+  __m512 rdivx16 = _mm512_set1_ps(rdiv);
+  __m512 epsx16 = _mm512_set1_ps(eps);
+  __m512 mulx16 = _mm512_set1_ps(mul * 0.5f);
+  __m512 three = _mm512_set1_ps(3.0f);
+  __m512 zero = _mm512_setzero_ps();
+  for (; i + 16 <= n; i += 16) {
+    __m512 x = _mm512_fmadd_ps(_mm512_loadu_ps(&data[i]), rdivx16, epsx16);
+    __mmask16 nonzero = _mm512_cmp_ps_mask(x, zero, _CMP_NEQ_OQ);
+    __m512 y = _mm512_maskz_mov_ps(nonzero, _mm512_rsqrt14_ps(x));
+    // one Newton-Raphson step: y * (3 - x*y*y) / 2
+    y = _mm512_mul_ps(y, _mm512_fnmadd_ps(_mm512_mul_ps(x, y), y, three));
+    _mm512_storeu_ps(&data[i], _mm512_mul_ps(y, mulx16));
+  }
+  ScaleRSqrtKeepZeroBaseline(data + i, n - i, eps, rdiv, mul);
+}
+
+#endif  // DALI_X86_DISPATCH
+
+/**
+ * @brief Calculates `mul/sqrt(data[i] * rdiv + eps)` for nonzero argument of sqrt and 0 otherwise
+ *
+ * @param rdiv reciprocal of the divisor
+ * @param mul scaling factor
+ * @param eps epsilon added to data[i] * rdiv to avoid reciprocals of small numbers
+ *
+ * @remarks The scaling is split into these two values for precision.
+ */
+static void ScaleRSqrtKeepZero(float *data, int64_t n, float eps, float rdiv, float mul) {
+  using Func = void (*)(float *, int64_t, float, float, float);
+  auto func = kernels::simd::IsaDispatch<Func>{
+    ScaleRSqrtKeepZeroBaseline,
+#if DALI_X86_DISPATCH
+    ScaleRSqrtKeepZeroAVX2,
+    ScaleRSqrtKeepZeroAVX512
+#endif
+  }.Select();
+  func(data, n, eps, rdiv, mul);
 }
 
 static void ScaleRSqrtKeepZero(const TensorView<StorageCPU, float> &inout,
@@ -0,0 +1,53 @@
+// Copyright (c) 2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+#include <cmath>
+#include <random>
+#include <vector>
+#include "dali/operators/math/normalize/normalize_utils.h"
+
+namespace dali {
+namespace normalize {
+namespace test {
+
+TEST(NormalizeUtilsTest, ScaleRSqrtKeepZeroAllIsas) {
+  std::mt19937_64 rng(1234);
+  std::uniform_real_distribution<float> dist(0, 1000);
+  const int64_t n = 1003;  // not a multiple of any vector size
+  std::vector<float> in(n);
+  for (auto &x : in)
+    x = dist(rng);
+  for (int64_t i = 0; i < n; i += 7)
+    in[i] = 0;
+
+  const float rdiv = 1.0f / 30, mul = 2.5f;
+  for (auto isa : kernels::simd::SupportedCpuIsas()) {
+    kernels::simd::ScopedCpuIsa scoped_isa(isa);
+    for (float eps : {0.0f, 1e-3f}) {
+      std::vector<float> out = in;
+      ScaleRSqrtKeepZero(out.data(), n, eps, rdiv, mul);
+      for (int64_t i = 0; i < n; i++) {
+        double x = static_cast<double>(in[i]) * rdiv + eps;
+        double ref = x ? mul / std::sqrt(x) : 0;
+        ASSERT_NEAR(out[i], ref, std::abs(ref) * 1e-5)
+            << "at " << i << ", eps = " << eps << ", isa = " << kernels::simd::CpuIsaName(isa);
+      }
+    }
+  }
+}
+
+}  // namespace test
+}  // namespace normalize
+}  // namespace dali
@@ -1,4 +1,4 @@
-// Copyright (c) 2019-2024, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+// Copyright (c) 2019-2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
 //
 // Licensed under the Apache License, Version 2.0 (the "License");
 // you may not use this file except in compliance with the License.
@@ -28,6 +28,10 @@ DALI_SCHEMA(DLTensorPythonFunctionImpl)
     .AddArg("function_id", R"code(Id of the python function)code", DALI_INT64)
     .AddOptionalArg("num_outputs", R"code(Number of outputs)code", 1)
     .AddArg("batch_processing", "Batch processing.", DALI_BOOL)
+    .AddOptionalArg("num_workers", R"code(Number of worker processes.
+
+If greater than 0, the function is called once per batch with the list of per-sample inputs
+and is expected to return the list of per-sample outputs.)code", 0)
     .NumInput(0, 256)
     .OutputFn([](const OpSpec &spec) {return spec.GetArgument<int>("num_outputs");})
     .AddOptionalArg<std::vector<TensorLayout>>("output_layouts",
@@ -66,6 +70,17 @@ the `synchronize_stream` flag can be set to False.
 separately for every sample in the batch.
 
 If set to True, the function will receive its arguments as lists of DLPack tensors.)code", false)
+    .AddOptionalArg("num_workers", R"code(Number of Python worker processes that run
+the function.
+
+If greater than 0, the samples of a batch are distributed among worker processes, which invoke
+the function in parallel. The inputs and outputs are passed through shared memory and the
+function receives DLPack views of it. Only CPU operators with ``batch_processing=False``
+support it.
+
+The workers are started with the pipeline's `py_start_method` when the pipeline is built (or
+when :meth:`~nvidia.dali.Pipeline.start_py_workers` is called). The function runs in
+a separate process, so it cannot rely on any state modified in the main process.)code", 0)
     .NumInput(0, 256)
     .AllowSequences()
     .SupportVolumetric()
@@ -1,4 +1,4 @@
-// Copyright (c) 2019-2024, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+// Copyright (c) 2019-2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
 //
 // Licensed under the Apache License, Version 2.0 (the "License");
 // you may not use this file except in compliance with the License.
@@ -158,6 +158,13 @@ class DLTensorPythonFunctionImpl : public StatelessOperator<Backend> {
           reinterpret_cast<PyObject*>(spec.GetArgument<int64_t>("function_id")))) {
     synchronize_stream_ = spec.GetArgument<bool>("synchronize_stream");
     batch_processing = spec.GetArgument<bool>("batch_processing");
+    num_workers_ = spec.GetArgument<int>("num_workers");
+    DALI_ENFORCE(num_workers_ >= 0, make_string(
+        "The number of workers must not be negative, got ", num_workers_, "."));
+    DALI_ENFORCE(num_workers_ == 0 || (std::is_same<Backend, CPUBackend>::value &&
+                                       !batch_processing),
+        "Python function workers can be used only by CPU operators with "
+        "``batch_processing=False``.");
     size_t num_outputs = spec.GetArgument<int>("num_outputs");
     bool listed_layouts = spec.TryGetRepeatedArgument(output_layouts_, "output_layouts");
     if (!listed_layouts && spec.HasArgument("output_layouts")) {
@@ -189,6 +196,15 @@ class DLTensorPythonFunctionImpl : public StatelessOperator<Backend> {
       if (batch_processing) {
         input_o_ = detail::PrepareDLTensorInputs<Backend>(ws);
         output_o_ = python_function(*input_o_);
+      } else if (num_workers_ > 0) {
+        // The function dispatches the samples to the worker processes and returns
+        // the list of per-sample outputs (or None)
+        input_o_ = detail::PrepareDLTensorInputsPerSample<Backend>(ws);
+        if (input_o_.size() == 0) {
+          for (int s = 0; s < curr_batch_size; ++s)
+            input_o_.append(py::list());
+        }
+        output_o_ = python_function(input_o_);
       } else {
         input_o_ = detail::PrepareDLTensorInputsPerSample<Backend>(ws);
         py::list out_batch;
@@ -237,6 +253,7 @@ class DLTensorPythonFunctionImpl : public StatelessOperator<Backend> {
   py::list input_o_;
   bool synchronize_stream_;
   bool batch_processing;
+  int num_workers_ = 0;
   std::vector<TensorLayout> output_layouts_;
 
  private:
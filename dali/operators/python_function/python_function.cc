@@ -1,4 +1,4 @@
-// Copyright (c) 2019-2024, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+// Copyright (c) 2019-2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
 //
 // Licensed under the Apache License, Version 2.0 (the "License");
 // you may not use this file except in compliance with the License.
@@ -71,7 +71,18 @@ The function should not modify input tensors.
 once per batch or separately for every sample in the batch.
 
 If set to True, the function will receive its arguments as lists of NumPy or CuPy arrays,
-for CPU and GPU backend, respectively.)code", false);
+for CPU and GPU backend, respectively.)code", false)
+        .AddOptionalArg("num_workers", R"code(Number of Python worker processes that run
+the function.
+
+If greater than 0, the samples of a batch are distributed among worker processes, which invoke
+the function in parallel, so that CPU-heavy functions are not limited by the GIL of the main
+process. The inputs and outputs are passed through shared memory and the function receives
+read-only NumPy views of it. Only CPU operators with ``batch_processing=False`` support it.
+
+The workers are started with the pipeline's `py_start_method` when the pipeline is built (or
+when :meth:`~nvidia.dali.Pipeline.start_py_workers` is called). The function runs in
+a separate process, so it cannot rely on any state modified in the main process.)code", 0);
 
 DALI_SCHEMA(TorchPythonFunction)
         .DocStr(R"code(Executes a function that is operating on Torch tensors.
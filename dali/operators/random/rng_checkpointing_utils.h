@@ -1,4 +1,4 @@
-// Copyright (c) 2023-2024, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+// Copyright (c) 2023-2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
 //
 // Licensed under the Apache License, Version 2.0 (the "License");
 // you may not use this file except in compliance with the License.
@@ -48,12 +48,11 @@ class RngCheckpointUtils<CPUBackend, BatchRNG<Rng>> {
 
   static std::string SerializeCheckpoint(const OpCheckpoint &cpt) {
     const auto &state = cpt.CheckpointState<BatchRNG<Rng>>();
-    return SnapshotSerializer().Serialize(state.ToVector());
+    return SnapshotSerializer().Serialize(state);
   }
 
   static void DeserializeCheckpoint(OpCheckpoint &cpt, const std::string &data) {
-    auto deserialized = SnapshotSerializer().Deserialize<std::vector<Rng>>(data);
-    cpt.MutableCheckpointState() = BatchRNG<Rng>::FromVector(deserialized);
+    cpt.MutableCheckpointState() = SnapshotSerializer().Deserialize<BatchRNG<Rng>>(data);
   }
 };
 
@@ -1,4 +1,4 @@
-// Copyright (c) 2017-2024, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+// Copyright (c) 2017-2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
 //
 // Licensed under the Apache License, Version 2.0 (the "License");
 // you may not use this file except in compliance with the License.
@@ -84,7 +84,12 @@ This readers produces the following outputs::
 * **image_ids** (Optional, present if argument `image_ids` is set to True)
   One element per sample, representing an image identifier.)code")
   .AddOptionalArg("preprocessed_annotations",
-    "Path to the directory with meta files that contain preprocessed COCO annotations.",
+    R"code(Path to the preprocessed COCO annotations.
+
+It can be the directory passed as `save_preprocessed_annotations_dir` or the annotation file
+saved in it. The annotation file is memory mapped and used in place, so the start-up time
+does not depend on the size of the dataset. Directories with annotations saved by older versions
+of DALI (a set of ``.dat`` files) are supported as well.)code",
     std::string())
   .DeprecateArgInFavorOf("meta_files_path", "preprocessed_annotations")  // deprecated since 0.28dev
   .AddOptionalArg("annotations_file",
@@ -154,8 +159,8 @@ The paths to be kept should match exactly those in the annotations file.
 Note: This argument is mutually exclusive with `preprocessed_annotations`.)code", nullptr)
   .DeprecateArgInFavorOf("save_img_ids", "image_ids")  // deprecated since 0.28dev
   .AddOptionalArg("save_preprocessed_annotations",
-      R"code(If set to True, the operator saves a set of files containing binary representations of the
-preprocessed COCO annotations.)code",
+      R"code(If set to True, the operator saves the preprocessed COCO annotations in a binary file,
+which can be read back with `preprocessed_annotations`.)code",
       false)
   .DeprecateArgInFavorOf("dump_meta_files",
                          "save_preprocessed_annotations")  // deprecated since 0.28dev
@@ -310,7 +315,8 @@ void COCOReader::PixelwiseMasks(int image_idx, int* mask) {
     const auto &rle = masks_info.rles[ann_id];
     auto mask_idx = masks_info.mask_indices[ann_id];
     int label = labels_span[mask_idx];
-    rleInit(&R[label], (*rle)->h, (*rle)->w, (*rle)->m, (*rle)->cnts);
+    auto *cnts = const_cast<uint *>(masks_info.rle_counts.data() + rle.counts_offset);
+    rleInit(&R[label], rle.h, rle.w, rle.counts_size, cnts);
   }
 
   // Merge each label (from multi-polygons annotations)
@@ -0,0 +1,250 @@
+// Copyright (c) 2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "dali/operators/reader/loader/audio_pcm_cache.h"
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <atomic>
+#include <cerrno>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <system_error>
+#include <utility>
+#include "dali/core/error_handling.h"
+#include "dali/core/format.h"
+#include "dali/core/util.h"
+#include "dali/pipeline/data/types.h"
+
+namespace dali {
+
+namespace {
+
+constexpr char kMagic[8] = "DALIPCM";
+constexpr uint32_t kVersion = 1;
+constexpr int64_t kDataAlignment = 64;
+
+struct EntryHeader {
+  char magic[8];
+  uint32_t version;
+  int32_t type;
+  uint64_t key_hi, key_lo;
+  int64_t length;       // length of the fragment, in frames of the source
+  int64_t offset;       // offset of the fragment, in frames of the source
+  int32_t sample_rate;  // of the source
+  int32_t channels;     // of the source
+  int32_t ndim;
+  int32_t reserved;
+  int64_t shape[2];
+  int64_t data_size;
+};
+
+constexpr int64_t kDataOffset = align_up(static_cast<int64_t>(sizeof(EntryHeader)),
+                                         kDataAlignment);
+
+/**
+ * @brief FNV-1a hash with a custom basis and a splitmix64 finalizer; not cryptographic.
+ */
+uint64_t Hash(const std::string &data, uint64_t basis) {
+  uint64_t h = basis;
+  for (unsigned char c : data) {
+    h ^= c;
+    h *= 0x100000001b3ull;
+  }
+  h ^= h >> 30;
+  h *= 0xbf58476d1ce4e5b9ull;
+  h ^= h >> 27;
+  h *= 0x94d049bb133111ebull;
+  h ^= h >> 31;
+  return h;
+}
+
+template <typename T>
+void AppendBytes(std::string &s, const T &value) {
+  s.append(reinterpret_cast<const char *>(&value), sizeof(T));
+}
+
+int64_t DataSize(const TensorShape<> &shape, DALIDataType type) {
+  return shape.num_elements() * static_cast<int64_t>(TypeTable::GetTypeInfo(type).size());
+}
+
+bool IsValid(const EntryHeader &hdr, const AudioPcmCache::Key &key, int64_t file_size) {
+  return !std::memcmp(hdr.magic, kMagic, sizeof(kMagic)) &&
+         hdr.version == kVersion &&
+         hdr.key_hi == key.hi && hdr.key_lo == key.lo &&
+         hdr.ndim >= 1 && hdr.ndim <= 2 &&
+         hdr.data_size >= 0 && kDataOffset + hdr.data_size <= file_size;
+}
+
+/**
+ * @brief Closes the file descriptor on scope exit
+ */
+struct FdGuard {
+  explicit FdGuard(int fd) : fd(fd) {}
+  ~FdGuard() {
+    if (fd >= 0)
+      close(fd);
+  }
+  int fd;
+};
+
+bool WriteAll(int fd, const void *data, size_t size) {
+  auto *ptr = static_cast<const char *>(data);
+  while (size > 0) {
+    ssize_t n = ::write(fd, ptr, size);
+    if (n < 0) {
+      if (errno == EINTR)
+        continue;
+      return false;
+    }
+    ptr += n;
+    size -= n;
+  }
+  return true;
+}
+
+}  // namespace
+
+AudioPcmCache::AudioPcmCache(std::string directory, std::string tag)
+    : directory_(std::move(directory)), tag_(std::move(tag)) {
+  DALI_ENFORCE(!directory_.empty(), "The audio cache directory must not be empty.");
+  std::error_code ec;
+  std::filesystem::create_directories(directory_, ec);
+  DALI_ENFORCE(std::filesystem::is_directory(directory_),
+               make_string("Could not create the audio cache directory \"", directory_, "\": ",
+                           ec.message()));
+}
+
+bool AudioPcmCache::MakeKey(Key &key, const std::string &path,
+                            double offset_sec, double duration_sec) const {
+  struct stat st;
+  if (stat(path.c_str(), &st) != 0)
+    return false;
+  std::string data;
+  data.reserve(tag_.size() + path.size() + 64);
+  data += tag_;
+  data += '\0';
+  data += path;
+  data += '\0';
+  AppendBytes(data, static_cast<int64_t>(st.st_size));
+  AppendBytes(data, static_cast<int64_t>(st.st_mtim.tv_sec));
+  AppendBytes(data, static_cast<int64_t>(st.st_mtim.tv_nsec));
+  AppendBytes(data, offset_sec);
+  AppendBytes(data, duration_sec);
+  key.hi = Hash(data, 0xcbf29ce484222325ull);
+  key.lo = Hash(data, 0x84222325cbf29ce4ull);
+  return true;
+}
+
+std::string AudioPcmCache::EntryPath(const Key &key) const {
+  char name[40];
+  snprintf(name, sizeof(name), "%016llx%016llx.pcm",
+           static_cast<unsigned long long>(key.hi),  // NOLINT(runtime/int)
+           static_cast<unsigned long long>(key.lo));  // NOLINT(runtime/int)
+  return make_string(directory_, "/", name);
+}
+
+bool AudioPcmCache::ReadMetadata(const Key &key, AudioMetadata &meta, int64_t &offset) const {
+  FdGuard f(open(EntryPath(key).c_str(), O_RDONLY | O_CLOEXEC));
+  if (f.fd < 0)
+    return false;
+  struct stat st;
+  EntryHeader hdr;
+  if (fstat(f.fd, &st) != 0 ||
+      pread(f.fd, &hdr, sizeof(hdr), 0) != static_cast<ssize_t>(sizeof(hdr)) ||
+      !IsValid(hdr, key, st.st_size))
+    return false;
+  meta = {};
+  meta.length = hdr.length;
+  meta.sample_rate = hdr.sample_rate;
+  meta.channels = hdr.channels;
+  meta.channels_interleaved = true;
+  offset = hdr.offset;
+  return true;
+}
+
+bool AudioPcmCache::Read(const Key &key, SampleView<CPUBackend> out) const {
+  FdGuard f(open(EntryPath(key).c_str(), O_RDONLY | O_CLOEXEC));
+  if (f.fd < 0)
+    return false;
+  struct stat st;
+  if (fstat(f.fd, &st) != 0 || st.st_size < kDataOffset)
+    return false;
+  void *map = mmap(nullptr, st.st_size, PROT_READ, MAP_PRIVATE, f.fd, 0);
+  if (map == MAP_FAILED)
+    return false;
+  auto *hdr = static_cast<const EntryHeader *>(map);
+  bool ok = IsValid(*hdr, key, st.st_size) &&
+            hdr->type == static_cast<int32_t>(out.type()) &&
+            hdr->ndim == out.shape().sample_dim();
+  for (int d = 0; ok && d < hdr->ndim; d++)
+    ok = hdr->shape[d] == out.shape()[d];
+  ok = ok && hdr->data_size == DataSize(out.shape(), out.type());
+  if (ok) {
+    madvise(map, st.st_size, MADV_SEQUENTIAL);
+    std::memcpy(out.raw_mutable_data(), static_cast<const char *>(map) + kDataOffset,
+                hdr->data_size);
+  }
+  munmap(map, st.st_size);
+  return ok;
+}
+
+void AudioPcmCache::Write(const Key &key, const AudioMetadata &meta, int64_t offset,
+                          ConstSampleView<CPUBackend> data) const {
+  int ndim = data.shape().sample_dim();
+  if (ndim < 1 || ndim > 2)
+    return;
+
+  EntryHeader hdr = {};
+  std::memcpy(hdr.magic, kMagic, sizeof(kMagic));
+  hdr.version = kVersion;
+  hdr.type = static_cast<int32_t>(data.type());
+  hdr.key_hi = key.hi;
+  hdr.key_lo = key.lo;
+  hdr.length = meta.length;
+  hdr.offset = offset;
+  hdr.sample_rate = meta.sample_rate;
+  hdr.channels = meta.channels;
+  hdr.ndim = ndim;
+  for (int d = 0; d < ndim; d++)
+    hdr.shape[d] = data.shape()[d];
+  hdr.data_size = DataSize(data.shape(), data.type());
+
+  // Write to a uniquely named temporary file and rename it, so that concurrent readers
+  // (possibly in other processes) never see a partially written entry.
+  static std::atomic<uint64_t> tmp_counter{0};
+  std::string path = EntryPath(key);
+  std::string tmp_path = make_string(path, ".tmp.", getpid(), ".", tmp_counter++);
+  bool ok;
+  {
+    FdGuard f(open(tmp_path.c_str(), O_WRONLY | O_CREAT | O_EXCL | O_CLOEXEC, 0644));
+    if (f.fd < 0)
+      return;
+    char padding[kDataOffset - sizeof(EntryHeader) + 1] = {};
+    ok = WriteAll(f.fd, &hdr, sizeof(hdr)) &&
+         WriteAll(f.fd, padding, kDataOffset - sizeof(EntryHeader)) &&
+         WriteAll(f.fd, data.raw_data(), hdr.data_size);
+  }
+  if (ok)
+    ok = rename(tmp_path.c_str(), path.c_str()) == 0;
+  if (!ok) {
+    unlink(tmp_path.c_str());
+    DALI_WARN_ONCE(make_string("Could not write to the audio cache in \"", directory_,
+                               "\"; the affected samples will be decoded every time."));
+  }
+}
+
+}  // namespace dali
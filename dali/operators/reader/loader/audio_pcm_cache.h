@@ -0,0 +1,96 @@
+// Copyright (c) 2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef DALI_OPERATORS_READER_LOADER_AUDIO_PCM_CACHE_H_
+#define DALI_OPERATORS_READER_LOADER_AUDIO_PCM_CACHE_H_
+
+#include <cstdint>
+#include <string>
+#include "dali/core/common.h"
+#include "dali/operators/decoder/audio/audio_decoder.h"
+#include "dali/pipeline/data/backend.h"
+#include "dali/pipeline/data/sample_view.h"
+
+namespace dali {
+
+/**
+ * @brief A persistent, local-disk cache of decoded (and resampled, downmixed) audio.
+ *
+ * Each entry is a separate file in the cache directory, holding the metadata of the source
+ * recording and the decoded samples, ready to be copied to the output. Entries are read with
+ * mmap and written to a temporary file which is then renamed, so the cache can be shared by
+ * several processes.
+ *
+ * An entry is identified by a key computed from the source path, its size and modification
+ * time, the offset and duration of the fragment and a tag describing the decoding parameters
+ * (target sample rate, downmixing, etc.). Modifying the source file invalidates the entry.
+ */
+class DLL_PUBLIC AudioPcmCache {
+ public:
+  struct Key {
+    uint64_t hi = 0, lo = 0;
+  };
+
+  /**
+   * @param directory Cache directory; it's created if it doesn't exist.
+   * @param tag       Describes the decoding parameters; entries written with a different tag
+   *                  are not visible.
+   */
+  AudioPcmCache(std::string directory, std::string tag);
+
+  const std::string &directory() const {
+    return directory_;
+  }
+
+  /**
+   * @brief Computes the key of a fragment of an audio file.
+   *
+   * @return false, if the file can't be accessed
+   */
+  bool MakeKey(Key &key, const std::string &path, double offset_sec, double duration_sec) const;
+
+  /**
+   * @brief Reads the metadata of a cached entry, without mapping the data.
+   *
+   * @param meta    Metadata of the source; the length is that of the fragment, in frames.
+   * @param offset  Offset of the fragment in the source, in frames.
+   * @return false, if there's no valid entry for the key
+   */
+  bool ReadMetadata(const Key &key, AudioMetadata &meta, int64_t &offset) const;
+
+  /**
+   * @brief Copies the cached data to `out`.
+   *
+   * @return false, if there's no valid entry for the key or its shape or type don't match `out`
+   */
+  bool Read(const Key &key, SampleView<CPUBackend> out) const;
+
+  /**
+   * @brief Stores the decoded data.
+   *
+   * Failures (e.g. a full disk) are not fatal - they are reported once and the entry is skipped.
+   */
+  void Write(const Key &key, const AudioMetadata &meta, int64_t offset,
+             ConstSampleView<CPUBackend> data) const;
+
+  std::string EntryPath(const Key &key) const;
+
+ private:
+  std::string directory_;
+  std::string tag_;
+};
+
+}  // namespace dali
+
+#endif  // DALI_OPERATORS_READER_LOADER_AUDIO_PCM_CACHE_H_
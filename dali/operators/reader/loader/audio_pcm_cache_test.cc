@@ -0,0 +1,113 @@
+// Copyright (c) 2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+#include <stdlib.h>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <vector>
+#include "dali/operators/reader/loader/audio_pcm_cache.h"
+
+namespace dali {
+
+class AudioPcmCacheTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    char tmpl[] = "/tmp/dali_audio_cache_XXXXXX";
+    ASSERT_NE(mkdtemp(tmpl), nullptr);
+    dir_ = tmpl;
+    src_ = dir_ + "/source.wav";
+    std::ofstream(src_) << "not really a wav file";
+  }
+
+  void TearDown() override {
+    std::filesystem::remove_all(dir_);
+  }
+
+  std::string dir_, src_;
+};
+
+TEST_F(AudioPcmCacheTest, WriteRead) {
+  AudioPcmCache cache(dir_ + "/cache", "test");
+  AudioPcmCache::Key key;
+  ASSERT_TRUE(cache.MakeKey(key, src_, 0.5, 2.0));
+
+  AudioMetadata meta, meta_out;
+  int64_t offset_out = -1;
+  EXPECT_FALSE(cache.ReadMetadata(key, meta_out, offset_out));
+
+  std::vector<int16_t> data(300 * 2), out(300 * 2);
+  for (size_t i = 0; i < data.size(); i++)
+    data[i] = i * 7 - 1000;
+  meta.length = 300;
+  meta.sample_rate = 16000;
+  meta.channels = 2;
+  cache.Write(key, meta, 8000, ConstSampleView<CPUBackend>(data.data(), {300, 2}));
+
+  ASSERT_TRUE(cache.ReadMetadata(key, meta_out, offset_out));
+  EXPECT_EQ(meta_out.length, 300);
+  EXPECT_EQ(meta_out.sample_rate, 16000);
+  EXPECT_EQ(meta_out.channels, 2);
+  EXPECT_EQ(offset_out, 8000);
+
+  ASSERT_TRUE(cache.Read(key, SampleView<CPUBackend>(out.data(), {300, 2})));
+  EXPECT_EQ(data, out);
+
+  // shape or type mismatch
+  EXPECT_FALSE(cache.Read(key, SampleView<CPUBackend>(out.data(), {600})));
+  std::vector<float> out_f(600);
+  EXPECT_FALSE(cache.Read(key, SampleView<CPUBackend>(out_f.data(), {300, 2})));
+}
+
+TEST_F(AudioPcmCacheTest, KeyDependsOnAllInputs) {
+  AudioPcmCache cache(dir_, "a"), other_tag(dir_, "b");
+  AudioPcmCache::Key k0, k1;
+  ASSERT_TRUE(cache.MakeKey(k0, src_, 0, -1));
+  ASSERT_TRUE(cache.MakeKey(k1, src_, 0, -1));
+  EXPECT_EQ(cache.EntryPath(k0), cache.EntryPath(k1));
+
+  ASSERT_TRUE(other_tag.MakeKey(k1, src_, 0, -1));
+  EXPECT_NE(cache.EntryPath(k0), cache.EntryPath(k1));
+  ASSERT_TRUE(cache.MakeKey(k1, src_, 0.1, -1));
+  EXPECT_NE(cache.EntryPath(k0), cache.EntryPath(k1));
+  ASSERT_TRUE(cache.MakeKey(k1, src_, 0, 1));
+  EXPECT_NE(cache.EntryPath(k0), cache.EntryPath(k1));
+
+  // modifying the source file invalidates the entry
+  std::ofstream(src_, std::ios::app) << "more data";
+  ASSERT_TRUE(cache.MakeKey(k1, src_, 0, -1));
+  EXPECT_NE(cache.EntryPath(k0), cache.EntryPath(k1));
+
+  EXPECT_FALSE(cache.MakeKey(k1, dir_ + "/does_not_exist.wav", 0, -1));
+}
+
+TEST_F(AudioPcmCacheTest, CorruptedEntry) {
+  AudioPcmCache cache(dir_, "test");
+  AudioPcmCache::Key key;
+  ASSERT_TRUE(cache.MakeKey(key, src_, 0, -1));
+  std::vector<float> data(100, 0.5f);
+  AudioMetadata meta;
+  meta.length = 100;
+  meta.sample_rate = 8000;
+  meta.channels = 1;
+  cache.Write(key, meta, 0, ConstSampleView<CPUBackend>(data.data(), {100}));
+  std::filesystem::resize_file(cache.EntryPath(key), 200);  // truncated
+
+  int64_t offset;
+  EXPECT_FALSE(cache.ReadMetadata(key, meta, offset));
+  EXPECT_FALSE(cache.Read(key, SampleView<CPUBackend>(data.data(), {100})));
+}
+
+}  // namespace dali
@@ -0,0 +1,112 @@
+// Copyright (c) 2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "dali/operators/reader/loader/coco_annotation_file.h"
+#include <unistd.h>
+#include <cerrno>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include "dali/core/util.h"
+#include "dali/util/mmaped_file.h"
+
+namespace dali {
+namespace coco {
+
+constexpr char AnnotationFile::kMagic[8];
+
+void AnnotationFileWriter::Write(const std::string &path, int64_t num_images,
+                                 uint32_t flags) const {
+  using ColumnDesc = AnnotationFile::ColumnDesc;
+  AnnotationFile::Header header{};
+  std::memcpy(header.magic, AnnotationFile::kMagic, sizeof(header.magic));
+  header.version = AnnotationFile::kVersion;
+  header.num_columns = columns_.size();
+  header.num_images = num_images;
+  header.flags = flags;
+
+  const uint64_t alignment = AnnotationFile::kColumnAlignment;
+  std::vector<ColumnDesc> table(columns_.size());
+  uint64_t offset = sizeof(header) + table.size() * sizeof(ColumnDesc);
+  for (size_t i = 0; i < columns_.size(); i++) {
+    offset = align_up(offset, alignment);
+    table[i].id = static_cast<uint32_t>(columns_[i].id);
+    table[i].element_size = columns_[i].element_size;
+    table[i].offset = offset;
+    table[i].size_bytes = columns_[i].size_bytes;
+    offset += columns_[i].size_bytes;
+  }
+
+  std::string tmp_path = make_string(path, ".tmp.", getpid());
+  {
+    std::ofstream file(tmp_path, std::ios_base::binary | std::ios_base::out);
+    DALI_ENFORCE(file, "CocoReader annotation file error while saving: " + tmp_path);
+    file.write(reinterpret_cast<const char *>(&header), sizeof(header));
+    file.write(reinterpret_cast<const char *>(table.data()), table.size() * sizeof(ColumnDesc));
+    uint64_t pos = sizeof(header) + table.size() * sizeof(ColumnDesc);
+    const char padding[AnnotationFile::kColumnAlignment] = {};
+    for (size_t i = 0; i < columns_.size(); i++) {
+      file.write(padding, table[i].offset - pos);
+      file.write(static_cast<const char *>(columns_[i].data), columns_[i].size_bytes);
+      pos = table[i].offset + table[i].size_bytes;
+    }
+    DALI_ENFORCE(file.good(), make_string("Error writing to path: ", tmp_path));
+  }
+  if (std::rename(tmp_path.c_str(), path.c_str()) != 0) {
+    std::remove(tmp_path.c_str());
+    DALI_FAIL(make_string("Could not save the annotation file \"", path, "\": ",
+                          std::strerror(errno)));
+  }
+}
+
+bool AnnotationFile::IsAnnotationFile(const std::string &path) {
+  std::ifstream file(path, std::ios_base::binary);
+  if (!file)
+    return false;
+  char magic[sizeof(kMagic)];
+  file.read(magic, sizeof(magic));
+  return file.gcount() == sizeof(magic) && !std::memcmp(magic, kMagic, sizeof(magic));
+}
+
+AnnotationFile::AnnotationFile(const std::string &path) : path_(path) {
+  MmapedFileStream stream(path, false);
+  size_ = stream.Size();
+  DALI_ENFORCE(size_ >= sizeof(Header),
+               make_string("The annotation file \"", path, "\" is too short."));
+  data_ = stream.Get(size_);
+  DALI_ENFORCE(data_ != nullptr, make_string("Could not map the annotation file \"", path, "\""));
+
+  Header header;
+  std::memcpy(&header, base(), sizeof(header));
+  DALI_ENFORCE(!std::memcmp(header.magic, kMagic, sizeof(kMagic)),
+               make_string("\"", path, "\" is not a preprocessed COCO annotation file."));
+  DALI_ENFORCE(header.version == kVersion,
+               make_string("Unsupported version of the annotation file \"", path, "\": ",
+                           header.version, ". Expected: ", kVersion, "."));
+  size_t table_end = sizeof(Header) + header.num_columns * sizeof(ColumnDesc);
+  DALI_ENFORCE(table_end <= size_,
+               make_string("The annotation file \"", path, "\" is truncated."));
+  columns_ = {reinterpret_cast<const ColumnDesc *>(base() + sizeof(Header)),
+              static_cast<span_extent_t>(header.num_columns)};
+  for (auto &col : columns_) {
+    DALI_ENFORCE(col.offset % kColumnAlignment == 0 && col.offset >= table_end &&
+                 col.offset + col.size_bytes <= size_,
+                 make_string("The annotation file \"", path, "\" is corrupted or truncated."));
+  }
+  num_images_ = header.num_images;
+  flags_ = header.flags;
+}
+
+}  // namespace coco
+}  // namespace dali
@@ -0,0 +1,193 @@
+// Copyright (c) 2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef DALI_OPERATORS_READER_LOADER_COCO_ANNOTATION_FILE_H_
+#define DALI_OPERATORS_READER_LOADER_COCO_ANNOTATION_FILE_H_
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+#include "dali/core/api_helper.h"
+#include "dali/core/error_handling.h"
+#include "dali/core/span.h"
+
+namespace dali {
+namespace coco {
+
+/**
+ * @brief A run-length encoded mask. The run lengths are stored in a separate, shared array.
+ */
+struct RLEMaskDesc {
+  int32_t h, w;
+  int64_t counts_offset;  // offset of the first run length
+  int64_t counts_size;    // number of run lengths
+};
+
+/**
+ * @brief Columns of the preprocessed annotation file.
+ *
+ * The per-image columns (offsets and counts) index the per-object, per-polygon, per-vertex and
+ * per-mask columns. The values are part of the file format - don't renumber them.
+ */
+enum class AnnotationColumn : uint32_t {
+  Offsets          = 0,   // int32,   per image: index of the first object
+  Counts           = 1,   // int32,   per image: number of objects
+  Boxes            = 2,   // float32, per object: 4 coordinates
+  Labels           = 3,   // int32,   per object
+  OriginalIds      = 4,   // int32,   per image
+  Heights          = 5,   // int32,   per image
+  Widths           = 6,   // int32,   per image
+  PolygonOffsets   = 7,   // int64,   per image: index of the first polygon
+  PolygonCounts    = 8,   // int64,   per image: number of polygons
+  Polygons         = 9,   // int32x3, per polygon: mask index, first vertex, end vertex
+  VertexOffsets    = 10,  // int64,   per image: index of the first vertex
+  VertexCounts     = 11,  // int64,   per image: number of vertices
+  Vertices         = 12,  // float32x2, per vertex
+  MaskOffsets      = 13,  // int64,   per image: index of the first RLE mask
+  MaskCounts       = 14,  // int64,   per image: number of RLE masks
+  MaskIndices      = 15,  // int32,   per RLE mask: index of the object
+  RLEMasks         = 16,  // RLEMaskDesc, per RLE mask
+  RLECounts        = 17,  // uint32,  run lengths of all RLE masks
+  FilenameOffsets  = 18,  // int64,   num_images + 1 offsets in FilenameData
+  FilenameData     = 19,  // char,    concatenated file names
+};
+
+enum AnnotationFileFlags : uint32_t {
+  kHasPolygons = 1,
+  kHasPixelwiseMasks = 2,
+  kHasImageIds = 4,
+};
+
+/**
+ * @brief The name of the annotation file in the `save_preprocessed_annotations_dir` directory.
+ */
+constexpr const char kAnnotationFileName[] = "annotations.dali";
+
+/**
+ * @brief Writes a single-file, columnar representation of preprocessed COCO annotations.
+ *
+ * The file consists of a header, a table of columns and the columns themselves, each aligned to
+ * kColumnAlignment bytes, so that it can be memory mapped and used in place.
+ * The columns are not copied - the data must stay alive until `Write` is called.
+ */
+class DLL_PUBLIC AnnotationFileWriter {
+ public:
+  template <typename T>
+  void AddColumn(AnnotationColumn id, span<const T> data) {
+    static_assert(std::is_trivially_copyable<T>::value, "Columns must be trivially copyable");
+    columns_.push_back({id, sizeof(T), data.data(), static_cast<int64_t>(data.size() * sizeof(T))});
+  }
+
+  /**
+   * @brief Writes the file. The data is written to a temporary file first and renamed,
+   *        so concurrent writers (e.g. ranks of a distributed job) don't produce a broken file.
+   */
+  void Write(const std::string &path, int64_t num_images, uint32_t flags) const;
+
+ private:
+  struct Column {
+    AnnotationColumn id;
+    uint32_t element_size;
+    const void *data;
+    int64_t size_bytes;
+  };
+  std::vector<Column> columns_;
+};
+
+/**
+ * @brief A memory mapped, read-only preprocessed COCO annotation file.
+ *
+ * The columns are used in place, so the startup cost doesn't depend on the size of the dataset
+ * and processes reading the same file share its pages through the page cache.
+ */
+class DLL_PUBLIC AnnotationFile {
+ public:
+  static constexpr int kColumnAlignment = 64;
+
+  AnnotationFile() = default;
+  explicit AnnotationFile(const std::string &path);
+
+  /**
+   * @brief Checks whether the file at `path` is a preprocessed annotation file.
+   */
+  static bool IsAnnotationFile(const std::string &path);
+
+  int64_t num_images() const { return num_images_; }
+  uint32_t flags() const { return flags_; }
+
+  bool HasColumn(AnnotationColumn id) const {
+    return FindColumn(id) != nullptr;
+  }
+
+  /**
+   * @brief Returns the contents of a column or an empty span if the column is absent.
+   */
+  template <typename T>
+  span<const T> Column(AnnotationColumn id) const {
+    auto *col = FindColumn(id);
+    if (!col)
+      return {};
+    DALI_ENFORCE(col->element_size == sizeof(T) && col->size_bytes % sizeof(T) == 0,
+                 make_string("Unexpected element size in column ", static_cast<int>(id),
+                             " of the annotation file \"", path_, "\""));
+    return {reinterpret_cast<const T *>(base() + col->offset),
+            static_cast<span_extent_t>(col->size_bytes / sizeof(T))};
+  }
+
+ private:
+  struct ColumnDesc {
+    uint32_t id;
+    uint32_t element_size;
+    uint64_t offset;
+    uint64_t size_bytes;
+  };
+
+  friend class AnnotationFileWriter;
+
+  struct Header {
+    char magic[8];
+    uint32_t version;
+    uint32_t num_columns;
+    int64_t num_images;
+    uint32_t flags;
+    uint32_t reserved;
+  };
+
+  static constexpr char kMagic[8] = {'D', 'A', 'L', 'I', 'C', 'O', 'C', 'O'};
+  static constexpr uint32_t kVersion = 1;
+
+  const ColumnDesc *FindColumn(AnnotationColumn id) const {
+    for (auto &col : columns_)
+      if (col.id == static_cast<uint32_t>(id))
+        return &col;
+    return nullptr;
+  }
+
+  const char *base() const {
+    return static_cast<const char *>(data_.get());
+  }
+
+  std::string path_;
+  std::shared_ptr<void> data_;
+  size_t size_ = 0;
+  int64_t num_images_ = 0;
+  uint32_t flags_ = 0;
+  span<const ColumnDesc> columns_;
+};
+
+}  // namespace coco
+}  // namespace dali
+
+#endif  // DALI_OPERATORS_READER_LOADER_COCO_ANNOTATION_FILE_H_
@@ -0,0 +1,108 @@
+// Copyright (c) 2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include "dali/operators/reader/loader/coco_annotation_file.h"
+
+namespace dali {
+namespace coco {
+
+class AnnotationFileTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    std::string tmpl = "/tmp/coco_annotation_file_test_XXXXXX";
+    int fd = mkstemp(&tmpl[0]);
+    ASSERT_GE(fd, 0);
+    close(fd);
+    path_ = tmpl;
+  }
+
+  void TearDown() override {
+    unlink(path_.c_str());
+  }
+
+  std::string path_;
+};
+
+TEST_F(AnnotationFileTest, RoundTrip) {
+  std::vector<int> offsets = {0, 2, 2};
+  std::vector<int> counts = {2, 0, 1};
+  std::vector<float> boxes = {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12};
+  std::vector<RLEMaskDesc> masks = {{10, 20, 0, 3}, {5, 5, 3, 1}};
+  std::vector<uint32_t> rle_counts = {1, 2, 197, 25};
+  std::vector<char> empty;
+
+  AnnotationFileWriter writer;
+  writer.AddColumn(AnnotationColumn::Offsets, make_cspan(offsets));
+  writer.AddColumn(AnnotationColumn::Counts, make_cspan(counts));
+  writer.AddColumn(AnnotationColumn::Boxes, make_cspan(boxes));
+  writer.AddColumn(AnnotationColumn::RLEMasks, make_cspan(masks));
+  writer.AddColumn(AnnotationColumn::RLECounts, make_cspan(rle_counts));
+  writer.AddColumn(AnnotationColumn::FilenameData, make_cspan(empty));
+  writer.Write(path_, 3, kHasPixelwiseMasks);
+
+  ASSERT_TRUE(AnnotationFile::IsAnnotationFile(path_));
+  AnnotationFile file(path_);
+  EXPECT_EQ(file.num_images(), 3);
+  EXPECT_EQ(file.flags(), kHasPixelwiseMasks);
+
+  auto check = [&](auto column_id, const auto &expected) {
+    using T = std::remove_const_t<std::remove_reference_t<decltype(expected[0])>>;
+    auto col = file.Column<T>(column_id);
+    ASSERT_EQ(static_cast<size_t>(col.size()), expected.size());
+    EXPECT_EQ(reinterpret_cast<uintptr_t>(col.data()) % AnnotationFile::kColumnAlignment, 0u);
+    EXPECT_EQ(std::memcmp(col.data(), expected.data(), expected.size() * sizeof(T)), 0);
+  };
+  check(AnnotationColumn::Offsets, offsets);
+  check(AnnotationColumn::Counts, counts);
+  check(AnnotationColumn::Boxes, boxes);
+  check(AnnotationColumn::RLEMasks, masks);
+  check(AnnotationColumn::RLECounts, rle_counts);
+
+  EXPECT_TRUE(file.HasColumn(AnnotationColumn::FilenameData));
+  EXPECT_TRUE(file.Column<char>(AnnotationColumn::FilenameData).empty());
+  EXPECT_FALSE(file.HasColumn(AnnotationColumn::Labels));
+  EXPECT_TRUE(file.Column<int>(AnnotationColumn::Labels).empty());
+  EXPECT_THROW(file.Column<int64_t>(AnnotationColumn::Offsets), std::runtime_error);
+}
+
+TEST_F(AnnotationFileTest, NotAnAnnotationFile) {
+  {
+    std::ofstream f(path_);
+    f << "offsets and other things";
+  }
+  EXPECT_FALSE(AnnotationFile::IsAnnotationFile(path_));
+  EXPECT_THROW(AnnotationFile file(path_), std::runtime_error);
+  EXPECT_FALSE(AnnotationFile::IsAnnotationFile(path_ + "_nonexistent"));
+}
+
+TEST_F(AnnotationFileTest, Truncated) {
+  std::vector<float> boxes(1000, 1.0f);
+  AnnotationFileWriter writer;
+  writer.AddColumn(AnnotationColumn::Boxes, make_cspan(boxes));
+  writer.Write(path_, 250, 0);
+  ASSERT_EQ(truncate(path_.c_str(), 1000), 0);
+  EXPECT_THROW(AnnotationFile file(path_), std::runtime_error);
+}
+
+}  // namespace coco
+}  // namespace dali
@@ -1,4 +1,4 @@
-// Copyright (c) 2019-2024, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+// Copyright (c) 2019-2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
 //
 // Licensed under the Apache License, Version 2.0 (the "License");
 // you may not use this file except in compliance with the License.
@@ -12,15 +12,19 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
-#include <list>
+#include <sys/stat.h>
 #include <map>
+#include <optional>
 #include <unordered_map>
 #include <iomanip>
 #include <iostream>
 #include <fstream>
+#include <string_view>
 
 #include "dali/operators/reader/loader/coco_loader.h"
+#include "dali/pipeline/util/json_scan.h"
 #include "dali/pipeline/util/lookahead_parser.h"
+#include "dali/pipeline/util/thread_pool.h"
 
 namespace dali {
 namespace detail {
@@ -78,80 +82,6 @@ void Read(std::ifstream& file, span<T> data, const char* filename) {
                            " bytes but requested ", bytes, " bytes."));
 }
 
-template <typename T>
-void Write(std::ofstream& file, T data, const char* filename) {
-  file.write(reinterpret_cast<const char*>(&data), sizeof(T));
-  DALI_ENFORCE(file.good(), make_string("Error reading from path: ", filename));
-}
-
-template <typename T>
-void Write(std::ofstream& file, span<const T> data, const char* filename) {
-  if (data.empty())
-    return;
-  file.write(reinterpret_cast<const char*>(data.data()), sizeof(T) * data.size());
-  DALI_ENFORCE(file.good(), make_string("Error reading from path: ", filename));
-}
-
-template <typename T>
-void SaveToFile(const std::vector<T> &input, const std::string path) {
-  if (input.empty())
-    return;
-  std::ofstream file(path, std::ios_base::binary | std::ios_base::out);
-  DALI_ENFORCE(file, "CocoReader meta file error while saving: " + path);
-
-  unsigned size = input.size();
-  Write(file, size, path.c_str());
-  Write(file, make_cspan(input), path.c_str());
-  DALI_ENFORCE(file.good(), make_string("Error writing to path: ", path));
-}
-
-template <>
-void SaveToFile(const std::vector<RLEMaskPtr> &input, const std::string path) {
-  if (input.empty())
-    return;
-  std::ofstream file(path, std::ios_base::binary | std::ios_base::out);
-  DALI_ENFORCE(file, "CocoReader meta file error while saving: " + path);
-
-  unsigned size = input.size();
-  Write(file, size, path.c_str());
-  for (auto &rle : input) {
-    assert((*rle)->h > 0 && (*rle)->w > 0 && (*rle)->m > 0);
-    siz dims[3] = {(*rle)->h, (*rle)->w, (*rle)->m};
-    Write(file, span<const siz>{&dims[0], 3}, path.c_str());
-    Write(file, span<const uint>{(*rle)->cnts, static_cast<ptrdiff_t>((*rle)->m)}, path.c_str());
-  }
-}
-
-template <typename T>
-void SaveToFile(const std::vector<std::vector<T> > &input, const std::string path) {
-  if (input.empty())
-    return;
-  std::ofstream file(path, std::ios_base::binary | std::ios_base::out);
-  DALI_ENFORCE(file, "CocoReader meta file error while saving: " + path);
-
-  unsigned size = input.size();
-  Write(file, size, path.c_str());
-
-  for (auto& v : input) {
-    size = v.size();
-    assert(size > 0);
-    Write(file, size, path.c_str());
-    Write(file, make_cspan(v), path.c_str());
-  }
-}
-
-template <>
-void SaveToFile(const std::vector<FileLabelEntry> &entries, const std::string path) {
-  if (entries.empty())
-    return;
-  std::ofstream file(path);
-  DALI_ENFORCE(file, "CocoReader meta file error while saving: " + path);
-  for (const auto &p : entries) {
-    file << p.filename << std::endl;
-  }
-  DALI_ENFORCE(file.good(), make_string("Error writing to path: ", path));
-}
-
 template <typename T>
 void LoadFromFile(std::vector<T> &output, const std::string path) {
   std::ifstream file(path);
@@ -165,23 +95,26 @@ void LoadFromFile(std::vector<T> &output, const std::string path) {
   Read(file, make_span(output), path.c_str());
 }
 
-template <>
-void LoadFromFile(std::vector<RLEMaskPtr> &output, const std::string path) {
+void LoadRLEsFromFile(std::vector<coco::RLEMaskDesc> &masks, std::vector<uint> &counts,
+                      const std::string path) {
   std::ifstream file(path);
-  output.clear();
+  masks.clear();
+  counts.clear();
   if (!file.good())
     return;
 
   unsigned size;
   Read(file, size, path.c_str());
-  output.clear();
-  output.resize(size);
-  for (auto &rle : output) {
+  masks.resize(size);
+  for (auto &mask : masks) {
     siz dims[3];
     Read(file, span<siz>{&dims[0], 3}, path.c_str());
-    siz h = dims[0], w = dims[1], m = dims[2];
-    rle = std::make_shared<RLEMask>(h, w, m);
-    Read(file, span<uint>{(*rle)->cnts, static_cast<ptrdiff_t>((*rle)->m)}, path.c_str());
+    mask.h = dims[0];
+    mask.w = dims[1];
+    mask.counts_offset = counts.size();
+    mask.counts_size = dims[2];
+    counts.resize(counts.size() + dims[2]);
+    Read(file, span<uint>{counts.data() + mask.counts_offset, mask.counts_size}, path.c_str());
   }
 }
 
@@ -376,10 +309,73 @@ void ParseAnnotations(LookaheadParser &parser, std::vector<Annotation> &annotati
   }
 }
 
+/**
+ * @brief Parses a JSON array of objects in parallel.
+ *
+ * The array is split into chunks of whole elements (without parsing) and each chunk is parsed
+ * as a separate array by `parse_chunk(parser, chunk_output)`. The outputs of the chunks are
+ * concatenated in the original order.
+ */
+template <typename T, typename ParseChunk>
+void ParseArrayInParallel(const char *begin, const char *end, std::vector<T> &output,
+                          ThreadPool *tp, ParseChunk &&parse_chunk) {
+  std::vector<std::pair<const char *, const char *>> elements;
+  DALI_ENFORCE(ScanJsonArray(begin, end, elements), "Error parsing JSON file.");
+  if (elements.empty())
+    return;
+
+  // split into chunks of similar size in bytes
+  int max_chunks = tp ? tp->NumThreads() * 4 : 1;
+  int64_t total_bytes = elements.back().second - elements.front().first;
+  int64_t chunk_bytes = std::max<int64_t>(div_ceil(total_bytes, max_chunks), 1);
+  std::vector<std::pair<size_t, size_t>> chunks;  // ranges of element indices
+  for (size_t first = 0; first < elements.size(); ) {
+    size_t last = first + 1;
+    while (last < elements.size() &&
+           elements[last].second - elements[first].first <= chunk_bytes)
+      last++;
+    chunks.emplace_back(first, last);
+    first = last;
+  }
+
+  std::vector<std::vector<T>> chunk_outputs(chunks.size());
+  auto parse = [&](int chunk_idx) {
+    auto [first, last] = chunks[chunk_idx];
+    // the parser works in situ - copy the elements to a separate, null-terminated array
+    const char *data_begin = elements[first].first;
+    const char *data_end = elements[last - 1].second;
+    std::vector<char> buf;
+    buf.reserve(data_end - data_begin + 3);
+    buf.push_back('[');
+    buf.insert(buf.end(), data_begin, data_end);
+    buf.push_back(']');
+    buf.push_back('\0');
+    LookaheadParser parser(buf.data());
+    parse_chunk(parser, chunk_outputs[chunk_idx]);
+    DALI_ENFORCE(parser.IsValid(), "Error parsing JSON file.");
+  };
+  if (!tp || chunks.size() == 1) {
+    for (size_t c = 0; c < chunks.size(); c++)
+      parse(c);
+  } else {
+    for (size_t c = 0; c < chunks.size(); c++)
+      tp->AddWork([&, c](int) { parse(c); }, chunks[c].second - chunks[c].first);
+    tp->RunAll();
+  }
+
+  size_t total = output.size();
+  for (auto &out : chunk_outputs)
+    total += out.size();
+  output.reserve(total);
+  for (auto &out : chunk_outputs)
+    output.insert(output.end(), std::make_move_iterator(out.begin()),
+                  std::make_move_iterator(out.end()));
+}
+
 void ParseJsonFile(const OpSpec &spec, std::vector<detail::ImageInfo> &image_infos,
                    std::vector<detail::Annotation> &annotations,
                    std::map<int, int> &category_ids,
-                   bool parse_segmentation, bool parse_rle) {
+                   bool parse_segmentation, bool parse_rle, int num_threads) {
   const auto annotations_file = spec.GetArgument<string>("annotations_file");
 
   std::ifstream f(annotations_file);
@@ -394,59 +390,89 @@ void ParseJsonFile(const OpSpec &spec, std::vector<detail::ImageInfo> &image_inf
   f.read(buff.get(), file_size);
   f.close();
 
-  detail::LookaheadParser parser(buff.get());
-
-  RAPIDJSON_ASSERT(parser.PeekType() == kObjectType);
-  parser.EnterObject();
   float sz_threshold = spec.GetArgument<float>("size_threshold");
   bool include_iscrowd = spec.GetArgument<bool>("include_iscrowd");
   bool ltrb = spec.GetArgument<bool>("ltrb");
-  while (const char* key = parser.NextObjectKey()) {
-    if (0 == std::strcmp(key, "images")) {
-      detail::ParseImageInfo(parser, image_infos);
-    } else if (0 == std::strcmp(key, "categories")) {
-      detail::ParseCategories(parser, category_ids);
-    } else if (0 == std::strcmp(key, "annotations")) {
-      ParseAnnotations(parser, annotations, sz_threshold, ltrb, parse_segmentation,
-                       parse_rle, include_iscrowd);
-    } else {
-      parser.SkipValue();
-    }
-  }
+
+  // Find the top-level members without parsing them; the (large) arrays of images and
+  // annotations are then split and parsed in parallel.
+  std::optional<ThreadPool> tp;
+  if (num_threads > 1)
+    tp.emplace(num_threads, CPU_ONLY_DEVICE_ID, false, "CocoLoader");
+  const char *begin = buff.get(), *end = buff.get() + file_size;
+  begin = SkipJsonWhitespace(begin, end);
+  const char *obj_end = ScanJsonObject(begin, end,
+    [&](std::string_view key, const char *value_begin, const char *value_end) {
+      if (key == "images") {
+        ParseArrayInParallel(value_begin, value_end, image_infos, tp ? &*tp : nullptr,
+          [](LookaheadParser &parser, std::vector<ImageInfo> &out) {
+            ParseImageInfo(parser, out);
+          });
+      } else if (key == "annotations") {
+        ParseArrayInParallel(value_begin, value_end, annotations, tp ? &*tp : nullptr,
+          [&](LookaheadParser &parser, std::vector<Annotation> &out) {
+            ParseAnnotations(parser, out, sz_threshold, ltrb, parse_segmentation,
+                             parse_rle, include_iscrowd);
+          });
+      } else if (key == "categories") {
+        std::string categories(value_begin, value_end);
+        LookaheadParser parser(&categories[0]);
+        ParseCategories(parser, category_ids);
+      }
+    });
+  DALI_ENFORCE(obj_end, make_string("Error parsing JSON file: \"", annotations_file, "\""));
 }
 
 }  // namespace detail
 
 void CocoLoader::SavePreprocessedAnnotations(
   const std::string &path, const std::vector<FileLabelEntry> &entries) {
-  using detail::SaveToFile;
-  SaveToFile(offsets_, path + "/offsets.dat");
-  SaveToFile(boxes_, path + "/boxes.dat");
-  SaveToFile(labels_, path + "/labels.dat");
-  SaveToFile(counts_, path + "/counts.dat");
-  SaveToFile(entries, path + "/filenames.dat");
+  using coco::AnnotationColumn;
+  coco::AnnotationFileWriter writer;
+  uint32_t flags = 0;
+  writer.AddColumn(AnnotationColumn::Offsets, cols_.offsets);
+  writer.AddColumn(AnnotationColumn::Counts, cols_.counts);
+  writer.AddColumn(AnnotationColumn::Boxes, cols_.boxes);
+  writer.AddColumn(AnnotationColumn::Labels, cols_.labels);
+
+  std::vector<int64_t> filename_offsets;
+  std::vector<char> filename_data;
+  filename_offsets.reserve(entries.size() + 1);
+  filename_offsets.push_back(0);
+  for (const auto &e : entries) {
+    filename_data.insert(filename_data.end(), e.filename.begin(), e.filename.end());
+    filename_offsets.push_back(filename_data.size());
+  }
+  writer.AddColumn(AnnotationColumn::FilenameOffsets, make_cspan(filename_offsets));
+  writer.AddColumn(AnnotationColumn::FilenameData, make_cspan(filename_data));
 
   if (output_polygon_masks_ || output_pixelwise_masks_) {
-    SaveToFile(polygon_data_, path + "/polygon_data.dat");
-    SaveToFile(polygon_offset_, path + "/polygon_offset.dat");
-    SaveToFile(polygon_count_, path + "/polygons_count.dat");
-    SaveToFile(vertices_data_, path + "/vertices.dat");
-    SaveToFile(vertices_offset_, path + "/vertices_offset.dat");
-    SaveToFile(vertices_count_, path + "/vertices_count.dat");
+    flags |= coco::kHasPolygons;
+    writer.AddColumn(AnnotationColumn::Polygons, cols_.polygon_data);
+    writer.AddColumn(AnnotationColumn::PolygonOffsets, cols_.polygon_offset);
+    writer.AddColumn(AnnotationColumn::PolygonCounts, cols_.polygon_count);
+    writer.AddColumn(AnnotationColumn::Vertices, cols_.vertices_data);
+    writer.AddColumn(AnnotationColumn::VertexOffsets, cols_.vertices_offset);
+    writer.AddColumn(AnnotationColumn::VertexCounts, cols_.vertices_count);
   }
 
   if (output_pixelwise_masks_) {
-    SaveToFile(masks_rles_, path + "/masks_rles.dat");
-    SaveToFile(masks_rles_idx_, path + "/masks_rles_idx.dat");
-    SaveToFile(mask_offsets_, path + "/masks_offset.dat");
-    SaveToFile(mask_counts_, path + "/mask_count.dat");
-    SaveToFile(heights_, path + "/heights.dat");
-    SaveToFile(widths_, path + "/widths.dat");
+    flags |= coco::kHasPixelwiseMasks;
+    writer.AddColumn(AnnotationColumn::RLEMasks, cols_.rle_masks);
+    writer.AddColumn(AnnotationColumn::RLECounts, cols_.rle_counts);
+    writer.AddColumn(AnnotationColumn::MaskIndices, cols_.masks_rles_idx);
+    writer.AddColumn(AnnotationColumn::MaskOffsets, cols_.mask_offsets);
+    writer.AddColumn(AnnotationColumn::MaskCounts, cols_.mask_counts);
+    writer.AddColumn(AnnotationColumn::Heights, cols_.heights);
+    writer.AddColumn(AnnotationColumn::Widths, cols_.widths);
   }
 
   if (output_image_ids_) {
-    SaveToFile(original_ids_, path + "/original_ids.dat");
+    flags |= coco::kHasImageIds;
+    writer.AddColumn(AnnotationColumn::OriginalIds, cols_.original_ids);
   }
+
+  writer.Write(path + "/" + coco::kAnnotationFileName, entries.size(), flags);
 }
 
 void CocoLoader::ParsePreprocessedAnnotations() {
@@ -454,6 +480,74 @@ void CocoLoader::ParsePreprocessedAnnotations() {
   const auto path = spec_.HasArgument("meta_files_path")
       ? spec_.GetArgument<string>("meta_files_path")
       : spec_.GetArgument<string>("preprocessed_annotations");
+  struct stat st;
+  bool is_dir = stat(path.c_str(), &st) == 0 && S_ISDIR(st.st_mode);
+  std::string file_path = is_dir ? path + "/" + coco::kAnnotationFileName : path;
+  if (coco::AnnotationFile::IsAnnotationFile(file_path)) {
+    MapPreprocessedAnnotations(file_path);
+  } else {
+    ParseLegacyPreprocessedAnnotations(path);
+  }
+}
+
+void CocoLoader::MapPreprocessedAnnotations(const std::string &path) {
+  using coco::AnnotationColumn;
+  annotation_file_ = coco::AnnotationFile(path);
+  const auto &file = annotation_file_;
+  auto require = [&](uint32_t flag, const char *what) {
+    DALI_ENFORCE(file.flags() & flag, make_string("The preprocessed annotations in \"", path,
+                 "\" don't contain ", what, ". Save them with the same options."));
+  };
+  cols_ = {};
+  cols_.offsets = file.Column<int>(AnnotationColumn::Offsets);
+  cols_.counts = file.Column<int>(AnnotationColumn::Counts);
+  cols_.boxes = file.Column<float>(AnnotationColumn::Boxes);
+  cols_.labels = file.Column<int>(AnnotationColumn::Labels);
+  int64_t n = file.num_images();
+  DALI_ENFORCE(cols_.offsets.size() == n && cols_.counts.size() == n,
+               make_string("The annotation file \"", path, "\" is corrupted."));
+
+  if (output_polygon_masks_ || output_pixelwise_masks_) {
+    require(coco::kHasPolygons, "polygons");
+    cols_.polygon_data = file.Column<ivec3>(AnnotationColumn::Polygons);
+    cols_.polygon_offset = file.Column<int64_t>(AnnotationColumn::PolygonOffsets);
+    cols_.polygon_count = file.Column<int64_t>(AnnotationColumn::PolygonCounts);
+    cols_.vertices_data = file.Column<vec2>(AnnotationColumn::Vertices);
+    cols_.vertices_offset = file.Column<int64_t>(AnnotationColumn::VertexOffsets);
+    cols_.vertices_count = file.Column<int64_t>(AnnotationColumn::VertexCounts);
+  }
+
+  if (output_pixelwise_masks_) {
+    require(coco::kHasPixelwiseMasks, "pixelwise masks");
+    cols_.rle_masks = file.Column<coco::RLEMaskDesc>(AnnotationColumn::RLEMasks);
+    cols_.rle_counts = file.Column<uint>(AnnotationColumn::RLECounts);
+    cols_.masks_rles_idx = file.Column<int>(AnnotationColumn::MaskIndices);
+    cols_.mask_offsets = file.Column<int64_t>(AnnotationColumn::MaskOffsets);
+    cols_.mask_counts = file.Column<int64_t>(AnnotationColumn::MaskCounts);
+    cols_.heights = file.Column<int>(AnnotationColumn::Heights);
+    cols_.widths = file.Column<int>(AnnotationColumn::Widths);
+  }
+
+  if (output_image_ids_) {
+    require(coco::kHasImageIds, "image ids");
+    cols_.original_ids = file.Column<int>(AnnotationColumn::OriginalIds);
+  }
+
+  auto filename_offsets = file.Column<int64_t>(AnnotationColumn::FilenameOffsets);
+  auto filename_data = file.Column<char>(AnnotationColumn::FilenameData);
+  DALI_ENFORCE(filename_offsets.size() == n + 1 && filename_offsets[n] <= filename_data.size(),
+               make_string("The annotation file \"", path, "\" is corrupted."));
+  file_label_entries_.clear();
+  file_label_entries_.reserve(n);
+  for (int64_t i = 0; i < n; i++) {
+    file_label_entries_.push_back({
+        std::string(filename_data.data() + filename_offsets[i],
+                    filename_data.data() + filename_offsets[i + 1]),
+        static_cast<int>(i)});
+  }
+}
+
+void CocoLoader::ParseLegacyPreprocessedAnnotations(const std::string &path) {
   using detail::LoadFromFile;
   LoadFromFile(offsets_, path + "/offsets.dat");
   LoadFromFile(boxes_, path + "/boxes.dat");
@@ -471,7 +565,7 @@ void CocoLoader::ParsePreprocessedAnnotations() {
   }
 
   if (output_pixelwise_masks_) {
-    LoadFromFile(masks_rles_, path + "/masks_rles.dat");
+    detail::LoadRLEsFromFile(rle_masks_, rle_counts_, path + "/masks_rles.dat");
     LoadFromFile(masks_rles_idx_, path + "/masks_rles_idx.dat");
     LoadFromFile(mask_offsets_, path + "/masks_offset.dat");
     LoadFromFile(mask_counts_, path + "/mask_count.dat");
@@ -482,6 +576,28 @@ void CocoLoader::ParsePreprocessedAnnotations() {
   if (output_image_ids_) {
     LoadFromFile(original_ids_, path + "/original_ids.dat");
   }
+  SetColumnsFromVectors();
+}
+
+void CocoLoader::SetColumnsFromVectors() {
+  cols_.heights = make_cspan(heights_);
+  cols_.widths = make_cspan(widths_);
+  cols_.offsets = make_cspan(offsets_);
+  cols_.boxes = make_cspan(boxes_);
+  cols_.labels = make_cspan(labels_);
+  cols_.counts = make_cspan(counts_);
+  cols_.original_ids = make_cspan(original_ids_);
+  cols_.polygon_data = make_cspan(polygon_data_);
+  cols_.polygon_offset = make_cspan(polygon_offset_);
+  cols_.polygon_count = make_cspan(polygon_count_);
+  cols_.vertices_data = make_cspan(vertices_data_);
+  cols_.vertices_offset = make_cspan(vertices_offset_);
+  cols_.vertices_count = make_cspan(vertices_count_);
+  cols_.rle_masks = make_cspan(rle_masks_);
+  cols_.rle_counts = make_cspan(rle_counts_);
+  cols_.masks_rles_idx = make_cspan(masks_rles_idx_);
+  cols_.mask_offsets = make_cspan(mask_offsets_);
+  cols_.mask_counts = make_cspan(mask_counts_);
 }
 
 void CocoLoader::ParseJsonAnnotations() {
@@ -491,7 +607,7 @@ void CocoLoader::ParseJsonAnnotations() {
 
   bool parse_segmentation = output_polygon_masks_ || output_pixelwise_masks_;
   detail::ParseJsonFile(spec_, image_infos, annotations, category_ids,
-                        parse_segmentation, output_pixelwise_masks_);
+                        parse_segmentation, output_pixelwise_masks_, num_threads_);
 
   if (images_.empty()) {
     std::sort(image_infos.begin(), image_infos.end(), [&](auto &left, auto &right) {
@@ -503,7 +619,7 @@ void CocoLoader::ParseJsonAnnotations() {
   }
 
   std::unordered_map<std::string, const detail::ImageInfo*> img_infos_map;
-  std::unordered_map<int, std::list<const detail::Annotation*>> img_annotations_map;
+  std::unordered_map<int, std::vector<const detail::Annotation*>> img_annotations_map;
   img_infos_map.reserve(images_.size());
   img_annotations_map.reserve(images_.size());
   for (const auto &filename : images_) {
@@ -542,7 +658,7 @@ void CocoLoader::ParseJsonAnnotations() {
     int64_t sample_polygons_count = 0;
     int64_t sample_vertices_offset = vertices_data_.size();
     int64_t sample_vertices_count = 0;
-    int64_t mask_offset = masks_rles_.size();
+    int64_t mask_offset = rle_masks_.size();
     int64_t mask_count = 0;
     for (const auto* annotation_ptr : img_annotations_map[image_id]) {
       const auto &annotation = *annotation_ptr;
@@ -595,8 +711,12 @@ void CocoLoader::ParseJsonAnnotations() {
             break;
           }
           case detail::Annotation::RLE: {
+            const auto &rle = *annotation.rle_;
             masks_rles_idx_.push_back(objects_in_sample);
-            masks_rles_.push_back(annotation.rle_);
+            rle_masks_.push_back({static_cast<int32_t>(rle->h), static_cast<int32_t>(rle->w),
+                                  static_cast<int64_t>(rle_counts_.size()),
+                                  static_cast<int64_t>(rle->m)});
+            rle_counts_.insert(rle_counts_.end(), rle->cnts, rle->cnts + rle->m);
             mask_count++;
             break;
           }
@@ -635,6 +755,7 @@ void CocoLoader::ParseJsonAnnotations() {
 
   // we don't need the list anymore and it can contain a lot of strings
   images_.clear();
+  SetColumnsFromVectors();
 
   if (spec_.GetArgument<bool>("save_preprocessed_annotations")) {
     SavePreprocessedAnnotations(
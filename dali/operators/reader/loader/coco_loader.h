@@ -1,4 +1,4 @@
-// Copyright (c) 2019-2024, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+// Copyright (c) 2019-2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
 //
 // Licensed under the Apache License, Version 2.0 (the "License");
 // you may not use this file except in compliance with the License.
@@ -22,6 +22,7 @@
 #include <unordered_set>
 #include <utility>
 
+#include "dali/operators/reader/loader/coco_annotation_file.h"
 #include "dali/operators/reader/loader/file_label_loader.h"
 #include "dali/core/common.h"
 #include "dali/core/error_handling.h"
@@ -113,6 +114,7 @@ class DLL_PUBLIC CocoLoader : public FileLabelLoaderBase<true> {
     }
 
     spec.TryGetRepeatedArgument(images_, "images");
+    num_threads_ = std::max(1, spec.GetArgument<int>("num_threads"));
     output_polygon_masks_ = OutPolygonMasksEnabled(spec);
     output_pixelwise_masks_ = OutPixelwiseMasksEnabled(spec);
     output_image_ids_ = OutImageIdsEnabled(spec);
@@ -128,8 +130,9 @@ class DLL_PUBLIC CocoLoader : public FileLabelLoaderBase<true> {
 
   struct PixelwiseMasksInfo {
     TensorShape<3> shape;
-    span<const RLEMaskPtr> rles;
+    span<const coco::RLEMaskDesc> rles;
     span<const int> mask_indices;
+    span<const uint> rle_counts;  // run lengths of all masks, indexed by RLEMaskDesc
   };
 
   struct PolygonMasksInfo {
@@ -138,40 +141,44 @@ class DLL_PUBLIC CocoLoader : public FileLabelLoaderBase<true> {
   };
 
   span<const vec<4>> bboxes(int image_idx) const {
-    return {reinterpret_cast<const vec<4>*>(boxes_.data()) + offsets_[image_idx],
-            counts_[image_idx]};
+    return {reinterpret_cast<const vec<4>*>(cols_.boxes.data()) + cols_.offsets[image_idx],
+            cols_.counts[image_idx]};
   }
 
   span<const int> labels(int image_idx) const {
-    return {labels_.data() + offsets_[image_idx], counts_[image_idx]};
+    return {cols_.labels.data() + cols_.offsets[image_idx], cols_.counts[image_idx]};
   }
 
   int image_id(int image_idx) const {
     assert(output_image_ids_);
-    return original_ids_[image_idx];
+    return cols_.original_ids[image_idx];
   }
 
   PixelwiseMasksInfo pixelwise_masks_info(int image_idx) const {
     assert(output_pixelwise_masks_);
     return {
-      {heights_[image_idx], widths_[image_idx], 1},
-      {masks_rles_.data() + mask_offsets_[image_idx], mask_counts_[image_idx]},
-      {masks_rles_idx_.data() + mask_offsets_[image_idx], mask_counts_[image_idx]}
+      {cols_.heights[image_idx], cols_.widths[image_idx], 1},
+      {cols_.rle_masks.data() + cols_.mask_offsets[image_idx], cols_.mask_counts[image_idx]},
+      {cols_.masks_rles_idx.data() + cols_.mask_offsets[image_idx], cols_.mask_counts[image_idx]},
+      cols_.rle_counts
     };
   }
 
   span<const ivec3> polygons(int image_idx) const {
     assert(output_polygon_masks_ || output_pixelwise_masks_);
-    if (polygon_data_.empty() || polygon_offset_.empty() || polygon_count_.empty())
+    if (cols_.polygon_data.empty() || cols_.polygon_offset.empty() || cols_.polygon_count.empty())
       return {};
-    return {polygon_data_.data() + polygon_offset_[image_idx], polygon_count_[image_idx]};
+    return {cols_.polygon_data.data() + cols_.polygon_offset[image_idx],
+            cols_.polygon_count[image_idx]};
   }
 
   span<const vec2> vertices(int image_idx) const {
     assert(output_polygon_masks_ || output_pixelwise_masks_);
-    if (vertices_data_.empty() || vertices_offset_.empty() || vertices_count_.empty())
+    if (cols_.vertices_data.empty() || cols_.vertices_offset.empty() ||
+        cols_.vertices_count.empty())
       return {};
-    return {vertices_data_.data() + vertices_offset_[image_idx], vertices_count_[image_idx]};
+    return {cols_.vertices_data.data() + cols_.vertices_offset[image_idx],
+            cols_.vertices_count[image_idx]};
   }
 
  protected:
@@ -199,14 +206,53 @@ class DLL_PUBLIC CocoLoader : public FileLabelLoaderBase<true> {
 
   void ParsePreprocessedAnnotations();
 
+  /**
+   * @brief Reads the annotations saved by DALI versions which stored each array in a separate file
+   */
+  void ParseLegacyPreprocessedAnnotations(const std::string &path);
+
+  /**
+   * @brief Maps a columnar annotation file; the annotations are used in place.
+   */
+  void MapPreprocessedAnnotations(const std::string &path);
+
   void ParseJsonAnnotations();
 
   void SavePreprocessedAnnotations(
     const std::string &path, const std::vector<FileLabelEntry> &image_id_pairs);
 
+  /**
+   * @brief Points the annotation views to the data parsed into the member vectors.
+   */
+  void SetColumnsFromVectors();
+
  private:
   const OpSpec spec_;
 
+  // The annotations - either parsed from JSON (or legacy preprocessed files) into the vectors
+  // below, or memory mapped from a preprocessed annotation file.
+  struct Columns {
+    span<const int> heights;
+    span<const int> widths;
+    span<const int> offsets;
+    span<const float> boxes;
+    span<const int> labels;
+    span<const int> counts;
+    span<const int> original_ids;
+    span<const ivec3> polygon_data;
+    span<const int64_t> polygon_offset;
+    span<const int64_t> polygon_count;
+    span<const vec2> vertices_data;
+    span<const int64_t> vertices_offset;
+    span<const int64_t> vertices_count;
+    span<const coco::RLEMaskDesc> rle_masks;
+    span<const uint> rle_counts;
+    span<const int> masks_rles_idx;
+    span<const int64_t> mask_offsets;
+    span<const int64_t> mask_counts;
+  } cols_;
+  coco::AnnotationFile annotation_file_;
+
   std::vector<int> heights_;
   std::vector<int> widths_;
   std::vector<int> offsets_;
@@ -225,7 +271,8 @@ class DLL_PUBLIC CocoLoader : public FileLabelLoaderBase<true> {
   std::vector<int64_t> vertices_count_;   // number of vertices per sample
 
   // masks_rles: (run-length encodings)
-  std::vector<RLEMaskPtr> masks_rles_;
+  std::vector<coco::RLEMaskDesc> rle_masks_;
+  std::vector<uint> rle_counts_;       // run lengths of all masks concatenated
   std::vector<int> masks_rles_idx_;
   std::vector<int64_t> mask_offsets_;  // per-sample offsets of masks
   std::vector<int64_t> mask_counts_;   // number of masks per sample
@@ -234,6 +281,7 @@ class DLL_PUBLIC CocoLoader : public FileLabelLoaderBase<true> {
   bool output_pixelwise_masks_ = false;
   bool output_image_ids_ = false;
   bool has_preprocessed_annotations_ = false;
+  int num_threads_ = 1;
 
   std::vector<std::string> images_;
 };
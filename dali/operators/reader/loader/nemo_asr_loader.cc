@@ -1,4 +1,4 @@
-// Copyright (c) 2020-2023, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+// Copyright (c) 2020-2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
 //
 // Licensed under the Apache License, Version 2.0 (the "License");
 // you may not use this file except in compliance with the License.
@@ -91,6 +91,67 @@ void NemoAsrLoader::PrepareMetadataImpl() {
     std::shuffle(shuffled_indices_.begin(), shuffled_indices_.end(), g);
   }
   Reset(true);
+  BuildIndex();
+}
+
+void NemoAsrLoader::IndexEntry(NemoAsrIndexEntry &index_entry, const NemoAsrEntry &entry) {
+  if (cache_ && !index_entry.has_cache_key) {
+    index_entry.has_cache_key = cache_->MakeKey(index_entry.cache_key, entry.audio_filepath,
+                                                entry.offset, entry.duration);
+  }
+  if (index_entry.has_cache_key &&
+      cache_->ReadMetadata(index_entry.cache_key, index_entry.meta, index_entry.offset)) {
+    index_entry.valid = true;
+    return;
+  }
+
+  auto decoder = make_generic_audio_decoder();
+  AudioMetadata meta = decoder->OpenFromFile(entry.audio_filepath);
+  decoder->Close();
+  assert(meta.channels_interleaved);  // it's always true
+
+  int64_t offset, length;
+  std::tie(offset, length) = ProcessOffsetAndLength(meta, entry.offset, entry.duration);
+  assert(0 < length && length <= meta.length && "Unexpected length");
+  meta.length = length;
+
+  index_entry.meta = meta;
+  index_entry.offset = offset;
+  index_entry.valid = true;
+}
+
+void NemoAsrLoader::BuildIndex() {
+  index_.clear();
+  index_.resize(entries_.size());
+
+  // Only the current shard is indexed upfront - the remaining entries are indexed on first use
+  Index begin = start_index(virtual_shard_id_, num_shards_, SizeImpl());
+  Index end = start_index(virtual_shard_id_ + 1, num_shards_, SizeImpl());
+  auto index_range = [&](Index first, Index last) {
+    for (Index i = first; i < last; i++) {
+      size_t idx = shuffled_indices_[i];
+      try {
+        IndexEntry(index_[idx], entries_[idx]);
+      } catch (std::exception &) {
+        index_[idx].valid = false;  // retried, and reported, in ReadSample
+      }
+    }
+  };
+
+  // Opening the files is I/O bound, so the work is split into more chunks than threads
+  Index total = end - begin;
+  int nchunks = std::min<Index>(num_threads_ * 4, total);
+  if (num_threads_ == 1 || nchunks <= 1) {
+    index_range(begin, end);
+    return;
+  }
+  ThreadPool tp(num_threads_, CPU_ONLY_DEVICE_ID, false, "NemoAsrIndex");
+  for (int c = 0; c < nchunks; c++) {
+    Index first = begin + total * c / nchunks;
+    Index last = begin + total * (c + 1) / nchunks;
+    tp.AddWork([&, first, last](int) { index_range(first, last); }, last - first);
+  }
+  tp.RunAll();
 }
 
 void NemoAsrLoader::Reset(bool wrap_to_shard) {
@@ -118,8 +179,7 @@ void NemoAsrLoader::ReadAudio(SampleView<CPUBackend> audio,
                               const AudioMetadata &audio_meta,
                               const NemoAsrEntry &entry,
                               AudioDecoderBase &decoder,
-                              std::vector<float> &decode_scratch,
-                              std::vector<float> &resample_scratch) {
+                              std::vector<float> &decode_scratch) {
   bool should_resample = sample_rate_ > 0 && audio_meta.sample_rate != sample_rate_;
   bool should_downmix = audio_meta.channels > 1 && downmix_;
 
@@ -128,25 +188,17 @@ void NemoAsrLoader::ReadAudio(SampleView<CPUBackend> audio,
     decode_scratch_sz = audio_meta.length * audio_meta.channels;
   decode_scratch.resize(decode_scratch_sz);
 
-  // resample scratch is used to prepare a single or multiple (depending if
-  // downmixing is needed) channel float input, required by the resampling
-  // kernel
-  int64_t resample_scratch_sz = 0;
-  if (should_resample)
-    resample_scratch_sz =
-        should_downmix ? audio_meta.length : audio_meta.length * audio_meta.channels;
-  resample_scratch.resize(resample_scratch_sz);
-
   DecodeAudio<OutputType>(
     view<OutputType>(audio), decoder, audio_meta, resampler_,
     {decode_scratch.data(), decode_scratch_sz},
-    {resample_scratch.data(), resample_scratch_sz},
     sample_rate_, downmix_,
     entry.audio_filepath.c_str());
 }
 
 void NemoAsrLoader::ReadSample(AsrSample& sample) {
-  auto &entry = entries_[shuffled_indices_[current_index_]];
+  size_t entry_idx = shuffled_indices_[current_index_];
+  auto &entry = entries_[entry_idx];
+  auto &index_entry = index_[entry_idx];
 
   // handle wrap-around
   ++current_index_;
@@ -158,32 +210,28 @@ void NemoAsrLoader::ReadSample(AsrSample& sample) {
 
   // Ignoring copy_read_data_, Sharing data is not supported with this loader
 
-  bool use_resampling = sample_rate_ > 0;
-  sample.decoder_ = make_generic_audio_decoder();
-
-  auto &meta = sample.audio_meta_ = sample.decoder().OpenFromFile(entry.audio_filepath);
-  assert(meta.channels_interleaved);  // it's always true
-
-  int64_t offset, length;
-  std::tie(offset, length) =
-      ProcessOffsetAndLength(meta, entry.offset, entry.duration);
-  assert(0 < length && length <= meta.length && "Unexpected length");
-  meta.length = length;
+  if (!index_entry.valid)
+    IndexEntry(index_entry, entry);
 
-  sample.shape_ = DecodedAudioShape(meta, sample_rate_, downmix_);
+  sample.audio_meta_ = index_entry.meta;
+  sample.shape_ = DecodedAudioShape(sample.audio_meta_, sample_rate_, downmix_);
   assert(sample.shape_.size() > 0);
-  sample.decoder().Close();  // avoid keeping too many files open at the same time.
 
   TYPE_SWITCH(dtype_, type2id, OutputType, (int16_t, int32_t, float), (
     // Audio decoding will be run in the prefetch function, once the batch is formed
-    sample.decode_f_ = [this, &sample, &entry, offset](SampleView<CPUBackend> audio, int tid) {
+    sample.decode_f_ = [this, &sample, &entry, &index_entry](SampleView<CPUBackend> audio,
+                                                             int tid) {
+      if (index_entry.has_cache_key && cache_->Read(index_entry.cache_key, audio))
+        return;
       sample.decoder().OpenFromFile(entry.audio_filepath);
-      if (offset > 0)
-        sample.decoder().SeekFrames(offset);
+      if (index_entry.offset > 0)
+        sample.decoder().SeekFrames(index_entry.offset);
       ReadAudio<OutputType>(
         audio, sample.audio_meta_, entry, sample.decoder(),
-        decode_scratch_[tid], resample_scratch_[tid]);
+        decode_scratch_[tid]);
       sample.decoder().Close();
+      if (index_entry.has_cache_key)
+        cache_->Write(index_entry.cache_key, sample.audio_meta_, index_entry.offset, audio);
     };
   ), (  // NOLINT
     DALI_FAIL(make_string("Unsupported output type: ", dtype_,
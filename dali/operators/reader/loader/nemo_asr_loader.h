@@ -1,4 +1,4 @@
-// Copyright (c) 2020-2023, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+// Copyright (c) 2020-2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
 //
 // Licensed under the Apache License, Version 2.0 (the "License");
 // you may not use this file except in compliance with the License.
@@ -28,6 +28,8 @@
 #include "dali/kernels/signal/resampling_cpu.h"
 #include "dali/operators/decoder/audio/audio_decoder.h"
 #include "dali/operators/decoder/audio/audio_decoder_impl.h"
+#include "dali/operators/decoder/audio/generic_decoder.h"
+#include "dali/operators/reader/loader/audio_pcm_cache.h"
 #include "dali/operators/reader/loader/file_label_loader.h"
 #include "dali/pipeline/util/thread_pool.h"
 
@@ -43,6 +45,17 @@ struct NemoAsrEntry {
   std::string text;  // transcription
 };
 
+/**
+ * @brief Audio metadata of a manifest entry, gathered before the samples are read
+ */
+struct NemoAsrIndexEntry {
+  AudioMetadata meta = {};  // the length is that of the fragment selected by offset/duration
+  int64_t offset = 0;       // in frames
+  AudioPcmCache::Key cache_key;
+  bool has_cache_key = false;
+  bool valid = false;
+};
+
 class AsrSample {
  public:
   int64_t index() const {
@@ -77,7 +90,8 @@ class AsrSample {
 
  private:
   AudioDecoderBase &decoder() {
-    assert(decoder_);
+    if (!decoder_)
+      decoder_ = make_generic_audio_decoder();
     return *decoder_;
   }
 
@@ -121,8 +135,8 @@ class DLL_PUBLIC NemoAsrLoader : public Loader<CPUBackend, AsrSample, true> {
         max_duration_(spec.GetArgument<float>("max_duration")),
         read_text_(spec.GetArgument<bool>("read_text")),
         num_threads_(std::max(1, spec.GetArgument<int>("num_threads"))),
-        decode_scratch_(num_threads_),
-        resample_scratch_(num_threads_) {
+        cache_dir_(spec.GetArgument<std::string>("cache_dir")),
+        decode_scratch_(num_threads_) {
     DALI_ENFORCE(!manifest_filepaths_.empty(), "``manifest_filepaths`` can not be empty");
     /*
      * Those options are mutually exclusive as `shuffle_after_epoch` will make every shard looks
@@ -145,6 +159,13 @@ class DLL_PUBLIC NemoAsrLoader : public Loader<CPUBackend, AsrSample, true> {
     // this should give 3 lobes for q = 0, 16 lobes for q = 50 and 64 lobes for q = 100
     int lobes = std::round(0.007 * q * q - 0.09 * q + 3);
     resampler_.Initialize(lobes, lobes * 64 + 1);
+
+    if (!cache_dir_.empty()) {
+      // Any parameter which affects the decoded samples must be a part of the cache key
+      cache_ = std::make_unique<AudioPcmCache>(cache_dir_, make_string(
+          "sample_rate=", sample_rate_, ";quality=", quality_, ";downmix=", downmix_,
+          ";dtype=", dtype_));
+    }
   }
 
   ~NemoAsrLoader() override = default;
@@ -164,11 +185,26 @@ class DLL_PUBLIC NemoAsrLoader : public Loader<CPUBackend, AsrSample, true> {
                  const AudioMetadata &audio_meta,
                  const NemoAsrEntry &entry,
                  AudioDecoderBase &decoder,
-                 std::vector<float> &decode_scratch,
-                 std::vector<float> &resample_scratch);
+                 std::vector<float> &decode_scratch);
+
+  /**
+   * @brief Fills the index entry (audio metadata, cache key) for given manifest entry.
+   *
+   * The metadata is taken from the cache, if available; otherwise the file is opened.
+   */
+  void IndexEntry(NemoAsrIndexEntry &index_entry, const NemoAsrEntry &entry);
+
+  /**
+   * @brief Indexes, in parallel, the entries in the current shard.
+   *
+   * Entries which fail (e.g. can't be opened) are left out - they're indexed, and the error
+   * is reported, when the sample is read.
+   */
+  void BuildIndex();
 
   std::vector<std::string> manifest_filepaths_;
   std::vector<NemoAsrEntry> entries_;
+  std::vector<NemoAsrIndexEntry> index_;
   std::vector<size_t> shuffled_indices_;
 
   bool shuffle_after_epoch_;
@@ -183,9 +219,10 @@ class DLL_PUBLIC NemoAsrLoader : public Loader<CPUBackend, AsrSample, true> {
   double max_duration_;
   bool read_text_;
   int num_threads_;
+  std::string cache_dir_;
+  std::unique_ptr<AudioPcmCache> cache_;
   kernels::signal::resampling::ResamplerCPU resampler_;
   std::vector<std::vector<float>> decode_scratch_;
-  std::vector<std::vector<float>> resample_scratch_;
 };
 
 }  // namespace dali
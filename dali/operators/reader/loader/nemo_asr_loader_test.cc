@@ -1,4 +1,4 @@
-// Copyright (c) 2020-2022, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+// Copyright (c) 2020-2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
 //
 // Licensed under the Apache License, Version 2.0 (the "License");
 // you may not use this file except in compliance with the License.
@@ -13,7 +13,9 @@
 // limitations under the License.
 
 #include <gtest/gtest.h>
+#include <sys/stat.h>
 #include <cstdio>
+#include <filesystem>
 #include <utility>
 #include <sstream>
 #include <string>
@@ -398,4 +400,66 @@ TEST(NemoAsrLoaderTest, ReadSample_OffsetAndDuration) {
 }
 
 
+TEST(NemoAsrLoaderTest, ReadSample_Cache) {
+  std::string wav_path = make_string(audio_data_root, "dziendobry.wav");
+  std::string manifest_filepath = "/tmp/nemo_asr_manifest_XXXXXX";
+  tempfile(manifest_filepath);
+  std::ofstream f(manifest_filepath);
+  f << "{\"audio_filepath\": \"" << wav_path << "\", \"offset\": 0.05, \"duration\": 0.5}";
+  f.close();
+
+  char cache_dir[] = "/tmp/nemo_asr_cache_XXXXXX";
+  ASSERT_NE(nullptr, mkdtemp(cache_dir));
+
+  auto spec = OpSpec("NemoAsrReader")
+                  .AddArg("manifest_filepaths", std::vector<std::string>{manifest_filepath})
+                  .AddArg("downmix", true)
+                  .AddArg("sample_rate", 16000.0f)
+                  .AddArg("dtype", DALI_FLOAT)
+                  .AddArg("num_threads", 4)
+                  .AddArg("max_batch_size", 32)
+                  .AddArg("device_id", -1);
+
+  auto read = [&](const OpSpec &spec, Tensor<CPUBackend> &out, float &sample_rate) {
+    NemoAsrLoader loader(spec);
+    loader.PrepareMetadata();
+    AsrSample sample;
+    loader.ReadSample(sample);
+    out.Resize(sample.shape(), DALI_FLOAT);
+    sample.decode_audio(sample_view(out), 0);
+    sample_rate = sample.audio_meta().sample_rate;
+  };
+
+  Tensor<CPUBackend> ref, first, cached;
+  float ref_sr, first_sr, cached_sr;
+  read(spec, ref, ref_sr);
+
+  auto cached_spec = OpSpec(spec).AddArg("cache_dir", std::string(cache_dir));
+  auto cache_entries = [&]() {
+    std::vector<std::filesystem::path> entries;
+    for (auto &e : std::filesystem::directory_iterator(cache_dir))
+      entries.push_back(e.path());
+    return entries;
+  };
+  read(cached_spec, first, first_sr);  // populates the cache
+  auto entries = cache_entries();
+  ASSERT_EQ(1u, entries.size());
+  struct stat st_first, st_cached;
+  ASSERT_EQ(0, stat(entries[0].c_str(), &st_first));
+
+  read(cached_spec, cached, cached_sr);  // reads from the cache, without rewriting the entry
+  entries = cache_entries();
+  ASSERT_EQ(1u, entries.size());
+  ASSERT_EQ(0, stat(entries[0].c_str(), &st_cached));
+  EXPECT_EQ(st_first.st_ino, st_cached.st_ino);
+
+  EXPECT_EQ(ref_sr, first_sr);
+  EXPECT_EQ(ref_sr, cached_sr);
+  Check(view<const float>(ref), view<const float>(first));
+  Check(view<const float>(ref), view<const float>(cached));
+
+  std::filesystem::remove_all(cache_dir);
+  ASSERT_EQ(0, std::remove(manifest_filepath.c_str()));
+}
+
 }  // namespace dali
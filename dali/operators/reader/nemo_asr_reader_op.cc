@@ -1,4 +1,4 @@
-// Copyright (c) 2020-2023, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+// Copyright (c) 2020-2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
 //
 // Licensed under the Apache License, Version 2.0 (the "License");
 // you may not use this file except in compliance with the License.
@@ -115,6 +115,15 @@ in seconds, of the audio samples.
 
 Samples with a duration longer than this value will be ignored.)code",
     0.0f)
+  .AddOptionalArg("cache_dir",
+    R"code(If specified, the decoded (and resampled, downmixed) audio is stored in this directory
+and, in subsequent epochs (and runs), read from there with memory mapping instead of being decoded.
+
+The directory should be on a local disk. The entries are identified by the file path, its size and
+modification time, the ``offset`` and ``duration`` from the manifest and the arguments which
+affect the decoded samples, so one directory can be shared by different pipelines and processes.
+The cache is not limited in size and is never cleaned up by DALI.)code",
+    std::string())
   .AddOptionalArg<bool>("normalize_text", "Normalize text.", nullptr)
   .DeprecateArg("normalize_text")  // deprecated since 0.28dev
   .AdditionalOutputsFn(NemoAsrReaderOutputFn)
@@ -1,4 +1,4 @@
-// Copyright (c) 2017-2024, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+// Copyright (c) 2017-2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
 //
 // Licensed under the Apache License, Version 2.0 (the "License");
 // you may not use this file except in compliance with the License.
@@ -14,73 +14,126 @@
 
 #include <algorithm>
 #include <cmath>
+#include <utility>
 
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
+#include "dali/core/small_vector.h"
+#include "dali/core/util.h"
 #include "dali/operators/ssd/box_encoder.h"
 
 namespace dali {
 
 using BoundingBox = BoxEncoder<CPUBackend>::BoundingBox;
 
-void BoxEncoder<CPUBackend>::CalculateIousForBox(float *ious, const BoundingBox &box) const {
-  ious[0] = intersection_over_union(box, anchors_[0]);
-  unsigned best_idx = 0;
-  float best_iou = ious[0];
-
-  for (unsigned anchor_idx = 1; anchor_idx < anchors_.size(); ++anchor_idx) {
-    ious[anchor_idx] = intersection_over_union(box, anchors_[anchor_idx]);
-
-    if (ious[anchor_idx] >= best_iou) {
-      best_iou = ious[anchor_idx];
-      best_idx = anchor_idx;
-    }
+void BoxEncoder<CPUBackend>::AnchorsSoA::Init(const vector<BoundingBox> &anchors) {
+  int n = anchors.size();
+  lo_x.resize(n);
+  lo_y.resize(n);
+  hi_x.resize(n);
+  hi_y.resize(n);
+  area.resize(n);
+  for (int i = 0; i < n; i++) {
+    lo_x[i] = anchors[i].lo.x;
+    lo_y[i] = anchors[i].lo.y;
+    hi_x[i] = anchors[i].hi.x;
+    hi_y[i] = anchors[i].hi.y;
+    area[i] = volume(anchors[i]);
   }
-
-  // For best default box matched with current object let iou = 2, to make sure there is a match,
-  // as this object will be the best (highest IoU), for this default box
-  ious[best_idx] = 2.;
 }
 
-vector<float> BoxEncoder<CPUBackend>::CalculateIous(const vector<BoundingBox> &boxes) const {
-  vector<float> ious(boxes.size() * anchors_.size());
-
-  for (unsigned bbox_idx = 0; bbox_idx < boxes.size(); ++bbox_idx) {
-    auto ious_row = ious.data() + bbox_idx * anchors_.size();
-    CalculateIousForBox(ious_row, boxes[bbox_idx]);
-  }
-
-  return ious;
+namespace {
+
+/**
+ * @brief Scalar IoU, computed with exactly the same sequence of operations as the vectorized
+ *        variant and `intersection_over_union`.
+ */
+inline float AnchorIoU(float box_lo_x, float box_lo_y, float box_hi_x, float box_hi_y,
+                       float box_area, float lo_x, float lo_y, float hi_x, float hi_y,
+                       float area) {
+  float ix0 = std::max(box_lo_x, lo_x);
+  float iy0 = std::max(box_lo_y, lo_y);
+  float ix1 = std::min(box_hi_x, hi_x);
+  float iy1 = std::min(box_hi_y, hi_y);
+  if (!(ix1 > ix0 && iy1 > iy0))
+    return 0.0f;
+  float intersection = (ix1 - ix0) * (iy1 - iy0);
+  if (intersection == 0)
+    return 0.0f;
+  return intersection / (box_area + area - intersection);
 }
 
-unsigned BoxEncoder<CPUBackend>::FindBestBoxForAnchor(
-  unsigned anchor_idx, const vector<float> &ious, unsigned num_boxes) const {
-  unsigned best_idx = 0;
-  float best_iou = ious[anchor_idx];
-
-  for (unsigned bbox_idx = 1; bbox_idx < num_boxes; ++bbox_idx) {
-    if (ious[bbox_idx * anchors_.size() + anchor_idx] >= best_iou) {
-      best_iou = ious[bbox_idx * anchors_.size() + anchor_idx];
-      best_idx = bbox_idx;
+}  // namespace
+
+std::pair<float, int> BoxEncoder<CPUBackend>::CalculateIousForBox(
+    float *ious, const BoundingBox &box, float box_area, int begin, int end) const {
+  const float *lo_x = anchors_soa_.lo_x.data();
+  const float *lo_y = anchors_soa_.lo_y.data();
+  const float *hi_x = anchors_soa_.hi_x.data();
+  const float *hi_y = anchors_soa_.hi_y.data();
+  const float *area = anchors_soa_.area.data();
+
+  float best_iou = -1.0f;
+  int best_idx = -1;
+  int anchor_idx = begin;
+
+#ifdef __SSE2__
+  if (end - begin >= 4) {
+    __m128 blo_x = _mm_set1_ps(box.lo.x), blo_y = _mm_set1_ps(box.lo.y);
+    __m128 bhi_x = _mm_set1_ps(box.hi.x), bhi_y = _mm_set1_ps(box.hi.y);
+    __m128 barea = _mm_set1_ps(box_area);
+    __m128 zero = _mm_setzero_ps();
+    __m128 best_v = _mm_set1_ps(-1.0f);
+    __m128i best_i = _mm_set1_epi32(-1);
+    __m128i idx = _mm_setr_epi32(begin, begin + 1, begin + 2, begin + 3);
+    const __m128i four = _mm_set1_epi32(4);
+    for (; anchor_idx + 4 <= end; anchor_idx += 4) {
+      __m128 ix0 = _mm_max_ps(blo_x, _mm_loadu_ps(lo_x + anchor_idx));
+      __m128 iy0 = _mm_max_ps(blo_y, _mm_loadu_ps(lo_y + anchor_idx));
+      __m128 ix1 = _mm_min_ps(bhi_x, _mm_loadu_ps(hi_x + anchor_idx));
+      __m128 iy1 = _mm_min_ps(bhi_y, _mm_loadu_ps(hi_y + anchor_idx));
+      __m128 valid = _mm_and_ps(_mm_cmpgt_ps(ix1, ix0), _mm_cmpgt_ps(iy1, iy0));
+      __m128 intersection = _mm_and_ps(valid,
+                                       _mm_mul_ps(_mm_sub_ps(ix1, ix0), _mm_sub_ps(iy1, iy0)));
+      __m128 union_area = _mm_sub_ps(_mm_add_ps(barea, _mm_loadu_ps(area + anchor_idx)),
+                                     intersection);
+      // mask out 0/0 for empty intersections with degenerate boxes
+      __m128 iou = _mm_and_ps(_mm_cmpneq_ps(intersection, zero),
+                              _mm_div_ps(intersection, union_area));
+      _mm_storeu_ps(ious + anchor_idx, iou);
+
+      __m128 better = _mm_cmpge_ps(iou, best_v);
+      __m128i better_i = _mm_castps_si128(better);
+      best_v = _mm_or_ps(_mm_and_ps(better, iou), _mm_andnot_ps(better, best_v));
+      best_i = _mm_or_si128(_mm_and_si128(better_i, idx), _mm_andnot_si128(better_i, best_i));
+      idx = _mm_add_epi32(idx, four);
+    }
+    float lane_iou[4];
+    int lane_idx[4];
+    _mm_storeu_ps(lane_iou, best_v);
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(lane_idx), best_i);
+    for (int l = 0; l < 4; l++) {
+      if (lane_iou[l] > best_iou || (lane_iou[l] == best_iou && lane_idx[l] > best_idx)) {
+        best_iou = lane_iou[l];
+        best_idx = lane_idx[l];
+      }
     }
   }
-
-  return best_idx;
-}
-
-vector<std::pair<unsigned, unsigned>> BoxEncoder<CPUBackend>::MatchBoxesWithAnchors(
-  const vector<BoundingBox> &boxes) const {
-  const auto ious = CalculateIous(boxes);
-  vector<std::pair<unsigned, unsigned>> matches;
-
-  for (unsigned anchor_idx = 0; anchor_idx < anchors_.size(); ++anchor_idx) {
-    const auto best_idx = FindBestBoxForAnchor(anchor_idx, ious, boxes.size());
-
-    // Filter matches by criteria
-    if (ious[best_idx * anchors_.size() + anchor_idx] > criteria_) {
-      matches.push_back({best_idx, anchor_idx});
+#endif  // __SSE2__
+
+  for (; anchor_idx < end; anchor_idx++) {
+    float iou = AnchorIoU(box.lo.x, box.lo.y, box.hi.x, box.hi.y, box_area,
+                          lo_x[anchor_idx], lo_y[anchor_idx], hi_x[anchor_idx], hi_y[anchor_idx],
+                          area[anchor_idx]);
+    ious[anchor_idx] = iou;
+    if (iou >= best_iou) {
+      best_iou = iou;
+      best_idx = anchor_idx;
     }
   }
-
-  return matches;
+  return {best_iou, best_idx};
 }
 
 template <int ndim>
@@ -92,15 +145,14 @@ void WriteBoxToOutput(float *out_box_data, const vec<ndim, float> &center,
   }
 }
 
-void BoxEncoder<CPUBackend>::WriteAnchorsToOutput(float *out_boxes, int *out_labels) const {
+void BoxEncoder<CPUBackend>::WriteAnchorsToOutput(float *out_boxes, int *out_labels,
+                                                  int begin, int end) const {
   if (offset_) {
-    std::memset(out_boxes, 0,
-                sizeof(std::remove_pointer<decltype(out_boxes)>::type) * BoundingBox::size *
-                    anchors_.size());
-    std::memset(out_labels, 0,
-                sizeof(std::remove_pointer<decltype(out_labels)>::type) * anchors_.size());
+    std::memset(out_boxes + begin * BoundingBox::size, 0,
+                sizeof(*out_boxes) * BoundingBox::size * (end - begin));
+    std::memset(out_labels + begin, 0, sizeof(*out_labels) * (end - begin));
   } else {
-    for (unsigned int idx = 0; idx < anchors_.size(); idx++) {
+    for (int idx = begin; idx < end; idx++) {
       float *out_box = out_boxes + idx * BoundingBox::size;
       const auto &anchor = anchors_[idx];
       WriteBoxToOutput(out_box, anchor.centroid(), anchor.extent());
@@ -133,55 +185,159 @@ GetOffsets(vec2 box_center,
   return std::make_pair(center, extent);
 }
 
-void BoxEncoder<CPUBackend>::WriteMatchesToOutput(
-  const vector<std::pair<unsigned, unsigned>> &matches, const vector<BoundingBox> &boxes,
-  const int *labels, float *out_boxes, int *out_labels) const {
+void BoxEncoder<CPUBackend>::WriteMatchToOutput(const BoundingBox &box, int label, int anchor_idx,
+                                                float *out_boxes, int *out_labels) const {
+  float *out_box = out_boxes + anchor_idx * BoundingBox::size;
   if (offset_) {
-    for (const auto &match : matches) {
-      auto box = boxes[match.first];
-      auto anchor = anchors_[match.second];
-
-      vec2 center, extent;
-      std::tie(center, extent) = GetOffsets(box.centroid(), box.extent(), anchor.centroid(),
-                                            anchor.extent(), means_, stds_, scale_);
-      WriteBoxToOutput(out_boxes + match.second * BoundingBox::size, center, extent);
-      out_labels[match.second] = labels[match.first];
-    }
+    const auto &anchor = anchors_[anchor_idx];
+    vec2 center, extent;
+    std::tie(center, extent) = GetOffsets(box.centroid(), box.extent(), anchor.centroid(),
+                                          anchor.extent(), means_, stds_, scale_);
+    WriteBoxToOutput(out_box, center, extent);
   } else {
-    for (const auto &match : matches) {
-      auto box = boxes[match.first];
-      WriteBoxToOutput(out_boxes + match.second * BoundingBox::size, box.centroid(),
-                       box.extent());
-      out_labels[match.second] = labels[match.first];
+    WriteBoxToOutput(out_box, box.centroid(), box.extent());
+  }
+  out_labels[anchor_idx] = label;
+}
+
+void BoxEncoder<CPUBackend>::MatchAndWriteBlock(const SampleData &sample, const int *labels,
+                                                float *out_boxes, int *out_labels,
+                                                int begin, int end) const {
+  WriteAnchorsToOutput(out_boxes, out_labels, begin, end);
+  int num_boxes = sample.boxes.size();
+  if (num_boxes == 0)
+    return;
+
+  const int nanchors = anchors_.size();
+  const float *ious = sample.ious.data();
+  int len = end - begin;
+  // Rows of the IoU matrix are traversed in order, so that the loop over anchors vectorizes
+  SmallVector<float, 64> best_iou;
+  SmallVector<int, 64> best_box;
+  best_iou.resize(len);
+  best_box.resize(len, 0);
+  for (int i = 0; i < len; i++)
+    best_iou[i] = ious[begin + i];
+  for (int box_idx = 1; box_idx < num_boxes; box_idx++) {
+    const float *row = ious + static_cast<int64_t>(box_idx) * nanchors + begin;
+    for (int i = 0; i < len; i++) {
+      bool better = row[i] >= best_iou[i];
+      best_iou[i] = better ? row[i] : best_iou[i];
+      best_box[i] = better ? box_idx : best_box[i];
+    }
+  }
+
+  for (int i = 0; i < len; i++) {
+    // Filter matches by criteria
+    if (best_iou[i] > criteria_) {
+      int box_idx = best_box[i];
+      WriteMatchToOutput(sample.boxes[box_idx], labels[box_idx], begin + i,
+                         out_boxes, out_labels);
     }
   }
 }
 
-void BoxEncoder<CPUBackend>::RunImpl(SampleWorkspace &ws) {
+int BoxEncoder<CPUBackend>::AnchorBlockSize(int nsamples, int num_threads) const {
+  int nanchors = anchors_.size();
+  if (nsamples >= num_threads || nanchors < 2 * kMinAnchorBlock)
+    return nanchors;
+  int nblocks = std::min(div_ceil(num_threads, nsamples), nanchors / kMinAnchorBlock);
+  return align_up(div_ceil(nanchors, nblocks), 4);
+}
+
+bool BoxEncoder<CPUBackend>::SetupImpl(std::vector<OutputDesc> &output_desc,
+                                       const Workspace &ws) {
   const auto &bboxes_input = ws.Input<CPUBackend>(kBoxesInId);
   const auto &labels_input = ws.Input<CPUBackend>(kLabelsInId);
-  const auto num_boxes = bboxes_input.dim(0);
-  const auto labels = labels_input.data<int>();
-
-  vector<BoundingBox> boxes;
-  boxes.resize(num_boxes);
-  ReadBoxes(make_span(boxes), make_cspan(bboxes_input.data<float>(), bboxes_input.size()), {}, {});
+  int nsamples = bboxes_input.num_samples();
+  int nanchors = anchors_.size();
+  output_desc.resize(2);
+  output_desc[kBoxesOutId].shape = uniform_list_shape(nsamples, {nanchors, BoundingBox::size});
+  output_desc[kBoxesOutId].type = bboxes_input.type();
+  output_desc[kLabelsOutId].shape = uniform_list_shape(nsamples, {nanchors});
+  output_desc[kLabelsOutId].type = labels_input.type();
+  return true;
+}
 
-  // Create output
+void BoxEncoder<CPUBackend>::RunImpl(Workspace &ws) {
+  const auto &bboxes_input = ws.Input<CPUBackend>(kBoxesInId);
+  const auto &labels_input = ws.Input<CPUBackend>(kLabelsInId);
   auto &bboxes_output = ws.Output<CPUBackend>(kBoxesOutId);
-  bboxes_output.Resize({static_cast<int>(anchors_.size()), BoundingBox::size}, bboxes_input.type());
-  auto out_boxes = bboxes_output.mutable_data<float>();
-
   auto &labels_output = ws.Output<CPUBackend>(kLabelsOutId);
-  labels_output.Resize({static_cast<int>(anchors_.size())}, labels_input.type());
-  auto out_labels = labels_output.mutable_data<int>();
+  auto &tp = ws.GetThreadPool();
+
+  const int nsamples = bboxes_input.num_samples();
+  const int nanchors = anchors_.size();
+  const int block_size = AnchorBlockSize(nsamples, tp.NumThreads());
+  const int nblocks = div_ceil(nanchors, block_size);
+
+  samples_.resize(nsamples);
+  for (int sample_idx = 0; sample_idx < nsamples; sample_idx++) {
+    auto &sample = samples_[sample_idx];
+    const auto &bboxes = bboxes_input[sample_idx];
+    int num_boxes = bboxes.shape()[0];
+    sample.boxes.resize(num_boxes);
+    ReadBoxes(make_span(sample.boxes),
+              make_cspan(bboxes.data<float>(), volume(bboxes.shape())), {}, {});
+    sample.box_areas.resize(num_boxes);
+    for (int box_idx = 0; box_idx < num_boxes; box_idx++)
+      sample.box_areas[box_idx] = volume(sample.boxes[box_idx]);
+    sample.ious.resize(static_cast<int64_t>(num_boxes) * nanchors);
+    sample.block_best.resize(nblocks * num_boxes);
+  }
 
-  WriteAnchorsToOutput(out_boxes, out_labels);
-  if (num_boxes == 0)
-    return;
+  // Stage 1: IoU matrix and the best anchor for each box, within each anchor block
+  for (int sample_idx = 0; sample_idx < nsamples; sample_idx++) {
+    int num_boxes = samples_[sample_idx].boxes.size();
+    if (num_boxes == 0)
+      continue;
+    for (int block_idx = 0; block_idx < nblocks; block_idx++) {
+      int begin = block_idx * block_size;
+      int end = std::min(begin + block_size, nanchors);
+      tp.AddWork([this, sample_idx, block_idx, begin, end](int) {
+        auto &sample = samples_[sample_idx];
+        int num_boxes = sample.boxes.size();
+        for (int box_idx = 0; box_idx < num_boxes; box_idx++) {
+          float *ious_row = sample.ious.data() + static_cast<int64_t>(box_idx) * anchors_.size();
+          sample.block_best[block_idx * num_boxes + box_idx] =
+              CalculateIousForBox(ious_row, sample.boxes[box_idx], sample.box_areas[box_idx],
+                                  begin, end);
+        }
+      }, static_cast<int64_t>(num_boxes) * (end - begin));
+    }
+  }
+  tp.RunAll();
+
+  // For best default box matched with current object let iou = 2, to make sure there is a match,
+  // as this object will be the best (highest IoU), for this default box
+  for (int sample_idx = 0; sample_idx < nsamples; sample_idx++) {
+    auto &sample = samples_[sample_idx];
+    int num_boxes = sample.boxes.size();
+    for (int box_idx = 0; box_idx < num_boxes; box_idx++) {
+      auto best = sample.block_best[box_idx];
+      for (int block_idx = 1; block_idx < nblocks; block_idx++) {
+        const auto &candidate = sample.block_best[block_idx * num_boxes + box_idx];
+        if (candidate.first >= best.first)
+          best = candidate;
+      }
+      sample.ious[static_cast<int64_t>(box_idx) * nanchors + best.second] = 2.;
+    }
+  }
 
-  const auto matches = MatchBoxesWithAnchors(boxes);
-  WriteMatchesToOutput(matches, boxes, labels, out_boxes, out_labels);
+  // Stage 2: find the best box for each anchor and write the encoded output
+  for (int sample_idx = 0; sample_idx < nsamples; sample_idx++) {
+    int num_boxes = samples_[sample_idx].boxes.size();
+    for (int block_idx = 0; block_idx < nblocks; block_idx++) {
+      int begin = block_idx * block_size;
+      int end = std::min(begin + block_size, nanchors);
+      tp.AddWork([&, sample_idx, begin, end](int) {
+        MatchAndWriteBlock(samples_[sample_idx], labels_input[sample_idx].data<int>(),
+                           bboxes_output.mutable_tensor<float>(sample_idx),
+                           labels_output.mutable_tensor<int>(sample_idx), begin, end);
+      }, static_cast<int64_t>(num_boxes + 1) * (end - begin));
+    }
+  }
+  tp.RunAll();
 }
 
 DALI_REGISTER_OPERATOR(BoxEncoder, BoxEncoder<CPUBackend>, CPU);
@@ -53,6 +53,7 @@ class BoxEncoder<CPUBackend>: public StatelessOperator<CPUBackend> {
 
     anchors_.resize(nanchors);
     ReadBoxes(make_span(anchors_), make_cspan(anchors), {}, {});
+    anchors_soa_.Init(anchors_);
 
     means_ = spec.GetArgument<vector<float>>("means");
     DALI_ENFORCE(means_.size() == 4,
@@ -70,41 +71,65 @@ class BoxEncoder<CPUBackend>: public StatelessOperator<CPUBackend> {
   DISABLE_COPY_MOVE_ASSIGN(BoxEncoder);
 
  protected:
-  bool HasContiguousOutputs() const override {
-    return false;
-  }
-
-  bool SetupImpl(std::vector<OutputDesc> &output_desc, const Workspace &ws) override {
-    return false;
-  }
+  bool SetupImpl(std::vector<OutputDesc> &output_desc, const Workspace &ws) override;
 
-  void RunImpl(SampleWorkspace &ws) override;
-  using StatelessOperator<CPUBackend>::RunImpl;
+  void RunImpl(Workspace &ws) override;
 
  private:
+  /**
+   * @brief Anchors stored in structure-of-arrays layout, so that IoUs against a range of
+   *        consecutive anchors can be computed with vector instructions.
+   */
+  struct AnchorsSoA {
+    vector<float> lo_x, lo_y, hi_x, hi_y, area;
+
+    void Init(const vector<BoundingBox> &anchors);
+  };
+
+  /**
+   * @brief Per-sample intermediate data, reused between iterations.
+   */
+  struct SampleData {
+    vector<BoundingBox> boxes;
+    vector<float> box_areas;
+    /// IoU matrix, num_boxes x num_anchors
+    vector<float> ious;
+    /// Best (IoU, anchor index) for each box, num_blocks x num_boxes
+    vector<std::pair<float, int>> block_best;
+  };
+
+  /**
+   * @brief Calculates IoUs of `box` with anchors in range [begin, end) and returns
+   *        the best one; ties are resolved in favor of the anchor with the higher index.
+   */
+  std::pair<float, int> CalculateIousForBox(float *ious, const BoundingBox &box, float box_area,
+                                            int begin, int end) const;
+
+  /**
+   * @brief Matches anchors in range [begin, end) with boxes and writes the encoded output
+   */
+  void MatchAndWriteBlock(const SampleData &sample, const int *labels,
+                          float *out_boxes, int *out_labels, int begin, int end) const;
+
+  void WriteAnchorsToOutput(float *out_boxes, int *out_labels, int begin, int end) const;
+
+  void WriteMatchToOutput(const BoundingBox &box, int label, int anchor_idx,
+                          float *out_boxes, int *out_labels) const;
+
+  int AnchorBlockSize(int nsamples, int num_threads) const;
+
   const float criteria_;
   vector<BoundingBox> anchors_;
+  AnchorsSoA anchors_soa_;
+  vector<SampleData> samples_;
 
   bool offset_;
   vector<float> means_;
   vector<float> stds_;
   float scale_;
 
-  vector<float> CalculateIous(const vector<BoundingBox> &boxes) const;
-
-  void CalculateIousForBox(float *ious, const BoundingBox &box) const;
-
-  void WriteAnchorsToOutput(float *out_boxes, int *out_labels) const;
-
-  void WriteMatchesToOutput(const vector<std::pair<unsigned, unsigned>> &matches,
-                            const vector<BoundingBox> &boxes, const int *labels,
-                            float *out_boxes, int *out_labels) const;
-
-  vector<std::pair<unsigned, unsigned>> MatchBoxesWithAnchors(
-    const vector<BoundingBox> &boxes) const;
-
-  unsigned FindBestBoxForAnchor(
-    unsigned anchor_idx, const vector<float> &ious, unsigned num_boxes) const;
+  /// Minimum number of anchors processed by a single task when a sample is split
+  static constexpr int kMinAnchorBlock = 2048;
 
   static const int kBoxesInId = 0;
   static const int kLabelsInId = 1;
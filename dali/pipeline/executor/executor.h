@@ -1,4 +1,4 @@
-// Copyright (c) 2017-2024, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+// Copyright (c) 2017-2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
 //
 // Licensed under the Apache License, Version 2.0 (the "License");
 // you may not use this file except in compliance with the License.
@@ -15,6 +15,8 @@
 #ifndef DALI_PIPELINE_EXECUTOR_EXECUTOR_H_
 #define DALI_PIPELINE_EXECUTOR_EXECUTOR_H_
 
+#include <functional>
+#include <stdexcept>
 #include <string>
 #include <unordered_map>
 #include <vector>
@@ -60,6 +62,17 @@ class DLL_PUBLIC ExecutorBase {
   DLL_PUBLIC virtual int InputFeedCount(std::string_view input_name) = 0;
   DLL_PUBLIC virtual OperatorBase *GetOperator(std::string_view name) = 0;
 
+  /**
+   * @brief Sets a function which is called each time the outputs of an iteration are ready.
+   *
+   * The function is called from an executor thread, after which popping the outputs doesn't
+   * wait for the iteration to complete on host. It's also called if the iteration fails.
+   * The callback must not be changed while the executor is running.
+   */
+  DLL_PUBLIC virtual void SetOutputReadyCallback(std::function<void()> callback) {
+    throw std::runtime_error("Output notifications are supported only by the dynamic executor.");
+  }
+
  protected:
   /**
    * @brief Returns true if conditionals are used in the executed graph, @see DetectConditionals().
@@ -24,6 +24,8 @@
 #include "dali/pipeline/executor/executor2/exec_graph.h"
 #include "dali/pipeline/executor/executor2/stream_assignment.h"
 #include "dali/pipeline/operator/builtin/input_operator.h"
+#include "dali/pipeline/operator/checkpointing/stateless_operator.h"
+#include "dali/pipeline/operator/error_reporting.h"
 
 namespace dali {
 namespace exec2 {
@@ -63,6 +65,15 @@ void ApplyConcurrencyLimit(ExecGraph &graph, OperatorConcurrency concurrency) {
   }
 }
 
+/** Checks whether several instances of the node's operator can run different iterations. */
+bool IsReplicable(const ExecNode &node) {
+  return node.op &&
+         node.backend == OpType::CPU &&
+         !node.is_batch_size_provider &&
+         !IsInputOperator(node.op.get()) &&
+         dynamic_cast<const StatelessOperator<CPUBackend> *>(node.op.get()) != nullptr;
+}
+
 }  // namespace
 
 class Executor2::Impl {
@@ -116,6 +127,8 @@ class Executor2::Impl {
     ApplyConcurrencyLimit(graph_, config_.concurrency);
     SetupStreams();
     SetupThreadPool();
+    SetupLanes();
+    SetupOutputBufferPools();
 
     last_iter_data_ = InitIterationData(-1);
     if (last_iter_data_->checkpoint)
@@ -131,7 +144,7 @@ class Executor2::Impl {
       throw std::runtime_error("The executor is not initialized.");
     InitIteration();
     DomainTimeRange tr("[DALI][Executor] Launch");
-    pending_outputs_.push(graph_.Launch(*exec_));
+    pending_outputs_.push(graph_.Launch(*exec_, output_ready_callback_));
   }
 
   void Prefetch() {
@@ -198,6 +211,7 @@ class Executor2::Impl {
     DomainTimeRange tr("[DALI][Executor] InitIteration");
     WorkspaceParams params{};
     params.max_batch_size = config_.max_batch_size;
+    params.lane = num_lanes_ > 1 ? iter_index_ % num_lanes_ : 0;
     params.iter_data = InitIterationData(iter_index_++);
     graph_.PrepareIteration(params);
   }
@@ -211,6 +225,10 @@ class Executor2::Impl {
     return prefetch_depth_;
   }
 
+  void SetOutputReadyCallback(std::function<void()> callback) {
+    output_ready_callback_ = std::move(callback);
+  }
+
   OperatorBase *GetOperator(std::string_view operator_name) const {
     auto it = node_map_.find(operator_name);
     if (it == node_map_.end())
@@ -350,7 +368,8 @@ class Executor2::Impl {
         config_.thread_pool_threads,
         config_.device.value_or(CPU_ONLY_DEVICE_ID),
         config_.set_affinity,
-        "Executorv_v2");
+        "Executorv_v2",
+        SharedCpuPool::Global());
     } else {
       tp_.reset();
     }
@@ -360,6 +379,83 @@ class Executor2::Impl {
     }
   }
 
+  /** Sets up the lanes which run the iterations of the CPU stage in parallel.
+   *
+   * Each lane has its own thread pool and CPU concurrency limit. Stateless CPU operators get
+   * an instance per lane, so they don't need to wait for the previous iteration. The remaining
+   * CPU operators have a single instance and still run the iterations sequentially.
+   */
+  void SetupLanes() {
+    num_lanes_ = 1;
+    if (config_.cpu_parallel_iterations <= 1 || graph_info_.num_cpu == 0 ||
+        config_.concurrency == OperatorConcurrency::None)
+      return;
+    num_lanes_ = config_.cpu_parallel_iterations;
+
+    std::vector<ThreadPool *> lane_tps = { tp_.get() };
+    for (int l = 1; l < num_lanes_; l++) {
+      lane_tps_.push_back(std::make_unique<ThreadPool>(
+        config_.thread_pool_threads,
+        config_.device.value_or(CPU_ONLY_DEVICE_ID),
+        config_.set_affinity,
+        make_string("Executorv_v2_", l).c_str(),
+        SharedCpuPool::Global()));
+      lane_tps.push_back(lane_tps_.back().get());
+    }
+
+    std::vector<std::shared_ptr<tasking::Semaphore>> lane_sems(num_lanes_);
+    for (auto &sem : lane_sems)
+      sem = std::make_shared<tasking::Semaphore>(1);
+
+    for (auto &n : graph_.Nodes()) {
+      if (n.backend != OpType::CPU || !n.op)
+        continue;
+      n.lanes.resize(num_lanes_);
+      for (int l = 0; l < num_lanes_; l++) {
+        n.lanes[l].env = n.env;
+        n.lanes[l].env.thread_pool = lane_tps[l];
+        n.lanes[l].concurrency = lane_sems[l];
+      }
+      if (IsReplicable(n)) {
+        for (int l = 1; l < num_lanes_; l++) {
+          try {
+            n.op_replicas.push_back(InstantiateOperator(n.op->GetSpec()));
+          } catch (...) {
+            PropagateError({std::current_exception(),
+                            "Critical error when building pipeline:\n" +
+                                GetErrorContextMessage(n.op->GetSpec()),
+                            "\nCurrent pipeline object is no longer valid."});
+          }
+        }
+      }
+    }
+    graph_.Invalidate();
+  }
+
+  /** Creates the pools which recycle the memory of CPU operator outputs.
+   *
+   * Outputs which may pass through an input don't own their memory and aren't recycled.
+   * Pinned outputs are determined later, when the graph is analyzed - these bypass the pool.
+   */
+  void SetupOutputBufferPools() {
+    if (!config_.recycle_cpu_outputs)
+      return;
+    for (auto &n : graph_.Nodes()) {
+      if (n.backend != OpType::CPU || !n.op)
+        continue;
+      auto &schema = n.op->GetSpec().GetSchema();
+      for (int o = 0; o < static_cast<int>(n.outputs.size()); o++) {
+        if (n.outputs[o].device != StorageDevice::CPU)
+          continue;
+        bool pass_through = false;
+        for (int i = 0; i < static_cast<int>(n.inputs.size()) && !pass_through; i++)
+          pass_through = schema.IsPassThrough(i, o, false);
+        if (!pass_through)
+          n.outputs[o].buffer_pool = std::make_shared<OutputBufferPool>();
+      }
+    }
+  }
+
   void Start() {
     if (state_ != State::Built)
       throw std::logic_error("Incorrect state transition.");
@@ -422,12 +518,16 @@ class Executor2::Impl {
   // Runtime environment
 
   std::unique_ptr<ThreadPool> tp_;
+  /** Thread pools of the lanes 1..N-1; lane 0 uses tp_ */
+  std::vector<std::unique_ptr<ThreadPool>> lane_tps_;
+  int num_lanes_ = 1;
   std::queue<tasking::TaskFuture> pending_outputs_;
   std::vector<CUDAStreamLease> streams_;
   std::map<std::string, ExecNode *, std::less<>> node_map_;
 
   ExecGraph graph_;
   std::unique_ptr<tasking::Executor> exec_;
+  std::function<void()> output_ready_callback_;
 
   // dynamic data
 
@@ -516,6 +616,10 @@ OperatorBase *Executor2::GetOperator(std::string_view name) {
   return impl_->GetOperator(name);
 }
 
+void Executor2::SetOutputReadyCallback(std::function<void()> callback) {
+  impl_->SetOutputReadyCallback(std::move(callback));
+}
+
 
 }  // namespace exec2
 }  // namespace dali
@@ -1,4 +1,4 @@
-// Copyright (c) 2023-2024, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+// Copyright (c) 2023-2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
 //
 // Licensed under the Apache License, Version 2.0 (the "License");
 // you may not use this file except in compliance with the License.
@@ -15,6 +15,7 @@
 #ifndef DALI_PIPELINE_EXECUTOR_EXECUTOR2_EXEC2_H_
 #define DALI_PIPELINE_EXECUTOR_EXECUTOR2_EXEC2_H_
 
+#include <functional>
 #include <memory>
 #include <string>
 #include <vector>
@@ -88,6 +89,21 @@ class DLL_PUBLIC Executor2 : public ExecutorBase {
     bool checkpointing = false;
     /** If true, pipeline outputs are returned on a stream (no sync with host) */
     bool async_output = false;
+    /** The number of iterations of the CPU stage which can run in parallel
+     *
+     * With a value greater than 1, stateless CPU operators are instantiated once per parallel
+     * iteration and each parallel iteration gets a separate thread pool with
+     * `thread_pool_threads` threads. Stateful CPU operators (e.g. readers) still run their
+     * iterations in order. The number of iterations in flight is also limited by the queue
+     * depth. It has no effect with OperatorConcurrency::None.
+     */
+    int cpu_parallel_iterations = 1;
+    /** If true, the memory of non-pinned CPU operator outputs is reused in later iterations
+     *
+     * The buffers released by the consumers are kept in a per-output pool and each new output
+     * gets the pooled buffer that fits it best.
+     */
+    bool recycle_cpu_outputs = true;
 
     QueueDepthPolicy queue_policy = QueueDepthPolicy::Legacy;
     OperatorConcurrency concurrency = OperatorConcurrency::Backend;
@@ -118,6 +134,7 @@ class DLL_PUBLIC Executor2 : public ExecutorBase {
   void RestoreStateFromCheckpoint(const Checkpoint &cpt) override;
   int InputFeedCount(std::string_view input_name) override;
   OperatorBase *GetOperator(std::string_view name) override;
+  void SetOutputReadyCallback(std::function<void()> callback) override;
 
  protected:
   bool HasConditionals() const override {
@@ -31,6 +31,14 @@ DALI_SCHEMA(Exec2TestOp)  // DALI_SCHEMA can't take a macro :(
 DALI_REGISTER_OPERATOR(Exec2TestOp, exec2::test::DummyOpCPU, CPU);
 DALI_REGISTER_OPERATOR(Exec2TestOp, exec2::test::DummyOpGPU, GPU);
 
+DALI_SCHEMA(Exec2StatelessTestOp)
+  .NumInput(0, 99)
+  .NumOutput(1)
+  .AddOptionalArg("delay", "in milliseconds, to wait inside the operator's Run", 1.0f)
+  .AddArg("addend", "a value added to the sum of inputs", DALI_INT32, true);
+
+DALI_REGISTER_OPERATOR(Exec2StatelessTestOp, exec2::test::StatelessDummyOpCPU, CPU);
+
 DALI_SCHEMA(Exec2Counter)
   .NumInput(0)
   .NumOutput(1);
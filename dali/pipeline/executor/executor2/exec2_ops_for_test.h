@@ -1,4 +1,4 @@
-// Copyright (c) 2024, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+// Copyright (c) 2024-2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
 //
 // Licensed under the Apache License, Version 2.0 (the "License");
 // you may not use this file except in compliance with the License.
@@ -24,6 +24,7 @@
 #include "dali/pipeline/operator/operator.h"
 #include "dali/pipeline/operator/arg_helper.h"
 #include "dali/pipeline/graph/op_graph2.h"
+#include "dali/pipeline/operator/checkpointing/stateless_operator.h"
 
 namespace dali {
 namespace exec2 {
@@ -79,6 +80,30 @@ class DummyOpCPU : public Operator<CPUBackend> {
   std::string instance_name_;
 };
 
+constexpr char kStatelessTestOpName[] = "Exec2StatelessTestOp";
+
+/** A stateless variant of DummyOpCPU.
+ *
+ * Executor2 can run several iterations of a stateless CPU operator at a time, each in a separate
+ * replica of the operator (see Executor2::Config::cpu_parallel_iterations).
+ */
+class StatelessDummyOpCPU : public StatelessOperator<CPUBackend> {
+ public:
+  explicit StatelessDummyOpCPU(const OpSpec &spec)
+  : StatelessOperator<CPUBackend>(spec), impl_(spec) {}
+
+  bool SetupImpl(std::vector<OutputDesc> &outs, const Workspace &ws) override {
+    return impl_.SetupImpl(outs, ws);
+  }
+
+  void RunImpl(Workspace &ws) override {
+    impl_.RunImpl(ws);
+  }
+
+ private:
+  DummyOpCPU impl_;
+};
+
 /** A dummy operator that takes a bunch of scalar inputs and returns their sum.
  *
  * This operator introduces some pointless GPU work to increase latency and expose bugs.
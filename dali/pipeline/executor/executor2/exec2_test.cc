@@ -1,4 +1,4 @@
-// Copyright (c) 2024, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+// Copyright (c) 2024-2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
 //
 // Licensed under the Apache License, Version 2.0 (the "License");
 // you may not use this file except in compliance with the License.
@@ -75,6 +75,8 @@ inline std::ostream &operator<<(std::ostream &os, const Executor2::Config &cfg)
     PRINT_CONFIG_FIELD(stream_policy),
     PRINT_CONFIG_FIELD(cpu_queue_depth),
     PRINT_CONFIG_FIELD(gpu_queue_depth),
+    PRINT_CONFIG_FIELD(cpu_parallel_iterations),
+    PRINT_CONFIG_FIELD(recycle_cpu_outputs),
     PRINT_CONFIG_FIELD(set_affinity));
   return os;
 }
@@ -110,6 +112,21 @@ TEST_P(Exec2Test, Graph1_CPUOnly) {
   }
 }
 
+TEST_P(Exec2Test, Graph1_CPUOnlyStateless) {
+  Executor2 exec(config_);
+  graph::OpGraph graph = GetTestGraph1(kStatelessTestOpName);
+  exec.Build(graph);
+  for (int i = 0; i < 10; i++) {
+    exec.Run();
+  }
+  Workspace ws;
+  for (int i = 0; i < 10; i++) {
+    ws.Clear();
+    exec.Outputs(&ws);
+    CheckTestGraph1Results(ws, config_.max_batch_size);
+  }
+}
+
 TEST_P(Exec2Test, Graph2_CPU2GPU) {
   Executor2 exec(config_);
   graph::OpGraph graph = GetTestGraph2();
@@ -146,6 +163,20 @@ TEST_P(Exec2Test, Graph3_SinkOnly) {
   }
 }
 
+TEST_P(Exec2Test, Graph4_StatefulThenStateless) {
+  Executor2 exec(config_);
+  graph::OpGraph graph = GetTestGraph4(32, 1);
+  exec.Build(graph);
+  for (int i = 0; i < 10; i++) {
+    exec.Run();
+  }
+  Workspace ws;
+  for (int i = 0; i < 10; i++) {
+    ws.Clear();
+    exec.Outputs(&ws);
+    CheckTestGraph4Results(ws, config_.max_batch_size, i);
+  }
+}
 
 Executor2::Config MakeCfg(QueueDepthPolicy q, OperatorConcurrency c, StreamPolicy s) {
   Executor2::Config cfg;
@@ -158,11 +189,28 @@ Executor2::Config MakeCfg(QueueDepthPolicy q, OperatorConcurrency c, StreamPolic
   return cfg;
 }
 
+Executor2::Config MakeParallelCfg(QueueDepthPolicy q, OperatorConcurrency c, int iterations) {
+  Executor2::Config cfg = MakeCfg(q, c, StreamPolicy::PerBackend);
+  cfg.cpu_parallel_iterations = iterations;
+  cfg.cpu_queue_depth = iterations;
+  cfg.operator_threads = iterations + 1;
+  return cfg;
+}
+
+Executor2::Config MakeNoRecyclingCfg(QueueDepthPolicy q, OperatorConcurrency c) {
+  Executor2::Config cfg = MakeCfg(q, c, StreamPolicy::PerBackend);
+  cfg.recycle_cpu_outputs = false;
+  return cfg;
+}
+
 std::vector<Executor2::Config> configs = {
   MakeCfg(QueueDepthPolicy::OutputOnly, OperatorConcurrency::None, StreamPolicy::Single),
   MakeCfg(QueueDepthPolicy::FullyBuffered, OperatorConcurrency::Full, StreamPolicy::Single),
   MakeCfg(QueueDepthPolicy::BackendChange, OperatorConcurrency::Backend, StreamPolicy::PerBackend),
   MakeCfg(QueueDepthPolicy::FullyBuffered, OperatorConcurrency::Full, StreamPolicy::PerOperator),
+  MakeParallelCfg(QueueDepthPolicy::FullyBuffered, OperatorConcurrency::Backend, 3),
+  MakeParallelCfg(QueueDepthPolicy::OutputOnly, OperatorConcurrency::Full, 3),
+  MakeNoRecyclingCfg(QueueDepthPolicy::FullyBuffered, OperatorConcurrency::Backend),
 };
 
 INSTANTIATE_TEST_SUITE_P(Exec2Test, Exec2Test, testing::ValuesIn(configs));
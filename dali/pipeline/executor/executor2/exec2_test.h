@@ -36,21 +36,21 @@ inline auto &AddCommonArgs(
   return spec;
 }
 
-inline auto GetTestGraph1() {
-  auto spec0 = OpSpec(kTestOpName)
+inline auto GetTestGraph1(const char *op_name = kTestOpName) {
+  auto spec0 = OpSpec(op_name)
     .AddArg("name", "op0")
     .AddOutput("op0_0", StorageDevice::CPU)
     .AddArg("addend", 10);
-  auto spec1 = OpSpec(kTestOpName)
+  auto spec1 = OpSpec(op_name)
     .AddArg("name", "op1")
     .AddArg("addend", 20)
     .AddOutput("op1_0", StorageDevice::CPU);
-  auto spec2 = OpSpec(kTestOpName)
+  auto spec2 = OpSpec(op_name)
     .AddInput("op0_0", StorageDevice::CPU)
     .AddArg("name", "op2")
     .AddArgumentInput("addend", "op1_0")
     .AddOutput("op2_0", StorageDevice::CPU);
-  auto spec3 = OpSpec(kTestOpName)
+  auto spec3 = OpSpec(op_name)
     .AddArg("name", "op3")
     .AddInput("op0_0", StorageDevice::CPU)
     .AddInput("op1_0", StorageDevice::CPU)
@@ -169,6 +169,37 @@ inline auto GetTestGraph3() {
   return std::move(b).GetGraph(true);
 }
 
+inline auto GetTestGraph4(int max_batch_size, float delay_ms) {
+  auto spec0 = OpSpec(kCounterOpName)
+    .AddArg("name", "op0")
+    .AddOutput("op0_0", StorageDevice::CPU);
+  auto spec1 = OpSpec(kStatelessTestOpName)
+    .AddArg("name", "op1")
+    .AddInput("op0_0", StorageDevice::CPU)
+    .AddArg("addend", 100)
+    .AddArg("delay", delay_ms)
+    .AddOutput("op1_0", StorageDevice::CPU);
+  graph::OpGraph::Builder b;
+  b.Add("op0", std::move(AddCommonArgs(spec0, max_batch_size)));
+  b.Add("op1", std::move(AddCommonArgs(spec1, max_batch_size)));
+  b.AddOutput("op1_0_cpu");
+  return std::move(b).GetGraph(true);
+}
+
+inline void CheckTestGraph4Results(const Workspace &ws, int batch_size, int iteration) {
+  auto &o = ws.Output<CPUBackend>(0);
+  ASSERT_EQ(o.num_samples(), batch_size);
+  for (int i = 0; i < batch_size; i++) {
+    // The pipeline:
+    // op0 = Counter()
+    // op1 = StatelessDummyOp(op0, addend=100)
+    // return op1
+    //
+    // The counter is stateful and must see the iterations in order.
+    EXPECT_EQ(*o[i].data<int>(), iteration * batch_size + i + 100 + i);
+  }
+}
+
 }  // namespace test
 }  // namespace exec2
 }  // namespace dali
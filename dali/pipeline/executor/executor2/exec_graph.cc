@@ -1,4 +1,4 @@
-// Copyright (c) 2024, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+// Copyright (c) 2024-2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
 //
 // Licensed under the Apache License, Version 2.0 (the "License");
 // you may not use this file except in compliance with the License.
@@ -13,6 +13,7 @@
 // limitations under the License.
 
 #include <cassert>
+#include <functional>
 #include <utility>
 #include "dali/core/cuda_event_pool.h"
 #include "dali/pipeline/executor/executor2/exec_graph.h"
@@ -58,9 +59,12 @@ ExecNode::ExecNode(std::unique_ptr<OperatorBase> op, const graph::OpNode *def)
 }
 
 void ExecNode::CreateMainTask(const WorkspaceParams &params) {
+  lane_ = params.lane;
+  auto &instance = Instance(lane_);
   main_task_ = ExecNodeTask::CreateTask(this, params);
-  if (prev_task_)
-    main_task_->Succeed(prev_task_);
+  if (instance.prev_task)
+    main_task_->Succeed(instance.prev_task);
+  instance.prev_task = main_task_;
 }
 
 void ExecNode::CreateAuxTasks() {
@@ -68,8 +72,8 @@ void ExecNode::CreateAuxTasks() {
   // one concurrency semaphore.
   // Note that operator cannot run parallel to its previous iterations and we add a temporal
   // dependency between the previous and current iteration.
-  if (concurrency)
-    main_task_->GuardWith(concurrency);
+  if (auto &sem = Concurrency(lane_))
+    main_task_->GuardWith(sem);
 
   // The output queue depth may be limited - this is guarded by a semaphore with initial count
   // equal to the queue depth.
@@ -91,11 +95,19 @@ void ExecNode::CreateAuxTasks() {
   }
 }
 
-std::optional<tasking::TaskFuture> ExecNode::Launch(Scheduler &sched) {
+std::optional<tasking::TaskFuture> ExecNode::Launch(
+      Scheduler &sched,
+      const std::function<void()> &on_output_ready) {
   if (release_outputs_)
     sched.AddSilentTask(release_outputs_);
   if (is_pipeline_output) {
-    return sched.AddTask(main_task_);
+    auto future = sched.AddTask(main_task_);
+    if (on_output_ready) {
+      auto notify = tasking::Task::Create(on_output_ready);
+      notify->Succeed(main_task_);
+      sched.AddSilentTask(notify);
+    }
+    return future;
   } else {
     sched.AddSilentTask(main_task_);
     return std::nullopt;
@@ -145,35 +157,39 @@ std::unique_ptr<Workspace> ExecNode::CreateOpWorkspace() {
 
 std::pair<std::unique_ptr<Workspace>, CUDASharedEvent>
 ExecNode::GetWorkspace(WorkspaceParams params) {
-  if (!ws_) {
-    assert(!has_workspace_);
+  auto &instance = Instance(params.lane);
+  auto &ws = instance.ws;
+  if (!ws) {
+    assert(!instance.has_workspace);
     if (op) {
-      ws_ = CreateOpWorkspace();
+      ws = CreateOpWorkspace();
     } else {
-      ws_ = CreateOutputWorkspace();
+      ws = CreateOutputWorkspace();
     }
-    has_workspace_ = true;
+    instance.has_workspace = true;
   }
   if (!params.env)
-    params.env = &env;
+    params.env = &Env(params.lane);
 
-  ApplyWorkspaceParams(*ws_, params);
+  ApplyWorkspaceParams(*ws, params);
 
-  if (ws_->output_order().is_device())
-    ws_event_ = CUDASharedEvent::GetFromPool();
+  auto &event = instance.ws_event;
+  if (ws->output_order().is_device())
+    event = CUDASharedEvent::GetFromPool();
   else
-    ws_event_.reset();
-  ws_->set_event(ws_event_);
+    event.reset();
+  ws->set_event(event);
 
-  return { std::move(ws_), ws_event_ };
+  return { std::move(ws), event };
 }
 
-void ExecNode::PutWorkspace(std::unique_ptr<Workspace> &&ws) {
-  assert(has_workspace_);
+void ExecNode::PutWorkspace(std::unique_ptr<Workspace> &&ws, int lane) {
+  auto &instance = Instance(lane);
+  assert(instance.has_workspace);
   assert(ws);
-  assert(!ws_);
-  assert(!ws->has_event() || ws->event() == ws_event_.get());
-  ws_ = std::move(ws);
+  assert(!instance.ws);
+  assert(!ws->has_event() || ws->event() == instance.ws_event.get());
+  instance.ws = std::move(ws);
 }
 
 void ExecNode::AddDataDeps() {
@@ -280,7 +296,8 @@ tasking::SharedTask ExecGraph::InferBatchSize(const std::shared_ptr<IterationDat
 }
 
 
-tasking::TaskFuture ExecGraph::Launch(tasking::Scheduler &sched) {
+tasking::TaskFuture ExecGraph::Launch(tasking::Scheduler &sched,
+                                      const std::function<void()> &on_output_ready) {
   if (!iteration_prepared_)
     throw std::logic_error("Launch called before PrepareIteration");
   iteration_prepared_ = false;
@@ -291,7 +308,7 @@ tasking::TaskFuture ExecGraph::Launch(tasking::Scheduler &sched) {
 
   std::optional<tasking::TaskFuture> ret;
   for (auto &n : nodes_) {
-    auto maybe_future = n.Launch(sched);
+    auto maybe_future = n.Launch(sched, on_output_ready);
     if (maybe_future) {
       assert(!ret && "Internal error - multiple output nodes present");
       ret = std::move(maybe_future);
@@ -1,4 +1,4 @@
-// Copyright (c) 2023-2024, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+// Copyright (c) 2023-2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
 //
 // Licensed under the Apache License, Version 2.0 (the "License");
 // you may not use this file except in compliance with the License.
@@ -27,6 +27,7 @@
 #include <vector>
 
 #include "dali/core/cuda_shared_event.h"
+#include "dali/pipeline/executor/executor2/output_buffer_pool.h"
 #include "dali/pipeline/operator/operator.h"
 #include "dali/pipeline/workspace/workspace.h"
 
@@ -48,6 +49,8 @@ struct WorkspaceParams {
   ExecEnv *env = nullptr;
   std::shared_ptr<IterationData> iter_data;
   int max_batch_size = -1;
+  /** The lane of the iteration - see ExecNode::lanes */
+  int lane = 0;
 };
 
 inline void ApplyWorkspaceParams(Workspace &ws, const WorkspaceParams &params) {
@@ -118,6 +121,9 @@ struct ExecOutputDesc {
   bool pinned = false;
 
   bool parallel_consumers = true;
+
+  /** Recycles the buffers of a non-pinned CPU output; null if the output is not recycled. */
+  std::shared_ptr<OutputBufferPool> buffer_pool;
 };
 
 /** An execution node.
@@ -174,6 +180,45 @@ class DLL_PUBLIC ExecNode {
   /** Data-independent execution environment (thread pool, stream, etc). */
   ExecEnv env = {};
 
+  /** Execution resources of a lane.
+   *
+   * When the executor runs several iterations in parallel, the iteration `i` is assigned
+   * the lane `i % num_lanes`. The operators which run in a given lane share its thread pool
+   * and concurrency limit, so that iterations in different lanes don't compete for them.
+   */
+  struct Lane {
+    ExecEnv env;
+    std::shared_ptr<tasking::Semaphore> concurrency;
+  };
+
+  /** Per-lane execution resources. If empty, `env` and `concurrency` are used in all lanes. */
+  std::vector<Lane> lanes;
+
+  /** Additional instances of a stateless operator, used in lanes 1..N-1.
+   *
+   * A node with replicas doesn't have to wait for its previous iteration - it waits only for
+   * the previous iteration of the same instance.
+   */
+  std::vector<std::unique_ptr<OperatorBase>> op_replicas;
+
+  /** Returns the operator instance used in the given lane. */
+  OperatorBase *Op(int lane) const {
+    if (op_replicas.empty())
+      return op.get();
+    int instance = InstanceIdx(lane);
+    return instance == 0 ? op.get() : op_replicas[instance - 1].get();
+  }
+
+  /** Returns the execution environment used in the given lane. */
+  ExecEnv &Env(int lane) {
+    return lanes.empty() ? env : lanes[lane % lanes.size()].env;
+  }
+
+  /** Returns the concurrency limit used in the given lane. */
+  const std::shared_ptr<tasking::Semaphore> &Concurrency(int lane) const {
+    return lanes.empty() ? concurrency : lanes[lane % lanes.size()].concurrency;
+  }
+
   /** Obtains the cached workspace, if present, or creates a new one.
    *
    * There can be only one workspace per node. The workspace is removed and then put back.
@@ -185,8 +230,9 @@ class DLL_PUBLIC ExecNode {
   /** Puts the workspace back into the node for later reuse.
    *
    * The workspace must not contain any TensorLists.
+   * The `lane` must be the same as the one in WorkspaceParams passed to GetWorkspace.
    */
-  void PutWorkspace(std::unique_ptr<Workspace> &&ws);
+  void PutWorkspace(std::unique_ptr<Workspace> &&ws, int lane = 0);
 
   /** The instance name of the operator. */
   const std::string instance_name;
@@ -212,12 +258,12 @@ class DLL_PUBLIC ExecNode {
   }
 
  private:
-  /** The task from the previous iteration - kept in order to maintain execution order */
-  tasking::SharedTask prev_task_;
-
   /** The task from the current iteration */
   tasking::SharedTask main_task_;
 
+  /** The lane of the current iteration */
+  int lane_ = 0;
+
   /** The task that releases the output_queue_limit semaphore.
    *
    * IMPORTANT: Release_outputs_ is NOT required for correctness. It's sole function is limiting
@@ -244,16 +290,36 @@ class DLL_PUBLIC ExecNode {
   /** Creates a workspace suitable for running the operator `op`. */
   std::unique_ptr<Workspace> CreateOpWorkspace();
 
-  /** The workspace.
-   *
-   * An operator never executes in parallel with its previous instance,
-   * so we never need more than one workspace.
-   */
-  std::unique_ptr<Workspace> ws_;
-  bool has_workspace_ = false;
+  /** The runtime state of an operator instance. */
+  struct InstanceState {
+    /** The task from the previous iteration - kept in order to maintain execution order */
+    tasking::SharedTask prev_task;
+
+    /** The workspace.
+     *
+     * An operator instance never executes in parallel with its previous iteration,
+     * so we never need more than one workspace per instance.
+     */
+    std::unique_ptr<Workspace> ws;
+    bool has_workspace = false;
+
+    /** The event associated with the workspace */
+    CUDASharedEvent ws_event;
+  };
 
-  /** The event associated with the workspace */
-  CUDASharedEvent ws_event_;
+  /** The state of `op` followed by the states of `op_replicas` */
+  SmallVector<InstanceState, 1> instances_;
+
+  int InstanceIdx(int lane) const {
+    return lane % (op_replicas.size() + 1);
+  }
+
+  InstanceState &Instance(int lane) {
+    size_t idx = InstanceIdx(lane);
+    if (instances_.size() <= idx)
+      instances_.resize(op_replicas.size() + 1);
+    return instances_[idx];
+  }
 
   /** Custom data stored alongside the node.
    *
@@ -264,7 +330,7 @@ class DLL_PUBLIC ExecNode {
 
   /** Moves to a new iteration. */
   void NextIter() {
-    prev_task_ = std::move(main_task_);
+    main_task_.reset();
     release_outputs_.reset();
   }
 
@@ -283,7 +349,8 @@ class DLL_PUBLIC ExecNode {
   void AddDataDeps();
   /** Creates auxiliary tasks and applies concurrency constraints. */
   void CreateAuxTasks();
-  std::optional<tasking::TaskFuture> Launch(tasking::Scheduler &sched);
+  std::optional<tasking::TaskFuture> Launch(tasking::Scheduler &sched,
+                                            const std::function<void()> &on_output_ready);
 };
 
 /** The execution graph */
@@ -375,8 +442,13 @@ class DLL_PUBLIC ExecGraph {
   /** Prepares the run-time resources necessary to execute an interation */
   void PrepareIteration(const WorkspaceParams &params);
 
-  /** Executes the recently prepared iteration */
-  tasking::TaskFuture Launch(tasking::Scheduler &sched);
+  /** Executes the recently prepared iteration
+   *
+   * @param on_output_ready If not empty, it's called when the output task of the iteration
+   *                        completes (successfully or not).
+   */
+  tasking::TaskFuture Launch(tasking::Scheduler &sched,
+                             const std::function<void()> &on_output_ready = {});
 
   /** Populates the graph based on a pipeline definiton graph. */
   void Lower(const graph::OpGraph &def);
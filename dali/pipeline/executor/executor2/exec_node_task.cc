@@ -43,6 +43,8 @@ class OpTask : public ExecNodeTask {
   /** Gets a functor that runs the operator. */
   auto GetRunnable() && {
     assert(!node_->is_pipeline_output);
+    // The metadata is initialized here, because replicated nodes can run in parallel
+    InitMeta();
     return [self = std::move(*this)](tasking::Task *t) mutable {
       self.task_ = t;
       return self.Run();
@@ -101,6 +103,12 @@ class OpTask : public ExecNodeTask {
   void RunOp();
   OpTaskOutputs GetWorkspaceOutputs();
 
+  /** Replaces a recycled CPU output with a pooled buffer that fits the output better, if any.
+   *
+   * Before Setup, the size of the output is only guessed based on the previous iteration.
+   */
+  void RefitOutputBuffer(int output_idx, const OutputDesc &desc);
+
 
   /** If true, the operator's Setup and Run are skipped. */
   bool skip_ = false;
@@ -146,8 +154,6 @@ class OpTask : public ExecNodeTask {
 };
 
 OpTask::OpTaskOutputs OpTask::Run() {
-  InitMeta();
-
   // We cannot use DomainTimeRange, because it would outlive workspace_scope - we can use `optional`
   // to shorten the life of the range.
   std::optional<DomainTimeRange> ws_init_tr;
@@ -264,8 +270,14 @@ void OpTask::SetupOp() {
   for (int i = 0; i < nout; i++) {
     if (ws.OutputIsType<CPUBackend>(i)) {
       assert(!ws.OutputPtr<CPUBackend>(i));
-      auto tl = std::make_shared<TensorList<CPUBackend>>();
       bool pinned = node_->outputs[i].pinned;
+      auto &pool = node_->outputs[i].buffer_pool;
+      if (pool && !pinned) {
+        // the recycled buffers are never pinned
+        ws.SetOutput(i, pool->Get(pool->SizeHint()));
+        continue;
+      }
+      auto tl = std::make_shared<TensorList<CPUBackend>>();
       tl->set_pinned(pinned);
       if (pinned) {
         tl->set_order(ws.output_order(), false);
@@ -293,10 +305,11 @@ void OpTask::SetupOp() {
     std::vector<OutputDesc> output_descs;
     output_descs.reserve(nout);
     // If Setup returns true, we must resize the outputs;
-    if (node_->op->Setup(output_descs, ws)) {
+    if (Op()->Setup(output_descs, ws)) {
       assert(output_descs.size() == static_cast<size_t>(nout));
       for (int i = 0; i < nout; i++) {
         if (ws.OutputIsType<CPUBackend>(i)) {
+          RefitOutputBuffer(i, output_descs[i]);
           ws.Output<CPUBackend>(i).Resize(output_descs[i].shape, output_descs[i].type);
         } else if (ws.OutputIsType<GPUBackend>(i)) {
           auto &output = ws.Output<GPUBackend>(i);
@@ -309,10 +322,21 @@ void OpTask::SetupOp() {
   }
 }
 
+void OpTask::RefitOutputBuffer(int output_idx, const OutputDesc &desc) {
+  auto &pool = node_->outputs[output_idx].buffer_pool;
+  if (!pool || node_->outputs[output_idx].pinned)
+    return;
+  auto &ws = *ws_;
+  size_t bytes = desc.shape.num_elements() * TypeTable::GetTypeInfo(desc.type).size();
+  auto &out = ws.Output<CPUBackend>(output_idx);
+  if (auto better = pool->GetBetterFit(bytes, out.capacity()))
+    ws.SetOutput(output_idx, std::move(better));
+}
+
 void OpTask::RunOp() {
   if (!skip_) {
     DomainTimeRange tr(meta_->nvtx.run_range_name, meta_->nvtx.range_color);
-    node_->op->Run(*ws_);
+    Op()->Run(*ws_);
     {
       DomainTimeRange r("[Exec] ResetInputLayouts", RangeBase::kMagenta);
       ResetInputLayouts();
@@ -324,7 +348,7 @@ void OpTask::RunOp() {
   }
   assert(ws_->GetIterationData());
   if (auto cpt = ws_->GetIterationData()->checkpoint) {
-    node_->op->SaveState(cpt->GetOpCheckpoint(node_->instance_name), ws_->output_order());
+    Op()->SaveState(cpt->GetOpCheckpoint(node_->instance_name), ws_->output_order());
   }
   if (ws_->has_stream()) {
     DomainTimeRange r("[Exec] Post-run set events", RangeBase::kMagenta);
@@ -466,6 +490,8 @@ OpTask::OpTaskOutputs OpTask::GetWorkspaceOutputs() {
         }
         ptr->set_ready_event(event_);
       }
+      if (auto &pool = node_->outputs[o].buffer_pool)
+        pool->UpdateSizeHint(ptr->nbytes());
       ret.push_back(OperatorIO<CPUBackend>{std::move(ptr), order});
     } else {
       assert(ws_->OutputIsType<GPUBackend>(o));
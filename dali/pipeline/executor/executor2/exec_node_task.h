@@ -84,9 +84,14 @@ class ExecNodeTask {
     assert(ws_->output_order() && "Workspace must have a valid order");
     return AtScopeExit([this]() {
       ClearWorkspace();
-      node_->PutWorkspace(std::move(ws_));
+      node_->PutWorkspace(std::move(ws_), ws_params_.lane);
     });
   }
+
+  /** The operator instance which runs in the lane of this task's iteration. */
+  OperatorBase *Op() const {
+    return node_->Op(ws_params_.lane);
+  }
 };
 
 
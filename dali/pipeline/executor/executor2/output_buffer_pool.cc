@@ -0,0 +1,161 @@
+// Copyright (c) 2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <iterator>
+#include <memory>
+#include <utility>
+#include "dali/pipeline/executor/executor2/output_buffer_pool.h"
+
+namespace dali {
+namespace exec2 {
+
+namespace {
+
+/** Checks whether the TensorList is the only owner of its memory.
+ *
+ * In a contiguous batch, the samples alias the batch buffer - these references are accounted for.
+ * Any other reference means that the memory is used elsewhere and cannot be overwritten.
+ */
+bool IsSoleOwner(TensorList<CPUBackend> &tl) {
+  if (tl.shares_data())
+    return false;
+  int n = tl.num_samples();
+  if (tl.IsContiguous()) {
+    auto &owner = unsafe_owner(tl);
+    if (!owner)
+      return false;
+    int64_t expected_refs = 1;
+    for (int i = 0; i < n; i++) {
+      auto &sample = unsafe_sample_owner(tl, i);
+      if (same_managed_object(sample, owner))
+        expected_refs++;
+      else if (sample && sample.use_count() != 1)
+        return false;
+    }
+    return owner.use_count() == expected_refs;
+  } else {
+    for (int i = 0; i < n; i++) {
+      auto &sample = unsafe_sample_owner(tl, i);
+      if (sample && sample.use_count() != 1)
+        return false;
+    }
+    return true;
+  }
+}
+
+/** Clears the metadata which an operator might not overwrite in the next iteration. */
+void ResetMetadata(TensorList<CPUBackend> &tl) {
+  for (int i = 0; i < tl.num_samples(); i++) {
+    tl.SetSourceInfo(i, {});
+    tl.SetSkipSample(i, false);
+  }
+  tl.SetLayout({});
+  tl.set_ready_event({});
+}
+
+/** Checks whether a buffer of given capacity would be reallocated when resized to `bytes`. */
+bool NeedsRealloc(size_t bytes, size_t capacity) {
+  return bytes > capacity || bytes < capacity * Buffer<CPUBackend>::GetShrinkThreshold();
+}
+
+}  // namespace
+
+std::shared_ptr<OutputBufferPool::TL> OutputBufferPool::Get(size_t expected_bytes) {
+  std::unique_lock lock(mtx_);
+  if (buffers_.empty()) {
+    stats_.created++;
+    lock.unlock();
+    auto tl = std::make_unique<TL>();
+    tl->set_pinned(false);
+    return Wrap(std::move(tl));
+  }
+  auto it = buffers_.lower_bound(expected_bytes);
+  if (it == buffers_.end())
+    it = std::prev(it);  // nothing is large enough - take the largest buffer
+  auto tl = Take(it);
+  lock.unlock();
+  return Wrap(std::move(tl));
+}
+
+std::shared_ptr<OutputBufferPool::TL>
+OutputBufferPool::GetBetterFit(size_t bytes, size_t current_capacity) {
+  std::unique_lock lock(mtx_);
+  auto it = buffers_.lower_bound(bytes);
+  if (it == buffers_.end() || NeedsRealloc(bytes, it->first))
+    return nullptr;
+  if (!NeedsRealloc(bytes, current_capacity) && it->first >= current_capacity)
+    return nullptr;
+  auto tl = Take(it);
+  lock.unlock();
+  return Wrap(std::move(tl));
+}
+
+void OutputBufferPool::Clear() {
+  Buffers buffers;
+  {
+    std::lock_guard g(mtx_);
+    buffers.swap(buffers_);
+    stats_.pooled = 0;
+    stats_.pooled_bytes = 0;
+  }
+  // the buffers are freed here, outside of the lock
+}
+
+OutputBufferPool::Stats OutputBufferPool::GetStats() const {
+  std::lock_guard g(mtx_);
+  return stats_;
+}
+
+std::unique_ptr<OutputBufferPool::TL> OutputBufferPool::Take(Buffers::iterator it) {
+  auto tl = std::move(it->second);
+  stats_.reused++;
+  stats_.pooled--;
+  stats_.pooled_bytes -= it->first;
+  buffers_.erase(it);
+  return tl;
+}
+
+std::shared_ptr<OutputBufferPool::TL> OutputBufferPool::Wrap(std::unique_ptr<TL> tl) {
+  return std::shared_ptr<TL>(tl.release(), [weak_pool = weak_from_this()](TL *ptr) {
+    std::unique_ptr<TL> owned(ptr);
+    if (auto pool = weak_pool.lock())
+      pool->Recycle(std::move(owned));
+  });
+}
+
+void OutputBufferPool::Recycle(std::unique_ptr<TL> tl) {
+  size_t capacity = 0;
+  bool reusable = false;
+  try {
+    if (!tl->is_pinned() && IsSoleOwner(*tl)) {
+      capacity = tl->capacity();
+      ResetMetadata(*tl);
+      reusable = capacity > 0;
+    }
+  } catch (...) {
+    reusable = false;
+  }
+
+  std::lock_guard g(mtx_);
+  if (!reusable) {
+    stats_.discarded++;
+    return;  // the TensorList is destroyed when `tl` goes out of scope
+  }
+  stats_.pooled++;
+  stats_.pooled_bytes += capacity;
+  buffers_.emplace(capacity, std::move(tl));
+}
+
+}  // namespace exec2
+}  // namespace dali
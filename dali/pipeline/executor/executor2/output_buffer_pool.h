@@ -0,0 +1,120 @@
+// Copyright (c) 2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef DALI_PIPELINE_EXECUTOR_EXECUTOR2_OUTPUT_BUFFER_POOL_H_
+#define DALI_PIPELINE_EXECUTOR_EXECUTOR2_OUTPUT_BUFFER_POOL_H_
+
+#include <atomic>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include "dali/core/api_helper.h"
+#include "dali/pipeline/data/backend.h"
+#include "dali/pipeline/data/tensor_list.h"
+
+namespace dali {
+namespace exec2 {
+
+/** Recycles the storage of the (non-pinned) host TensorLists produced by an operator output.
+ *
+ * Without recycling, each iteration produces a new TensorList, which allocates memory as soon
+ * as it's resized. With variable-size batches the allocations are also hard to reuse by the
+ * underlying memory resource.
+ *
+ * The pool hands out TensorLists which are returned to the pool when the last reference is
+ * dropped - this can happen in any thread, e.g. when the user releases the pipeline outputs.
+ * The returned buffers are kept ordered by their capacity, so that the buffer that fits
+ * the requested size best can be found quickly.
+ *
+ * A buffer is created only when the pool is empty, so the number of buffers never exceeds
+ * the peak number of outputs that were alive at the same time.
+ *
+ * A TensorList is recycled only if it's the sole owner of its memory. If the memory is still
+ * referenced elsewhere (e.g. it was shared with a TensorList produced by a pass-through operator
+ * or with an external consumer), the TensorList is simply destroyed.
+ *
+ * The pool must be owned by a std::shared_ptr. The buffers which are still in use when the pool
+ * is destroyed are freed normally.
+ */
+class DLL_PUBLIC OutputBufferPool : public std::enable_shared_from_this<OutputBufferPool> {
+ public:
+  using TL = TensorList<CPUBackend>;
+
+  /** Obtains a buffer suitable for storing `expected_bytes` bytes of data.
+   *
+   * The buffer with the smallest capacity that's no less than `expected_bytes` is chosen.
+   * If there's no such buffer, the largest one is returned. If the pool is empty, a new
+   * (empty) TensorList is created.
+   */
+  std::shared_ptr<TL> Get(size_t expected_bytes);
+
+  /** Obtains a buffer with a capacity that's not smaller than `bytes`
+   *
+   * The function returns a pooled buffer only if it's a better fit for `bytes` than
+   * `current_capacity`, i.e. when the current buffer would need to be reallocated or when
+   * the pooled buffer is smaller than the current one.
+   * If there's no better buffer, the function returns null.
+   */
+  std::shared_ptr<TL> GetBetterFit(size_t bytes, size_t current_capacity);
+
+  /** The size of the most recently produced output - used as a hint for the next iteration. */
+  size_t SizeHint() const {
+    return size_hint_.load(std::memory_order_relaxed);
+  }
+
+  void UpdateSizeHint(size_t bytes) {
+    size_hint_.store(bytes, std::memory_order_relaxed);
+  }
+
+  /** Removes all pooled buffers. The buffers which are in use are not affected. */
+  void Clear();
+
+  struct Stats {
+    /** The number of TensorLists created by the pool */
+    int64_t created = 0;
+    /** The number of times a TensorList was taken from the pool */
+    int64_t reused = 0;
+    /** The number of TensorLists that couldn't be recycled (e.g. their memory was shared) */
+    int64_t discarded = 0;
+    /** The number of TensorLists currently in the pool */
+    int64_t pooled = 0;
+    /** The total capacity of the TensorLists currently in the pool */
+    size_t pooled_bytes = 0;
+  };
+
+  Stats GetStats() const;
+
+ private:
+  using Buffers = std::multimap<size_t, std::unique_ptr<TL>>;
+
+  /** Wraps a TensorList in a shared pointer which puts the TensorList back to this pool. */
+  std::shared_ptr<TL> Wrap(std::unique_ptr<TL> tl);
+
+  /** Takes the buffer from the pool. Requires the lock to be held. */
+  std::unique_ptr<TL> Take(Buffers::iterator it);
+
+  /** Puts the TensorList back in the pool or destroys it, if it's not reusable. */
+  void Recycle(std::unique_ptr<TL> tl);
+
+  mutable std::mutex mtx_;
+  Buffers buffers_;
+  Stats stats_;
+  std::atomic<size_t> size_hint_{0};
+};
+
+}  // namespace exec2
+}  // namespace dali
+
+#endif  // DALI_PIPELINE_EXECUTOR_EXECUTOR2_OUTPUT_BUFFER_POOL_H_
@@ -0,0 +1,134 @@
+// Copyright (c) 2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+#include <memory>
+#include <vector>
+#include "dali/pipeline/executor/executor2/output_buffer_pool.h"
+
+namespace dali {
+namespace exec2 {
+namespace test {
+
+namespace {
+
+std::shared_ptr<TensorList<CPUBackend>> GetBuffer(OutputBufferPool &pool, int64_t bytes) {
+  auto tl = pool.Get(bytes);
+  tl->Resize(uniform_list_shape(1, TensorShape<>{bytes}), DALI_UINT8);
+  return tl;
+}
+
+}  // namespace
+
+TEST(Exec2OutputBufferPoolTest, BestFit) {
+  auto pool = std::make_shared<OutputBufferPool>();
+  {
+    auto a = GetBuffer(*pool, 1000);
+    auto b = GetBuffer(*pool, 4000);
+    auto c = GetBuffer(*pool, 16000);
+    EXPECT_EQ(pool->GetStats().created, 3);
+    EXPECT_EQ(pool->GetStats().pooled, 0);
+  }
+  auto stats = pool->GetStats();
+  EXPECT_EQ(stats.pooled, 3);
+  EXPECT_EQ(stats.pooled_bytes, 21000u);
+
+  auto tl = pool->Get(3000);
+  EXPECT_EQ(tl->capacity(), 4000u);
+  auto large = pool->Get(100000);
+  EXPECT_EQ(large->capacity(), 16000u) << "The largest buffer should be used";
+  auto small = pool->Get(1);
+  EXPECT_EQ(small->capacity(), 1000u);
+  auto fresh = pool->Get(1);
+  EXPECT_EQ(fresh->capacity(), 0u);
+
+  stats = pool->GetStats();
+  EXPECT_EQ(stats.created, 4);
+  EXPECT_EQ(stats.reused, 3);
+  EXPECT_EQ(stats.pooled, 0);
+  EXPECT_EQ(stats.pooled_bytes, 0u);
+}
+
+TEST(Exec2OutputBufferPoolTest, BetterFit) {
+  auto pool = std::make_shared<OutputBufferPool>();
+  {
+    auto a = GetBuffer(*pool, 4000);
+    auto b = GetBuffer(*pool, 16000);
+  }
+  ASSERT_EQ(pool->GetStats().pooled, 2);
+
+  EXPECT_EQ(pool->GetBetterFit(20000, 1000), nullptr) << "No buffer is large enough";
+  EXPECT_EQ(pool->GetBetterFit(3000, 3500), nullptr) << "The current buffer fits better";
+  EXPECT_EQ(pool->GetBetterFit(1000, 1000), nullptr) << "The pooled buffers would shrink";
+
+  auto tl = pool->GetBetterFit(3000, 16000);
+  ASSERT_NE(tl, nullptr);
+  EXPECT_EQ(tl->capacity(), 4000u);
+  tl = pool->GetBetterFit(10000, 4000);
+  ASSERT_NE(tl, nullptr) << "The current buffer is too small";
+  EXPECT_EQ(tl->capacity(), 16000u);
+  EXPECT_EQ(pool->GetStats().pooled, 1) << "The replaced buffer should go back to the pool";
+}
+
+TEST(Exec2OutputBufferPoolTest, ResetMetadata) {
+  auto pool = std::make_shared<OutputBufferPool>();
+  {
+    auto tl = pool->Get(0);
+    tl->Resize(uniform_list_shape(2, TensorShape<>{4, 5, 3}), DALI_UINT8);
+    tl->SetLayout("HWC");
+    tl->SetSourceInfo(0, "a.jpg");
+    tl->SetSourceInfo(1, "b.jpg");
+    tl->SetSkipSample(1, true);
+  }
+  auto tl = pool->Get(0);
+  EXPECT_EQ(tl->capacity(), 120u);
+  EXPECT_EQ(tl->GetLayout(), "");
+  for (int i = 0; i < tl->num_samples(); i++) {
+    EXPECT_EQ(tl->GetMeta(i).GetSourceInfo(), "");
+    EXPECT_FALSE(tl->GetMeta(i).ShouldSkipSample());
+  }
+}
+
+TEST(Exec2OutputBufferPoolTest, SharedMemoryNotRecycled) {
+  auto pool = std::make_shared<OutputBufferPool>();
+  TensorList<CPUBackend> alias;
+  {
+    auto tl = GetBuffer(*pool, 1000);
+    alias.ShareData(*tl);
+  }
+  auto stats = pool->GetStats();
+  EXPECT_EQ(stats.pooled, 0);
+  EXPECT_EQ(stats.discarded, 1);
+
+  Tensor<CPUBackend> sample;
+  {
+    auto tl = GetBuffer(*pool, 1000);
+    sample.ShareData(unsafe_sample_owner(*tl, 0), 1000, false, TensorShape<>{1000}, DALI_UINT8,
+                     CPU_ONLY_DEVICE_ID);
+  }
+  stats = pool->GetStats();
+  EXPECT_EQ(stats.pooled, 0);
+  EXPECT_EQ(stats.discarded, 2);
+}
+
+TEST(Exec2OutputBufferPoolTest, PoolDestroyedFirst) {
+  auto pool = std::make_shared<OutputBufferPool>();
+  auto tl = GetBuffer(*pool, 1000);
+  pool.reset();
+  tl.reset();  // must not crash
+}
+
+}  // namespace test
+}  // namespace exec2
+}  // namespace dali
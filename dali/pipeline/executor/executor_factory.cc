@@ -59,7 +59,27 @@ auto MakeExec2Config(int batch_size, int num_thread, int device_id,
     return std::nullopt;;
   }();
 
-  cfg.operator_threads = exec2_num_threads.value_or(std::min(num_thread, exec2_max_threads));
+  static int exec2_cpu_parallel_iterations = []() {
+    const char *env = getenv("DALI_EXEC2_CPU_PARALLEL_ITERATIONS");
+    if (env) {
+      int value = atoi(env);
+      if (value >= 1)
+        return value;
+    }
+    return 1;
+  }();
+
+  static bool exec2_recycle_cpu_outputs = []() {
+    const char *env = getenv("DALI_EXEC2_RECYCLE_CPU_OUTPUTS");
+    return !env || atoi(env) != 0;
+  }();
+
+  cfg.cpu_parallel_iterations = exec2_cpu_parallel_iterations;
+  cfg.recycle_cpu_outputs = exec2_recycle_cpu_outputs;
+  // Each parallel iteration occupies an operator thread, leave one for the other stages
+  int min_threads = cfg.cpu_parallel_iterations > 1 ? cfg.cpu_parallel_iterations + 1 : 1;
+  cfg.operator_threads = exec2_num_threads.value_or(
+      std::max(std::min(num_thread, exec2_max_threads), min_threads));
   if (device_id != CPU_ONLY_DEVICE_ID)
     cfg.device = device_id;
   cfg.max_batch_size = batch_size;
@@ -80,7 +80,8 @@ class DLL_PUBLIC Executor : public ExecutorBase, public QueuePolicy {
         device_id_(device_id),
         bytes_per_sample_hint_(bytes_per_sample_hint),
         event_pool_(),
-        thread_pool_(num_thread, device_id, Test(flags, ExecutorFlags::SetAffinity), "Executor"),
+        thread_pool_(num_thread, device_id, Test(flags, ExecutorFlags::SetAffinity), "Executor",
+                     SharedCpuPool::Global()),
         exec_error_(false),
         queue_sizes_(prefetch_queue_depth),
         enable_memory_stats_(false), checkpointing_(false) {
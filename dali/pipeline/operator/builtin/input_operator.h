@@ -15,6 +15,7 @@
 #ifndef DALI_PIPELINE_OPERATOR_BUILTIN_INPUT_OPERATOR_H_
 #define DALI_PIPELINE_OPERATOR_BUILTIN_INPUT_OPERATOR_H_
 
+#include <functional>
 #include <list>
 #include <memory>
 #include <optional>
@@ -225,10 +226,21 @@ class InputOperator : public Operator<Backend>, virtual public BatchSizeProvider
     }
   }
 
+  /**
+   * @brief Sets a function which is called each time a batch of data is consumed by the operator.
+   *
+   * The function is called from the thread which runs the operator, without holding any locks,
+   * so it may feed the operator with more data.
+   */
+  void SetDataConsumedCallback(std::function<void()> callback) {
+    std::lock_guard<std::mutex> busy_lock(busy_m_);
+    data_consumed_callback_ = std::move(callback);
+  }
+
   /**
    * Break waiting for the next batch of data
    */
-  void BreakWaiting() {
+  virtual void BreakWaiting() {
     {
       std::lock_guard<std::mutex> busy_lock(busy_m_);
       running_ = false;
@@ -340,8 +352,14 @@ class InputOperator : public Operator<Backend>, virtual public BatchSizeProvider
  private:
   void RecycleBuffer(queue_item_t &&data) {
     data->copy_complete.Put();
-    std::lock_guard<std::mutex> busy_lock(busy_m_);
-    tl_data_.Recycle(std::move(data));
+    std::function<void()> callback;
+    {
+      std::lock_guard<std::mutex> busy_lock(busy_m_);
+      tl_data_.Recycle(std::move(data));
+      callback = data_consumed_callback_;
+    }
+    if (callback)
+      callback();
   }
 
 
@@ -552,6 +570,7 @@ class InputOperator : public Operator<Backend>, virtual public BatchSizeProvider
 
   std::mutex busy_m_;
   std::condition_variable cv_;
+  std::function<void()> data_consumed_callback_;
 
   /*
    * indicates that user provide noncontiguous GPU input with zero copy option so DALI needs
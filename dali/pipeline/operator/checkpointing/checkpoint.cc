@@ -1,4 +1,4 @@
-// Copyright (c) 2024, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+// Copyright (c) 2024-2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
 //
 // Licensed under the Apache License, Version 2.0 (the "License");
 // you may not use this file except in compliance with the License.
@@ -76,24 +76,48 @@ Index Checkpoint::NumOp() const {
 }
 
 std::string Checkpoint::SerializeToProtobuf(ExecutorBase &exec) const {
+  CheckpointBase base;
+  return SerializeToProtobuf(exec, base);
+}
+
+std::string Checkpoint::SerializeToProtobuf(ExecutorBase &exec, CheckpointBase &base) const {
   dali_proto::Checkpoint checkpoint;
+  bool incremental = base.iteration_id.has_value();
+  if (incremental)
+    checkpoint.set_base_iteration_id(*base.iteration_id);
+  checkpoint.set_iteration_id(iteration_id_);
   for (const OpCheckpoint &cpt : cpts_) {
-    auto op_cpt = checkpoint.add_cpts();
     const auto &name = cpt.OperatorName();
-    op_cpt->set_operator_name(name);
     auto *op = exec.GetOperator(name);
     assert(op);
-    op_cpt->set_operator_state(op->SerializeCheckpoint(cpt));
+    auto state = op->SerializeCheckpoint(cpt);
+    auto it = base.op_states.find(name);
+    if (it == base.op_states.end()) {
+      it = base.op_states.emplace(name, std::string()).first;
+    } else if (incremental && it->second == state) {
+      continue;
+    }
+    auto op_cpt = checkpoint.add_cpts();
+    op_cpt->set_operator_name(name);
+    op_cpt->set_operator_state(state);
+    it->second = std::move(state);
   }
+  base.iteration_id = iteration_id_;
   checkpoint.mutable_external_ctx_cpt()->set_pipeline_data(external_ctx_cpt_.pipeline_data);
   checkpoint.mutable_external_ctx_cpt()->set_iterator_data(external_ctx_cpt_.iterator_data);
   return checkpoint.SerializeAsString();
 }
 
 void Checkpoint::DeserializeFromProtobuf(ExecutorBase &exec, std::string_view serialized_data) {
-  Clear();
   dali_proto::Checkpoint checkpoint;
   checkpoint.ParseFromArray(serialized_data.data(), serialized_data.size());
+  if (checkpoint.has_base_iteration_id()) {
+    DALI_ENFORCE(NumOp() > 0 && iteration_id_ == checkpoint.base_iteration_id(), make_string(
+                 "The incremental checkpoint is based on the checkpoint from iteration ",
+                 checkpoint.base_iteration_id(), ", which needs to be restored first."));
+  } else {
+    Clear();
+  }
 
   for (int i = 0; i < checkpoint.cpts_size(); i++) {
     const auto &name = checkpoint.cpts(i).operator_name();
@@ -102,10 +126,13 @@ void Checkpoint::DeserializeFromProtobuf(ExecutorBase &exec, std::string_view se
     DALI_ENFORCE(op, make_string(
                  "The executor doesn't recognize \"", name, "\" as a name of an operator.\n"
                  "The checkpoint might come from another pipeline."));
-    auto idx = AddOperator(name);  // this extends the `cpts_` vector
-    auto &op_cpt = cpts_[idx];
+    auto idx = OperatorIdx(name);
+    if (!idx)
+      idx = AddOperator(name);  // this extends the `cpts_` vector
+    auto &op_cpt = cpts_[*idx];
     op->DeserializeCheckpoint(op_cpt, data);
   }
+  iteration_id_ = checkpoint.iteration_id();
   external_ctx_cpt_.pipeline_data = checkpoint.external_ctx_cpt().pipeline_data();
   external_ctx_cpt_.iterator_data = checkpoint.external_ctx_cpt().iterator_data();
 }
@@ -1,4 +1,4 @@
-// Copyright (c) 2023-2024, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+// Copyright (c) 2023-2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
 //
 // Licensed under the Apache License, Version 2.0 (the "License");
 // you may not use this file except in compliance with the License.
@@ -36,6 +36,16 @@ struct ExternalContextCheckpoint {
   std::string iterator_data;
 };
 
+/**
+ * @brief Serialized operator states of the most recent checkpoint.
+ *
+ * Incremental checkpoints store only the operators whose state differs from the base.
+ */
+struct CheckpointBase {
+  std::optional<size_t> iteration_id;
+  std::map<std::string, std::string, std::less<>> op_states;
+};
+
 /**
  * @brief Aggregation of operator checkpoints for a whole pipeline.
  */
@@ -83,8 +93,21 @@ class DLL_PUBLIC Checkpoint {
   */
   std::string SerializeToProtobuf(ExecutorBase &exec) const;
 
+  /**
+   * @brief Serializes this object into an incremental checkpoint.
+   *
+   * Only the operators whose serialized state differs from the one in `base` are stored.
+   * If `base` is empty, a full checkpoint is produced.
+   * The `base` is updated with the states of this checkpoint, so that it can be used
+   * for the next incremental checkpoint.
+  */
+  std::string SerializeToProtobuf(ExecutorBase &exec, CheckpointBase &base) const;
+
   /**
    * @brief Deserializes a protobuf message and builds this object.
+   *
+   * If the message is an incremental checkpoint, this object must hold the checkpoint
+   * it is based on. The operators missing in the message keep their current state.
   */
   void DeserializeFromProtobuf(ExecutorBase &exec, std::string_view serialized_data);
 
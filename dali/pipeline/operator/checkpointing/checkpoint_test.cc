@@ -404,4 +404,56 @@ TEST_F(CheckpointTest, Serialize) {
     EXPECT_EQ(deserialized.GetOpCheckpoint(i).CheckpointState<uint8_t>(), i);
 }
 
+TEST_F(CheckpointTest, SerializeIncremental) {
+  Checkpoint checkpoint;
+  OpGraph graph;
+  auto exec = GetSimpleExecutor();
+
+  graph.AddOp(this->PrepareSpec(
+    OpSpec("TestStatefulSource")
+    .AddArg("device", "cpu")
+    .AddArg("epoch_size", 1)
+    .AddOutput("data_1", StorageDevice::CPU)), "stateful_source");
+
+  graph.AddOp(this->PrepareSpec(
+    OpSpec("TestStatefulOp")
+    .AddArg("device", "cpu")
+    .AddInput("data_1", StorageDevice::CPU)
+    .AddOutput("data_2", StorageDevice::CPU)), "stateful_op_1");
+
+  exec->Build(&graph, {"data_2_cpu"});
+  BuildFromLegacyGraph(checkpoint, graph);
+  checkpoint.GetOpCheckpoint(0).MutableCheckpointState() = uint8_t(10);
+  checkpoint.GetOpCheckpoint(1).MutableCheckpointState() = uint8_t(20);
+  checkpoint.SetIterationId(1);
+
+  CheckpointBase base;
+  auto full = checkpoint.SerializeToProtobuf(*exec, base);
+
+  checkpoint.GetOpCheckpoint(1).MutableCheckpointState() = uint8_t(21);
+  checkpoint.SetIterationId(2);
+  auto delta = checkpoint.SerializeToProtobuf(*exec, base);
+  EXPECT_LT(delta.size(), full.size());
+
+  checkpoint.GetOpCheckpoint(0).MutableCheckpointState() = uint8_t(11);
+  checkpoint.SetIterationId(3);
+  auto delta2 = checkpoint.SerializeToProtobuf(*exec, base);
+
+  Checkpoint deserialized;
+  EXPECT_THROW(deserialized.DeserializeFromProtobuf(*exec, delta), std::exception);
+
+  deserialized.DeserializeFromProtobuf(*exec, full);
+  EXPECT_THROW(deserialized.DeserializeFromProtobuf(*exec, delta2), std::exception);
+  deserialized.DeserializeFromProtobuf(*exec, delta);
+  EXPECT_EQ(deserialized.GetIterationId(), 2u);
+  EXPECT_EQ(deserialized.GetOpCheckpoint(0).CheckpointState<uint8_t>(), 10);
+  EXPECT_EQ(deserialized.GetOpCheckpoint(1).CheckpointState<uint8_t>(), 21);
+
+  deserialized.DeserializeFromProtobuf(*exec, delta2);
+  ASSERT_EQ(deserialized.NumOp(), 2);
+  EXPECT_EQ(deserialized.GetIterationId(), 3u);
+  EXPECT_EQ(deserialized.GetOpCheckpoint(0).CheckpointState<uint8_t>(), 11);
+  EXPECT_EQ(deserialized.GetOpCheckpoint(1).CheckpointState<uint8_t>(), 21);
+}
+
 }  // namespace dali
@@ -1,4 +1,4 @@
-// Copyright (c) 2023, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+// Copyright (c) 2023-2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
 //
 // Licensed under the Apache License, Version 2.0 (the "License");
 // you may not use this file except in compliance with the License.
@@ -14,6 +14,7 @@
 
 #include "dali/pipeline/operator/checkpointing/snapshot_serializer.h"
 
+#include <sstream>
 #include <string>
 #include <vector>
 
@@ -66,8 +67,99 @@ std::vector<T> DeserializeRNG(const std::string &data) {
   return snapshot;
 }
 
+/**
+ * @brief Extracts the state of the engine as the sequence of numbers it's written as.
+ */
+template<class T>
+void GetStateWords(const T &engine, google::protobuf::RepeatedField<uint64_t> *words) {
+  std::stringstream stream(SerializeToString(engine));
+  uint64_t word;
+  while (stream >> word)
+    words->Add(word);
+}
+
+template<class T>
+T SetStateWords(const google::protobuf::RepeatedField<uint64_t> &words) {
+  std::stringstream stream;
+  for (int i = 0; i < words.size(); i++)
+    stream << (i ? " " : "") << words[i];
+  T engine;
+  stream >> engine;
+  DALI_ENFORCE(!stream.fail(), "Invalid random number generator state in the checkpoint.");
+  return engine;
+}
+
+template<class T>
+std::string SerializeBatchRNG(const BatchRNG<T> &snapshot) {
+  dali_proto::RNGSnapshotCPU proto_snapshot;
+  proto_snapshot.set_seed(snapshot.Seed());
+  proto_snapshot.set_state_size(snapshot.StateSize());
+  for (int i = 0; i < snapshot.BatchSize(); i++) {
+    uint64_t draws = snapshot[i].draws();
+    if (draws > SnapshotSerializer::kMaxReplayedDraws) {
+      auto *state = proto_snapshot.add_state();
+      state->set_index(i);
+      GetStateWords(snapshot[i].engine(), state->mutable_words());
+    }
+    // the number of draws is stored even with the full state, so that the engine
+    // can be serialized compactly again after restoring
+    proto_snapshot.add_draws(draws);
+  }
+  return proto_snapshot.SerializeAsString();
+}
+
+template<class T>
+BatchRNG<T> DeserializeBatchRNG(const std::string &data) {
+  using Engine = typename BatchRNG<T>::engine_type;
+  dali_proto::RNGSnapshotCPU proto_snapshot;
+  proto_snapshot.ParseFromString(data);
+  if (proto_snapshot.rng_size() > 0) {
+    // textual format
+    std::vector<T> engines;
+    for (int i = 0; i < proto_snapshot.rng_size(); i++)
+      engines.push_back(DeserializeFromString<T>(proto_snapshot.rng(i)));
+    return BatchRNG<T>::FromVector(engines);
+  }
+  const auto &draws = proto_snapshot.draws();
+  std::vector<uint64_t> replayed(draws.begin(), draws.end());
+  for (const auto &state : proto_snapshot.state()) {
+    DALI_ENFORCE_VALID_INDEX(state.index(), replayed.size());
+    replayed[state.index()] = Engine::kUnknownDraws;
+  }
+  for (int i = 0; i < draws.size(); i++) {
+    DALI_ENFORCE(replayed[i] <= SnapshotSerializer::kMaxReplayedDraws ||
+                 draws[i] > SnapshotSerializer::kMaxReplayedDraws,
+                 "Invalid random number generator state in the checkpoint.");
+  }
+  auto batch = BatchRNG<T>::FromDraws(proto_snapshot.seed(), proto_snapshot.state_size(),
+                                      make_cspan(replayed));
+  for (const auto &state : proto_snapshot.state()) {
+    int idx = state.index();
+    batch.SetEngine(idx, Engine(SetStateWords<T>(state.words()), draws[idx]));
+  }
+  return batch;
+}
+
 }  // namespace
 
+std::string SnapshotSerializer::Serialize(const BatchRNG<std::mt19937> &snapshot) {
+  return SerializeBatchRNG(snapshot);
+}
+
+template<> DLL_PUBLIC
+BatchRNG<std::mt19937> SnapshotSerializer::Deserialize(const std::string &data) {
+  return DeserializeBatchRNG<std::mt19937>(data);
+}
+
+std::string SnapshotSerializer::Serialize(const BatchRNG<std::mt19937_64> &snapshot) {
+  return SerializeBatchRNG(snapshot);
+}
+
+template<> DLL_PUBLIC
+BatchRNG<std::mt19937_64> SnapshotSerializer::Deserialize(const std::string &data) {
+  return DeserializeBatchRNG<std::mt19937_64>(data);
+}
+
 std::string SnapshotSerializer::Serialize(const std::vector<std::mt19937> &snapshot) {
   return SerializeRNG(snapshot);
 }
@@ -123,4 +215,35 @@ LoaderStateSnapshot SnapshotSerializer::Deserialize(const std::string &data) {
   };
 }
 
+std::string SnapshotSerializer::Serialize(const kernels::MomentsSnapshot &snapshot) {
+  dali_proto::MomentsSnapshot proto_snapshot;
+  proto_snapshot.set_iterations(snapshot.iterations);
+  for (auto extent : snapshot.shape)
+    proto_snapshot.add_shape(extent);
+  for (const auto &m : snapshot.moments) {
+    proto_snapshot.add_count(m.count);
+    proto_snapshot.add_mean(m.mean);
+    proto_snapshot.add_m2(m.m2);
+  }
+  return proto_snapshot.SerializeAsString();
+}
+
+template<> DLL_PUBLIC
+kernels::MomentsSnapshot SnapshotSerializer::Deserialize(const std::string &data) {
+  dali_proto::MomentsSnapshot proto_snapshot;
+  proto_snapshot.ParseFromString(data);
+  DALI_ENFORCE(proto_snapshot.count_size() == proto_snapshot.mean_size() &&
+               proto_snapshot.count_size() == proto_snapshot.m2_size(),
+               "Corrupted moments snapshot");
+  kernels::MomentsSnapshot snapshot;
+  snapshot.iterations = proto_snapshot.iterations();
+  snapshot.shape.resize(proto_snapshot.shape_size());
+  for (int i = 0; i < proto_snapshot.shape_size(); i++)
+    snapshot.shape[i] = proto_snapshot.shape(i);
+  snapshot.moments.resize(proto_snapshot.count_size());
+  for (int i = 0; i < proto_snapshot.count_size(); i++)
+    snapshot.moments[i] = { proto_snapshot.count(i), proto_snapshot.mean(i), proto_snapshot.m2(i) };
+  return snapshot;
+}
+
 }  // namespace dali
@@ -1,4 +1,4 @@
-// Copyright (c) 2023, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+// Copyright (c) 2023-2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
 //
 // Licensed under the Apache License, Version 2.0 (the "License");
 // you may not use this file except in compliance with the License.
@@ -48,6 +48,48 @@ TEST_F(SnapshotSerializerTest, VectorMt19937_64) {
     EXPECT_EQ(snapshot[i], deserialized[i]);
 }
 
+TEST_F(SnapshotSerializerTest, BatchRNGCompact) {
+  BatchRNG<std::mt19937_64> snapshot(1234, 64);
+  for (int i = 0; i < snapshot.BatchSize(); i++)
+    snapshot[i].discard(i * 7);
+  // draw more than it's worth replaying, so that the full state is stored
+  snapshot[5].discard(SnapshotSerializer::kMaxReplayedDraws + 1);
+
+  std::string serialized = SnapshotSerializer().Serialize(snapshot);
+  std::string text = SnapshotSerializer().Serialize(snapshot.ToVector());
+  EXPECT_LT(serialized.size() * 10, text.size());
+
+  auto deserialized =
+      SnapshotSerializer().Deserialize<BatchRNG<std::mt19937_64>>(serialized);
+  ASSERT_EQ(snapshot.BatchSize(), deserialized.BatchSize());
+  for (int i = 0; i < snapshot.BatchSize(); i++) {
+    EXPECT_EQ(snapshot[i], deserialized[i]);
+    EXPECT_EQ(snapshot[i].draws(), deserialized[i].draws());
+    EXPECT_EQ(snapshot[i](), deserialized[i]());
+  }
+}
+
+TEST_F(SnapshotSerializerTest, BatchRNGFromVector) {
+  std::vector<std::mt19937> engines;
+  for (int i = 123; i <= 321; i++)
+    engines.emplace_back(i);
+  auto snapshot = BatchRNG<std::mt19937>::FromVector(engines);
+
+  // the number of draws is not known - the full state is stored
+  std::string serialized = SnapshotSerializer().Serialize(snapshot);
+  auto deserialized = SnapshotSerializer().Deserialize<BatchRNG<std::mt19937>>(serialized);
+  ASSERT_EQ(snapshot.BatchSize(), deserialized.BatchSize());
+  for (int i = 0; i < snapshot.BatchSize(); i++)
+    EXPECT_EQ(snapshot[i], deserialized[i]);
+
+  // the textual format is still accepted
+  std::string text = SnapshotSerializer().Serialize(engines);
+  deserialized = SnapshotSerializer().Deserialize<BatchRNG<std::mt19937>>(text);
+  ASSERT_EQ(snapshot.BatchSize(), deserialized.BatchSize());
+  for (int i = 0; i < snapshot.BatchSize(); i++)
+    EXPECT_EQ(snapshot[i], deserialized[i]);
+}
+
 TEST_F(SnapshotSerializerTest, LoaderStateSnapshot) {
   LoaderStateSnapshot snapshot = {
     std::default_random_engine(123),
@@ -63,4 +105,23 @@ TEST_F(SnapshotSerializerTest, LoaderStateSnapshot) {
   EXPECT_EQ(snapshot.age, deserialized.age);
 }
 
+TEST_F(SnapshotSerializerTest, MomentsSnapshot) {
+  kernels::MomentsSnapshot snapshot;
+  snapshot.iterations = 42;
+  snapshot.shape = { 1, 1, 3 };
+  snapshot.moments = { { 100, 1.5, 20.25 }, { 100, -3, 0.125 }, { 100, 1e10, 1e-10 } };
+
+  std::string serialized = SnapshotSerializer().Serialize(snapshot);
+  auto deserialized = SnapshotSerializer().Deserialize<kernels::MomentsSnapshot>(serialized);
+
+  EXPECT_EQ(snapshot.iterations, deserialized.iterations);
+  EXPECT_EQ(snapshot.shape, deserialized.shape);
+  ASSERT_EQ(snapshot.moments.size(), deserialized.moments.size());
+  for (size_t i = 0; i < snapshot.moments.size(); i++) {
+    EXPECT_EQ(snapshot.moments[i].count, deserialized.moments[i].count);
+    EXPECT_EQ(snapshot.moments[i].mean, deserialized.moments[i].mean);
+    EXPECT_EQ(snapshot.moments[i].m2, deserialized.moments[i].m2);
+  }
+}
+
 }  // namespace dali
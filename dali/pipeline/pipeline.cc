@@ -20,10 +20,12 @@
 #include <exception>
 #include <fstream>
 #include <functional>
+#include <iterator>
 #include <memory>
 
 #include "dali/core/device_guard.h"
 #include "dali/core/mm/default_resources.h"
+#include "dali/core/os/numa.h"
 #include "dali/pipeline/dali.pb.h"
 #include "dali/pipeline/executor/executor_factory.h"
 #include "dali/pipeline/operator/argument.h"
@@ -285,6 +287,53 @@ void Pipeline::Validate(const PipelineParams &params) {
                                   "if separated execution is not used.");
     }
   }
+
+  if (params.numa_node.has_value() && params.cpu_affinity.has_value())
+    throw std::invalid_argument("The `numa_node` and `cpu_affinity` cannot be used together.");
+  if ((params.numa_node.has_value() || params.cpu_affinity.has_value()) &&
+      params.executor_flags.has_value() &&
+      Test(*params.executor_flags, ExecutorFlags::SetAffinity)) {
+    throw std::invalid_argument("The `numa_node` and `cpu_affinity` cannot be combined with "
+                                "`set_affinity`.");
+  }
+  if (params.numa_node.has_value()) {
+    int node = *params.numa_node;
+    if (node < 0 || node >= numa::NumNodes())
+      throw std::invalid_argument(make_string("The numa_node=", node, " is invalid. "
+                                              "Valid range is [0..", numa::NumNodes() - 1, "]."));
+    auto &process_cpus = numa::ProcessCpus();
+    auto &node_cpus = numa::NodeCpus(node);
+    if (std::none_of(node_cpus.begin(), node_cpus.end(), [&](int cpu) {
+          return std::binary_search(process_cpus.begin(), process_cpus.end(), cpu);
+        })) {
+      throw std::invalid_argument(make_string("None of the CPUs of the NUMA node ", node,
+                                              " is available to the process."));
+    }
+  }
+  if (params.cpu_affinity.has_value()) {
+    if (params.cpu_affinity->empty())
+      throw std::invalid_argument("The `cpu_affinity` must not be empty.");
+    auto &process_cpus = numa::ProcessCpus();
+    for (int cpu : *params.cpu_affinity) {
+      if (!std::binary_search(process_cpus.begin(), process_cpus.end(), cpu))
+        throw std::invalid_argument(make_string("The CPU ", cpu, " in `cpu_affinity` is invalid "
+                                                "or not available to the process."));
+    }
+  }
+}
+
+std::vector<int> Pipeline::PipelineCpus() const {
+  if (params_.cpu_affinity.has_value())
+    return *params_.cpu_affinity;
+  std::vector<int> cpus;
+  if (params_.numa_node.has_value()) {
+    auto &process_cpus = numa::ProcessCpus();
+    auto &node_cpus = numa::NodeCpus(*params_.numa_node);
+    std::set_intersection(node_cpus.begin(), node_cpus.end(),
+                          process_cpus.begin(), process_cpus.end(),
+                          std::back_inserter(cpus));
+  }
+  return cpus;
 }
 
 void Pipeline::Init(const PipelineParams &params) {
@@ -565,6 +614,13 @@ void Pipeline::Build(std::vector<PipelineOutputDesc> output_descs) {
   }
   DeviceGuard d(device_id());
   DALI_ENFORCE(!built_, "\"Build()\" can only be called once.");
+  // The threads started by the executor and the operators inherit the affinity of this thread,
+  // so they run on the CPUs of the pipeline and allocate the host memory on their node.
+  auto cpus = PipelineCpus();
+  numa::ScopedThreadAffinity affinity(make_cspan(cpus));
+  // With a NUMA policy, the large host buffers should be placed on the node of the pipeline.
+  if (params_.numa_node.has_value() || params_.cpu_affinity.has_value())
+    mm::UseNumaHostMemory();
   auto num_outputs = output_descs_.size();
   DALI_ENFORCE(num_outputs > 0,
                make_string("User specified incorrect number of outputs (", num_outputs, ")."));
@@ -949,6 +1005,25 @@ int Pipeline::InputFeedCount(std::string_view name) {
   return executor_->InputFeedCount(name);
 }
 
+void Pipeline::SetOutputReadyCallback(std::function<void()> callback) {
+  DALI_ENFORCE(built_,
+               "\"Build()\" must be called prior to calling \"SetOutputReadyCallback()\".");
+  executor_->SetOutputReadyCallback(std::move(callback));
+}
+
+void Pipeline::SetInputConsumedCallback(std::string_view name, std::function<void()> callback) {
+  DALI_ENFORCE(built_,
+               "\"Build()\" must be called prior to calling \"SetInputConsumedCallback()\".");
+  auto *op = executor_->GetOperator(name);
+  if (auto *in_op = dynamic_cast<InputOperator<CPUBackend> *>(op))
+    return in_op->SetDataConsumedCallback(std::move(callback));
+  if (auto *in_op = dynamic_cast<InputOperator<MixedBackend> *>(op))
+    return in_op->SetDataConsumedCallback(std::move(callback));
+  if (auto *in_op = dynamic_cast<InputOperator<GPUBackend> *>(op))
+    return in_op->SetDataConsumedCallback(std::move(callback));
+  DALI_FAIL(make_string("Could not find an input operator named \"", name, "\"."));
+}
+
 const TensorLayout &Pipeline::GetInputLayout(std::string_view name) {
   DALI_ENFORCE(built_, "\"Build()\" must be called prior to calling \"GetInputLayout()\".");
   auto *op = executor_->GetOperator(name);
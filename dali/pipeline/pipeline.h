@@ -321,12 +321,18 @@ class DLL_PUBLIC Pipeline {
    * @brief Returns a serialized Checkpoint
    *
    * @param external_ctx_cpt Additional information from python side to be included
+   * @param incremental If true, only the operators whose state changed since the previous
+   *                    checkpoint returned by this function are stored. Restoring such
+   *                    a checkpoint requires the whole chain, starting with the last full one.
    */
   DLL_PUBLIC string
-  GetSerializedCheckpoint(const ExternalContextCheckpoint &external_ctx_cpt) const {
+  GetSerializedCheckpoint(const ExternalContextCheckpoint &external_ctx_cpt,
+                          bool incremental = false) const {
     auto cpt = GetCheckpoint();
     cpt.external_ctx_cpt_ = external_ctx_cpt;
-    return cpt.SerializeToProtobuf(*executor_);
+    if (!incremental)
+      checkpoint_base_ = {};
+    return cpt.SerializeToProtobuf(*executor_, checkpoint_base_);
   }
 
   /**
@@ -338,6 +344,19 @@ class DLL_PUBLIC Pipeline {
     return cpt;
   }
 
+  /**
+   * @brief Reconstitutes a checkpoint from a full serialized checkpoint followed by
+   *        the incremental checkpoints based on it, in the order they were created.
+   */
+  DLL_PUBLIC Checkpoint
+  DeserializeCheckpoint(span<const std::string_view> serialized_checkpoints) const {
+    DALI_ENFORCE(!serialized_checkpoints.empty(), "No checkpoints to restore from.");
+    Checkpoint cpt;
+    for (auto serialized_checkpoint : serialized_checkpoints)
+      cpt.DeserializeFromProtobuf(*executor_, serialized_checkpoint);
+    return cpt;
+  }
+
   /**
    * @brief Restores pipeline state from a serialized Checkpoint
    *
@@ -355,6 +374,24 @@ class DLL_PUBLIC Pipeline {
     return cpt.external_ctx_cpt_;
   }
 
+  /**
+   * @brief Restores pipeline state from a chain of serialized checkpoints
+   *
+   * The first checkpoint must be a full one and the following ones incremental,
+   * each based on the previous one.
+   *
+   * @return Extra context passed to SerializedCheckpoint when creating the last checkpoint
+  */
+  DLL_PUBLIC ExternalContextCheckpoint RestoreFromSerializedCheckpoint(
+      span<const std::string_view> serialized_checkpoints) {
+    DALI_ENFORCE(checkpointing_enabled(),
+                 "Cannot restore checkpoint. The `enable_checkpointing` was not "
+                 "specified when creating the pipeline");
+    Checkpoint cpt = DeserializeCheckpoint(serialized_checkpoints);
+    RestoreFromCheckpoint(cpt);
+    return cpt.external_ctx_cpt_;
+  }
+
   /**
    * @brief Restores pipeline state from an unserialized Checkpoint
    *
@@ -425,6 +462,22 @@ class DLL_PUBLIC Pipeline {
    */
   DLL_PUBLIC int InputFeedCount(std::string_view input_name);
 
+  /**
+   * @brief Sets a function which is called each time the outputs of an iteration are ready.
+   *
+   * The function is called from an executor thread. Requires the dynamic executor.
+   * It must not be changed while the pipeline is running.
+   */
+  DLL_PUBLIC void SetOutputReadyCallback(std::function<void()> callback);
+
+  /**
+   * @brief Sets a function which is called each time a batch is consumed from the given input.
+   *
+   * The function is called from the thread which runs the input operator.
+   */
+  DLL_PUBLIC void SetInputConsumedCallback(std::string_view input_name,
+                                           std::function<void()> callback);
+
   /**
    * @brief Fills the input device workspace with the output of the pipeline.
    * Previously returned buffers are released.
@@ -578,6 +631,8 @@ class DLL_PUBLIC Pipeline {
   void Init(const PipelineParams &params);
   /** Validate the Pipeline parameters */
   static void Validate(const PipelineParams &params);
+  /** The CPUs to which the pipeline's threads are pinned; empty if there's no NUMA policy */
+  std::vector<int> PipelineCpus() const;
 
   struct EdgeMeta {
     bool has_cpu;
@@ -729,6 +784,8 @@ class DLL_PUBLIC Pipeline {
   bool requires_gpu_ = false;
 
   std::unique_ptr<ExecutorBase> executor_;
+  /// Operator states of the last serialized checkpoint, used by the incremental checkpoints
+  mutable CheckpointBase checkpoint_base_;
   graph::OpGraph graph_;
   graph::OpGraph::Builder graph_builder_;
   std::map<string, EdgeMeta> edge_names_;
@@ -16,6 +16,7 @@
 #define DALI_PIPELINE_PIPELINE_PARAMS_H_
 
 #include <optional>
+#include <vector>
 #include "dali/pipeline/executor/queue_metadata.h"
 #include "dali/pipeline/executor/executor_type.h"
 
@@ -33,6 +34,10 @@ struct PipelineParams {
   std::optional<bool> enable_checkpointing;
   std::optional<bool> enable_memory_stats;
   std::optional<size_t> bytes_per_sample_hint;
+  /** The NUMA node on which the pipeline's threads run and allocate host memory */
+  std::optional<int> numa_node;
+  /** The CPUs on which the pipeline's threads run; mutually exclusive with `numa_node` */
+  std::optional<std::vector<int>> cpu_affinity;
 
   PipelineParams& Update(const PipelineParams &p) {
     #define UPDATE_IF_SET(field) if (p.field.has_value()) field = p.field;
@@ -70,6 +75,8 @@ struct PipelineParams {
     UPDATE_IF_SET(enable_checkpointing);
     UPDATE_IF_SET(enable_memory_stats);
     UPDATE_IF_SET(bytes_per_sample_hint);
+    UPDATE_IF_SET(numa_node);
+    UPDATE_IF_SET(cpu_affinity);
     #undef UPDATE_IF_SET
     return *this;
   }
@@ -1,4 +1,4 @@
-// Copyright (c) 2019, NVIDIA CORPORATION. All rights reserved.
+// Copyright (c) 2019-2025, NVIDIA CORPORATION. All rights reserved.
 //
 // Licensed under the Apache License, Version 2.0 (the "License");
 // you may not use this file except in compliance with the License.
@@ -15,6 +15,7 @@
 #ifndef DALI_PIPELINE_UTIL_BATCH_RNG_H_
 #define DALI_PIPELINE_UTIL_BATCH_RNG_H_
 
+#include <cstdint>
 #include <random>
 #include <vector>
 
@@ -22,9 +23,71 @@
 
 namespace dali {
 
+/**
+ * @brief A random engine which counts the values drawn from the wrapped engine.
+ *
+ * An engine created from a known seed sequence can be recreated from that sequence and the
+ * number of draws, which is much more compact than the full state of the engine.
+ */
+template <typename RNG>
+class CountingRNG {
+ public:
+  using result_type = typename RNG::result_type;
+
+  /**
+   * @brief Marks an engine whose number of draws since seeding is not known.
+   */
+  static constexpr uint64_t kUnknownDraws = UINT64_MAX;
+
+  static constexpr result_type min() { return RNG::min(); }
+  static constexpr result_type max() { return RNG::max(); }
+
+  CountingRNG() = default;
+
+  explicit CountingRNG(const RNG &engine, uint64_t draws = kUnknownDraws)
+  : engine_(engine), draws_(draws) {}
+
+  result_type operator()() {
+    if (draws_ != kUnknownDraws)
+      draws_++;
+    return engine_();
+  }
+
+  void discard(uint64_t n) {
+    engine_.discard(n);
+    if (draws_ != kUnknownDraws)
+      draws_ += n;
+  }
+
+  /**
+   * @brief The number of values drawn since the engine was seeded or kUnknownDraws.
+   */
+  uint64_t draws() const noexcept {
+    return draws_;
+  }
+
+  const RNG &engine() const noexcept {
+    return engine_;
+  }
+
+  bool operator==(const CountingRNG &other) const {
+    return engine_ == other.engine_;
+  }
+
+  bool operator!=(const CountingRNG &other) const {
+    return !(*this == other);
+  }
+
+ private:
+  RNG engine_;
+  uint64_t draws_ = kUnknownDraws;
+};
+
 template <typename RNG = std::mt19937>
 class BatchRNG {
  public:
+  using engine_type = CountingRNG<RNG>;
+
   /**
    * @brief Used to keep batch of RNGs, so Operators can be immune to order of sample processing
    * while using randomness
@@ -34,14 +97,13 @@ class BatchRNG {
    * @param state_size How many seed are used to initialize one RNG. Used to lower probablity of
    * collisions between seeds used to initialize RNGs in different operators.
    */
-  BatchRNG(int64_t seed, int batch_size, int state_size = 4) : seed_(seed) {
-    std::seed_seq seq{seed_};
-    std::vector<uint32_t> seeds(batch_size * state_size);
-    seq.generate(seeds.begin(), seeds.end());
+  BatchRNG(int64_t seed, int batch_size, int state_size = 4)
+  : seed_(seed), state_size_(state_size) {
+    auto seeds = SampleSeeds(seed, batch_size, state_size);
     rngs_.reserve(batch_size);
     for (int i = 0; i < batch_size * state_size; i += state_size) {
       std::seed_seq s(seeds.begin() + i, seeds.begin() + i + state_size);
-      rngs_.emplace_back(s);
+      rngs_.emplace_back(RNG(s), 0);
     }
   }
 
@@ -49,27 +111,86 @@ class BatchRNG {
   /**
    * Returns engine corresponding to given sample ID
    */
-  RNG &operator[](int sample) noexcept {
+  engine_type &operator[](int sample) noexcept {
+    return rngs_[sample];
+  }
+
+  const engine_type &operator[](int sample) const noexcept {
     return rngs_[sample];
   }
 
   std::vector<RNG> ToVector() const {
-    return rngs_;
+    std::vector<RNG> result;
+    result.reserve(rngs_.size());
+    for (auto &rng : rngs_)
+      result.push_back(rng.engine());
+    return result;
   }
 
+  /**
+   * @brief Creates a batch of engines with given states.
+   *
+   * The number of draws of such engines is not known, so they can only be
+   * serialized with their full state.
+   */
   static BatchRNG<RNG> FromVector(const std::vector<RNG> &vec) {
     BatchRNG<RNG> result(0, 0);
-    result.rngs_ = vec;
+    result.rngs_.reserve(vec.size());
+    for (auto &rng : vec)
+      result.rngs_.emplace_back(rng);
+    return result;
+  }
+
+  /**
+   * @brief Recreates a batch of engines from the seed and the per-sample number of draws.
+   *
+   * The engines for which the number of draws is CountingRNG::kUnknownDraws are default
+   * constructed and should be overwritten with SetEngine.
+   */
+  static BatchRNG<RNG> FromDraws(int64_t seed, int state_size, span<const uint64_t> draws) {
+    BatchRNG<RNG> result(0, 0);
+    result.seed_ = seed;
+    result.state_size_ = state_size;
+    int batch_size = draws.size();
+    auto seeds = SampleSeeds(seed, batch_size, state_size);
+    result.rngs_.resize(batch_size);
+    for (int i = 0; i < batch_size; i++) {
+      if (draws[i] == engine_type::kUnknownDraws)
+        continue;
+      std::seed_seq s(seeds.begin() + i * state_size, seeds.begin() + (i + 1) * state_size);
+      result.rngs_[i] = engine_type(RNG(s), 0);
+      result.rngs_[i].discard(draws[i]);
+    }
     return result;
   }
 
+  void SetEngine(int sample, const engine_type &engine) {
+    rngs_[sample] = engine;
+  }
+
   int BatchSize() const {
     return static_cast<int>(rngs_.size());
   }
 
+  int64_t Seed() const {
+    return seed_;
+  }
+
+  int StateSize() const {
+    return state_size_;
+  }
+
  private:
+  static std::vector<uint32_t> SampleSeeds(int64_t seed, int batch_size, int state_size) {
+    std::seed_seq seq{seed};
+    std::vector<uint32_t> seeds(batch_size * state_size);
+    seq.generate(seeds.begin(), seeds.end());
+    return seeds;
+  }
+
   int64_t seed_;
-  std::vector<RNG> rngs_;
+  int state_size_;
+  std::vector<engine_type> rngs_;
 };
 
 }  // namespace dali
@@ -0,0 +1,164 @@
+// Copyright (c) 2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef DALI_PIPELINE_UTIL_COST_SCHEDULER_H_
+#define DALI_PIPELINE_UTIL_COST_SCHEDULER_H_
+
+#include <algorithm>
+#include <functional>
+#include <utility>
+#include <vector>
+#include "dali/core/util.h"
+#include "dali/pipeline/util/thread_pool.h"
+
+namespace dali {
+
+/**
+ * @brief The minimum number of elements in a separately scheduled block of work.
+ *
+ * Smaller blocks cost more to schedule than they gain in parallelism. The CPU kernels which
+ * split their own work (`Schedule` with `req_nblocks`) don't go below it and it's a reasonable
+ * `min_extent` for CostScheduler::AddWork, once converted to the units of the extent.
+ */
+constexpr int64_t kMinBlockVolume = 1 << 14;
+
+/**
+ * @brief Schedules the per-sample work of a batch in a ThreadPool, based on cost estimates.
+ *
+ * The work is collected first, so that the total cost of the batch is known before anything
+ * is submitted. When the work is run:
+ *  - samples whose cost exceeds a chunk (a fraction of the per-thread share of the total cost)
+ *    are split into sub-ranges, if the caller supports it,
+ *  - the work items are submitted with their cost as the priority, so the thread pool picks
+ *    up the most expensive ones first (longest processing time first), which keeps the few
+ *    large samples in a batch from becoming stragglers at the end of the batch.
+ *
+ * The costs only need to be consistent within a batch - e.g. the number of elements processed.
+ */
+class CostScheduler {
+ public:
+  using Work = ThreadPool::Work;
+  /** Processes the range [begin, end) of a sample. */
+  using RangeWork = std::function<void(int thread_idx, int64_t begin, int64_t end)>;
+
+  static constexpr int kDefaultChunksPerThread = 8;
+
+  explicit CostScheduler(ThreadPool &tp, int chunks_per_thread = kDefaultChunksPerThread)
+  : tp_(tp), chunks_per_thread_(chunks_per_thread) {}
+
+  /**
+   * @brief Adds a work item that cannot be split.
+   */
+  void AddWork(int64_t cost, Work work) {
+    Item item;
+    item.cost = cost;
+    item.work = std::move(work);
+    total_cost_ += cost;
+    items_.push_back(std::move(item));
+  }
+
+  /**
+   * @brief Adds a work item which can be processed in parts.
+   *
+   * @param cost        the estimated cost of processing the whole range
+   * @param extent      the size of the range, e.g. the number of rows or elements
+   * @param work        the function processing a sub-range
+   * @param min_extent  the minimum practical size of a sub-range
+   */
+  void AddWork(int64_t cost, int64_t extent, RangeWork work, int64_t min_extent = 1) {
+    Item item;
+    item.cost = cost;
+    item.extent = extent;
+    item.min_extent = std::max<int64_t>(min_extent, 1);
+    item.range_work = std::move(work);
+    total_cost_ += cost;
+    items_.push_back(std::move(item));
+  }
+
+  int64_t TotalCost() const {
+    return total_cost_;
+  }
+
+  /**
+   * @brief Calculates the number of chunks a sample should be split into.
+   *
+   * The chunk cost is the total cost divided by `num_threads * chunks_per_thread`; samples
+   * which are smaller than that are not split at all.
+   * It can be used with kernels that do their own partitioning (e.g. as `req_nblocks`).
+   */
+  static int NumChunks(int64_t cost, int64_t total_cost, int num_threads,
+                       int chunks_per_thread = kDefaultChunksPerThread) {
+    if (num_threads <= 1 || cost <= 0 || total_cost <= 0)
+      return 1;
+    int64_t max_chunks = static_cast<int64_t>(num_threads) * chunks_per_thread;
+    int64_t chunk_cost = div_ceil(total_cost, static_cast<uint64_t>(max_chunks));
+    return std::max<int64_t>(1, std::min(cost / chunk_cost, max_chunks));
+  }
+
+  int NumChunks(int64_t cost) const {
+    return NumChunks(cost, total_cost_, tp_.NumThreads(), chunks_per_thread_);
+  }
+
+  /**
+   * @brief Submits the collected work to the thread pool and runs it.
+   *
+   * The scheduler is empty afterwards and can be reused for the next batch.
+   */
+  void Run(bool wait = true) {
+    for (auto &item : items_) {
+      if (!item.range_work) {
+        tp_.AddWork(std::move(item.work), item.cost);
+        continue;
+      }
+      if (item.extent <= 0)
+        continue;
+      int64_t nchunks = std::min<int64_t>(NumChunks(item.cost), item.extent / item.min_extent);
+      if (nchunks <= 1) {
+        tp_.AddWork([work = std::move(item.range_work), extent = item.extent](int tid) {
+          work(tid, 0, extent);
+        }, item.cost);
+        continue;
+      }
+      for (int64_t c = 0; c < nchunks; c++) {
+        int64_t begin = item.extent * c / nchunks;
+        int64_t end = item.extent * (c + 1) / nchunks;
+        int64_t chunk_cost = item.cost * (end - begin) / item.extent;
+        tp_.AddWork([work = item.range_work, begin, end](int tid) {
+          work(tid, begin, end);
+        }, chunk_cost);
+      }
+    }
+    items_.clear();
+    total_cost_ = 0;
+    tp_.RunAll(wait);
+  }
+
+ private:
+  struct Item {
+    int64_t cost = 0;
+    int64_t extent = 1;
+    int64_t min_extent = 1;
+    Work work;
+    RangeWork range_work;
+  };
+
+  ThreadPool &tp_;
+  int chunks_per_thread_;
+  int64_t total_cost_ = 0;
+  std::vector<Item> items_;
+};
+
+}  // namespace dali
+
+#endif  // DALI_PIPELINE_UTIL_COST_SCHEDULER_H_
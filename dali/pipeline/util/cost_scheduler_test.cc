@@ -0,0 +1,93 @@
+// Copyright (c) 2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "dali/pipeline/util/cost_scheduler.h"
+#include <gtest/gtest.h>
+#include <atomic>
+#include <vector>
+
+namespace dali {
+namespace test {
+
+TEST(CostScheduler, NumChunks) {
+  // uniform batch - the same as splitting the work evenly
+  EXPECT_EQ(CostScheduler::NumChunks(128, 512, 4, 8), 8);
+  EXPECT_EQ(CostScheduler::NumChunks(100, 400, 4, 1), 1);
+  EXPECT_EQ(CostScheduler::NumChunks(100, 6400, 4, 8), 1);
+  // a single thread never splits
+  EXPECT_EQ(CostScheduler::NumChunks(100, 100, 1, 8), 1);
+  // a sample dominating the batch is split the most
+  EXPECT_EQ(CostScheduler::NumChunks(1000, 1100, 4, 1), 3);
+  EXPECT_EQ(CostScheduler::NumChunks(10, 1100, 4, 1), 1);
+  // empty work
+  EXPECT_EQ(CostScheduler::NumChunks(0, 0, 4, 8), 1);
+}
+
+TEST(CostScheduler, LongestFirst) {
+  // only one thread to ensure deterministic behavior
+  ThreadPool tp(1, 0, false, "CostScheduler test");
+  CostScheduler sched(tp);
+  std::vector<int64_t> order;
+  std::vector<int64_t> costs = { 5, 100, 1, 42, 7 };
+  for (auto cost : costs)
+    sched.AddWork(cost, [&order, cost](int) { order.push_back(cost); });
+  EXPECT_EQ(sched.TotalCost(), 155);
+  sched.Run();
+  EXPECT_EQ(order, (std::vector<int64_t>{ 100, 42, 7, 5, 1 }));
+  EXPECT_EQ(sched.TotalCost(), 0);
+}
+
+TEST(CostScheduler, SplitRanges) {
+  ThreadPool tp(4, 0, false, "CostScheduler test");
+  CostScheduler sched(tp, 2);
+  const int64_t big = 100000, small = 10;
+  std::vector<std::atomic<int>> visited(big + 3 * small);
+  std::atomic<int> big_chunks{0}, small_chunks{0};
+  sched.AddWork(big, big, [&](int, int64_t begin, int64_t end) {
+    big_chunks++;
+    for (int64_t i = begin; i < end; i++)
+      visited[i]++;
+  });
+  for (int s = 0; s < 3; s++) {
+    int64_t offset = big + s * small;
+    sched.AddWork(small, small, [&, offset](int, int64_t begin, int64_t end) {
+      small_chunks++;
+      for (int64_t i = begin; i < end; i++)
+        visited[offset + i]++;
+    });
+  }
+  sched.Run();
+  for (auto &v : visited)
+    ASSERT_EQ(v, 1);
+  EXPECT_EQ(big_chunks, 7);
+  EXPECT_EQ(small_chunks, 3);
+}
+
+TEST(CostScheduler, MinExtent) {
+  ThreadPool tp(4, 0, false, "CostScheduler test");
+  CostScheduler sched(tp);
+  std::atomic<int> chunks{0};
+  std::atomic<int64_t> total{0};
+  sched.AddWork(1000, 10, [&](int, int64_t begin, int64_t end) {
+    EXPECT_GE(end - begin, 4);
+    chunks++;
+    total += end - begin;
+  }, 4);
+  sched.Run();
+  EXPECT_EQ(chunks, 2);
+  EXPECT_EQ(total, 10);
+}
+
+}  // namespace test
+}  // namespace dali
@@ -19,6 +19,7 @@
 #include <condition_variable>
 #include <atomic>
 
+#include "dali/core/error_handling.h"
 #include "dali/pipeline/util/thread_pool.h"
 
 namespace dali {
@@ -36,9 +37,16 @@ namespace dali {
  * @note This function is quite expensive - it creates a temporary mutex and condition variable.
  *       The intended usage is for initialization and shutdown of thread local storage or
  *       other thread-bound resources.
+ *
+ * @note A thread pool running in a shared CPU pool (DALI_SHARED_CPU_POOL) is not supported and
+ *       results in an error: its work runs in whichever threads of the shared pool are free,
+ *       so there's no set of threads to visit and the tasks waiting for each other could
+ *       take up the workers needed by other pipelines.
  */
 template <typename Func>
 void ForEachThread(ThreadPool &tp, Func &&func) {
+  DALI_ENFORCE(!tp.IsShared(),
+               "ForEachThread cannot be used with a thread pool running in a shared CPU pool.");
   std::mutex m;
   std::condition_variable cv;
   int n = tp.NumThreads();
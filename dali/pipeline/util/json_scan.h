@@ -0,0 +1,181 @@
+// Copyright (c) 2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef DALI_PIPELINE_UTIL_JSON_SCAN_H_
+#define DALI_PIPELINE_UTIL_JSON_SCAN_H_
+
+#include <cstring>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace dali {
+namespace detail {
+
+/**
+ * @brief Utilities for finding the boundaries of JSON values without parsing them.
+ *
+ * They only track strings and bracket nesting, which is much cheaper than full parsing and allows
+ * to split large documents (e.g. a huge array of objects) into parts which can be parsed
+ * independently. The values are not validated - that is left to the parser.
+ */
+
+inline const char *SkipJsonWhitespace(const char *p, const char *end) {
+  while (p < end && (*p == ' ' || *p == '\n' || *p == '\r' || *p == '\t'))
+    p++;
+  return p;
+}
+
+/**
+ * @brief Skips a JSON string; `p` points to the opening quote.
+ *
+ * @return The pointer past the closing quote or nullptr if the string is not terminated.
+ */
+inline const char *SkipJsonString(const char *p, const char *end) {
+  p++;
+  while (p < end) {
+    auto *q = static_cast<const char *>(std::memchr(p, '"', end - p));
+    if (!q)
+      return nullptr;
+    // the quote is escaped if it's preceded by an odd number of backslashes
+    const char *b = q;
+    while (b > p && b[-1] == '\\')
+      b--;
+    if ((q - b) % 2 == 0)
+      return q + 1;
+    p = q + 1;
+  }
+  return nullptr;
+}
+
+/**
+ * @brief Skips a JSON value; `p` points to the first character of the value.
+ *
+ * @return The pointer past the value or nullptr if the value is not terminated.
+ */
+inline const char *SkipJsonValue(const char *p, const char *end) {
+  if (p >= end)
+    return nullptr;
+  if (*p == '"')
+    return SkipJsonString(p, end);
+  if (*p == '{' || *p == '[') {
+    int depth = 0;
+    while (p < end) {
+      switch (*p) {
+        case '"':
+          p = SkipJsonString(p, end);
+          if (!p)
+            return nullptr;
+          continue;
+        case '{':
+        case '[':
+          depth++;
+          break;
+        case '}':
+        case ']':
+          if (--depth == 0)
+            return p + 1;
+          break;
+        default:
+          break;
+      }
+      p++;
+    }
+    return nullptr;
+  }
+  // a number or a literal
+  while (p < end && *p != ',' && *p != ']' && *p != '}' &&
+         *p != ' ' && *p != '\n' && *p != '\r' && *p != '\t')
+    p++;
+  return p;
+}
+
+/**
+ * @brief Finds the elements of a JSON array; `p` points to the opening bracket.
+ *
+ * The ranges `[begin, end)` of the elements are appended to `elements`.
+ *
+ * @return The pointer past the closing bracket or nullptr if the array is malformed.
+ */
+inline const char *ScanJsonArray(const char *p, const char *end,
+                                 std::vector<std::pair<const char *, const char *>> &elements) {
+  if (p >= end || *p != '[')
+    return nullptr;
+  p = SkipJsonWhitespace(p + 1, end);
+  if (p < end && *p == ']')
+    return p + 1;
+  while (p < end) {
+    const char *elem_end = SkipJsonValue(p, end);
+    if (!elem_end)
+      return nullptr;
+    elements.emplace_back(p, elem_end);
+    p = SkipJsonWhitespace(elem_end, end);
+    if (p >= end)
+      return nullptr;
+    if (*p == ']')
+      return p + 1;
+    if (*p != ',')
+      return nullptr;
+    p = SkipJsonWhitespace(p + 1, end);
+  }
+  return nullptr;
+}
+
+/**
+ * @brief Finds the values of the top-level members of a JSON object; `p` points to the opening
+ *        brace.
+ *
+ * The member names are not unescaped. For each member, `callback(name, value_begin, value_end)`
+ * is called.
+ *
+ * @return The pointer past the closing brace or nullptr if the object is malformed.
+ */
+template <typename Callback>
+const char *ScanJsonObject(const char *p, const char *end, Callback &&callback) {
+  if (p >= end || *p != '{')
+    return nullptr;
+  p = SkipJsonWhitespace(p + 1, end);
+  if (p < end && *p == '}')
+    return p + 1;
+  while (p < end) {
+    if (*p != '"')
+      return nullptr;
+    const char *key_end = SkipJsonString(p, end);
+    if (!key_end)
+      return nullptr;
+    std::string_view key(p + 1, key_end - p - 2);
+    p = SkipJsonWhitespace(key_end, end);
+    if (p >= end || *p != ':')
+      return nullptr;
+    p = SkipJsonWhitespace(p + 1, end);
+    const char *value_end = SkipJsonValue(p, end);
+    if (!value_end)
+      return nullptr;
+    callback(key, p, value_end);
+    p = SkipJsonWhitespace(value_end, end);
+    if (p >= end)
+      return nullptr;
+    if (*p == '}')
+      return p + 1;
+    if (*p != ',')
+      return nullptr;
+    p = SkipJsonWhitespace(p + 1, end);
+  }
+  return nullptr;
+}
+
+}  // namespace detail
+}  // namespace dali
+
+#endif  // DALI_PIPELINE_UTIL_JSON_SCAN_H_
@@ -0,0 +1,82 @@
+// Copyright (c) 2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "dali/pipeline/util/json_scan.h"
+#include <gtest/gtest.h>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace dali {
+namespace detail {
+
+namespace {
+
+std::vector<std::string> Elements(const std::string &json) {
+  std::vector<std::pair<const char *, const char *>> ranges;
+  const char *end = json.data() + json.size();
+  const char *arr_end = ScanJsonArray(json.data(), end, ranges);
+  EXPECT_NE(arr_end, nullptr);
+  std::vector<std::string> ret;
+  for (auto &r : ranges)
+    ret.emplace_back(r.first, r.second);
+  return ret;
+}
+
+}  // namespace
+
+TEST(JsonScan, SkipString) {
+  const std::string s = R"("abc\"def\\" rest)";
+  const char *end = SkipJsonString(s.data(), s.data() + s.size());
+  ASSERT_NE(end, nullptr);
+  EXPECT_EQ(std::string(s.data(), end), R"("abc\"def\\")");
+
+  const std::string unterminated = R"("abc\")";
+  EXPECT_EQ(SkipJsonString(unterminated.data(), unterminated.data() + unterminated.size()),
+            nullptr);
+}
+
+TEST(JsonScan, ArrayElements) {
+  EXPECT_TRUE(Elements("[]").empty());
+  EXPECT_TRUE(Elements("[ \n ]").empty());
+  EXPECT_EQ(Elements("[1, -2.5e3,true,null]"),
+            (std::vector<std::string>{"1", "-2.5e3", "true", "null"}));
+  EXPECT_EQ(Elements(R"([{"a": [1, {"b": "]}"}]}, "x,]", [[], {}] ])"),
+            (std::vector<std::string>{R"({"a": [1, {"b": "]}"}]})", R"("x,]")", "[[], {}]"}));
+}
+
+TEST(JsonScan, Malformed) {
+  std::vector<std::pair<const char *, const char *>> ranges;
+  for (std::string s : {"[1, 2", "[{\"a\": 1]", "[1 2]", "{}", "[\"abc]"}) {
+    ranges.clear();
+    EXPECT_EQ(ScanJsonArray(s.data(), s.data() + s.size(), ranges), nullptr) << s;
+  }
+}
+
+TEST(JsonScan, ObjectMembers) {
+  std::string json = R"({"images": [{"id": 1}], "info" : {"x": "}"}, "n": 5})";
+  std::vector<std::pair<std::string, std::string>> members;
+  const char *end = ScanJsonObject(json.data(), json.data() + json.size(),
+    [&](std::string_view key, const char *begin, const char *end) {
+      members.emplace_back(std::string(key), std::string(begin, end));
+    });
+  EXPECT_EQ(end, json.data() + json.size());
+  std::vector<std::pair<std::string, std::string>> expected = {
+    {"images", R"([{"id": 1}])"}, {"info", R"({"x": "}"})"}, {"n", "5"}
+  };
+  EXPECT_EQ(members, expected);
+}
+
+}  // namespace detail
+}  // namespace dali
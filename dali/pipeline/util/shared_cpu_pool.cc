@@ -0,0 +1,258 @@
+// Copyright (c) 2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "dali/pipeline/util/shared_cpu_pool.h"
+#include <algorithm>
+#include <cassert>
+#include <chrono>
+#include <cstdlib>
+#include <limits>
+#include "dali/core/error_handling.h"
+#include "dali/core/format.h"
+#include "dali/core/nvtx.h"
+#include "dali/core/os/numa.h"
+
+namespace dali {
+
+namespace {
+
+/**
+ * @brief How much a worker prefers the queues of its own NUMA node, in units of virtual time
+ */
+constexpr double kNumaPreference = 1e-3;
+
+/**
+ * @brief Returns the CPUs (available to the process) of each NUMA node which has any.
+ */
+std::vector<std::vector<int>> NumaNodeCpus() {
+  const auto &allowed = numa::ProcessCpus();
+  std::vector<std::vector<int>> result;
+  for (int node = 0; node < numa::NumNodes(); node++) {
+    std::vector<int> usable;
+    for (int cpu : numa::NodeCpus(node))
+      if (std::binary_search(allowed.begin(), allowed.end(), cpu))
+        usable.push_back(cpu);
+    if (!usable.empty())
+      result.push_back(std::move(usable));
+  }
+  return result;
+}
+
+int GetEnvInt(const char *name, int default_value) {
+  const char *env = std::getenv(name);
+  return env && *env ? atoi(env) : default_value;
+}
+
+}  // namespace
+
+SharedCpuPool *SharedCpuPool::Global() {
+  // The instance is never destroyed - the workers may still be in use by pipelines
+  // destroyed during the interpreter shutdown.
+  static SharedCpuPool *instance = []() -> SharedCpuPool * {
+    if (!GetEnvInt("DALI_SHARED_CPU_POOL", 0))
+      return nullptr;
+    return new SharedCpuPool(GetEnvInt("DALI_SHARED_CPU_POOL_THREADS", 0));
+  }();
+  return instance;
+}
+
+SharedCpuPool::SharedCpuPool(int num_threads, bool numa_aware) {
+  if (num_threads <= 0)
+    num_threads = std::max<int>(numa::ProcessCpus().size(), 1);
+  if (numa_aware) {
+    node_cpus_ = NumaNodeCpus();
+    if (node_cpus_.size() < 2)
+      node_cpus_.clear();  // nothing to choose from
+  }
+  std::lock_guard lock(mtx_);
+  AddWorkers(num_threads);
+}
+
+SharedCpuPool::~SharedCpuPool() {
+  {
+    std::lock_guard lock(mtx_);
+    assert(queues_.empty() && "All the queues must be destroyed before the pool");
+    stop_ = true;
+  }
+  work_cv_.notify_all();
+  for (auto &w : workers_)
+    w.join();
+}
+
+int SharedCpuPool::NumThreads() const {
+  std::lock_guard lock(mtx_);
+  return workers_.size();
+}
+
+std::vector<std::thread::id> SharedCpuPool::GetThreadIds() const {
+  std::lock_guard lock(mtx_);
+  std::vector<std::thread::id> ids;
+  ids.reserve(workers_.size());
+  for (auto &w : workers_)
+    ids.push_back(w.get_id());
+  return ids;
+}
+
+int SharedCpuPool::NumaNodeOf(const cpu_set_t &cpus) const {
+  int best = -1, best_count = 0;
+  for (int node = 0; node < NumNumaNodes(); node++) {
+    int count = 0;
+    for (int cpu : node_cpus_[node])
+      count += CPU_ISSET(cpu, &cpus) ? 1 : 0;
+    if (count > best_count) {
+      best = node;
+      best_count = count;
+    }
+  }
+  return best;
+}
+
+void SharedCpuPool::AddWorkers(int num_threads) {
+  for (int i = 0; i < num_threads; i++) {
+    int index = workers_.size();
+    int node = node_cpus_.empty() ? -1 : index % node_cpus_.size();
+    workers_.emplace_back(&SharedCpuPool::WorkerMain, this, index, node);
+  }
+}
+
+void SharedCpuPool::WorkerMain(int index, int node) {
+  SetThreadName(make_string("[DALI][CPU", index, "]").c_str());
+  // The workers may be started by a thread pinned by a pipeline (see Pipeline::Build) - they're
+  // shared, so they must not inherit its affinity.
+  const auto &cpus = node >= 0 ? node_cpus_[node] : numa::ProcessCpus();
+  try {
+    if (!cpus.empty() && numa::GetThreadAffinity() != cpus)
+      numa::SetThreadAffinity(make_cspan(cpus));
+  } catch (const std::exception &e) {
+    DALI_WARN("Could not set the affinity of a CPU worker. ", e.what());
+  }
+
+  std::unique_lock lock(mtx_);
+  for (;;) {
+    Queue *q = nullptr;
+    work_cv_.wait(lock, [&]() {
+      return stop_ || (q = PickQueue(node)) != nullptr;
+    });
+    if (!q)
+      break;
+
+    Task task = std::move(const_cast<PrioritizedTask &>(q->tasks_.top()).second);
+    q->tasks_.pop();
+    int slot = q->free_slots_.back();
+    q->free_slots_.pop_back();
+    q->running_++;
+    lock.unlock();
+
+    auto start = std::chrono::steady_clock::now();
+    task(slot);
+    task = {};
+    double elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start)
+                     .count();
+
+    lock.lock();
+    q->running_--;
+    q->free_slots_.push_back(slot);
+    q->vtime_ += elapsed / q->weight_;
+    if (q->Idle())
+      q->idle_cv_.notify_all();
+    else if (!q->tasks_.empty())
+      work_cv_.notify_one();  // the task may have been held back by the concurrency limit
+  }
+}
+
+SharedCpuPool::Queue *SharedCpuPool::PickQueue(int node) const {
+  Queue *best = nullptr;
+  double best_vtime = std::numeric_limits<double>::infinity();
+  for (Queue *q : queues_) {
+    if (!q->Runnable())
+      continue;
+    double vtime = q->vtime_;
+    if (node >= 0 && q->numa_node_ >= 0 && q->numa_node_ != node)
+      vtime += kNumaPreference;
+    if (vtime < best_vtime) {
+      best = q;
+      best_vtime = vtime;
+    }
+  }
+  return best;
+}
+
+double SharedCpuPool::MinActiveVTime() const {
+  double min_vtime = std::numeric_limits<double>::infinity();
+  for (Queue *q : queues_)
+    if (!q->Idle())
+      min_vtime = std::min(min_vtime, q->vtime_);
+  return min_vtime;
+}
+
+void SharedCpuPool::Activate(Queue &q) {
+  // A queue which was idle doesn't get credit for the time it wasn't competing
+  double min_vtime = MinActiveVTime();
+  if (min_vtime != std::numeric_limits<double>::infinity())
+    q.vtime_ = std::max(q.vtime_, min_vtime);
+}
+
+SharedCpuPool::Queue::Queue(SharedCpuPool &pool, int max_concurrency, double weight,
+                            int numa_node)
+    : pool_(pool), max_concurrency_(max_concurrency), weight_(weight) {
+  DALI_ENFORCE(max_concurrency > 0, "The concurrency of a queue must be positive.");
+  DALI_ENFORCE(weight > 0, "The weight of a queue must be positive.");
+  numa_node_ = numa_node >= 0 && numa_node < pool.NumNumaNodes() ? numa_node : -1;
+  free_slots_.reserve(max_concurrency);
+  for (int i = max_concurrency - 1; i >= 0; i--)
+    free_slots_.push_back(i);
+
+  std::lock_guard lock(pool_.mtx_);
+  // Tasks of a client may wait for each other, so the pool must be able to run as many tasks
+  // as the client's concurrency.
+  int num_workers = pool_.workers_.size();
+  if (max_concurrency > num_workers)
+    pool_.AddWorkers(max_concurrency - num_workers);
+  pool_.Activate(*this);
+  pool_.queues_.push_back(this);
+}
+
+SharedCpuPool::Queue::~Queue() {
+  std::unique_lock lock(pool_.mtx_);
+  idle_cv_.wait(lock, [&]() { return Idle(); });
+  auto it = std::find(pool_.queues_.begin(), pool_.queues_.end(), this);
+  assert(it != pool_.queues_.end());
+  pool_.queues_.erase(it);
+}
+
+void SharedCpuPool::Queue::Push(Task task, int64_t priority) {
+  {
+    std::lock_guard lock(pool_.mtx_);
+    if (Idle())
+      pool_.Activate(*this);
+    tasks_.emplace(priority, std::move(task));
+  }
+  pool_.work_cv_.notify_one();
+}
+
+void SharedCpuPool::Queue::Push(std::vector<PrioritizedTask> &&tasks) {
+  if (tasks.empty())
+    return;
+  {
+    std::lock_guard lock(pool_.mtx_);
+    if (Idle())
+      pool_.Activate(*this);
+    for (auto &t : tasks)
+      tasks_.push(std::move(t));
+  }
+  tasks.clear();
+  pool_.work_cv_.notify_all();
+}
+
+}  // namespace dali
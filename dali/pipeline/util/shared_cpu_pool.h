@@ -0,0 +1,181 @@
+// Copyright (c) 2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef DALI_PIPELINE_UTIL_SHARED_CPU_POOL_H_
+#define DALI_PIPELINE_UTIL_SHARED_CPU_POOL_H_
+
+#include <sched.h>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <queue>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+#include "dali/core/common.h"
+
+namespace dali {
+
+/**
+ * @brief A process-wide set of CPU worker threads, shared by the thread pools of several
+ *        pipelines.
+ *
+ * Each client (typically a pipeline's ThreadPool) submits its work to a Queue. The workers
+ * pick the tasks from the queues in weighted fair order: a queue is charged the CPU time of
+ * its tasks divided by its weight and the queue which has been charged the least goes first.
+ * A queue never runs more than `max_concurrency` tasks at a time and each running task gets
+ * a distinct slot index in range [0, max_concurrency), which the clients use as a thread index.
+ *
+ * On machines with multiple NUMA nodes, the workers are distributed over the nodes and pinned
+ * to the CPUs of their node; the workers prefer the queues bound to their own node.
+ *
+ * The global instance is enabled with the `DALI_SHARED_CPU_POOL` environment variable and
+ * sized with `DALI_SHARED_CPU_POOL_THREADS` (by default, the number of CPUs available to the
+ * process).
+ */
+class DLL_PUBLIC SharedCpuPool {
+ public:
+  /**
+   * @brief A task; the argument is the slot index. The task must not throw.
+   */
+  using Task = std::function<void(int)>;
+  using PrioritizedTask = std::pair<int64_t, Task>;
+
+  /**
+   * @brief Returns the process-wide instance or nullptr, if it's not enabled.
+   */
+  static SharedCpuPool *Global();
+
+  /**
+   * @param num_threads The number of worker threads; if not positive, the number of CPUs
+   *                    available to the process is used.
+   * @param numa_aware  If true, the workers are distributed over NUMA nodes and pinned
+   *                    to the CPUs of their node.
+   */
+  explicit SharedCpuPool(int num_threads = 0, bool numa_aware = true);
+  ~SharedCpuPool();
+
+  DISABLE_COPY_MOVE_ASSIGN(SharedCpuPool);
+
+  /**
+   * @brief The current number of workers.
+   *
+   * The pool grows if a queue with a concurrency higher than the number of workers is created.
+   */
+  int NumThreads() const;
+
+  int NumNumaNodes() const {
+    return static_cast<int>(node_cpus_.size());
+  }
+
+  std::vector<std::thread::id> GetThreadIds() const;
+
+  /**
+   * @brief Returns the NUMA node with the most CPUs from the set, or -1 if there's none
+   *        (or the NUMA placement is off).
+   */
+  int NumaNodeOf(const cpu_set_t &cpus) const;
+
+  /**
+   * @brief The work queue of one client of the pool.
+   */
+  class DLL_PUBLIC Queue {
+   public:
+    /**
+     * @param max_concurrency The maximum number of tasks from this queue running at a time
+     * @param weight          The share of the CPU time this queue gets when competing
+     *                        with other queues
+     * @param numa_node       The preferred NUMA node, or -1 for no preference
+     */
+    Queue(SharedCpuPool &pool, int max_concurrency, double weight, int numa_node = -1);
+
+    /**
+     * @brief Waits for the queued and running tasks to complete and detaches from the pool.
+     */
+    ~Queue();
+
+    DISABLE_COPY_MOVE_ASSIGN(Queue);
+
+    void Push(Task task, int64_t priority = 0);
+
+    /**
+     * @brief Pushes multiple tasks at once, waking up the workers only once.
+     */
+    void Push(std::vector<PrioritizedTask> &&tasks);
+
+    int MaxConcurrency() const {
+      return max_concurrency_;
+    }
+
+    double Weight() const {
+      return weight_;
+    }
+
+    int NumaNode() const {
+      return numa_node_;
+    }
+
+    SharedCpuPool &Pool() const {
+      return pool_;
+    }
+
+   private:
+    friend class SharedCpuPool;
+
+    struct ByPriority {
+      bool operator()(const PrioritizedTask &a, const PrioritizedTask &b) const {
+        return a.first < b.first;
+      }
+    };
+
+    bool Idle() const {
+      return tasks_.empty() && running_ == 0;
+    }
+
+    bool Runnable() const {
+      return !tasks_.empty() && running_ < max_concurrency_;
+    }
+
+    SharedCpuPool &pool_;
+    int max_concurrency_;
+    double weight_;
+    int numa_node_;
+
+    // guarded by pool_.mtx_
+    std::priority_queue<PrioritizedTask, std::vector<PrioritizedTask>, ByPriority> tasks_;
+    std::vector<int> free_slots_;
+    int running_ = 0;
+    double vtime_ = 0;  // CPU time used, in seconds, divided by weight
+    std::condition_variable idle_cv_;
+  };
+
+ private:
+  void AddWorkers(int num_threads);
+  void WorkerMain(int index, int node);
+  Queue *PickQueue(int node) const;
+  double MinActiveVTime() const;
+  void Activate(Queue &q);
+
+  mutable std::mutex mtx_;
+  std::condition_variable work_cv_;
+  bool stop_ = false;
+  std::vector<Queue *> queues_;
+  std::vector<std::thread> workers_;
+  std::vector<std::vector<int>> node_cpus_;  // empty if NUMA placement is off
+};
+
+}  // namespace dali
+
+#endif  // DALI_PIPELINE_UTIL_SHARED_CPU_POOL_H_
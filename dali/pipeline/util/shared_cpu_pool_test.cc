@@ -0,0 +1,150 @@
+// Copyright (c) 2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "dali/pipeline/util/shared_cpu_pool.h"
+#include <gtest/gtest.h>
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <vector>
+#include "dali/pipeline/util/for_each_thread.h"
+#include "dali/pipeline/util/thread_pool.h"
+
+namespace dali {
+
+namespace test {
+
+namespace {
+
+void Spin(std::chrono::microseconds duration) {
+  auto end = std::chrono::steady_clock::now() + duration;
+  while (std::chrono::steady_clock::now() < end) {}
+}
+
+}  // namespace
+
+TEST(SharedCpuPool, ThreadPoolsShareWorkers) {
+  SharedCpuPool pool(3);
+  ThreadPool tp1(4, CPU_ONLY_DEVICE_ID, false, "SharedTP1", &pool);
+  ThreadPool tp2(2, CPU_ONLY_DEVICE_ID, false, "SharedTP2", &pool);
+  EXPECT_TRUE(tp1.IsShared());
+  EXPECT_EQ(tp1.NumThreads(), 4);
+  EXPECT_EQ(tp2.NumThreads(), 2);
+  EXPECT_EQ(pool.NumThreads(), 4);  // grown to fit the concurrency of tp1
+
+  struct Stats {
+    std::atomic<int> count{0}, running{0}, max_running{0};
+    std::mutex m;
+    std::vector<int> busy_slots;
+  };
+  Stats stats[2];
+  ThreadPool *tps[2] = { &tp1, &tp2 };
+  for (int p = 0; p < 2; p++) {
+    Stats &st = stats[p];
+    st.busy_slots.resize(tps[p]->NumThreads());
+    for (int i = 0; i < 64; i++) {
+      tps[p]->AddWork([&st](int tid) {
+        {
+          std::lock_guard g(st.m);
+          ASSERT_GE(tid, 0);
+          ASSERT_LT(tid, static_cast<int>(st.busy_slots.size()));
+          EXPECT_EQ(st.busy_slots[tid]++, 0) << "Thread index " << tid << " used concurrently";
+        }
+        int r = ++st.running;
+        int prev = st.max_running;
+        while (r > prev && !st.max_running.compare_exchange_weak(prev, r)) {}
+        Spin(std::chrono::microseconds(100));
+        st.running--;
+        {
+          std::lock_guard g(st.m);
+          st.busy_slots[tid]--;
+        }
+        st.count++;
+      });
+    }
+  }
+  tp1.RunAll(false);
+  tp2.RunAll(false);
+  tp1.WaitForWork();
+  tp2.WaitForWork();
+  EXPECT_EQ(stats[0].count, 64);
+  EXPECT_EQ(stats[1].count, 64);
+  EXPECT_LE(stats[0].max_running, 4);
+  EXPECT_LE(stats[1].max_running, 2);
+}
+
+TEST(SharedCpuPool, ThreadPoolErrorsAndPriority) {
+  SharedCpuPool pool(2);
+  ThreadPool tp(1, CPU_ONLY_DEVICE_ID, false, "SharedTP", &pool);
+  std::vector<int> order;
+  for (int i = 0; i < 5; i++)
+    tp.AddWork([&, i](int) { order.push_back(i); }, i);
+  tp.RunAll();
+  EXPECT_EQ(order, (std::vector<int>{4, 3, 2, 1, 0}));
+
+  tp.AddWork([](int) { throw std::runtime_error("test error"); }, 0, true);
+  EXPECT_THROW(tp.WaitForWork(), std::runtime_error);
+
+  std::atomic<int> count{0};
+  for (int i = 0; i < 10; i++)
+    tp.AddWork([&](int) { count++; }, 0, true);
+  tp.WaitForWork();
+  EXPECT_EQ(count, 10);
+}
+
+TEST(SharedCpuPool, ForEachThreadNotSupported) {
+  SharedCpuPool pool(1);
+  ThreadPool tp(4, CPU_ONLY_DEVICE_ID, false, "SharedTP", &pool);
+  int calls = 0;
+  EXPECT_THROW(ForEachThread(tp, [&](int) { calls++; }), std::runtime_error);
+  EXPECT_EQ(calls, 0);
+}
+
+TEST(SharedCpuPool, WeightedFairShare) {
+  SharedCpuPool pool(1, false);
+  constexpr int kTasks = 120;
+  std::mutex m;
+  std::vector<int> order;
+  {
+    SharedCpuPool::Queue light(pool, 1, 1.0), heavy(pool, 1, 3.0);
+    std::vector<SharedCpuPool::PrioritizedTask> light_tasks, heavy_tasks;
+    for (int i = 0; i < kTasks; i++) {
+      light_tasks.emplace_back(0, [&](int) {
+        Spin(std::chrono::microseconds(200));
+        std::lock_guard g(m);
+        order.push_back(0);
+      });
+      heavy_tasks.emplace_back(0, [&](int) {
+        Spin(std::chrono::microseconds(200));
+        std::lock_guard g(m);
+        order.push_back(1);
+      });
+    }
+    light.Push(std::move(light_tasks));
+    heavy.Push(std::move(heavy_tasks));
+  }  // the destructors wait for the tasks to complete
+  ASSERT_EQ(order.size(), 2u * kTasks);
+
+  // While both queues compete, the heavy one should get ~3/4 of the time
+  int heavy = 0;
+  constexpr int kWindow = 80;
+  for (int i = 0; i < kWindow; i++)
+    heavy += order[i];
+  EXPECT_GE(heavy, kWindow * 6 / 10);
+  EXPECT_LE(heavy, kWindow * 9 / 10);
+}
+
+}  // namespace test
+
+}  // namespace dali
@@ -12,23 +12,27 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+#include <sched.h>
 #include <chrono>
 #include <cstdlib>
 #include <limits>
 #include <utility>
 #include "dali/pipeline/util/thread_pool.h"
 #if NVML_ENABLED
+#include <sys/sysinfo.h>
 #include "dali/util/nvml.h"
 #endif
 #include "dali/core/format.h"
 #include "dali/core/cuda_error.h"
 #include "dali/core/device_guard.h"
 #include "dali/core/nvtx.h"
+#include "dali/core/os/numa.h"
 
 namespace dali {
 
-ThreadPool::ThreadPool(int num_thread, int device_id, bool set_affinity, const char* name)
-    : threads_(num_thread) {
+ThreadPool::ThreadPool(int num_thread, int device_id, bool set_affinity, const char* name,
+                       SharedCpuPool *shared_pool)
+    : num_threads_(num_thread), device_id_(device_id) {
   DALI_ENFORCE(num_thread > 0, "Thread pool must have non-zero size");
 #if NVML_ENABLED
   // We use NVML only for setting thread affinity
@@ -36,17 +40,51 @@ ThreadPool::ThreadPool(int num_thread, int device_id, bool set_affinity, const c
     nvml_handle_ = nvml::NvmlInstance::CreateNvmlInstance();
   }
 #endif
+  tl_errors_.resize(num_thread);
+  if (shared_pool) {
+    int numa_node = -1;
+#if NVML_ENABLED
+    if (device_id != CPU_ONLY_DEVICE_ID && set_affinity && shared_pool->NumNumaNodes() > 1) {
+      DeviceGuard dg(device_id);
+      std::lock_guard<std::mutex> lock(nvml::Mutex());
+      cpu_set_t device_cpus;
+      CPU_ZERO(&device_cpus);
+      nvml::GetNVMLAffinityMask(&device_cpus, get_nprocs_conf());
+      numa_node = shared_pool->NumaNodeOf(device_cpus);
+    }
+#endif
+    if (numa_node < 0 && shared_pool->NumNumaNodes() > 1) {
+      // The pool is created by a thread pinned by the pipeline's NUMA policy - prefer the shared
+      // workers local to its CPUs.
+      auto cpus = numa::GetThreadAffinity();
+      if (!cpus.empty() && cpus != numa::ProcessCpus()) {
+        cpu_set_t cpu_set;
+        CPU_ZERO(&cpu_set);
+        for (int cpu : cpus)
+          CPU_SET(cpu, &cpu_set);
+        numa_node = shared_pool->NumaNodeOf(cpu_set);
+      }
+    }
+    shared_queue_ = std::make_unique<SharedCpuPool::Queue>(*shared_pool, num_thread, num_thread,
+                                                           numa_node);
+    return;
+  }
+  threads_.resize(num_thread);
   // Start the threads in the main loop
   for (int i = 0; i < num_thread; ++i) {
     threads_[i] = std::thread(std::bind(&ThreadPool::ThreadMain, this, i, device_id, set_affinity,
                                         make_string("[DALI][TP", i, "]", name)));
   }
-  tl_errors_.resize(num_thread);
 }
 
 ThreadPool::~ThreadPool() {
   WaitForWork(false);
 
+  if (shared_queue_) {
+    shared_queue_.reset();  // waits until the shared pool is done with this queue
+    return;
+  }
+
   std::unique_lock lock(queue_lock_);
   running_ = false;
   lock.unlock();
@@ -59,6 +97,17 @@ ThreadPool::~ThreadPool() {
 }
 
 void ThreadPool::AddWork(Work work, int64_t priority, bool start_immediately) {
+  if (shared_queue_) {
+    outstanding_work_.fetch_add(1);
+    if (started_) {
+      shared_queue_->Push(SharedWork(std::move(work)), priority);
+    } else {
+      work_queue_.push({priority, std::move(work)});
+      if (start_immediately)
+        RunAll(false);
+    }
+    return;
+  }
   bool started_before = started_;
   outstanding_work_.fetch_add(1);
   if (started_before) {
@@ -79,6 +128,13 @@ void ThreadPool::AddWork(Work work, int64_t priority, bool start_immediately) {
   }
 }
 
+SharedCpuPool::Task ThreadPool::SharedWork(Work &&work) {
+  return [this, work = std::move(work)](int thread_id) mutable {
+    DeviceGuard g(device_id_);
+    RunWork(work, thread_id);
+  };
+}
+
 // Blocks until all work issued to the thread pool is complete
 void ThreadPool::WaitForWork(bool checkForErrors) {
   if (outstanding_work_.load()) {
@@ -91,7 +147,7 @@ void ThreadPool::WaitForWork(bool checkForErrors) {
   if (checkForErrors) {
     // Check for errors
     std::lock_guard lock(error_mutex_);
-    for (size_t i = 0; i < threads_.size(); ++i) {
+    for (size_t i = 0; i < tl_errors_.size(); ++i) {
       if (!tl_errors_[i].empty()) {
         // Throw the first error that occurred
         string error = make_string("Error in thread ", i, ": ", tl_errors_[i].front());
@@ -103,7 +159,17 @@ void ThreadPool::WaitForWork(bool checkForErrors) {
 }
 
 void ThreadPool::RunAll(bool wait) {
-  if (!started_) {
+  if (shared_queue_ && !started_) {
+    started_ = true;
+    std::vector<SharedCpuPool::PrioritizedTask> tasks;
+    tasks.reserve(work_queue_.size());
+    while (!work_queue_.empty()) {
+      auto &top = const_cast<PrioritizedWork &>(work_queue_.top());
+      tasks.emplace_back(top.first, SharedWork(std::move(top.second)));
+      work_queue_.pop();
+    }
+    shared_queue_->Push(std::move(tasks));
+  } else if (!started_) {
     {
       std::lock_guard lock(queue_lock_);
       started_ = true;
@@ -116,10 +182,12 @@ void ThreadPool::RunAll(bool wait) {
 }
 
 int ThreadPool::NumThreads() const {
-  return threads_.size();
+  return num_threads_;
 }
 
 std::vector<std::thread::id> ThreadPool::GetThreadIds() const {
+  if (shared_queue_)
+    return shared_queue_->Pool().GetThreadIds();
   std::vector<std::thread::id> tids;
   tids.reserve(threads_.size());
   for (const auto &thread : threads_)
@@ -174,65 +242,69 @@ void ThreadPool::ThreadMain(int thread_id, int device_id, bool set_affinity,
     // Unlock the lock
     lock.unlock();
 
-    // If an error occurs, we save it in tl_errors_. When
-    // WaitForWork is called, we will check for any errors
-    // in the threads and return an error if one occured.
-    try {
-      work(thread_id);
-    } catch (std::exception &e) {
-      std::lock_guard lock(error_mutex_);
-      tl_errors_[thread_id].push(e.what());
-    } catch (...) {
-      std::lock_guard lock(error_mutex_);
-      tl_errors_[thread_id].push("Caught unknown exception");
-    }
+    RunWork(work, thread_id);
+  }
+}
 
-    // The task is now complete - we can atomically decrement the number of outstanding work.
-    // If it reaches zero, we must safely notify the potential threads waiting for the work
-    // to complete.
-    // NOTE: We don't have to acquire the mutex until the number of waiting threads reaches 0.
-    if (--outstanding_work_ == 0) {
-      // We don't need to guard the modification of the atomic value with a mutex -
-      // however, we need to lock it briefly to make sure we don't have this scenario:
-      //
-      // worker                           WaitForWork
-      //
-      //                                  completed_mutex_.lock()
-      //                                  return outstanding_work_ == 0  (false!)
-      // --outstanding_work == 0 (true)
-      // compleded_.notify_all()          NOT WAITING FOR compleded_ YET!!!!!!!!!!!!!
-      //                                  atomically unlock `lock` and wait for `completed_`
-      //                                                               ^^^^ deadlock
-
-
-      // The brief lock/unlock sequence avoids the above.
-      // The call to lock.lock() prevents the worker thread from signalling the event while
-      // the control thread is evaluating the condition (which happens with the mutex owned).
-      // Now it looks like this:
-      //
-      // worker                           WaitForWork
-      //
-      //                                  completed_mutex_.lock()
-      //                                  return outstanding_work_ == 0  (false!)
-      // --outstanding_work == 0 (true)
-      // completed_mutex_.lock()
-      //                                  atomically unlock `lock` and wait for `completed_`
-      // At this point we know that if
-      // anyone was executing WaitForWork
-      // they're not evaluating the
-      // condition but rather waiting on
-      // the completed_ condvar.
-      //
-      // completed_mutex_.unlock()
-      // compleded_.notify_all()
-      //                                  notified - wake up
-      //                                  completed_mutex_.lock()
-      //                                  continue execution
-      {
-        std::lock_guard lock2(completed_mutex_);
-      }
-      completed_.notify_all();
+void ThreadPool::RunWork(Work &work, int thread_id) {
+  // If an error occurs, we save it in tl_errors_. When
+  // WaitForWork is called, we will check for any errors
+  // in the threads and return an error if one occured.
+  try {
+    work(thread_id);
+  } catch (std::exception &e) {
+    std::lock_guard lock(error_mutex_);
+    tl_errors_[thread_id].push(e.what());
+  } catch (...) {
+    std::lock_guard lock(error_mutex_);
+    tl_errors_[thread_id].push("Caught unknown exception");
+  }
+
+  // The task is now complete - we can atomically decrement the number of outstanding work.
+  // If it reaches zero, we must safely notify the potential threads waiting for the work
+  // to complete.
+  // NOTE: We don't have to acquire the mutex until the number of waiting threads reaches 0.
+  if (--outstanding_work_ == 0) {
+    // We don't need to guard the modification of the atomic value with a mutex -
+    // however, we need to lock it briefly to make sure we don't have this scenario:
+    //
+    // worker                           WaitForWork
+    //
+    //                                  completed_mutex_.lock()
+    //                                  return outstanding_work_ == 0  (false!)
+    // --outstanding_work == 0 (true)
+    // compleded_.notify_all()          NOT WAITING FOR compleded_ YET!!!!!!!!!!!!!
+    //                                  atomically unlock `lock` and wait for `completed_`
+    //                                                               ^^^^ deadlock
+
+
+    // The brief lock/unlock sequence avoids the above.
+    // The call to lock.lock() prevents the worker thread from signalling the event while
+    // the control thread is evaluating the condition (which happens with the mutex owned).
+    // Now it looks like this:
+    //
+    // worker                           WaitForWork
+    //
+    //                                  completed_mutex_.lock()
+    //                                  return outstanding_work_ == 0  (false!)
+    // --outstanding_work == 0 (true)
+    // completed_mutex_.lock()
+    //                                  atomically unlock `lock` and wait for `completed_`
+    // At this point we know that if
+    // anyone was executing WaitForWork
+    // they're not evaluating the
+    // condition but rather waiting on
+    // the completed_ condvar.
+    //
+    // completed_mutex_.unlock()
+    // compleded_.notify_all()
+    //                                  notified - wake up
+    //                                  completed_mutex_.lock()
+    //                                  continue execution
+    {
+      std::lock_guard lock2(completed_mutex_);
     }
+    completed_.notify_all();
   }
 }
 
@@ -20,6 +20,7 @@
 #include <utility>
 #include <condition_variable>
 #include <functional>
+#include <memory>
 #include <mutex>
 #include <queue>
 #include <thread>
@@ -31,6 +32,7 @@
 #endif
 #include "dali/core/semaphore.h"
 #include "dali/core/spinlock.h"
+#include "dali/pipeline/util/shared_cpu_pool.h"
 
 
 namespace dali {
@@ -40,11 +42,23 @@ class DLL_PUBLIC ThreadPool {
   // Basic unit of work that our threads do
   typedef std::function<void(int)> Work;
 
-  DLL_PUBLIC ThreadPool(int num_thread, int device_id, bool set_affinity, const char* name);
+  DLL_PUBLIC ThreadPool(int num_thread, int device_id, bool set_affinity, const char* name)
+      : ThreadPool(num_thread, device_id, set_affinity, name, nullptr) {}
 
   DLL_PUBLIC ThreadPool(int num_thread, int device_id, bool set_affinity, const std::string& name)
       : ThreadPool(num_thread, device_id, set_affinity, name.c_str()) {}
 
+  /**
+   * @brief Creates a thread pool which, if `shared_pool` is not null, doesn't have threads
+   *        of its own, but runs the work in the shared pool.
+   *
+   * The work still sees thread indices in range [0, num_thread) and no more than `num_thread`
+   * work items run at a time. The share of the shared pool's CPU time is proportional to
+   * `num_thread`. With `set_affinity`, the work prefers the NUMA node closest to the device.
+   */
+  DLL_PUBLIC ThreadPool(int num_thread, int device_id, bool set_affinity, const char* name,
+                        SharedCpuPool *shared_pool);
+
   DLL_PUBLIC ~ThreadPool();
 
   /**
@@ -71,15 +85,37 @@ class DLL_PUBLIC ThreadPool {
 
   DLL_PUBLIC int NumThreads() const;
 
+  /**
+   * @brief Returns the identifiers of the threads which run the work.
+   *
+   * For a thread pool running in a shared pool, these are all the threads of the shared pool.
+   */
   DLL_PUBLIC std::vector<std::thread::id> GetThreadIds() const;
 
+  bool IsShared() const {
+    return shared_queue_ != nullptr;
+  }
+
   DISABLE_COPY_MOVE_ASSIGN(ThreadPool);
 
  private:
   DLL_PUBLIC void ThreadMain(int thread_id, int device_id, bool set_affinity,
                              const std::string &name);
 
+  /**
+   * @brief Runs a work item, records the errors and signals the completion
+   */
+  void RunWork(Work &work, int thread_id);
+
+  /**
+   * @brief Wraps a work item for execution in the shared pool
+   */
+  SharedCpuPool::Task SharedWork(Work &&work);
+
+  int num_threads_;
+  int device_id_;
   vector<std::thread> threads_;
+  std::unique_ptr<SharedCpuPool::Queue> shared_queue_;
 
   using PrioritizedWork = std::pair<int64_t, Work>;
   struct SortByPriority {
@@ -24,6 +24,7 @@
 #include "pyerrors.h"  // NOLINT(build/include)
 #if SHM_WRAPPER_ENABLED
 #include "dali/core/os/shared_mem.h"
+#include "dali/core/os/shm_ring.h"
 #endif
 #include "dali/core/python_util.h"
 #include "dali/core/mm/default_resources.h"
@@ -1725,6 +1726,20 @@ Calling this function while DALI pipelines are running is generally safe, but it
 to preallocate memory for a pipeline that's already running - this may result in a race
 for memory and possibly trigger out-of-memory error in the pipeline.
 )", "bytes"_a);
+  m.def("UseHugePageHostMemory", mm::UseHugePageHostMemory,
+R"(Serve large host memory allocations from huge pages
+
+The allocations larger than `min_bytes` are served from a pool backed by huge pages, which
+reduces the TLB misses and page faults when processing large CPU batches. The pages are
+populated when the pool grows.
+
+`page_size` is 0 for transparent huge pages or the size of explicit huge pages (2 MiB or 1 GiB).
+Explicit huge pages must be reserved in the system; if they're not available, transparent huge
+pages are used instead.
+
+The function should be called before the pipelines are built - the memory allocated earlier
+doesn't use huge pages.
+)", "page_size"_a = 0, "min_bytes"_a = mm::kDefaultHugePageMinBytes);
 
   m.def("ReleaseUnusedMemory", mm::ReleaseUnusedMemory,
 R"(Frees unused blocks from memory pools.
@@ -1875,7 +1890,9 @@ void ExposePipelineParams(py::module &m) {
         std::optional<std::pair<int, int>> prefetch_queue_depths,
         std::optional<bool> enable_checkpointing,
         std::optional<bool> enable_memory_stats,
-        std::optional<size_t> bytes_per_sample_hint) {
+        std::optional<size_t> bytes_per_sample_hint,
+        std::optional<int> numa_node,
+        std::optional<std::vector<int>> cpu_affinity) {
       std::optional<QueueSizes> queue_sizes;
       if (prefetch_queue_depths)
         queue_sizes = QueueSizes{prefetch_queue_depths->first, prefetch_queue_depths->second};
@@ -1890,7 +1907,9 @@ void ExposePipelineParams(py::module &m) {
         queue_sizes,
         enable_checkpointing,
         enable_memory_stats,
-        bytes_per_sample_hint
+        bytes_per_sample_hint,
+        numa_node,
+        std::move(cpu_affinity)
       });
     }),
     "max_batch_size"_a = py::none(),
@@ -1902,7 +1921,9 @@ void ExposePipelineParams(py::module &m) {
     "prefetch_queue_depths"_a = py::none(),
     "enable_checkpointing"_a = py::none(),
     "enable_memory_stats"_a = py::none(),
-    "bytes_per_sample_hint"_a = py::none()
+    "bytes_per_sample_hint"_a = py::none(),
+    "numa_node"_a = py::none(),
+    "cpu_affinity"_a = py::none()
     )
   .def_readwrite("max_batch_size", &PipelineParams::max_batch_size)
   .def_readwrite("num_threads", &PipelineParams::num_threads)
@@ -1925,7 +1946,9 @@ void ExposePipelineParams(py::module &m) {
     })
   .def_readwrite("enable_checkpointing", &PipelineParams::enable_checkpointing)
   .def_readwrite("enable_memory_stats", &PipelineParams::enable_memory_stats)
-  .def_readwrite("bytes_per_sample_hint", &PipelineParams::bytes_per_sample_hint);
+  .def_readwrite("bytes_per_sample_hint", &PipelineParams::bytes_per_sample_hint)
+  .def_readwrite("numa_node", &PipelineParams::numa_node)
+  .def_readwrite("cpu_affinity", &PipelineParams::cpu_affinity);
 }
 
 void ExposePipeline(py::module &m) {
@@ -1968,13 +1991,21 @@ void ExposePipeline(py::module &m) {
         },
         "checkpointing"_a = true)
     .def("GetSerializedCheckpoint",
-        [](Pipeline *p, const ExternalContextCheckpoint &external_ctx_cpt) -> py::bytes {
-          return p->GetSerializedCheckpoint(external_ctx_cpt);
-          })
+        [](Pipeline *p, const ExternalContextCheckpoint &external_ctx_cpt,
+           bool incremental) -> py::bytes {
+          return p->GetSerializedCheckpoint(external_ctx_cpt, incremental);
+          },
+        "external_ctx_cpt"_a, "incremental"_a = false)
     .def("RestoreFromSerializedCheckpoint",
         [](Pipeline *p, const std::string &serialized_checkpoint) {
           return p->RestoreFromSerializedCheckpoint(serialized_checkpoint);
         })
+    .def("RestoreFromSerializedCheckpoint",
+        [](Pipeline *p, const std::vector<std::string> &serialized_checkpoints) {
+          std::vector<std::string_view> views(serialized_checkpoints.begin(),
+                                              serialized_checkpoints.end());
+          return p->RestoreFromSerializedCheckpoint(make_cspan(views));
+        })
     .def("executor_statistics",
         [](Pipeline *p) {
           auto ret = p->GetExecutorMeta();
@@ -2449,6 +2480,57 @@ PYBIND11_MODULE(backend_impl, m) {
       .def("close_handle", &SharedMem::close_handle)
       .def("close", &SharedMem::close);
 
+  py::class_<shm_ring::Producer>(m, "ShmRingProducer",
+      "Writes batches to a shared memory ring, "
+      "read by ``fn.experimental.inputs.shared_memory_ring``.")
+      .def(py::init<std::string, int, uint64_t>(), "name"_a, "num_slots"_a, "slot_size"_a)
+      .def_property_readonly("name", &shm_ring::Producer::name)
+      .def_property_readonly("free_slots", &shm_ring::Producer::free_slots)
+      .def("push",
+           [](shm_ring::Producer &producer, const py::list &samples, const std::string &layout,
+              std::optional<double> timeout) {
+             DALI_ENFORCE(samples.size() > 0, "Cannot push an empty batch.");
+             std::vector<py::buffer_info> infos;
+             infos.reserve(samples.size());
+             for (py::handle sample : samples)
+               infos.push_back(sample.cast<py::buffer>().request());
+             int ndim = infos[0].ndim;
+             DALIDataType type = TypeFromFormatStr(infos[0].format).id();
+             TensorListShape<> shape(infos.size(), ndim);
+             for (size_t i = 0; i < infos.size(); i++) {
+               auto &info = infos[i];
+               DALI_ENFORCE(info.ndim == ndim && TypeFromFormatStr(info.format).id() == type,
+                            "All the samples in a batch must have the same type and number of "
+                            "dimensions.");
+               CheckContiguousTensor(info.strides, info.shape, info.itemsize);
+               shape.set_tensor_shape(i, info.shape);
+             }
+             auto wait_time = timeout.has_value()
+                 ? std::chrono::duration_cast<std::chrono::microseconds>(
+                       std::chrono::duration<double>(*timeout))
+                 : std::chrono::microseconds::max();
+             py::gil_scoped_release interpreter_unlock{};
+             if (!producer.WaitForSlot(wait_time))
+               return false;
+             uint8_t *dst = producer.BeginWrite(shape, type, layout);
+             for (auto &info : infos) {
+               size_t bytes = volume(info.shape) * info.itemsize;
+               memcpy(dst, info.ptr, bytes);
+               dst += bytes;
+             }
+             producer.Publish();
+             return true;
+           },
+           "samples"_a, "layout"_a = "", "timeout"_a = py::none(),
+           R"code(Copies a batch to the next free slot of the ring and publishes it.
+
+The samples must be contiguous arrays of the same type and number of dimensions.
+Waits for a free slot up to ``timeout`` seconds (indefinitely if ``None``).
+Returns ``False`` if the wait timed out.)code")
+      .def("close", &shm_ring::Producer::Close,
+           "Closes the ring - the pipeline raises ``StopIteration`` after reading the remaining "
+           "batches.");
+
 #endif
 
   // Types
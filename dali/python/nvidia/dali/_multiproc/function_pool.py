@@ -0,0 +1,307 @@
+# Copyright (c) 2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+"""Pool of worker processes running per-sample calls of CPU ``python_function`` operators.
+
+The main process copies the input samples into a shared memory arena and every worker gets
+zero-copy NumPy (or DLPack) views of its part of the batch. The outputs are written by the
+workers into their own shared memory arenas and passed back to DALI as zero-copy DLPack views,
+so the only copies are the ones into and out of DALI's own buffers.
+"""
+
+import multiprocessing
+import os
+import traceback
+from multiprocessing import reduction
+from nvidia.dali._multiproc.shared_batch import import_numpy, _align_up
+from nvidia.dali._multiproc.shared_mem import SharedMem
+
+np = None
+
+_initial_arena_size = 1 << 20
+_sample_alignment = 64
+
+
+def _import_numpy():
+    global np
+    if np is None:
+        import_numpy()
+        import numpy as np
+
+
+def _grow(shm, required):
+    """Grows the arena (keeping the handle) so that it can hold at least `required` bytes."""
+    if shm.capacity >= required:
+        return False
+    shm.resize(max(required, 2 * shm.capacity), trunc=True)
+    return True
+
+
+def _arena_view(shm, offset, shape, dtype):
+    return np.ndarray(shape, dtype=dtype, buffer=shm.buf, offset=offset)
+
+
+def _layout_samples(samples):
+    """Assigns aligned offsets to the arrays in `samples` (a list of lists of arrays).
+
+    Returns the list of per-sample lists of ``(offset, shape, dtype)`` descriptors and the total
+    size in bytes.
+    """
+    offset = 0
+    descs = []
+    for sample in samples:
+        sample_descs = []
+        for array in sample:
+            offset = _align_up(offset, _sample_alignment)
+            sample_descs.append((offset, array.shape, array.dtype.str))
+            offset += array.nbytes
+        descs.append(sample_descs)
+    return descs, offset
+
+
+def _write_samples(shm, samples, descs):
+    for sample, sample_descs in zip(samples, descs):
+        for array, (offset, shape, dtype) in zip(sample, sample_descs):
+            _arena_view(shm, offset, shape, dtype)[...] = array
+
+
+def _worker_loop(conn, function, num_outputs, from_array, to_array, check_outputs):
+    _import_numpy()
+    in_size = conn.recv()
+    in_shm = SharedMem.open(reduction.recv_handle(conn), in_size)
+    out_shm = SharedMem.allocate(_initial_arena_size)
+    conn.send(out_shm.capacity)
+    reduction.send_handle(conn, out_shm.handle, os.getppid())
+    while True:
+        msg = conn.recv()
+        if msg is None:
+            break
+        in_size, descs = msg
+        if in_size != in_shm.capacity:
+            # the main process resized the arena, adjust the mapping
+            in_shm.resize(in_size, trunc=False)
+        try:
+            outputs = []
+            for sample_descs in descs:
+                args = []
+                for offset, shape, dtype in sample_descs:
+                    array = _arena_view(in_shm, offset, shape, dtype)
+                    array.flags.writeable = False
+                    args.append(from_array(array))
+                out = function(*args)
+                if out is None:
+                    outputs.append(None)
+                    continue
+                check_outputs(out, num_outputs)
+                out = out if isinstance(out, tuple) else (out,)
+                outputs.append([np.asarray(to_array(o)) for o in out])
+            args = None
+            present = [sample for sample in outputs if sample is not None]
+            out_descs, out_size = _layout_samples(present)
+            _grow(out_shm, out_size)
+            _write_samples(out_shm, present, out_descs)
+            it = iter(out_descs)
+            result = [None if sample is None else next(it) for sample in outputs]
+            conn.send(("done", out_shm.capacity, result))
+        except Exception as e:
+            conn.send(("error", repr(e), traceback.format_exc()))
+    in_shm.close()
+    out_shm.close()
+    conn.close()
+
+
+class _Worker:
+    def __init__(self, process, conn, out_shm):
+        self.process = process
+        self.conn = conn
+        self.out_shm = out_shm
+
+
+class FunctionWorkerPool:
+    """Runs a per-sample Python function in a pool of worker processes.
+
+    Parameters
+    ----------
+    function : callable
+        Function invoked once per sample, with the sample's inputs as positional arguments.
+    num_outputs : int
+        Number of outputs returned by the function.
+    num_workers : int
+        Number of worker processes.
+    from_array : callable
+        Converts a NumPy view of an input in shared memory into the argument type expected by
+        the `function`.
+    to_array : callable
+        Converts a single output of the `function` into something accepted by ``numpy.asarray``.
+    check_outputs : callable
+        Validates the value returned by the `function`, ``check_outputs(outputs, num_outputs)``.
+    """
+
+    def __init__(
+        self,
+        function,
+        num_outputs,
+        num_workers,
+        from_array,
+        to_array,
+        check_outputs,
+    ):
+        if num_workers <= 0:
+            raise ValueError(f"The number of workers must be positive, got {num_workers}.")
+        self._function = function
+        self._num_outputs = num_outputs
+        self._num_workers = num_workers
+        self._from_array = from_array
+        self._to_array = to_array
+        self._check_outputs = check_outputs
+        self._workers = None
+        self._in_shm = None
+
+    @property
+    def started(self):
+        return self._workers is not None
+
+    def start(self, start_method="fork"):
+        """Starts the worker processes, if they are not running yet.
+
+        With ``"fork"``, it must be called before the current process acquires a CUDA context.
+        With ``"spawn"``, the `function` and the converters must be picklable.
+        """
+        if self.started:
+            return
+        _import_numpy()
+        mp = multiprocessing.get_context(start_method)
+        self._in_shm = SharedMem.allocate(_initial_arena_size)
+        workers = []
+        try:
+            for _ in range(self._num_workers):
+                conn, worker_conn = mp.Pipe(duplex=True)
+                process = mp.Process(
+                    target=_worker_loop,
+                    args=(
+                        worker_conn,
+                        self._function,
+                        self._num_outputs,
+                        self._from_array,
+                        self._to_array,
+                        self._check_outputs,
+                    ),
+                    daemon=True,
+                )
+                process.start()
+                worker_conn.close()
+                conn.send(self._in_shm.capacity)
+                reduction.send_handle(conn, self._in_shm.handle, process.pid)
+                workers.append(_Worker(process, conn, None))
+            for worker in workers:
+                out_size = worker.conn.recv()
+                worker.out_shm = SharedMem.open(reduction.recv_handle(worker.conn), out_size)
+        except:  # noqa: E722
+            self._workers = workers
+            self.close()
+            raise
+        self._workers = workers
+
+    def run(self, batch):
+        """Processes the `batch` - a list of per-sample lists of input DLPack tensors.
+
+        Returns the list of per-sample outputs (a DLPack tensor or a tuple of DLPack tensors
+        for multiple outputs), or None if the function returned None for every sample.
+        The returned tensors are views into the workers' shared memory, which stay valid until
+        the next call to ``run``.
+
+        The workers must be started first (see ``start``). If a worker exits unexpectedly,
+        the pool is closed and can't be used anymore.
+        """
+        from nvidia.dali.python_function_plugin import DLTensorToArray, ArrayToDLTensor
+
+        if not self.started:
+            # Starting the workers here, in the executor's thread, could fork a process which
+            # already has a CUDA context.
+            raise RuntimeError(
+                "The worker processes running the Python function are not running. They are "
+                "started when the pipeline is built and stopped if any of them exits unexpectedly."
+            )
+        samples = [[DLTensorToArray(dl) for dl in sample] for sample in batch]
+        in_descs, in_size = _layout_samples(samples)
+        _grow(self._in_shm, in_size)
+        _write_samples(self._in_shm, samples, in_descs)
+        samples = None
+
+        # contiguous ranges of samples, one per worker
+        num_samples = len(in_descs)
+        bounds = [num_samples * i // self._num_workers for i in range(self._num_workers + 1)]
+        for i, worker in enumerate(self._workers):
+            worker.conn.send((self._in_shm.capacity, in_descs[bounds[i] : bounds[i + 1]]))
+
+        results = []
+        error = None
+        for worker in self._workers:
+            try:
+                msg = worker.conn.recv()
+            except EOFError:
+                # The replies of the other workers would be read by the next call - don't reuse
+                # the pool.
+                exitcode = worker.process.exitcode
+                pid = worker.process.pid
+                self.close()
+                raise RuntimeError(
+                    f"The worker process (pid {pid}) running the Python function exited "
+                    f"unexpectedly with the exit code {exitcode}."
+                )
+            if msg[0] == "error":
+                if error is None:
+                    error = msg
+                continue
+            _, out_size, descs = msg
+            if out_size != worker.out_shm.capacity:
+                worker.out_shm.resize(out_size, trunc=False)
+            results.append((worker, descs))
+        if error is not None:
+            _, exc_repr, tb = error
+            raise RuntimeError(
+                f"Exception in the worker process running the Python function: {exc_repr}\n{tb}"
+            )
+
+        outputs = []
+        for worker, descs in results:
+            for sample_descs in descs:
+                if sample_descs is None:
+                    continue
+                tensors = tuple(
+                    ArrayToDLTensor(_arena_view(worker.out_shm, offset, shape, dtype))
+                    for offset, shape, dtype in sample_descs
+                )
+                outputs.append(tensors if self._num_outputs > 1 else tensors[0])
+        return outputs if outputs else None
+
+    def close(self):
+        if self._workers is None:
+            return
+        for worker in self._workers:
+            try:
+                worker.conn.send(None)
+            except (OSError, ValueError):
+                pass
+        for worker in self._workers:
+            worker.process.join(timeout=5)
+            if worker.process.is_alive():
+                worker.process.terminate()
+            worker.conn.close()
+            if worker.out_shm is not None:
+                worker.out_shm.close()
+        self._workers = None
+        if self._in_shm is not None:
+            self._in_shm.close()
+            self._in_shm = None
@@ -1,4 +1,4 @@
-# Copyright (c) 2023-2024, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+# Copyright (c) 2023-2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
 #
 # Licensed under the Apache License, Version 2.0 (the "License");
 # you may not use this file except in compliance with the License.
@@ -190,6 +190,71 @@ def _generate_input_desc(categories_idx, integers, reals):
     return input_desc
 
 
+# The limit of function nodes in an expression evaluated by one ArithmeticGenericOp.
+# With at most 3 operands per node, it keeps the number of inputs within the operator's limit.
+_max_fused_expr_nodes = 16
+
+
+class _ArithmExpr:
+    """
+    Expression tree evaluated by one ArithmeticGenericOp on the CPU.
+
+    The arguments of the function are the inputs (DataNodes), scalar constants or nested
+    expressions - the results of other CPU arithmetic operations, folded into this one.
+    """
+
+    def __init__(self, name, args):
+        self.name = name
+        self.args = args
+        self.num_nodes = 1 + sum(arg.num_nodes for arg in args if isinstance(arg, _ArithmExpr))
+
+
+def _fold_subexpressions(name, categories_idxs, edges, integers, reals):
+    """
+    Create the expression tree of an arithmetic operation, inlining the inputs which are
+    results of other CPU arithmetic operations, so that the whole expression is evaluated
+    in one pass, without intermediate batches.
+
+    The subexpression is inlined even if its result is used elsewhere - recomputing it is
+    usually cheaper than writing and reading back the intermediate batch.
+    """
+    categories = {"edge": edges, "integer": integers, "real": reals}
+    args = []
+    num_nodes = 1
+    for category, idx in categories_idxs:
+        arg = categories[category][idx]
+        subexpr = getattr(arg, "_arithm_expr", None) if category == "edge" else None
+        if subexpr is not None and num_nodes + subexpr.num_nodes <= _max_fused_expr_nodes:
+            arg = subexpr
+            num_nodes += subexpr.num_nodes
+        args.append(arg)
+    return _ArithmExpr(name, args)
+
+
+def _generate_expression_desc(expr, edges, integers, reals):
+    """
+    Generate the ``expression_desc`` of the expression tree, as specified by the grammar for
+    ArithmeticGenericOp. The inputs and constants are appended to ``edges``, ``integers``
+    and ``reals`` - a DataNode used more than once in the expression is one input.
+    """
+    arg_descs = []
+    for arg in expr.args:
+        if isinstance(arg, _ArithmExpr):
+            arg_descs.append(_generate_expression_desc(arg, edges, integers, reals))
+        elif isinstance(arg, _DataNode):
+            idx = next((i for i, edge in enumerate(edges) if edge is arg), len(edges))
+            if idx == len(edges):
+                edges.append(arg)
+            arg_descs.append("&{}".format(idx))
+        elif _is_integer_like(arg):
+            arg_descs.append("${}:{}".format(len(integers), _to_type_desc(arg)))
+            integers.append(arg)
+        else:
+            arg_descs.append("${}:{}".format(len(reals), _to_type_desc(arg)))
+            reals.append(arg)
+    return "{}({})".format(expr.name, " ".join(arg_descs))
+
+
 def _has_nested_datanodes(value, visited):
     i = id(value)
     if i in visited:
@@ -256,9 +321,20 @@ def _arithm_op(name, *inputs, definition_frame_end=None):
         _check_nested_datanode(display_name, i, inp)
 
     categories_idxs, edges, integers, reals = _group_inputs(inputs)
-    input_desc = _generate_input_desc(categories_idxs, integers, reals)
-    expression_desc = "{}({})".format(name, input_desc)
     dev = nvidia.dali.ops._choose_device(edges)
+    # The CPU operator evaluates whole expression trees - the nested arithmetic operations are
+    # folded into one operator. The GPU operator supports only single-function expressions.
+    # The folding is skipped in conditionals, which need to split the inputs of each operator.
+    expr = None
+    if dev == "cpu" and not _conditionals.conditionals_enabled():
+        expr = _fold_subexpressions(name, categories_idxs, edges, integers, reals)
+        edges, integers, reals = [], [], []
+        expression_desc = _generate_expression_desc(expr, edges, integers, reals)
+        integers = integers or None
+        reals = reals or None
+    else:
+        input_desc = _generate_input_desc(categories_idxs, integers, reals)
+        expression_desc = "{}({})".format(name, input_desc)
 
     # We calculate the stack depth of the user code here to reduce the noise.
     if _dali_trace.is_tracing_enabled():
@@ -284,6 +360,8 @@ def _arithm_op(name, *inputs, definition_frame_end=None):
 
     # Call it immediately
     result = op(*dev_inputs)
+    if expr is not None:
+        result._arithm_expr = expr
     if _conditionals.conditionals_enabled():
         _conditionals.register_data_nodes(result, dev_inputs)
     return result
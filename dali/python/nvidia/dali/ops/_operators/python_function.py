@@ -1,4 +1,4 @@
-# Copyright (c) 2023-2024, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+# Copyright (c) 2023-2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
 #
 # Licensed under the Apache License, Version 2.0 (the "License");
 # you may not use this file except in compliance with the License.
@@ -13,12 +13,14 @@
 # limitations under the License.
 
 
+import weakref
 import nvidia.dali.python_function_plugin
 from nvidia.dali import ops
 from nvidia.dali.ops import _registry
 from nvidia.dali.data_node import DataNode as _DataNode
 from nvidia.dali.pipeline import Pipeline as _Pipeline
 from nvidia.dali.types import CUDAStream as _CUDAStream
+from nvidia.dali._multiproc.function_pool import FunctionWorkerPool as _FunctionWorkerPool
 
 
 cupy = None
@@ -48,6 +50,18 @@ def _get_base_impl(name, impl_name):
             self.function = function
             self.num_outputs = num_outputs
             self._preserve = True
+            self._worker_pool = None
+
+        def _set_worker_pool(self, pool):
+            self._worker_pool = pool
+            # ensure the worker processes are stopped when the operator is no longer used
+            weakref.finalize(self, lambda pool: pool.close(), pool)
+
+        def _start_py_workers(self, start_method):
+            """Starts the worker processes, if the operator uses them. Called by the pipeline
+            before it acquires a CUDA context."""
+            if self._worker_pool is not None:
+                self._worker_pool.start(start_method)
 
         def __call__(self, *inputs, **kwargs):
             inputs = ops._preprocess_inputs(inputs, impl_name, self._device, None)
@@ -80,6 +94,19 @@ def _get_base_impl(name, impl_name):
     return PythonFunctionBase
 
 
+def _check_worker_pool_args(device, batch_processing):
+    if device != "cpu" or batch_processing:
+        raise ValueError(
+            "Python function workers can be used only by CPU operators with "
+            "``batch_processing=False``."
+        )
+
+
+def _identity(x):
+    # module-level, so that it can be pickled when the workers are spawned
+    return x
+
+
 def _dlpack_to_array(dlpack):
     return nvidia.dali.python_function_plugin.DLTensorToArray(dlpack)
 
@@ -201,11 +228,28 @@ class PythonFunction(_get_base_impl("PythonFunction", "DLTensorPythonFunctionImp
                 *dlpack_inputs,
             )
 
-    def __init__(self, function, num_outputs=1, device="cpu", batch_processing=False, **kwargs):
+    def __init__(
+        self, function, num_outputs=1, device="cpu", batch_processing=False, num_workers=0, **kwargs
+    ):
         if device == "gpu":
             _setup_cupy()
 
-        if device == "cpu":
+        pool = None
+        if num_workers:
+            _check_worker_pool_args(device, batch_processing)
+            pool = _FunctionWorkerPool(
+                function,
+                num_outputs,
+                num_workers,
+                _identity,
+                _identity,
+                PythonFunction.check_outputs,
+            )
+
+            def func(batch):
+                return pool.run(batch)
+
+        elif device == "cpu":
 
             def func(*ts):
                 return self._function_wrapper_cpu(batch_processing, function, num_outputs, *ts)
@@ -221,8 +265,11 @@ class PythonFunction(_get_base_impl("PythonFunction", "DLTensorPythonFunctionImp
             device=device,
             synchronize_stream=False,
             batch_processing=batch_processing,
+            num_workers=num_workers,
             **kwargs,
         )
+        if pool is not None:
+            self._set_worker_pool(pool)
 
 
 class DLTensorPythonFunction(
@@ -234,11 +281,11 @@ class DLTensorPythonFunction(
     def _function_wrapper_dlpack(self, batch_processing, function, num_outputs, *dlpack_inputs):
         if batch_processing:
             return PythonFunction.function_wrapper_batch(
-                self.pipeline, function, num_outputs, lambda x: x, lambda x: x, *dlpack_inputs
+                self.pipeline, function, num_outputs, _identity, _identity, *dlpack_inputs
             )
         else:
             return PythonFunction.function_wrapper_per_sample(
-                self.pipeline, function, num_outputs, lambda x: x, lambda x: x, *dlpack_inputs
+                self.pipeline, function, num_outputs, _identity, _identity, *dlpack_inputs
             )
 
     def __init__(
@@ -248,10 +295,28 @@ class DLTensorPythonFunction(
         device="cpu",
         synchronize_stream=True,
         batch_processing=True,
+        num_workers=0,
         **kwargs,
     ):
-        def func(*ts):
-            return self._function_wrapper_dlpack(batch_processing, function, num_outputs, *ts)
+        pool = None
+        if num_workers:
+            _check_worker_pool_args(device, batch_processing)
+            pool = _FunctionWorkerPool(
+                function,
+                num_outputs,
+                num_workers,
+                _dlpack_from_array,
+                _dlpack_to_array,
+                PythonFunction.check_outputs,
+            )
+
+            def func(batch):
+                return pool.run(batch)
+
+        else:
+
+            def func(*ts):
+                return self._function_wrapper_dlpack(batch_processing, function, num_outputs, *ts)
 
         super().__init__(
             function=func,
@@ -259,5 +324,8 @@ class DLTensorPythonFunction(
             device=device,
             synchronize_stream=synchronize_stream,
             batch_processing=batch_processing,
+            num_workers=num_workers,
             **kwargs,
         )
+        if pool is not None:
+            self._set_worker_pool(pool)
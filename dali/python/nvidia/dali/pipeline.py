@@ -159,6 +159,16 @@ class Pipeline(object):
     concurrency : OperatorConcurrency, optional, default = None
         Operator concurrency policy (only for dynamic executor).
         If not specified, the default value is ``OperatorConcurrency.BACKEND``.
+    numa_node : int, optional, default = None
+        The NUMA node on which the pipeline runs.
+        The pipeline's threads are pinned to the CPUs of this node and the large host buffers
+        they allocate are placed on this node (see ``DALI_USE_NUMA_HOST_MEM``).
+        Useful when several pipelines run on one multi-socket host.
+        Cannot be used together with `cpu_affinity` or `set_affinity`.
+    cpu_affinity : list of int, optional, default = None
+        The CPUs to which the pipeline's threads are pinned.
+        The large host buffers are allocated on the NUMA node of the CPU on which a thread runs.
+        Cannot be used together with `numa_node` or `set_affinity`.
     bytes_per_sample : int, optional, default = 0
         A hint for DALI for how much memory to use for its tensors.
     set_affinity : bool, optional, default = False
@@ -184,6 +194,8 @@ class Pipeline(object):
         Serialized checkpoint, received from `checkpoint` method.
         When pipeline is built, its state is restored from the `checkpoint` and the pipeline
         resumes execution from the saved iteration.
+        A list of checkpoints can be passed to restore from a full checkpoint followed by
+        the incremental ones (see `checkpoint` method).
 
         More details can be found in
         `this documentation section <advanced_topics_checkpointing.html>`_.
@@ -287,6 +299,8 @@ class Pipeline(object):
         experimental_exec_dynamic=None,
         stream_policy=None,
         concurrency=None,
+        numa_node=None,
+        cpu_affinity=None,
     ):
         if experimental_exec_dynamic is not None:
             _show_deprecation_warning("experimental_exec_dynamic", "exec_dynamic")
@@ -333,6 +347,8 @@ class Pipeline(object):
         self._set_affinity = set_affinity
         self._stream_policy = stream_policy
         self._concurrency = concurrency
+        self._numa_node = numa_node
+        self._cpu_affinity = list(cpu_affinity) if cpu_affinity is not None else None
         self._py_num_workers = py_num_workers
         self._py_start_method = py_start_method
         if py_callback_pickler is not None and py_start_method == "fork":
@@ -522,6 +538,16 @@ class Pipeline(object):
         """Operator concurrency for the pipeline."""
         return self._concurrency
 
+    @property
+    def numa_node(self):
+        """The NUMA node on which the pipeline runs."""
+        return self._numa_node
+
+    @property
+    def cpu_affinity(self):
+        """The CPUs to which the pipeline's threads are pinned."""
+        return self._cpu_affinity
+
     @property
     def set_affinity(self):
         """If True, worker threads are bound to CPU cores."""
@@ -978,6 +1004,11 @@ class Pipeline(object):
             self._pipe.SetPyObjDependency(self._py_pool)
 
     def _start_py_workers(self):
+        for op in self._ops:
+            # python_function operators running the function in worker processes
+            start_op_workers = getattr(op._op, "_start_py_workers", None)
+            if start_op_workers is not None:
+                start_op_workers(self._py_start_method)
         if not self._parallel_input_callbacks:
             return
         self._py_pool = WorkerPool.from_groups(
@@ -1004,6 +1035,8 @@ class Pipeline(object):
             enable_checkpointing=self._enable_checkpointing,
             enable_memory_stats=self._enable_memory_stats,
             bytes_per_sample_hint=self._bytes_per_sample,
+            numa_node=self._numa_node,
+            cpu_affinity=self._cpu_affinity,
         )
 
     def _set_params(self, params):
@@ -1018,6 +1051,8 @@ class Pipeline(object):
         self._enable_checkpointing = params.enable_checkpointing
         self._enable_memory_stats = params.enable_memory_stats
         self._bytes_per_sample = params.bytes_per_sample_hint
+        self._numa_node = params.numa_node
+        self._cpu_affinity = params.cpu_affinity
         # reconsitute legacy flags
         self._exec_async = bool(params.executor_type & b._ExecutorType.AsyncFlag)
         self._exec_pipelined = bool(params.executor_type & b._ExecutorType.PipelinedFlag)
@@ -1806,6 +1841,8 @@ class Pipeline(object):
             enable_checkpointing=kw.get("enable_checkpointing", None),
             enable_memory_stats=kw.get("enable_memory_stats", None),
             bytes_per_sample_hint=kw.get("bytes_per_sample", None),
+            numa_node=kw.get("numa_node", None),
+            cpu_affinity=kw.get("cpu_affinity", None),
         )
         pipeline._pipe = b.Pipeline(serialized_pipeline, params)
         if pipeline._pipe.requires_gpu():
@@ -1870,7 +1907,7 @@ class Pipeline(object):
 
         self._pipe.SaveGraphToDotFile(filename, show_tensors, use_colors)
 
-    def _get_checkpoint(self, iterator_data=""):
+    def _get_checkpoint(self, iterator_data="", incremental=False):
         """
         Returns the pipeline's state as a serialized Protobuf string.
         Also, allows to pass additional data to be saved in the checkpoint.
@@ -1881,9 +1918,9 @@ class Pipeline(object):
             {"iter": self._consumer_iter, "epoch_idx": self._epoch_idx}
         )
         external_ctx_cpt.iterator_data = iterator_data
-        return self._pipe.GetSerializedCheckpoint(external_ctx_cpt)
+        return self._pipe.GetSerializedCheckpoint(external_ctx_cpt, incremental)
 
-    def checkpoint(self, filename=None):
+    def checkpoint(self, filename=None, incremental=False):
         """Returns the pipeline's state as a serialized Protobuf string.
 
         Additionally, if `filename` is specified, the serialized checkpoint will be
@@ -1899,9 +1936,13 @@ class Pipeline(object):
         ----------
         filename : str
                 The file that the serialized pipeline will be written to.
+        incremental : bool, optional, default = False
+                If True, only the state of the operators which changed since the previous
+                checkpoint is saved. To restore such a checkpoint, pass the list of checkpoints
+                starting with the last full one.
         """
         self.build()
-        cpt = self._get_checkpoint()
+        cpt = self._get_checkpoint(incremental=incremental)
         if filename is not None:
             with open(filename, "wb") as checkpoint_file:
                 checkpoint_file.write(cpt)
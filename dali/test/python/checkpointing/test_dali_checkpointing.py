@@ -1,4 +1,4 @@
-# Copyright (c) 2023-2024, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+# Copyright (c) 2023-2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
 #
 # Licensed under the Apache License, Version 2.0 (the "License");
 # you may not use this file except in compliance with the License.
@@ -39,6 +39,7 @@ from reader.test_numpy import is_gds_supported
 
 reader_signed_off = create_sign_off_decorator()
 random_signed_off = create_sign_off_decorator()
+stateful_signed_off = create_sign_off_decorator()
 
 data_root = get_dali_extra_path()
 images_dir = os.path.join(data_root, "db", "single", "jpeg")
@@ -848,6 +849,17 @@ def test_experimental_video_reader(
     )
 
 
+# Stateful operators section
+
+
+@params(-1, 3)
+@stateful_signed_off("dataset_statistics")
+def test_dataset_statistics(num_iterations):
+    check_single_input_operator(
+        fn.dataset_statistics, "cpu", axis_names="HW", num_iterations=num_iterations
+    )
+
+
 # Randomized operators section
 # note: fn.decoders.image_random_crop is tested by
 # `check_single_input_operator`
@@ -1203,10 +1215,39 @@ unsupported_readers = [
 unsupported_ops = [
     "experimental.decoders.video",
     "experimental.inputs.video",
+    "experimental.inputs.shared_memory_ring",
     "plugin.video.decoder",
 ]
 
 
+@params(None, (100000,))
+def test_incremental_checkpoints(shape):
+    @pipeline_def
+    def pipeline():
+        data, label = fn.readers.file(
+            name="Reader", file_root=images_dir, pad_last_batch=True, random_shuffle=True
+        )
+        flip = fn.random.coin_flip()
+        noise = fn.random.uniform(shape=shape)
+        const = fn.constant(idata=[1, 2, 3])
+        return label, flip, noise, const
+
+    pipe = pipeline(**pipeline_args)
+    iterations_in_epoch = calculate_iterations_in_epoch(pipe, pipeline_args["batch_size"])
+    checkpoints = []
+    for i in range(3):
+        for _ in range(iterations_in_epoch):
+            pipe.run()
+        checkpoints.append(pipe.checkpoint(incremental=i > 0))
+    assert len(checkpoints[1]) < len(checkpoints[0])
+
+    restored = pipeline(**pipeline_args, checkpoint=checkpoints)
+    compare_pipelines(pipe, restored, pipeline_args["batch_size"], comparsion_iterations)
+
+    with assert_raises(RuntimeError, glob="needs to be restored first"):
+        pipeline(**pipeline_args, checkpoint=checkpoints[1:]).build()
+
+
 def test_coverage():
     from checkpointing.test_dali_stateless_operators import stateless_signed_off
 
@@ -1214,6 +1255,7 @@ def test_coverage():
         stateless_signed_off.tested_ops
         | reader_signed_off.tested_ops
         | random_signed_off.tested_ops
+        | stateful_signed_off.tested_ops
     )
 
     excluded_ops = unsupported_readers + unsupported_ops
@@ -601,6 +601,13 @@ def test_spectrogram_stateless(device):
     check_single_1d_input(fn.spectrogram, device)
 
 
+@stateless_signed_off("mel_spectrogram")
+def test_mel_spectrogram_stateless():
+    check_single_1d_input(
+        fn.mel_spectrogram, "cpu", nfft=60, window_length=50, window_step=25, nfilter=16
+    )
+
+
 @stateless_signed_off("power_spectrum")
 def test_power_spectrum_stateless():
     check_single_signal_input(fn.power_spectrum, "cpu")
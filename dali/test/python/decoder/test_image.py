@@ -1,4 +1,4 @@
-# Copyright (c) 2019-2024, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+# Copyright (c) 2019-2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
 #
 # Licensed under the Apache License, Version 2.0 (the "License");
 # you may not use this file except in compliance with the License.
@@ -512,3 +512,60 @@ def test_tiff_palette():
 
     delta = np.abs(imgs.at(0).astype("float") - imgs.at(1).astype("float")) / 256
     assert np.quantile(delta, 0.9) < 0.05, "Original and palette TIFF differ significantly"
+
+
+decode_size_hint_cases = [
+    (random_crop, size)
+    for random_crop in (False, True)
+    for size in ((64, 64), (100, 80), (150,))
+]
+
+
+@params(*decode_size_hint_cases)
+def test_decode_size_hint(random_crop, size):
+    data_path = os.path.join(test_data_root, good_path, "jpeg")
+    resize_h, resize_w = size if len(size) == 2 else size * 2
+
+    @pipeline_def(batch_size=8, device_id=0, num_threads=4, seed=1234)
+    def pipe():
+        encoded, _ = fn.readers.file(file_root=data_path)
+        shape = fn.peek_image_shape(encoded)
+        if random_crop:
+            decode_args = dict(random_area=[0.3, 1.0], seed=4321)
+            full = fn.decoders.image_random_crop(encoded, device="cpu", **decode_args)
+            hinted = fn.decoders.image_random_crop(
+                encoded, device="cpu", decode_size_hint=size, **decode_args
+            )
+        else:
+            full = fn.decoders.image(encoded, device="cpu")
+            hinted = fn.decoders.image(encoded, device="cpu", decode_size_hint=size)
+        full_resized = fn.resize(full, size=[resize_h, resize_w])
+        hinted_resized = fn.resize(hinted, size=[resize_h, resize_w])
+        return shape, full, hinted, full_resized, hinted_resized
+
+    p = pipe()
+    for _ in range(3):
+        shapes, full, hinted, full_resized, hinted_resized = tuple(to_array(o) for o in p.run())
+        for i in range(len(shapes)):
+            shape = shapes[i]
+            full_shape, hinted_shape = full[i].shape, hinted[i].shape
+            # never smaller than the hint, never larger than the full decode
+            assert hinted_shape[0] >= min(resize_h, full_shape[0]), (hinted_shape, size)
+            assert hinted_shape[1] >= min(resize_w, full_shape[1]), (hinted_shape, size)
+            assert hinted_shape[0] <= full_shape[0] and hinted_shape[1] <= full_shape[1]
+            if not random_crop and shape[0] >= 2 * resize_h and shape[1] >= 2 * resize_w:
+                assert hinted_shape[0] < full_shape[0], (hinted_shape, full_shape)
+            delta = np.abs(full_resized[i].astype("float") - hinted_resized[i].astype("float"))
+            assert np.mean(delta) < 4, f"Mean difference too big: {np.mean(delta)}"
+            assert np.quantile(delta, 0.9) < 12, "The resized images differ significantly"
+
+
+def test_decode_size_hint_too_many_values():
+    @pipeline_def(batch_size=1, device_id=0, num_threads=1)
+    def pipe():
+        encoded, _ = fn.readers.file(file_root=os.path.join(test_data_root, good_path, "jpeg"))
+        return fn.decoders.image(encoded, device="cpu", decode_size_hint=[1, 2, 3])
+
+    with assert_raises(RuntimeError, glob="*`decode_size_hint` must have at most 2 elements*"):
+        p = pipe()
+        p.build()
@@ -0,0 +1,102 @@
+# Copyright (c) 2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+import os
+import threading
+import numpy as np
+import nvidia.dali.fn as fn
+import nvidia.dali.types as types
+from nose_utils import assert_raises
+from nvidia.dali import pipeline_def
+from nvidia.dali.backend import ShmRingProducer
+
+max_batch_size = 4
+
+
+def ring_name(suffix):
+    return f"/dali_test_shm_ring_{os.getpid()}_{suffix}"
+
+
+def make_batch(iteration):
+    batch_size = 1 + iteration % max_batch_size
+    return [
+        np.full((1 + (iteration + i) % 3, 5), iteration * 100 + i, dtype=np.int32)
+        for i in range(batch_size)
+    ]
+
+
+@pipeline_def(batch_size=max_batch_size, num_threads=1, device_id=None)
+def ring_pipeline(name, dtype=types.INT32):
+    return fn.experimental.inputs.shared_memory_ring(ring_name=name, dtype=dtype, layout="HW")
+
+
+def check_batch(out, iteration):
+    ref = make_batch(iteration)
+    assert len(out) == len(ref), f"Expected {len(ref)} samples, got {len(out)}"
+    assert out.layout() == "HW"
+    for i, ref_sample in enumerate(ref):
+        np.testing.assert_array_equal(out.at(i), ref_sample)
+
+
+def test_read_batches():
+    num_batches = 10
+    # the pipeline keeps up to prefetch_queue_depth batches - the ring must have more slots
+    producer = ShmRingProducer(ring_name("read"), num_slots=6, slot_size=1 << 16)
+
+    def produce():
+        for i in range(num_batches):
+            assert producer.push(make_batch(i), "HW")
+        producer.close()
+
+    producer_thread = threading.Thread(target=produce)
+    producer_thread.start()
+    try:
+        pipe = ring_pipeline(producer.name)
+        for i in range(num_batches):
+            (out,) = pipe.run()
+            check_batch(out, i)
+        with assert_raises(StopIteration):
+            pipe.run()
+    finally:
+        producer_thread.join()
+
+
+def test_stop_iteration_when_closed():
+    num_batches = 2
+    producer = ShmRingProducer(ring_name("closed"), num_slots=num_batches, slot_size=4096)
+    for i in range(num_batches):
+        assert producer.push(make_batch(i), "HW")
+    producer.close()
+
+    pipe = ring_pipeline(producer.name)
+    for i in range(num_batches):
+        (out,) = pipe.run()
+        check_batch(out, i)
+    with assert_raises(StopIteration):
+        pipe.run()
+
+
+def test_push_timeout():
+    producer = ShmRingProducer(ring_name("full"), num_slots=1, slot_size=4096)
+    assert producer.push(make_batch(0), "HW", timeout=0)
+    assert producer.free_slots == 0
+    assert not producer.push(make_batch(1), "HW", timeout=0.01)
+
+
+def test_type_mismatch():
+    producer = ShmRingProducer(ring_name("type"), num_slots=2, slot_size=4096)
+    producer.push([np.zeros((2, 2), dtype=np.float32)], "HW")
+    pipe = ring_pipeline(producer.name)
+    with assert_raises(RuntimeError, glob="*contains data of type*expected*"):
+        pipe.run()
@@ -1219,3 +1219,43 @@ def test_empty_batch(device):
     p = empty_input_pipe()
     (o,) = p.run()
     assert tuple(o[0].shape()) == (0, 3)
+
+
+def test_cpu_expression_folding():
+    batch_size = 4
+    rng = np.random.default_rng(42)
+    data = [rng.uniform(-2, 2, size=(10, 20, 3)).astype(np.float32) for _ in range(batch_size)]
+    mean, std, a, b = 0.25, 1.5, 0.75, 0.5
+
+    @pipeline_def(device_id=None, batch_size=batch_size, num_threads=4)
+    def folded_pipe():
+        x = fn.external_source(source=lambda: data, batch=True, layout="HWC")
+        y = (x - mean) / std
+        out = math.clamp(y * a + b, 0, 1)
+        # the whole expression is evaluated by one operator
+        assert len(out.source.inputs) == 1 and out.source.inputs[0] is x
+        # a subexpression which is also an output of the pipeline is still available
+        return out, y, x * x
+
+    p = folded_pipe()
+    out, y, square = p.run()
+    for i in range(batch_size):
+        ref_y = (data[i] - np.float32(mean)) / np.float32(std)
+        ref = np.clip(ref_y * np.float32(a) + np.float32(b), 0, 1)
+        np.testing.assert_allclose(np.array(y[i]), ref_y, rtol=1e-6)
+        np.testing.assert_allclose(np.array(out[i]), ref, rtol=1e-6, atol=1e-6)
+        np.testing.assert_array_equal(np.array(square[i]), data[i] * data[i])
+    assert out.layout() == "HWC"
+
+
+def test_cpu_expression_folding_limit():
+    @pipeline_def(device_id=None, batch_size=1, num_threads=4)
+    def long_chain_pipe():
+        x = types.Constant(np.int32([1, 2, 3]))
+        for _ in range(100):
+            x = x + 1
+        return x
+
+    p = long_chain_pipe()
+    (out,) = p.run()
+    np.testing.assert_array_equal(np.array(out[0]), np.int32([101, 102, 103]))
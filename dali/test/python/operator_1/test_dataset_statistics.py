@@ -0,0 +1,130 @@
+# Copyright (c) 2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+import numpy as np
+from nvidia.dali import fn, pipeline_def
+from nose2.tools import params
+from nose_utils import assert_raises
+
+batch_size = 7
+num_iters = 5
+
+
+def make_batches(dtype, seed, channels=3):
+    rng = np.random.default_rng(seed)
+    batches = []
+    for _ in range(num_iters):
+        batch = []
+        for _ in range(batch_size):
+            shape = (rng.integers(10, 40), rng.integers(10, 40), channels)
+            if np.issubdtype(dtype, np.integer):
+                batch.append(rng.integers(0, 100, size=shape).astype(dtype))
+            else:
+                batch.append((rng.standard_normal(shape) * 10 + 50).astype(dtype))
+        batches.append(batch)
+    return batches
+
+
+def ref_stats(batches, ddof):
+    # per-channel statistics of all the pixels seen so far
+    data = np.concatenate([x.reshape(-1, x.shape[-1]) for b in batches for x in b])
+    data = data.astype(np.float64)
+    return data.mean(axis=0), data.std(axis=0, ddof=ddof)
+
+
+@pipeline_def(batch_size=batch_size, num_threads=3, device_id=None)
+def stats_pipe(batches, **kwargs):
+    data = fn.external_source(source=batches, cycle=False, layout="HWC")
+    mean, stddev = fn.dataset_statistics(data, axis_names="HW", **kwargs)
+    return data, mean, stddev, fn.normalize(data, mean=mean, stddev=stddev)
+
+
+@params(
+    (np.uint8, 0),
+    (np.int16, 1),
+    (np.float32, 0),
+    (np.uint16, 1),
+)
+def test_accumulation(dtype, ddof):
+    batches = make_batches(dtype, 1234)
+    pipe = stats_pipe(batches, ddof=ddof)
+    pipe.build()
+    for i in range(num_iters):
+        data, mean, stddev, normalized = pipe.run()
+        ref_mean, ref_stddev = ref_stats(batches[: i + 1], ddof)
+        for s in range(batch_size):
+            m = np.array(mean[s])
+            sd = np.array(stddev[s])
+            assert m.shape == (1, 1, 3) and sd.shape == (1, 1, 3)
+            assert mean.layout() == "HWC"
+            np.testing.assert_allclose(m.ravel(), ref_mean, rtol=1e-6)
+            np.testing.assert_allclose(sd.ravel(), ref_stddev, rtol=1e-5)
+            ref_normalized = (np.array(data[s]).astype(np.float32) - m) / sd
+            np.testing.assert_allclose(
+                np.array(normalized[s]), ref_normalized, rtol=1e-5, atol=1e-5
+            )
+
+
+def test_num_iterations():
+    batches = make_batches(np.uint8, 4321)
+    pipe = stats_pipe(batches, num_iterations=2)
+    pipe.build()
+    ref_mean, ref_stddev = ref_stats(batches[:2], 0)
+    for i in range(num_iters):
+        _, mean, stddev, _ = pipe.run()
+        if i < 1:
+            continue
+        # the statistics are frozen after 2 iterations
+        np.testing.assert_allclose(np.array(mean[0]).ravel(), ref_mean, rtol=1e-6)
+        np.testing.assert_allclose(np.array(stddev[0]).ravel(), ref_stddev, rtol=1e-5)
+
+
+def test_deterministic():
+    # the result doesn't depend on the number of threads
+    batches = make_batches(np.float32, 42)
+    results = []
+    for num_threads in [1, 4]:
+        pipe = stats_pipe(batches, num_threads=num_threads)
+        pipe.build()
+        for _ in range(num_iters):
+            _, mean, stddev, _ = pipe.run()
+        results.append((np.array(mean[0]), np.array(stddev[0])))
+    np.testing.assert_array_equal(results[0][0], results[1][0])
+    np.testing.assert_array_equal(results[0][1], results[1][1])
+
+
+def test_all_axes():
+    batches = make_batches(np.uint8, 5)
+
+    @pipeline_def(batch_size=batch_size, num_threads=3, device_id=None)
+    def pipe():
+        data = fn.external_source(source=batches, cycle=False, layout="HWC")
+        return fn.dataset_statistics(data)
+
+    p = pipe()
+    p.build()
+    mean, stddev = p.run()
+    data = np.concatenate([x.ravel() for x in batches[0]]).astype(np.float64)
+    assert np.array(mean[0]).shape == (1, 1, 1)
+    np.testing.assert_allclose(np.array(mean[0]).ravel(), [data.mean()], rtol=1e-6)
+    np.testing.assert_allclose(np.array(stddev[0]).ravel(), [data.std()], rtol=1e-5)
+
+
+def test_shape_mismatch():
+    batches = [make_batches(np.uint8, 1, channels=3)[0], make_batches(np.uint8, 2, channels=4)[0]]
+    pipe = stats_pipe(batches)
+    pipe.build()
+    pipe.run()
+    with assert_raises(RuntimeError, glob="*non-reduced dimensions must be the same*"):
+        pipe.run()
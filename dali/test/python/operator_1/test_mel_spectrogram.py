@@ -0,0 +1,78 @@
+# Copyright (c) 2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+import numpy as np
+from nvidia.dali import fn, pipeline_def
+
+from test_utils import check_batch
+
+
+def random_audio(batch_size):
+    rng = np.random.default_rng(1234)
+
+    def gen():
+        lengths = rng.integers(1000, 20000, size=batch_size)
+        return [
+            (np.sin(np.arange(n) * 0.05) + 0.1 * rng.standard_normal(n)).astype(np.float32)
+            for n in lengths
+        ]
+
+    return gen
+
+
+@pipeline_def
+def separate_vs_fused_pipe(layout, n_mfcc, reference, lifter, normalize):
+    audio = fn.external_source(source=random_audio(8), batch=True)
+    spectrogram_args = dict(nfft=512, window_length=400, window_step=160)
+    mel_args = dict(sample_rate=16000, nfilter=64)
+    db_args = dict(cutoff_db=-100)
+    if reference is not None:
+        db_args["reference"] = reference
+    spec = fn.spectrogram(audio, layout=layout, **spectrogram_args)
+    mel = fn.mel_filter_bank(spec, **mel_args)
+    separate = fn.to_decibels(mel, **db_args)
+    if n_mfcc > 0:
+        axis = 0 if layout == "ft" else 1
+        separate = fn.mfcc(separate, n_mfcc=n_mfcc, axis=axis, lifter=lifter, normalize=normalize)
+    fused = fn.mel_spectrogram(
+        audio,
+        layout=layout,
+        n_mfcc=n_mfcc,
+        lifter=lifter,
+        dct_normalize=normalize,
+        **spectrogram_args,
+        **mel_args,
+        **db_args,
+    )
+    return separate, fused
+
+
+def _test_separate_vs_fused(layout, n_mfcc, reference, lifter=0.0, normalize=False):
+    pipe = separate_vs_fused_pipe(
+        layout, n_mfcc, reference, lifter, normalize, batch_size=8, num_threads=3, device_id=None
+    )
+    for _ in range(2):
+        separate, fused = pipe.run()
+        check_batch(fused, separate, eps=1e-3, max_allowed_error=1e-2, expected_layout=layout)
+
+
+def test_separate_vs_fused():
+    for layout in ("ft", "tf"):
+        for reference in (None, 1.0):
+            yield _test_separate_vs_fused, layout, 0, reference
+            yield _test_separate_vs_fused, layout, 20, reference, 22.0
+
+
+def test_mfcc_normalized():
+    yield _test_separate_vs_fused, "ft", 13, None, 0.0, True
@@ -1,4 +1,4 @@
-# Copyright (c) 2019-2024, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+# Copyright (c) 2019-2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
 #
 # Licensed under the Apache License, Version 2.0 (the "License");
 # you may not use this file except in compliance with the License.
@@ -28,7 +28,7 @@ from PIL import Image, ImageEnhance
 from nvidia.dali.ops import _DataNode
 from nose2.tools import params
 import numpy as np
-from nose_utils import raises
+from nose_utils import assert_raises, raises
 from test_utils import get_dali_extra_path, np_type_to_dali
 
 test_data_root = get_dali_extra_path()
@@ -681,3 +681,117 @@ def test_delete_pipe_while_function_running():
             pipe.set_outputs(fn.python_function(types.Constant(0), function=func))
             pipe.run()
         del pipe
+
+
+def split_and_shift(x):
+    return x[:, :, 0] + 1, numpy.ascontiguousarray(x[::2, ::2, :])
+
+
+def dl_split_and_shift(x):
+    outs = split_and_shift(ops._dlpack_to_array(x))
+    return tuple(ops._dlpack_from_array(o) for o in outs)
+
+
+@params(
+    (fn.python_function, split_and_shift, 0),
+    (fn.python_function, split_and_shift, 3),
+    (fn.dl_tensor_python_function, dl_split_and_shift, 2),
+)
+def test_python_function_workers(op, function, num_workers):
+    batch_size = 7
+
+    @pipeline_def(batch_size=batch_size, num_threads=2, device_id=None, seed=SEED)
+    def workers_pipe():
+        jpegs, _ = fn.readers.file(file_root=images_dir)
+        images = fn.decoders.image(jpegs, device="cpu")
+        reference = fn.python_function(images, function=split_and_shift, num_outputs=2)
+        kwargs = {"batch_processing": False} if op is fn.dl_tensor_python_function else {}
+        outs = op(images, function=function, num_outputs=2, num_workers=num_workers, **kwargs)
+        return (*outs, *reference)
+
+    pipe = workers_pipe()
+    for _ in range(3):
+        out0, out1, ref0, ref1 = pipe.run()
+        for i in range(batch_size):
+            np.testing.assert_array_equal(out0.at(i), ref0.at(i))
+            np.testing.assert_array_equal(out1.at(i), ref1.at(i))
+
+
+def test_python_function_workers_spawn():
+    batch_size = 5
+
+    @pipeline_def(
+        batch_size=batch_size, num_threads=2, device_id=None, seed=SEED, py_start_method="spawn"
+    )
+    def spawn_pipe():
+        jpegs, _ = fn.readers.file(file_root=images_dir)
+        images = fn.decoders.image(jpegs, device="cpu")
+        reference = fn.python_function(images, function=split_and_shift, num_outputs=2)
+        outs = fn.python_function(images, function=split_and_shift, num_outputs=2, num_workers=2)
+        return (*outs, *reference)
+
+    pipe = spawn_pipe()
+    out0, out1, ref0, ref1 = pipe.run()
+    for i in range(batch_size):
+        np.testing.assert_array_equal(out0.at(i), ref0.at(i))
+        np.testing.assert_array_equal(out1.at(i), ref1.at(i))
+
+
+def exit_in_worker(x):
+    os._exit(1)
+
+
+def test_python_function_workers_exit():
+    from nvidia.dali._multiproc.function_pool import FunctionWorkerPool
+
+    pool = FunctionWorkerPool(exit_in_worker, 1, 2, lambda x: x, lambda x: x, lambda *_: None)
+    batch = [[ops._dlpack_from_array(np.full((2,), i, np.int32))] for i in range(4)]
+    # the workers are not started implicitly, from the executor's thread
+    with assert_raises(RuntimeError, glob="*worker processes*are not running*"):
+        pool.run(batch)
+    pool.start()
+    with assert_raises(RuntimeError, glob="*exited unexpectedly*"):
+        pool.run(batch)
+    # the pool is closed, so the replies of the other workers can't be taken for the next batch
+    assert not pool.started
+    with assert_raises(RuntimeError, glob="*worker processes*are not running*"):
+        pool.run(batch)
+
+
+def test_python_function_workers_no_inputs():
+    batch_size = 5
+
+    @pipeline_def(batch_size=batch_size, num_threads=1, device_id=None)
+    def no_inputs_pipe():
+        return fn.python_function(function=lambda: np.full((2, 3), 42, np.int32), num_workers=2)
+
+    pipe = no_inputs_pipe()
+    (out,) = pipe.run()
+    for i in range(batch_size):
+        np.testing.assert_array_equal(out.at(i), np.full((2, 3), 42, np.int32))
+
+
+def raise_in_worker(x):
+    raise ValueError("Error raised in the worker")
+
+
+@raises(Exception, glob="*Error raised in the worker*")
+def test_python_function_workers_error():
+    @pipeline_def(batch_size=4, num_threads=1, device_id=None)
+    def error_pipe():
+        return fn.python_function(types.Constant(0), function=raise_in_worker, num_workers=2)
+
+    pipe = error_pipe()
+    pipe.run()
+
+
+@raises(ValueError, glob="*only by CPU operators with ``batch_processing=False``*")
+def test_python_function_workers_batch_processing():
+    @pipeline_def(batch_size=4, num_threads=1, device_id=None)
+    def batch_pipe():
+        return fn.python_function(
+            types.Constant(0), function=lambda x: x, batch_processing=True, num_workers=2
+        )
+
+    pipe = batch_pipe()
+    pipe.build()
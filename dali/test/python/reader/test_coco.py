@@ -1,4 +1,4 @@
-# Copyright (c) 2020-2024, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+# Copyright (c) 2020-2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
 #
 # Licensed under the Apache License, Version 2.0 (the "License");
 # you may not use this file except in compliance with the License.
@@ -82,10 +82,22 @@ def check_operator_coco_reader_custom_order(order=None, add_invalid_paths=False)
                 assert out[0].at(s) == expected_ids[i], f"{i}, {expected_ids}"
                 i = i + 1
 
-        filenames_file = os.path.join(annotations_dir, "filenames.dat")
-        with open(filenames_file) as f:
-            lines = f.read().splitlines()
-        assert lines.sort() == images.sort()
+        # read back the preprocessed annotations
+        pipeline = Pipeline(batch_size=batch_size, num_threads=4, device_id=0)
+        with pipeline:
+            _, _, _, ids = fn.readers.coco(
+                file_root=file_root,
+                image_ids=True,
+                preprocessed_annotations=annotations_dir,
+            )
+            pipeline.set_outputs(ids)
+
+        i = 0
+        while i < len(images):
+            out = pipeline.run()
+            for s in range(batch_size):
+                assert out[0].at(s) == expected_ids[i], f"{i}, {expected_ids}"
+                i = i + 1
 
 
 def test_operator_coco_reader_custom_order():
@@ -24,6 +24,7 @@ import os
 import re
 from collections.abc import Iterable
 from nose_utils import attr, nottest, assert_raises
+from nvidia.dali.backend import ShmRingProducer
 from nvidia.dali.pipeline import Pipeline, pipeline_def
 from nvidia.dali.pipeline.experimental import pipeline_def as experimental_pipeline_def
 from nvidia.dali.plugin.numba.fn.experimental import numba_function
@@ -567,6 +568,18 @@ def test_mfcc_cpu():
         pipe.run()
 
 
+def test_mel_spectrogram_cpu():
+    check_single_input(
+        fn.mel_spectrogram,
+        get_data=get_audio_data,
+        input_layout=None,
+        nfft=60,
+        window_length=50,
+        window_step=25,
+        nfilter=16,
+    )
+
+
 def test_fast_resize_crop_mirror_cpu():
     check_single_input(fn.fast_resize_crop_mirror, crop=[5, 5], resize_shorter=10)
 
@@ -649,6 +662,10 @@ def test_normalize_cpu():
     check_single_input(fn.normalize, batch=True)
 
 
+def test_dataset_statistics_cpu():
+    check_single_input(fn.dataset_statistics, axis_names="HW")
+
+
 def test_lookup_table_cpu():
     test_data_shape = [100]
 
@@ -1310,6 +1327,22 @@ def test_video_input():
         p.run()
 
 
+def test_shared_memory_ring_input():
+    producer = ShmRingProducer(f"/dali_test_cpu_only_ring_{os.getpid()}", 4, 1 << 16)
+
+    @pipeline_def(batch_size=batch_size, num_threads=3, device_id=None)
+    def pipe():
+        return fn.experimental.inputs.shared_memory_ring(ring_name=producer.name)
+
+    n_iterations = 3
+    for _ in range(n_iterations):
+        producer.push([np.random.rand(*test_data_shape).astype(np.float32)] * batch_size)
+    producer.close()
+    p = pipe()
+    for _ in range(n_iterations):
+        p.run()
+
+
 def test_conditional():
     @experimental_pipeline_def(enable_conditionals=True)
     def conditional_pipeline():
@@ -1426,6 +1459,7 @@ tested_methods = [
     "experimental.decoders.image_slice",
     "experimental.decoders.image_random_crop",
     "experimental.inputs.video",
+    "experimental.inputs.shared_memory_ring",
     "decoders.audio",
     "external_source",
     "stack",
@@ -1515,6 +1549,7 @@ tested_methods = [
     "bb_flip",
     "warp_affine",
     "normalize",
+    "dataset_statistics",
     "pad",
     "preemphasis_filter",
     "power_spectrum",
@@ -1533,6 +1568,7 @@ tested_methods = [
     "segmentation.random_mask_pixel",
     "transpose",
     "mfcc",
+    "mel_spectrogram",
     "lookup_table",
     "element_extract",
     "arithmetic_generic_op",
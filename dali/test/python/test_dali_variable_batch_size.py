@@ -1,4 +1,4 @@
-# Copyright (c) 2020-2024, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+# Copyright (c) 2020-2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
 #
 # Licensed under the Apache License, Version 2.0 (the "License");
 # you may not use this file except in compliance with the License.
@@ -414,6 +414,10 @@ float_array_ops = [
     (fn.power_spectrum, {"devices": ["cpu"]}),
     (fn.preemphasis_filter, {}),
     (fn.spectrogram, {"nfft": 60, "window_length": 50, "window_step": 25}),
+    (
+        fn.mel_spectrogram,
+        {"devices": ["cpu"], "nfft": 60, "window_length": 50, "window_step": 25, "nfilter": 16},
+    ),
     (fn.to_decibels, {}),
     (fn.audio_resample, {"devices": ["cpu"], "scale": 1.2}),
 ]
@@ -488,6 +492,20 @@ def test_batch_permute():
     run_pipeline(generate_data(31, 13, image_like_shape_generator), pipeline_fn=pipe)
 
 
+def test_dataset_statistics():
+    def pipe(max_batch_size, input_data, device):
+        pipe = Pipeline(batch_size=max_batch_size, num_threads=4, device_id=0)
+        data = fn.external_source(source=input_data, cycle=False, device=device, layout="HWC")
+        mean, stddev = fn.dataset_statistics(data, axis_names="HW")
+        processed = fn.normalize(data, mean=mean, stddev=stddev)
+        pipe.set_outputs(processed, mean, stddev)
+        return pipe
+
+    run_pipeline(
+        generate_data(31, 13, image_like_shape_generator), pipeline_fn=pipe, devices=["cpu"]
+    )
+
+
 def test_coin_flip():
     def pipe(max_batch_size, input_data, device):
         pipe = Pipeline(batch_size=max_batch_size, num_threads=4, device_id=0)
@@ -1680,6 +1698,7 @@ tested_methods = [
     "copy",
     "crop",
     "crop_mirror_normalize",
+    "dataset_statistics",
     "decoders.audio",
     "decoders.image",
     "decoders.image_crop",
@@ -1753,6 +1772,7 @@ tested_methods = [
     "math.tan",
     "math.tanh",
     "mel_filter_bank",
+    "mel_spectrogram",
     "mfcc",
     "noise.gaussian",
     "noise.salt_and_pepper",
@@ -1858,6 +1878,8 @@ excluded_methods = [
     "readers.webdataset",  # readers do not support variable batch size yet
     "experimental.inputs.video",  # Input batch_size of inputs.video is always 1 and output
     # batch_size varies and is tested in this operator's test.
+    "experimental.inputs.shared_memory_ring",  # The batch size is set by the producer of
+    # the ring; variable batch size is tested in this operator's test.
     "experimental.readers.video",  # readers do not support variable batch size yet
     "experimental.audio_resample",  # Alias of audio_resample (already tested)
     "experimental.readers.fits",  # readers do not support variable batch size yet
@@ -2502,3 +2502,28 @@ def test_executor_flags():
         p2 = Pipeline.deserialize(s)
         assert p2.stream_policy == stream_policy
         assert p2.concurrency == concurrency
+
+
+def test_numa_policy():
+    @pipeline_def(batch_size=4, num_threads=2, device_id=None)
+    def pipe():
+        data = fn.random.uniform(range=[0, 1], shape=[1000])
+        return fn.normalize(data)
+
+    cpus = sorted(os.sched_getaffinity(0))
+    for kwargs in [{"cpu_affinity": cpus[:1]}, {"cpu_affinity": cpus}]:
+        p = pipe(**kwargs)
+        assert p.cpu_affinity == kwargs["cpu_affinity"]
+        for _ in range(3):
+            p.run()
+        # the pipeline's CPUs don't leak into the thread which built it
+        assert sorted(os.sched_getaffinity(0)) == cpus
+
+    with assert_raises(ValueError, glob="cannot be used together"):
+        pipe(numa_node=0, cpu_affinity=cpus).build()
+    with assert_raises(ValueError, glob="cannot be combined with `set_affinity`"):
+        pipe(cpu_affinity=cpus, set_affinity=True).build()
+    with assert_raises(ValueError, glob="must not be empty"):
+        pipe(cpu_affinity=[]).build()
+    with assert_raises(ValueError, glob="numa_node=-1 is invalid"):
+        pipe(numa_node=-1).build()
@@ -1,4 +1,4 @@
-// Copyright (c) 2021-2023, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+// Copyright (c) 2021-2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
 //
 // Licensed under the Apache License, Version 2.0 (the "License");
 // you may not use this file except in compliance with the License.
@@ -156,6 +156,51 @@ void PreallocateDeviceMemory(size_t bytes, int device_id = -1);
 DLL_PUBLIC
 void PreallocatePinnedMemory(size_t bytes);
 
+/**
+ * @brief The default size above which the allocations are served from huge pages
+ */
+constexpr size_t kDefaultHugePageMinBytes = 1 << 20;
+
+/**
+ * @brief Makes the default host memory resource serve large allocations from huge pages
+ *
+ * The allocations larger than `min_bytes` are served from a pool backed by huge pages; the
+ * smaller ones still go to the current default host resource. The pages are faulted in when
+ * the pool grows, so the large buffers don't cause page faults when they're first touched.
+ * The memory allocated before the call remains valid.
+ *
+ * The same effect can be achieved with the environment variable `DALI_HOST_HUGE_PAGES`
+ * set to 1 (transparent huge pages), 2M or 1G.
+ *
+ * @param page_size  0 to use transparent huge pages or the size of explicit huge pages
+ *                   (2 MiB or 1 GiB). Explicit huge pages must be reserved in the system
+ *                   (e.g. with /proc/sys/vm/nr_hugepages) - if they're not available,
+ *                   transparent huge pages are used instead.
+ * @param min_bytes  The allocations of this size or smaller don't use huge pages.
+ *
+ * @throws std::invalid_argument if the page size is not supported
+ */
+DLL_PUBLIC
+void UseHugePageHostMemory(size_t page_size = 0, size_t min_bytes = kDefaultHugePageMinBytes);
+
+/**
+ * @brief Makes the default host memory resource serve large allocations from the NUMA node
+ *        of the calling thread.
+ *
+ * The allocations larger than the malloc pool threshold (see `DALI_MALLOC_POOL_THRESHOLD`) are
+ * served from per-node pools; the smaller ones go to the current default resource. The memory
+ * allocated before the call is freed correctly.
+ *
+ * The function is called by the pipelines with a NUMA policy (`numa_node` or `cpu_affinity`).
+ * The same effect can be achieved with the environment variable `DALI_USE_NUMA_HOST_MEM=1`;
+ * setting it to 0 disables the NUMA-aware resource altogether.
+ *
+ * @return true if the default host resource is NUMA-aware; false if it's disabled or there's
+ *         only one NUMA node
+ */
+DLL_PUBLIC
+bool UseNumaHostMemory();
+
 }  // namespace mm
 }  // namespace dali
 
@@ -0,0 +1,82 @@
+// Copyright (c) 2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef DALI_CORE_MM_HUGE_PAGE_RESOURCE_H_
+#define DALI_CORE_MM_HUGE_PAGE_RESOURCE_H_
+
+#include <atomic>
+#include "dali/core/mm/memory_resource.h"
+
+namespace dali {
+namespace mm {
+
+/**
+ * @brief A memory resource which maps host memory backed by huge pages.
+ *
+ * With `page_size` equal to 0, the memory is mapped with regular pages and marked as eligible
+ * for transparent huge pages (madvise(MADV_HUGEPAGE)); the blocks are aligned and rounded to
+ * 2 MiB, so the kernel can back them with huge pages.
+ * Otherwise, explicit huge pages of the given size (2 MiB or 1 GiB) are requested from the
+ * hugetlb pool; if the pool is exhausted or not configured, the resource falls back to
+ * transparent huge pages.
+ *
+ * If `prefault` is set, the pages are populated when the block is mapped, so the page faults
+ * are taken once, when a pool grows, and not when the buffers are first touched.
+ *
+ * @remarks The allocations are rounded up to a multiple of the huge page size - the resource
+ *          is meant to be used as an upstream of a pool.
+ */
+class DLL_PUBLIC huge_page_memory_resource : public host_memory_resource {
+ public:
+  static constexpr size_t kTransparentHugePageSize = 2 << 20;
+
+  explicit huge_page_memory_resource(size_t page_size = 0, bool prefault = true);
+
+  /** The requested size of explicit huge pages or 0 for transparent huge pages */
+  size_t page_size() const noexcept {
+    return page_size_;
+  }
+
+  /** The size to which the allocations are rounded up */
+  size_t block_granularity() const noexcept {
+    return page_size_ ? page_size_ : kTransparentHugePageSize;
+  }
+
+  /** The number of allocations for which explicit huge pages were not available */
+  int64_t num_fallbacks() const noexcept {
+    return num_fallbacks_;
+  }
+
+ private:
+  void *do_allocate(size_t bytes, size_t alignment) override;
+  void do_deallocate(void *ptr, size_t bytes, size_t alignment) override;
+
+  bool do_is_equal(const host_memory_resource &other) const noexcept override {
+    auto *hp = dynamic_cast<const huge_page_memory_resource *>(&other);
+    return hp && hp->page_size_ == page_size_;
+  }
+
+  void *MapExplicit(size_t size);
+  void *MapTransparent(size_t size, size_t alignment);
+  void Prefault(void *ptr, size_t size);
+
+  size_t page_size_;
+  bool prefault_;
+  std::atomic<int64_t> num_fallbacks_{0};
+};
+
+}  // namespace mm
+}  // namespace dali
+
+#endif  // DALI_CORE_MM_HUGE_PAGE_RESOURCE_H_
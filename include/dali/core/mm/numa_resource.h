@@ -0,0 +1,120 @@
+// Copyright (c) 2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef DALI_CORE_MM_NUMA_RESOURCE_H_
+#define DALI_CORE_MM_NUMA_RESOURCE_H_
+
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <vector>
+#include "dali/core/mm/memory_resource.h"
+#include "dali/core/mm/pool_resource.h"
+#include "dali/core/spinlock.h"
+
+namespace dali {
+namespace mm {
+
+/**
+ * @brief A memory resource which maps host memory on a given NUMA node.
+ *
+ * The memory is obtained with mmap and bound to the node with mbind, so the pages are placed
+ * on that node regardless of which thread touches them first. If the node can't be used
+ * (e.g. the kernel doesn't support NUMA), the memory is placed as usual.
+ */
+class DLL_PUBLIC numa_node_memory_resource : public host_memory_resource {
+ public:
+  explicit numa_node_memory_resource(int node) : node_(node) {}
+
+  int node() const noexcept {
+    return node_;
+  }
+
+  /**
+   * @brief Checks whether the pointer lies in a block allocated from this resource.
+   */
+  bool owns(const void *ptr) const;
+
+ private:
+  void *do_allocate(size_t bytes, size_t alignment) override;
+  void do_deallocate(void *ptr, size_t bytes, size_t alignment) override;
+
+  bool do_is_equal(const host_memory_resource &other) const noexcept override {
+    return this == &other;
+  }
+
+  int node_;
+  mutable std::mutex mtx_;
+  std::map<uintptr_t, uintptr_t> blocks_;  // start -> end
+};
+
+/**
+ * @brief A host memory resource which serves the large allocations of the calling thread from
+ *        the NUMA node on which it runs.
+ *
+ * The split follows the default host resource: the allocations up to `pool_threshold` go to
+ * the `small` resource (malloc), the larger ones come from per-node pools. When the threads of
+ * a pipeline are pinned to the CPUs of a node, its large buffers are placed in the memory local
+ * to these CPUs. The small allocations are placed by malloc, on first touch.
+ *
+ * The blocks which don't come from the per-node pools are returned to `small` - so the resource
+ * can replace a default resource which still has outstanding allocations.
+ */
+class DLL_PUBLIC numa_host_memory_resource : public host_memory_resource {
+ public:
+  /**
+   * @param small           The resource for the small allocations and the blocks allocated
+   *                        before this resource was created
+   * @param pool_threshold  The allocations larger than this are served from the per-node pools.
+   */
+  numa_host_memory_resource(std::shared_ptr<host_memory_resource> small, size_t pool_threshold);
+  ~numa_host_memory_resource();
+
+  int num_nodes() const noexcept {
+    return nodes_.size();
+  }
+
+ private:
+  using pool_t = pool_resource<mm::memory_kind::host, coalescing_free_tree, spinlock>;
+
+  struct Node {
+    // the pool is declared after its upstream, so it's destroyed first
+    std::unique_ptr<numa_node_memory_resource> upstream;
+    std::unique_ptr<pool_t> pool;
+  };
+
+  void *do_allocate(size_t bytes, size_t alignment) override;
+  void do_deallocate(void *ptr, size_t bytes, size_t alignment) override;
+
+  bool do_is_equal(const host_memory_resource &other) const noexcept override {
+    return this == &other;
+  }
+
+  /** Returns the node whose pool owns the pointer or null. */
+  Node *NodeOf(void *ptr);
+
+  bool use_pool(size_t bytes) const noexcept {
+    return bytes > pool_threshold_;
+  }
+
+  std::shared_ptr<host_memory_resource> small_;
+  size_t pool_threshold_;
+  std::vector<Node> nodes_;
+};
+
+}  // namespace mm
+}  // namespace dali
+
+#endif  // DALI_CORE_MM_NUMA_RESOURCE_H_
@@ -0,0 +1,115 @@
+// Copyright (c) 2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef DALI_CORE_OS_NUMA_H_
+#define DALI_CORE_OS_NUMA_H_
+
+#include <cstddef>
+#include <string>
+#include <vector>
+#include "dali/core/api_helper.h"
+#include "dali/core/span.h"
+
+namespace dali {
+namespace numa {
+
+/**
+ * @brief Parses a Linux CPU (or node) list, e.g. "0-3,8,10-11"
+ */
+DLL_PUBLIC std::vector<int> ParseCpuList(const std::string &list);
+
+/**
+ * @brief The CPUs the process was allowed to run on when DALI was loaded.
+ *
+ * Unlike the affinity of the calling thread, this is not affected by the pinning done by DALI.
+ */
+DLL_PUBLIC const std::vector<int> &ProcessCpus();
+
+/**
+ * @brief The number of NUMA nodes; the node indices are in range [0, NumNodes()).
+ *
+ * If the NUMA topology is not known, the whole system is treated as a single node.
+ */
+DLL_PUBLIC int NumNodes();
+
+/**
+ * @brief All the CPUs of a NUMA node, in ascending order. The list is empty for nodes without
+ *        CPUs and for invalid node indices.
+ */
+DLL_PUBLIC const std::vector<int> &NodeCpus(int node);
+
+/**
+ * @brief The NUMA node of a CPU or -1, if the CPU is not known.
+ */
+DLL_PUBLIC int NodeOfCpu(int cpu);
+
+/**
+ * @brief The NUMA node to which most of the CPUs belong or -1, if there are no known CPUs.
+ */
+DLL_PUBLIC int NodeOfCpus(span<const int> cpus);
+
+/**
+ * @brief The NUMA node of the CPU on which the calling thread is running.
+ *
+ * For a thread pinned to the CPUs of one node, this is always that node.
+ */
+DLL_PUBLIC int CurrentNode();
+
+/**
+ * @brief Asks the kernel to place the pages of a memory range on given NUMA node.
+ *
+ * The policy is "preferred" - if the node runs out of memory, the pages are placed elsewhere.
+ * The pages which have already been touched are not moved.
+ *
+ * @param addr  page-aligned start of the range
+ * @param size  size of the range, in bytes
+ * @return true, if the policy was set
+ */
+DLL_PUBLIC bool BindMemory(void *addr, size_t size, int node);
+
+/**
+ * @brief The CPUs on which the calling thread is allowed to run.
+ */
+DLL_PUBLIC std::vector<int> GetThreadAffinity();
+
+/**
+ * @brief Restricts the calling thread to given CPUs.
+ *
+ * The threads started by the calling thread inherit the affinity.
+ */
+DLL_PUBLIC void SetThreadAffinity(span<const int> cpus);
+
+/**
+ * @brief Pins the calling thread to given CPUs and restores the original affinity on
+ *        destruction.
+ *
+ * Since the threads inherit the affinity of their creator, all the threads started in the
+ * scope run on the given CPUs. An empty set of CPUs leaves the affinity unchanged.
+ */
+class DLL_PUBLIC ScopedThreadAffinity {
+ public:
+  explicit ScopedThreadAffinity(span<const int> cpus);
+  ~ScopedThreadAffinity();
+
+  ScopedThreadAffinity(const ScopedThreadAffinity &) = delete;
+  ScopedThreadAffinity &operator=(const ScopedThreadAffinity &) = delete;
+
+ private:
+  std::vector<int> prev_;
+};
+
+}  // namespace numa
+}  // namespace dali
+
+#endif  // DALI_CORE_OS_NUMA_H_
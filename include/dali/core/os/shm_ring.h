@@ -0,0 +1,245 @@
+// Copyright (c) 2025, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef DALI_CORE_OS_SHM_RING_H_
+#define DALI_CORE_OS_SHM_RING_H_
+
+#include <stdint.h>
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+#include "dali/core/common.h"
+#include "dali/core/dali_data_type.h"
+#include "dali/core/os/shared_mem.h"
+#include "dali/core/tensor_layout.h"
+#include "dali/core/tensor_shape.h"
+#include "dali/core/util.h"
+
+namespace dali {
+namespace shm_ring {
+
+/**
+ * @brief The layout of a single-producer/single-consumer ring of batches in shared memory.
+ *
+ * The shared memory object starts with a RingHeader, followed by `num_slots` slots of
+ * `slot_size` bytes each. A slot holds one batch: a SlotHeader, the sample shapes and the
+ * densely packed sample data, starting at `data_offset` from the beginning of the slot.
+ *
+ * The producer writes the slot `head % num_slots` and publishes it by incrementing `head`.
+ * The consumer releases the slots in order by incrementing `tail`. The ring is full when
+ * `head - tail == num_slots` - this is the backpressure the producer observes.
+ * The counters wrap around; both sides wait on them with (process-shared) futexes.
+ */
+constexpr uint64_t kMagic = 0x474e4952494c4144ull;  // "DALIRING"
+constexpr uint32_t kVersion = 1;
+constexpr size_t kDataAlignment = 64;
+
+struct RingHeader {
+  uint64_t magic;
+  uint32_t version;
+  uint32_t num_slots;
+  uint64_t slot_size;
+  uint64_t slots_offset;
+  /// The number of batches published by the producer
+  alignas(64) std::atomic<uint32_t> head;
+  /// The number of slots released by the consumer
+  alignas(64) std::atomic<uint32_t> tail;
+  /// Set by the producer when no more batches will be published
+  alignas(64) std::atomic<uint32_t> closed;
+};
+
+static_assert(std::atomic<uint32_t>::is_always_lock_free,
+              "The ring requires lock-free 32-bit atomics.");
+
+struct SlotHeader {
+  uint32_t num_samples;
+  int32_t ndim;
+  int32_t type;  // daliDataType_t
+  char layout[16];
+  uint64_t data_offset;
+  uint64_t data_size;
+  // followed by int64_t shape[num_samples * ndim]
+};
+
+/** The maximum number of dimensions of the samples stored in the ring */
+constexpr int kMaxNdim = 64;
+
+/** The offset of the sample data in a slot for a batch with the given shape */
+inline uint64_t DataOffset(int num_samples, int ndim) {
+  return align_up(sizeof(SlotHeader) + sizeof(int64_t) * num_samples * ndim, kDataAlignment);
+}
+
+/** The size of the slot needed to store a batch with the given shape and data size */
+inline uint64_t RequiredSlotSize(int num_samples, int ndim, uint64_t data_size) {
+  return DataOffset(num_samples, ndim) + data_size;
+}
+
+/** A view of a batch stored in a slot of the ring */
+struct BatchView {
+  uint32_t seq = 0;  // the value of `head` at which the batch was published
+  TensorListShape<> shape;
+  daliDataType_t type = DALI_NO_TYPE;
+  TensorLayout layout;
+  uint8_t *data = nullptr;
+  uint64_t size = 0;
+};
+
+/**
+ * @brief The common part of the producer and the consumer - the mapping of the ring.
+ */
+class DLL_PUBLIC RingBase {
+ public:
+  int num_slots() const {
+    return num_slots_;
+  }
+
+  uint64_t slot_size() const {
+    return slot_size_;
+  }
+
+  /** The capacity of a slot for a batch of the given dimensionality and number of samples */
+  uint64_t data_capacity(int num_samples, int ndim) const {
+    uint64_t offset = DataOffset(num_samples, ndim);
+    return offset < slot_size() ? slot_size() - offset : 0;
+  }
+
+  const std::string &name() const {
+    return name_;
+  }
+
+ protected:
+  RingHeader *header() const {
+    return reinterpret_cast<RingHeader *>(shm_->get_raw_ptr());
+  }
+
+  uint8_t *slot(uint32_t seq) const {
+    return shm_->get_raw_ptr() + slots_offset_ + (seq % num_slots_) * slot_size_;
+  }
+
+  std::string name_;
+  std::unique_ptr<SharedMem> shm_;
+  // The geometry of the ring, validated when mapping it. It's not read back from the header,
+  // which the other process can overwrite.
+  uint32_t num_slots_ = 0;
+  uint64_t slot_size_ = 0;
+  uint64_t slots_offset_ = 0;
+};
+
+/**
+ * @brief Creates a named ring and writes batches to it.
+ *
+ * The producer owns the name - it's removed when the producer is destroyed; the consumers
+ * which are already attached keep working.
+ */
+class DLL_PUBLIC Producer : public RingBase {
+ public:
+  /**
+   * @param name       The name of the POSIX shared memory object, e.g. "/my_ring"
+   * @param num_slots  The number of batches that can be in flight
+   * @param slot_size  The size of a slot, including the slot header and the shapes
+   *                   (see RequiredSlotSize)
+   */
+  Producer(std::string name, int num_slots, uint64_t slot_size);
+  ~Producer();
+
+  /** The number of slots which can be written without waiting for the consumer */
+  int free_slots() const;
+
+  /**
+   * @brief Waits until a slot is free.
+   *
+   * @return false on timeout
+   */
+  bool WaitForSlot(std::chrono::microseconds timeout = std::chrono::microseconds::max());
+
+  /**
+   * @brief Prepares the next slot for a batch and returns a pointer to its data area.
+   *
+   * The data of the samples must be written densely, in order. The batch becomes visible
+   * to the consumer after Publish. There must be a free slot (see WaitForSlot).
+   */
+  uint8_t *BeginWrite(const TensorListShape<> &shape, daliDataType_t type,
+                      const TensorLayout &layout = "");
+
+  /** Makes the batch prepared with BeginWrite available to the consumer. */
+  void Publish();
+
+  /**
+   * @brief Copies a contiguous batch to the ring, waiting for a free slot.
+   *
+   * @return false on timeout
+   */
+  bool Push(const void *data, const TensorListShape<> &shape, daliDataType_t type,
+            const TensorLayout &layout = "",
+            std::chrono::microseconds timeout = std::chrono::microseconds::max());
+
+  /** Signals the consumer that no more batches will be published. */
+  void Close();
+
+ private:
+  bool writing_ = false;
+};
+
+/**
+ * @brief Attaches to a named ring and reads the batches from it.
+ *
+ * The batches are read in order, but they can be released in any order and from any
+ * thread - a slot is returned to the producer when it and all the slots before it
+ * are released.
+ */
+class DLL_PUBLIC Consumer : public RingBase {
+ public:
+  explicit Consumer(std::string name);
+
+  /**
+   * @brief Waits until the batch with the given sequence number is published.
+   *
+   * @return false if the ring is closed and the batch will never be published or on timeout
+   */
+  bool WaitForBatch(uint32_t seq,
+                    std::chrono::microseconds timeout = std::chrono::microseconds::max());
+
+  /** Whether the producer has closed the ring */
+  bool closed() const;
+
+  /**
+   * @brief Returns a view of a published batch.
+   *
+   * The slot header is validated, as it's written by another process - an error is raised
+   * if the described batch doesn't fit in the slot.
+   */
+  BatchView Get(uint32_t seq) const;
+
+  /** Returns the slot of the batch `seq` to the producer. */
+  void Release(uint32_t seq);
+
+  /** Wakes up the threads waiting in WaitForBatch, making them return false. */
+  void Interrupt();
+
+  /** The sequence number of the first batch which hasn't been released */
+  uint32_t first_unreleased() const;
+
+ private:
+  std::mutex release_mtx_;
+  std::vector<uint8_t> released_;
+  std::atomic<bool> interrupted_{false};
+};
+
+}  // namespace shm_ring
+}  // namespace dali
+
+#endif  // DALI_CORE_OS_SHM_RING_H_
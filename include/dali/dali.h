@@ -571,6 +571,102 @@ DALI_API daliResult_t daliPipelinePopOutputsAsync(
   daliPipelineOutputs_h *out,
   cudaStream_t stream);
 
+/** Events signaled by a pipeline.
+ *
+ * @see daliPipelineSetEventCallback
+ * @see daliPipelineGetEventFd
+ */
+typedef enum _DALIPipelineEvent {
+  /** The outputs of an iteration are ready.
+   *
+   * Popping the outputs of this iteration doesn't wait for it to be processed on host.
+   * NOTE: `daliPipelinePopOutputs` may still wait for the device work to complete;
+   *       `daliPipelinePopOutputsAsync` doesn't.
+   * The event is also signaled if the iteration failed - popping its outputs reports the error.
+   */
+  DALI_PIPELINE_EVENT_OUTPUTS_READY = 0,
+  /** A batch of data was consumed from an input - the input can be fed with another batch. */
+  DALI_PIPELINE_EVENT_INPUT_CONSUMED = 1,
+
+  DALI_PIPELINE_EVENT_FORCE_INT32 = 0x7fffffff
+} daliPipelineEvent_t;
+
+/** A function called when a pipeline event occurs.
+ *
+ * The function is called from a thread internal to DALI. It should return quickly and it must
+ * not call any functions of the pipeline - typically, it wakes up an event loop or a thread
+ * which then interacts with the pipeline.
+ *
+ * @param context     the context passed to `daliPipelineSetEventCallback`
+ * @param pipeline    the pipeline which signaled the event
+ * @param event       the event
+ * @param input_name  the name of the input, for DALI_PIPELINE_EVENT_INPUT_CONSUMED;
+ *                    NULL otherwise
+ */
+typedef void (*daliPipelineEventCallback_t)(
+  void *context,
+  daliPipeline_h pipeline,
+  daliPipelineEvent_t event,
+  const char *input_name);
+
+/** Sets a function which is called each time the pipeline signals an event.
+ *
+ * Only the iterations scheduled after the first call to this function or to
+ * `daliPipelineGetEventFd` are signaled.
+ *
+ * NOTE: The pipeline must be built and must use DALI_EXEC_IS_DYNAMIC.
+ *
+ * @param pipeline  [in] The pipeline
+ * @param callback  [in] The function to call or NULL, to stop calling the previous one.
+ * @param context   [in] A user-provided context passed to the callback.
+ *
+ * @retval DALI_SUCCESS
+ * @retval DALI_ERROR_INVALID_OPERATION   the pipeline wasn't built or the executor doesn't
+ *                                        support events
+ */
+DALI_API daliResult_t daliPipelineSetEventCallback(
+  daliPipeline_h pipeline,
+  daliPipelineEventCallback_t callback,
+  void *context);
+
+/** Gets a file descriptor which becomes readable when the pipeline signals an event.
+ *
+ * The descriptor is an eventfd counter, incremented with each occurrence of the event.
+ * Reading 8 bytes from the descriptor yields the number of occurrences (as a 64-bit unsigned
+ * integer) since the previous read and resets the counter. For example, having read N from
+ * the descriptor of DALI_PIPELINE_EVENT_OUTPUTS_READY, the caller can pop N outputs without
+ * waiting for their host processing. This allows a single event loop (e.g. based on epoll) to
+ * drive many pipelines.
+ *
+ * The descriptor is non-blocking and it's owned by the pipeline - it's valid until the pipeline
+ * is destroyed and it must not be closed by the caller. Subsequent calls for the same event
+ * (and input) return the same descriptor.
+ *
+ * Only the iterations scheduled after the first call to this function or to
+ * `daliPipelineSetEventCallback` are signaled.
+ *
+ * NOTE: The pipeline must be built and must use DALI_EXEC_IS_DYNAMIC.
+ *
+ * @param pipeline    [in]  The pipeline
+ * @param out_fd      [out] A pointer to the location where the descriptor is stored.
+ * @param event       [in]  The event.
+ * @param input_name  [in]  The name of the input, for DALI_PIPELINE_EVENT_INPUT_CONSUMED;
+ *                          must be NULL for other events.
+ *
+ * @retval DALI_SUCCESS
+ * @retval DALI_ERROR_INVALID_ARGUMENT    the event is not valid or `input_name` doesn't match it
+ * @retval DALI_ERROR_INVALID_KEY         `input_name` is not a valid name of an input of the
+ *                                        pipeline
+ * @retval DALI_ERROR_INVALID_OPERATION   the pipeline wasn't built or the executor doesn't
+ *                                        support events
+ * @retval DALI_ERROR_SYSTEM              the descriptor could not be created
+ */
+DALI_API daliResult_t daliPipelineGetEventFd(
+  daliPipeline_h pipeline,
+  int *out_fd,
+  daliPipelineEvent_t event,
+  const char *input_name);
+
 /** Releases the pipeline outputs.
  *
  * @param pipeline [in]  The pipeline outputs which are being released.